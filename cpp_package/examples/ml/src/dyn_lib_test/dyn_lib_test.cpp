@@ -32,6 +32,26 @@ int predict (double *data, int data_len, double *output, int *output_len,
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int predict_batch (double *data, int batch_size, int data_len, double *output, int *output_len,
+    struct BrainFlowModelParams *params)
+{
+    if ((batch_size < 1) || (output_len == NULL))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    for (int i = 0; i < batch_size; i++)
+    {
+        int len = 0;
+        int res = predict (data + i * data_len, data_len, output + i, &len, params);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    *output_len = batch_size;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int release (struct BrainFlowModelParams *params)
 {
     return (int)BrainFlowExitCodes::STATUS_OK;
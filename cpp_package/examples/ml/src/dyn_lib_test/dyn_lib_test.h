@@ -20,6 +20,9 @@ extern "C"
         void *custom, struct BrainFlowModelParams *params);
     SHARED_EXPORT int CALLING_CONVENTION predict (double *data, int data_len, double *output,
         int *output_len, struct BrainFlowModelParams *params);
+    // optional, if it's not exported predict is called for each row
+    SHARED_EXPORT int CALLING_CONVENTION predict_batch (double *data, int batch_size,
+        int data_len, double *output, int *output_len, struct BrainFlowModelParams *params);
     SHARED_EXPORT int CALLING_CONVENTION release (struct BrainFlowModelParams *params);
 
 #ifdef __cplusplus
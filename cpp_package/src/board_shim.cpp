@@ -158,6 +158,19 @@ void BoardShim::delete_streamer (std::string streamer_params, int preset)
     }
 }
 
+std::string BoardShim::get_streamer_stats (std::string streamer_params, int preset)
+{
+    int stats_len = 0;
+    char stats[8192];
+    int res = ::get_streamer_stats (streamer_params.c_str (), preset, stats, &stats_len, board_id,
+        serialized_params.c_str ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to get streamer stats", res);
+    }
+    return std::string ((const char *)stats, stats_len);
+}
+
 void BoardShim::start_stream (int buffer_size, std::string streamer_params)
 {
     int res = ::start_stream (
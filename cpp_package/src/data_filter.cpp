@@ -85,6 +85,108 @@ void DataFilter::remove_environmental_noise (
     }
 }
 
+int DataFilter::create_lowpass_filter (int sampling_rate, double cutoff, int order,
+    int filter_type, double ripple, int num_channels)
+{
+    int filter_id = 0;
+    int res = ::create_lowpass_filter (
+        sampling_rate, cutoff, order, filter_type, ripple, num_channels, &filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create filter", res);
+    }
+    return filter_id;
+}
+
+int DataFilter::create_highpass_filter (int sampling_rate, double cutoff, int order,
+    int filter_type, double ripple, int num_channels)
+{
+    int filter_id = 0;
+    int res = ::create_highpass_filter (
+        sampling_rate, cutoff, order, filter_type, ripple, num_channels, &filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create filter", res);
+    }
+    return filter_id;
+}
+
+int DataFilter::create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq,
+    int order, int filter_type, double ripple, int num_channels)
+{
+    int filter_id = 0;
+    int res = ::create_bandpass_filter (sampling_rate, start_freq, stop_freq, order, filter_type,
+        ripple, num_channels, &filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create filter", res);
+    }
+    return filter_id;
+}
+
+int DataFilter::create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq,
+    int order, int filter_type, double ripple, int num_channels)
+{
+    int filter_id = 0;
+    int res = ::create_bandstop_filter (sampling_rate, start_freq, stop_freq, order, filter_type,
+        ripple, num_channels, &filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create filter", res);
+    }
+    return filter_id;
+}
+
+int DataFilter::create_environmental_noise_filter (
+    int sampling_rate, int noise_type, int num_channels)
+{
+    int filter_id = 0;
+    int res =
+        ::create_environmental_noise_filter (sampling_rate, noise_type, num_channels, &filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create filter", res);
+    }
+    return filter_id;
+}
+
+void DataFilter::process_filter (int filter_id, int channel, double *data, int data_len)
+{
+    int res = ::process_filter (filter_id, channel, data, data_len);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
+void DataFilter::process_filter_block (int filter_id, BrainFlowArray<double, 2> &data)
+{
+    int res = ::process_filter_block (
+        filter_id, data.get_raw_ptr (), data.get_size (0), data.get_size (1));
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to filter signal", res);
+    }
+}
+
+void DataFilter::reset_filter (int filter_id)
+{
+    int res = ::reset_filter (filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to reset filter", res);
+    }
+}
+
+void DataFilter::release_filter (int filter_id)
+{
+    int res = ::release_filter (filter_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release filter", res);
+    }
+}
+
 void DataFilter::restore_data_from_wavelet_detailed_coeffs (double *data, int data_len, int wavelet,
     int decomposition_level, int level_to_restore, double *output)
 {
@@ -106,6 +208,36 @@ void DataFilter::detect_peaks_z_score (
     }
 }
 
+int DataFilter::create_z_score_peak_detector (int lag, double threshold, double influence)
+{
+    int detector_id = 0;
+    int res = ::create_z_score_peak_detector (lag, threshold, influence, &detector_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create peak detector", res);
+    }
+    return detector_id;
+}
+
+void DataFilter::process_z_score_peak_detector (
+    int detector_id, double *data, int data_len, double *output)
+{
+    int res = ::process_z_score_peak_detector (detector_id, data, data_len, output);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to detect", res);
+    }
+}
+
+void DataFilter::release_z_score_peak_detector (int detector_id)
+{
+    int res = ::release_z_score_peak_detector (detector_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release peak detector", res);
+    }
+}
+
 void DataFilter::perform_rolling_filter (double *data, int data_len, int period, int agg_operation)
 {
     int res = ::perform_rolling_filter (data, data_len, period, agg_operation);
@@ -157,6 +289,37 @@ std::pair<double *, int *> DataFilter::perform_wavelet_transform (
     return std::make_pair (wavelet_output, decomposition_lengths);
 }
 
+std::pair<BrainFlowArray<double, 2>, BrainFlowArray<int, 1>>
+DataFilter::perform_wavelet_transform_block (
+    BrainFlowArray<double, 2> &data, int wavelet, int decomposition_level, int extension_type)
+{
+    if ((data.empty ()) || (decomposition_level <= 0))
+    {
+        throw BrainFlowException (
+            "invalid input params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+
+    int rows = data.get_size (0);
+    int cols = data.get_size (1);
+    // I get this formula from wavelib sources
+    std::vector<double> wavelet_output (rows * (cols + 2 * decomposition_level * (40 + 1)));
+    BrainFlowArray<int, 1> decomposition_lengths (decomposition_level + 1);
+    int res = ::perform_wavelet_transform_block (data.get_raw_ptr (), rows, cols, wavelet,
+        decomposition_level, extension_type, wavelet_output.data (),
+        decomposition_lengths.get_raw_ptr ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to perform wavelet", res);
+    }
+    int output_len = 0;
+    for (int i = 0; i < decomposition_level + 1; i++)
+    {
+        output_len += decomposition_lengths[i];
+    }
+    BrainFlowArray<double, 2> coeffs (wavelet_output.data (), rows, output_len);
+    return std::make_pair (std::move (coeffs), std::move (decomposition_lengths));
+}
+
 double *DataFilter::perform_inverse_wavelet_transform (std::pair<double *, int *> wavelet_output,
     int original_data_len, int wavelet, int decomposition_level, int extension_type)
 {
@@ -189,8 +352,22 @@ void DataFilter::perform_wavelet_denoising (double *data, int data_len, int wave
     }
 }
 
+void DataFilter::perform_wavelet_denoising_block (BrainFlowArray<double, 2> &data, int wavelet,
+    int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type,
+    int noise_level)
+{
+    int res = ::perform_wavelet_denoising_block (data.get_raw_ptr (), data.get_size (0),
+        data.get_size (1), wavelet, decomposition_level, wavelet_denoising, threshold,
+        extenstion_type, noise_level);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to perform wavelet denoising", res);
+    }
+}
+
 std::pair<BrainFlowArray<double, 2>, BrainFlowArray<double, 1>> DataFilter::get_csp (
-    const BrainFlowArray<double, 3> &data, const BrainFlowArray<double, 1> &labels)
+    const BrainFlowArray<double, 3> &data, const BrainFlowArray<double, 1> &labels,
+    double shrinkage)
 {
     if ((data.empty ()) || (labels.empty ()))
     {
@@ -201,9 +378,9 @@ std::pair<BrainFlowArray<double, 2>, BrainFlowArray<double, 1>> DataFilter::get_
     BrainFlowArray<double, 2> filters (data.get_size (1), data.get_size (1));
     BrainFlowArray<double, 1> output_eigenvalues (data.get_size (1));
 
-    int res =
-        ::get_csp (data.get_raw_ptr (), labels.get_raw_ptr (), data.get_size (0), data.get_size (1),
-            data.get_size (2), filters.get_raw_ptr (), output_eigenvalues.get_raw_ptr ());
+    int res = ::get_regularized_csp (data.get_raw_ptr (), labels.get_raw_ptr (),
+        data.get_size (0), data.get_size (1), data.get_size (2), shrinkage, filters.get_raw_ptr (),
+        output_eigenvalues.get_raw_ptr ());
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to compute the CSP filters", res);
@@ -212,6 +389,25 @@ std::pair<BrainFlowArray<double, 2>, BrainFlowArray<double, 1>> DataFilter::get_
     return std::make_pair (std::move (filters), std::move (output_eigenvalues));
 }
 
+BrainFlowArray<double, 2> DataFilter::apply_csp_filters (
+    const BrainFlowArray<double, 2> &filters, const BrainFlowArray<double, 2> &data)
+{
+    if ((filters.empty ()) || (data.empty ()) || (filters.get_size (1) != data.get_size (0)))
+    {
+        throw BrainFlowException (
+            "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+
+    BrainFlowArray<double, 2> output (filters.get_size (0), data.get_size (1));
+    int res = ::apply_csp_filters (filters.get_raw_ptr (), filters.get_size (0),
+        filters.get_size (1), data.get_raw_ptr (), data.get_size (1), output.get_raw_ptr ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to apply the CSP filters", res);
+    }
+    return output;
+}
+
 double *DataFilter::get_window (int window_function, int window_len)
 {
     double *window_data = new double[window_len];
@@ -224,6 +420,34 @@ double *DataFilter::get_window (int window_function, int window_len)
     return window_data;
 }
 
+double *DataFilter::get_custom_window (int window_function, int window_len, double param)
+{
+    double *window_data = new double[window_len];
+    int res = ::get_custom_window (window_function, window_len, param, window_data);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] window_data;
+        throw BrainFlowException ("failed to get window", res);
+    }
+    return window_data;
+}
+
+BrainFlowArray<double, 2> DataFilter::get_dpss_tapers (int window_len, double nw, int num_tapers)
+{
+    if ((window_len < 2) || (num_tapers < 1))
+    {
+        throw BrainFlowException (
+            "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    BrainFlowArray<double, 2> tapers (num_tapers, window_len);
+    int res = ::get_dpss_tapers (window_len, nw, num_tapers, tapers.get_raw_ptr ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to get dpss tapers", res);
+    }
+    return tapers;
+}
+
 std::complex<double> *DataFilter::perform_fft (double *data, int data_len, int window, int *fft_len)
 {
     if ((data_len % 2 == 1) || (data_len <= 0))
@@ -286,6 +510,27 @@ std::pair<double *, double *> DataFilter::get_psd (
     return std::make_pair (ampl, freq);
 }
 
+std::pair<double *, double *> DataFilter::get_psd_multitaper (
+    double *data, int data_len, int sampling_rate, double nw, int num_tapers, int *psd_len)
+{
+    if ((data_len % 2 == 1) || (data_len <= 0))
+    {
+        throw BrainFlowException (
+            "data len must be even", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    double *ampl = new double[data_len / 2 + 1];
+    double *freq = new double[data_len / 2 + 1];
+    int res = ::get_psd_multitaper (data, data_len, sampling_rate, nw, num_tapers, ampl, freq);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] ampl;
+        delete[] freq;
+        throw BrainFlowException ("failed to get psd", res);
+    }
+    *psd_len = data_len / 2 + 1;
+    return std::make_pair (ampl, freq);
+}
+
 std::pair<double *, double *> DataFilter::get_psd_welch (
     double *data, int data_len, int nfft, int overlap, int sampling_rate, int window, int *psd_len)
 {
@@ -365,6 +610,115 @@ std::pair<double *, double *> DataFilter::get_custom_band_powers (
     return std::make_pair (avg_bands, stddev_bands);
 }
 
+int DataFilter::create_band_power_stream (
+    int sampling_rate, int window_len, int num_channels, bool apply_filters)
+{
+    int stream_id = 0;
+    int res = ::create_band_power_stream (
+        sampling_rate, window_len, num_channels, (int)apply_filters, &stream_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to create band power stream", res);
+    }
+    return stream_id;
+}
+
+void DataFilter::add_band_power_stream_data (
+    int stream_id, const BrainFlowArray<double, 2> &data, std::vector<int> channels)
+{
+    int cols = data.get_size (1);
+    int channels_len = (int)channels.size ();
+    std::vector<double> data_1d (cols * channels_len);
+    for (int i = 0; i < channels_len; i++)
+    {
+        for (int j = 0; j < cols; j++)
+        {
+            data_1d[j + cols * i] = data.at (channels[i], j);
+        }
+    }
+    int res = ::add_band_power_stream_data (stream_id, data_1d.data (), channels_len, cols);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to add data to band power stream", res);
+    }
+}
+
+std::pair<double *, double *> DataFilter::get_band_power_stream_powers (
+    int stream_id, std::vector<std::pair<double, double>> bands)
+{
+    if (bands.empty ())
+    {
+        throw BrainFlowException (
+            "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    std::vector<double> start_freqs (bands.size ());
+    std::vector<double> stop_freqs (bands.size ());
+    for (int i = 0; i < (int)bands.size (); i++)
+    {
+        start_freqs[i] = std::get<0> (bands[i]);
+        stop_freqs[i] = std::get<1> (bands[i]);
+    }
+    double *avg_bands = new double[bands.size ()];
+    double *stddev_bands = new double[bands.size ()];
+    int res = ::get_band_power_stream_powers (stream_id, start_freqs.data (), stop_freqs.data (),
+        (int)bands.size (), avg_bands, stddev_bands);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] avg_bands;
+        delete[] stddev_bands;
+        throw BrainFlowException ("failed to get band powers from stream", res);
+    }
+    return std::make_pair (avg_bands, stddev_bands);
+}
+
+void DataFilter::release_band_power_stream (int stream_id)
+{
+    int res = ::release_band_power_stream (stream_id);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to release band power stream", res);
+    }
+}
+
+double DataFilter::get_eeg_metric (const BrainFlowArray<double, 2> &data,
+    std::vector<int> channels, int sampling_rate, int metric, bool apply_filters)
+{
+    if ((data.empty ()) || (channels.empty ()))
+    {
+        throw BrainFlowException (
+            "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    int cols = data.get_size (1);
+    int channels_len = (int)channels.size ();
+    std::vector<double> data_1d (cols * channels_len);
+    for (int i = 0; i < channels_len; i++)
+    {
+        for (int j = 0; j < cols; j++)
+        {
+            data_1d[j + cols * i] = data.at (channels[i], j);
+        }
+    }
+    double output = 0.0;
+    int res = ::get_eeg_metric (data_1d.data (), channels_len, cols, sampling_rate, metric,
+        (int)apply_filters, &output);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to get eeg metric", res);
+    }
+    return output;
+}
+
+double DataFilter::get_band_power_stream_metric (int stream_id, int metric)
+{
+    double output = 0.0;
+    int res = ::get_band_power_stream_metric (stream_id, metric, &output);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to get eeg metric from stream", res);
+    }
+    return output;
+}
+
 double DataFilter::get_band_power (
     std::pair<double *, double *> psd, int data_len, double freq_start, double freq_end)
 {
@@ -441,11 +795,11 @@ BrainFlowArray<double, 2> DataFilter::read_file (std::string file_name)
     return data;
 }
 
-void DataFilter::write_file (
-    const BrainFlowArray<double, 2> &data, std::string file_name, std::string file_mode)
+void DataFilter::write_file (const BrainFlowArray<double, 2> &data, std::string file_name,
+    std::string file_mode, int timestamp_channel)
 {
-    int res = ::write_file (data.get_raw_ptr (), data.get_size (0), data.get_size (1),
-        file_name.c_str (), file_mode.c_str ());
+    int res = ::write_file_with_index (data.get_raw_ptr (), data.get_size (0), data.get_size (1),
+        file_name.c_str (), file_mode.c_str (), timestamp_channel);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to write file", res);
@@ -520,7 +874,18 @@ std::tuple<BrainFlowArray<double, 2>, BrainFlowArray<double, 2>, BrainFlowArray<
 DataFilter::perform_ica (
     const BrainFlowArray<double, 2> &data, int num_components, std::vector<int> channels)
 {
-    if ((data.empty ()) || (channels.empty ()) || (num_components < 1))
+    return perform_custom_ica (data, num_components, channels, 300, 0.0001);
+}
+
+std::tuple<BrainFlowArray<double, 2>, BrainFlowArray<double, 2>, BrainFlowArray<double, 2>,
+    BrainFlowArray<double, 2>>
+DataFilter::perform_custom_ica (const BrainFlowArray<double, 2> &data, int num_components,
+    std::vector<int> channels, int max_iterations, double tolerance,
+    const BrainFlowArray<double, 2> &w_init, bool use_float32)
+{
+    if ((data.empty ()) || (channels.empty ()) || (num_components < 1) ||
+        ((!w_init.empty ()) &&
+            ((w_init.get_size (0) != num_components) || (w_init.get_size (1) != num_components))))
     {
         throw BrainFlowException (
             "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
@@ -541,7 +906,8 @@ DataFilter::perform_ica (
             data_1d[j + cols * i] = data.at (channels[i], j);
         }
     }
-    int res = ::perform_ica (data_1d, channels_len, cols, num_components, w, k, a, s);
+    int res = ::perform_custom_ica (data_1d, channels_len, cols, num_components, max_iterations,
+        tolerance, w_init.empty () ? NULL : w_init.get_raw_ptr (), (int)use_float32, w, k, a, s);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         delete[] data_1d;
@@ -224,8 +224,11 @@ public:
      * add streamer
      * @param streamer_params use it to pass data packages further or store them directly during
      streaming, supported values: "file://%file_name%:w", "file://%file_name%:a",
-     "streaming_board://%multicast_group_ip%:%port%"". Range for multicast addresses is from
-     "224.0.0.0" to "239.255.255.255"
+     "binary_file://%file_name%:w", "binary_file://%file_name%:a" (append _float32 to the mode
+     for float32 values), "streaming_board://%multicast_group_ip%:%port%"". Range for multicast
+     addresses is from "224.0.0.0" to "239.255.255.255". Streamers run in their own thread,
+     queue can be configured with "?queue_size=%num_packages%&overflow=%policy%" suffix, policy is
+     block(default), drop_oldest or drop_newest
      */
     void add_streamer (
         std::string streamer_params, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
@@ -238,6 +241,12 @@ public:
      */
     void delete_streamer (
         std::string streamer_params, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /**
+     * get streamer queue counters
+     * @return json string with queued, queue_size, streamed, dropped and max_latency_ms fields
+     */
+    std::string get_streamer_stats (
+        std::string streamer_params, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     /// check if session is ready or not
     bool is_prepared ();
     /// stop streaming thread, doesnt release other resources
@@ -43,6 +43,29 @@ public:
     /// apply notch filter to remove env noise
     static void remove_environmental_noise (
         double *data, int data_len, int sampling_rate, int noise_type);
+    /// create stateful low pass filter, returns filter id
+    static int create_lowpass_filter (int sampling_rate, double cutoff, int order,
+        int filter_type, double ripple, int num_channels);
+    /// create stateful high pass filter, returns filter id
+    static int create_highpass_filter (int sampling_rate, double cutoff, int order,
+        int filter_type, double ripple, int num_channels);
+    /// create stateful bandpass filter, returns filter id
+    static int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq,
+        int order, int filter_type, double ripple, int num_channels);
+    /// create stateful bandstop filter, returns filter id
+    static int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq,
+        int order, int filter_type, double ripple, int num_channels);
+    /// create stateful filter to remove env noise, returns filter id
+    static int create_environmental_noise_filter (
+        int sampling_rate, int noise_type, int num_channels);
+    /// filter next chunk of a channel in-place, history is kept between calls
+    static void process_filter (int filter_id, int channel, double *data, int data_len);
+    /// filter next chunk of all channels in-place, rows of data must match channels of filter
+    static void process_filter_block (int filter_id, BrainFlowArray<double, 2> &data);
+    /// clear history of all channels
+    static void reset_filter (int filter_id);
+    /// free filter created by create_*_filter
+    static void release_filter (int filter_id);
     /// perform moving average or moving median filter in-place
     static void perform_rolling_filter (double *data, int data_len, int period, int agg_operation);
     /// perform data downsampling, it just aggregates several data points
@@ -62,6 +85,13 @@ public:
      */
     static std::pair<double *, int *> perform_wavelet_transform (
         double *data, int data_len, int wavelet, int decomposition_level, int extension_type = (int)WaveletExtensionTypes::SYMMETRIC);
+    /**
+     * perform wavelet transform of each row of data
+     * @return std::pair of coeffs of each row in the same format as for perform_wavelet_transform
+     *              and array of lengths for each block, it's the same for all rows
+     */
+    static std::pair<BrainFlowArray<double, 2>, BrainFlowArray<int, 1>> perform_wavelet_transform_block (
+        BrainFlowArray<double, 2> &data, int wavelet, int decomposition_level, int extension_type = (int)WaveletExtensionTypes::SYMMETRIC);
     // clang-format on
     /// performs inverse wavelet transform
     static double *perform_inverse_wavelet_transform (std::pair<double *, int *> wavelet_output,
@@ -85,12 +115,25 @@ public:
         int threshold = (int)ThresholdTypes::HARD,
         int extenstion_type = (int)WaveletExtensionTypes::SYMMETRIC,
         int noise_level = (int)NoiseEstimationLevelTypes::FIRST_LEVEL);
+    /// perform wavelet denoising of each row of data inplace
+    static void perform_wavelet_denoising_block (BrainFlowArray<double, 2> &data, int wavelet,
+        int decomposition_level, int wavelet_denoising = (int)WaveletDenoisingTypes::SURESHRINK,
+        int threshold = (int)ThresholdTypes::HARD,
+        int extenstion_type = (int)WaveletExtensionTypes::SYMMETRIC,
+        int noise_level = (int)NoiseEstimationLevelTypes::FIRST_LEVEL);
     /// restore data from selected detailed coeffs
     static void restore_data_from_wavelet_detailed_coeffs (double *data, int data_len, int wavelet,
         int decomposition_level, int level_to_restore, double *output);
     /// z score peak detection, more info https://stackoverflow.com/a/22640362
     static void detect_peaks_z_score (
         double *data, int data_len, int lag, double threshold, double influence, double *output);
+    /// create stateful z-score peak detector, returns detector id
+    static int create_z_score_peak_detector (int lag, double threshold, double influence);
+    /// detect peaks in the next chunk of data, state is kept between calls
+    static void process_z_score_peak_detector (
+        int detector_id, double *data, int data_len, double *output);
+    /// free detector created by create_z_score_peak_detector
+    static void release_z_score_peak_detector (int detector_id);
     // clang-format off
     /**
     * calculate filters and the corresponding eigenvalues using the Common Spatial Patterns
@@ -99,13 +142,28 @@ public:
     * @param n_epochs the total number of epochs
     * @param n_channels the number of EEG channels
     * @param n_times the number of samples (observations) for a single epoch for a single channel 
+    * @param shrinkage value in [0, 1] to regularize covariances: (1 - shrinkage) * C + shrinkage * trace (C) / n_channels * I
     * @return pair of two arrays. The first [n_channel x n_channel]-shaped 2D array represents filters. The second n-channel length 1D array represents eigenvalues
     */
     static std::pair<BrainFlowArray<double, 2>, BrainFlowArray<double, 1>> get_csp (
-        const BrainFlowArray<double, 3> &data, const BrainFlowArray<double,1> &labels);
+        const BrainFlowArray<double, 3> &data, const BrainFlowArray<double,1> &labels, double shrinkage = 0.0);
     // clang-format on
+    /// apply [n_filters x n_channels] filters from get_csp to [n_channels x n_times] data, data can
+    /// be a chunk of a stream
+    static BrainFlowArray<double, 2> apply_csp_filters (
+        const BrainFlowArray<double, 2> &filters, const BrainFlowArray<double, 2> &data);
     /// perform data windowing
     static double *get_window (int window_function, int window_len);
+    /// perform data windowing, param is alpha for TUKEY and beta for KAISER
+    static double *get_custom_window (int window_function, int window_len, double param);
+    /**
+     * calculate DPSS tapers for multitaper spectral estimation
+     * @param window_len len of each taper
+     * @param nw time half bandwidth product
+     * @param num_tapers number of tapers, usually 2 * nw - 1
+     * @return tapers in rows with unit energy
+     */
+    static BrainFlowArray<double, 2> get_dpss_tapers (int window_len, double nw, int num_tapers);
     /**
      * perform direct fft
      * @param data input array
@@ -140,6 +198,18 @@ public:
      */
     static std::pair<double *, double *> get_psd (
         double *data, int data_len, int sampling_rate, int window, int *psd_len);
+    /**
+     * calculate multitaper PSD, average of PSDs with DPSS tapers
+     * @param data input array
+     * @param data_len must be even
+     * @param sampling_rate sampling rate
+     * @param nw time half bandwidth product
+     * @param num_tapers number of tapers, usually 2 * nw - 1
+     * @param psd_len output len (data_len / 2 + 1)
+     * @return pair of amplitude and freq arrays of size data_len / 2 + 1
+     */
+    static std::pair<double *, double *> get_psd_multitaper (double *data, int data_len,
+        int sampling_rate, double nw, int num_tapers, int *psd_len);
     /**
      * subtract trend from data
      * @param data input array
@@ -184,6 +254,22 @@ public:
     static std::pair<double *, double *> get_custom_band_powers (
         const BrainFlowArray<double, 2> &data, std::vector<std::pair<double, double>> bands,
         std::vector<int> channels, int sampling_rate, bool apply_filters);
+    /// create stateful band power calculator for the last window_len samples, returns stream id
+    static int create_band_power_stream (
+        int sampling_rate, int window_len, int num_channels, bool apply_filters);
+    /// add new datapoints of channels, number of channels must match the stream
+    static void add_band_power_stream_data (
+        int stream_id, const BrainFlowArray<double, 2> &data, std::vector<int> channels);
+    /// the same as get_custom_band_powers for the last window_len datapoints of the stream
+    static std::pair<double *, double *> get_band_power_stream_powers (
+        int stream_id, std::vector<std::pair<double, double>> bands);
+    /// free stream created by create_band_power_stream
+    static void release_band_power_stream (int stream_id);
+    /// mindfulness or restfulness score in one call, the same as MLModel predict for band powers
+    static double get_eeg_metric (const BrainFlowArray<double, 2> &data, std::vector<int> channels,
+        int sampling_rate, int metric, bool apply_filters = true);
+    /// the same as get_eeg_metric for the last window_len datapoints of the stream
+    static double get_band_power_stream_metric (int stream_id, int metric);
     /**
      * calculate oxygen level
      * @param ppg_ir input 1d array
@@ -205,9 +291,10 @@ public:
      */
     static double get_heart_rate (
         double *ppg_ir, double *ppg_red, int data_len, int sampling_rate, int fft_size);
-    /// write file, in file data will be transposed
-    static void write_file (
-        const BrainFlowArray<double, 2> &data, std::string file_name, std::string file_mode);
+    /// write file, in file data will be transposed, for "wb" and "ab" modes timestamp_channel
+    /// is used to build timestamp index, -1 to skip it
+    static void write_file (const BrainFlowArray<double, 2> &data, std::string file_name,
+        std::string file_mode, int timestamp_channel = -1);
     /// read data from file, data will be transposed to original format
     static BrainFlowArray<double, 2> read_file (std::string file_name);
     /// calc stddev
@@ -234,6 +321,24 @@ public:
     static std::tuple<BrainFlowArray<double, 2>, BrainFlowArray<double, 2>,
         BrainFlowArray<double, 2>, BrainFlowArray<double, 2>>
     perform_ica (const BrainFlowArray<double, 2> &data, int num_components);
+    /**
+     * calculate ICA with custom convergence params
+     * @param data input 2d array, rows are samples
+     * @param num_components number of components to find
+     * @param channels rows to use
+     * @param max_iterations max number of fixed point iterations
+     * @param tolerance stop when unmixing matrix changes less than tolerance
+     * @param w_init num_components x num_components unmixing matrix to start from, for example W
+     * from the previous window of the same recording, random if empty
+     * @param use_float32 run iterations in single precision, faster for large inputs
+     * @return unmixed signal
+     */
+    static std::tuple<BrainFlowArray<double, 2>, BrainFlowArray<double, 2>,
+        BrainFlowArray<double, 2>, BrainFlowArray<double, 2>>
+    perform_custom_ica (const BrainFlowArray<double, 2> &data, int num_components,
+        std::vector<int> channels, int max_iterations, double tolerance,
+        const BrainFlowArray<double, 2> &w_init = BrainFlowArray<double, 2> (),
+        bool use_float32 = false);
 
 
     /// get brainflow version
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <memory>
 #include <stdlib.h>
 #include <string>
 #include <vector>
 
 // include it here to allow user include only this single file
+#include "brainflow_array.h"
 #include "brainflow_constants.h"
 #include "brainflow_exception.h"
 #include "brainflow_model_params.h"
@@ -17,6 +19,8 @@ class MLModel
 private:
     struct BrainFlowModelParams params;
     std::string serialized_params;
+    // handle from prepare_with_handle, shared by copies and cleared by release
+    std::shared_ptr<void *> handle;
 
 public:
     MLModel (struct BrainFlowModelParams params);
@@ -45,6 +49,15 @@ public:
     void prepare ();
     /// calculate metric from data
     std::vector<double> predict (double *data, int data_len);
+    /// calculate metric for each row of data in a single call, rows of output match rows of data
+    BrainFlowArray<double, 2> predict_batch (const BrainFlowArray<double, 2> &data);
+    /// calculate metric for model with several inputs and outputs, inputs are batch_size x
+    /// input_len arrays in model order, returns batch_size x output_len array per output
+    std::vector<BrainFlowArray<double, 2>> predict_multi (
+        const std::vector<BrainFlowArray<double, 2>> &inputs, int num_outputs = 1);
+    /// the same for float32 inputs, float models use them without conversion
+    std::vector<BrainFlowArray<double, 2>> predict_multi (
+        const std::vector<BrainFlowArray<float, 2>> &inputs, int num_outputs = 1);
     /// release classifier
     void release ();
 };
@@ -27,29 +27,39 @@ std::string params_to_string (struct BrainFlowModelParams params)
     j["other_info"] = params.other_info;
     j["output_name"] = params.output_name;
     j["max_array_size"] = params.max_array_size;
+    j["intra_op_num_threads"] = params.intra_op_num_threads;
+    j["inter_op_num_threads"] = params.inter_op_num_threads;
+    j["graph_optimization_level"] = params.graph_optimization_level;
+    j["use_global_thread_pool"] = params.use_global_thread_pool;
+    j["optimized_model_file"] = params.optimized_model_file;
     std::string post_str = j.dump ();
     return post_str;
 }
 
-MLModel::MLModel (struct BrainFlowModelParams model_params) : params (model_params)
+MLModel::MLModel (struct BrainFlowModelParams model_params)
+    : params (model_params), handle (std::make_shared<void *> (nullptr))
 {
     serialized_params = params_to_string (model_params);
 }
 
 void MLModel::prepare ()
 {
-    int res = ::prepare (serialized_params.c_str ());
+    void *model_handle = nullptr;
+    int res = ::prepare_with_handle (serialized_params.c_str (), &model_handle);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to prepare classifier", res);
     }
+    *handle = model_handle;
 }
 
 std::vector<double> MLModel::predict (double *data, int data_len)
 {
     double *output = new double[params.max_array_size];
     int size = 0;
-    int res = ::predict (data, data_len, output, &size, serialized_params.c_str ());
+    int res = (*handle != nullptr) ?
+        ::predict_with_handle (*handle, data, data_len, output, &size) :
+        ::predict (data, data_len, output, &size, serialized_params.c_str ());
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         delete[] output;
@@ -61,9 +71,126 @@ std::vector<double> MLModel::predict (double *data, int data_len)
     return result;
 }
 
+BrainFlowArray<double, 2> MLModel::predict_batch (const BrainFlowArray<double, 2> &data)
+{
+    if (data.empty ())
+    {
+        throw BrainFlowException (
+            "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    int batch_size = data.get_size (0);
+    double *output = new double[(size_t)batch_size * params.max_array_size];
+    int size = 0;
+    double *raw_data = const_cast<double *> (data.get_raw_ptr ());
+    int res = (*handle != nullptr) ?
+        ::predict_batch_with_handle (
+            *handle, raw_data, batch_size, data.get_size (1), output, &size) :
+        ::predict_batch (
+            raw_data, batch_size, data.get_size (1), output, &size, serialized_params.c_str ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        delete[] output;
+        throw BrainFlowException ("failed to predict", res);
+    }
+    BrainFlowArray<double, 2> result (output, batch_size, size / batch_size);
+    delete[] output;
+    return result;
+}
+
+// single input is passed as is, several inputs are packed one after another
+template <typename T>
+static const T *pack_inputs (const std::vector<BrainFlowArray<T, 2>> &inputs,
+    std::vector<T> &packed, std::vector<int> &input_lens, int &batch_size)
+{
+    if (inputs.empty () || inputs[0].empty ())
+    {
+        throw BrainFlowException (
+            "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    batch_size = inputs[0].get_size (0);
+    for (const BrainFlowArray<T, 2> &input : inputs)
+    {
+        if (input.empty () || (input.get_size (0) != batch_size))
+        {
+            throw BrainFlowException (
+                "Invalid params", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+        }
+        input_lens.push_back (input.get_size (1));
+    }
+    if (inputs.size () == 1)
+    {
+        return inputs[0].get_raw_ptr ();
+    }
+    for (const BrainFlowArray<T, 2> &input : inputs)
+    {
+        const T *ptr = input.get_raw_ptr ();
+        packed.insert (packed.end (), ptr, ptr + (size_t)input.get_size (0) * input.get_size (1));
+    }
+    return packed.data ();
+}
+
+static std::vector<BrainFlowArray<double, 2>> unpack_outputs (
+    double *output, const std::vector<int> &output_lens, int batch_size)
+{
+    std::vector<BrainFlowArray<double, 2>> result;
+    for (int len : output_lens)
+    {
+        result.push_back (BrainFlowArray<double, 2> (output, batch_size, len / batch_size));
+        output += len;
+    }
+    return result;
+}
+
+std::vector<BrainFlowArray<double, 2>> MLModel::predict_multi (
+    const std::vector<BrainFlowArray<double, 2>> &inputs, int num_outputs)
+{
+    std::vector<double> packed;
+    std::vector<int> input_lens;
+    int batch_size = 0;
+    const double *data = pack_inputs (inputs, packed, input_lens, batch_size);
+    std::vector<double> output ((size_t)batch_size * params.max_array_size);
+    std::vector<int> output_lens (num_outputs > 0 ? num_outputs : 0);
+    int res = ::predict_multi (const_cast<double *> (data), batch_size, input_lens.data (),
+        (int)input_lens.size (), output.data (), output_lens.data (), num_outputs,
+        serialized_params.c_str ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to predict", res);
+    }
+    return unpack_outputs (output.data (), output_lens, batch_size);
+}
+
+std::vector<BrainFlowArray<double, 2>> MLModel::predict_multi (
+    const std::vector<BrainFlowArray<float, 2>> &inputs, int num_outputs)
+{
+    std::vector<float> packed;
+    std::vector<int> input_lens;
+    int batch_size = 0;
+    const float *data = pack_inputs (inputs, packed, input_lens, batch_size);
+    std::vector<double> output ((size_t)batch_size * params.max_array_size);
+    std::vector<int> output_lens (num_outputs > 0 ? num_outputs : 0);
+    int res = ::predict_multi_float32 (const_cast<float *> (data), batch_size, input_lens.data (),
+        (int)input_lens.size (), output.data (), output_lens.data (), num_outputs,
+        serialized_params.c_str ());
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to predict", res);
+    }
+    return unpack_outputs (output.data (), output_lens, batch_size);
+}
+
 void MLModel::release ()
 {
-    int res = ::release (serialized_params.c_str ());
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    if (*handle != nullptr)
+    {
+        res = ::release_with_handle (*handle);
+        *handle = nullptr;
+    }
+    else
+    {
+        res = ::release (serialized_params.c_str ());
+    }
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to release classifier", res);
@@ -205,6 +205,8 @@ namespace brainflow
         public static extern int add_streamer (string streamer, int preset, int board_id, string input_json);
         [DllImport ("BoardController.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int delete_streamer (string streamer, int preset, int board_id, string input_json);
+        [DllImport ("BoardController.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_streamer_stats (string streamer, int preset, byte[] stats, int[] len, int board_id, string input_json);
     }
 
     public static class BoardControllerLibrary32
@@ -291,6 +293,8 @@ namespace brainflow
         public static extern int delete_streamer (string streamer, int preset, int board_id, string input_json);
         [DllImport ("BoardController32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int get_magnetometer_channels (int board_id, int preset, int[] channels, int[] len);
+        [DllImport ("BoardController32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_streamer_stats (string streamer, int preset, byte[] stats, int[] len, int board_id, string input_json);
     }
 
     public static class BoardControllerLibraryLinux
@@ -377,6 +381,8 @@ namespace brainflow
         public static extern int delete_streamer (string streamer, int preset, int board_id, string input_json);
         [DllImport ("libBoardController.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int get_magnetometer_channels (int board_id, int preset, int[] channels, int[] len);
+        [DllImport ("libBoardController.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_streamer_stats (string streamer, int preset, byte[] stats, int[] len, int board_id, string input_json);
     }
 
     public static class BoardControllerLibraryMac
@@ -463,6 +469,8 @@ namespace brainflow
         public static extern int delete_streamer (string streamer, int preset, int board_id, string input_json);
         [DllImport ("libBoardController.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int get_magnetometer_channels (int board_id, int preset, int[] channels, int[] len);
+        [DllImport ("libBoardController.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_streamer_stats (string streamer, int preset, byte[] stats, int[] len, int board_id, string input_json);
     }
 
     public static class BoardControllerLibrary
@@ -1164,5 +1172,22 @@ namespace brainflow
 
             return (int)BrainFlowExitCodes.GENERAL_ERROR;
         }
+
+        public static int get_streamer_stats (string streamer, int preset, byte[] stats, int[] len, int board_id, string input_json)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return BoardControllerLibrary64.get_streamer_stats (streamer, preset, stats, len, board_id, input_json);
+                case LibraryEnvironment.x86:
+                    return BoardControllerLibrary32.get_streamer_stats (streamer, preset, stats, len, board_id, input_json);
+                case LibraryEnvironment.Linux:
+                    return BoardControllerLibraryLinux.get_streamer_stats (streamer, preset, stats, len, board_id, input_json);
+                case LibraryEnvironment.MacOS:
+                    return BoardControllerLibraryMac.get_streamer_stats (streamer, preset, stats, len, board_id, input_json);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
     }
 }
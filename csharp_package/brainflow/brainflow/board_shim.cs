@@ -728,6 +728,24 @@ namespace brainflow
             }
         }
 
+        /// <summary>
+        /// get streamer queue counters
+        /// </summary>
+        /// <param name="streamer_params">the same string which was used to add streamer</param>
+        /// <returns>json string with queued, queue_size, streamed, dropped and max_latency_ms fields</returns>
+        public string get_streamer_stats (string streamer_params, int preset = (int)BrainFlowPresets.DEFAULT_PRESET)
+        {
+            int[] len = new int[1];
+            byte[] str = new byte[8192];
+            int res = BoardControllerLibrary.get_streamer_stats (streamer_params, preset, str, len, board_id, input_json);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            string stats = System.Text.Encoding.UTF8.GetString (str, 0, len[0]);
+            return stats;
+        }
+
         /// <summary>
         /// insert marker to data array
         /// </summary>
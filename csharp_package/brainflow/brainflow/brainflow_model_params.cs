@@ -43,6 +43,31 @@ namespace brainflow
         /// </summary>
         [DataMember]
         public int max_array_size;
+        /// <summary>
+        /// onnx runtime intra op threads, 0 for default
+        /// </summary>
+        [DataMember]
+        public int intra_op_num_threads;
+        /// <summary>
+        /// onnx runtime inter op threads, 0 for default, more than 1 enables parallel execution
+        /// </summary>
+        [DataMember]
+        public int inter_op_num_threads;
+        /// <summary>
+        /// onnx runtime graph optimization level: 0, 1, 2 or 99
+        /// </summary>
+        [DataMember]
+        public int graph_optimization_level;
+        /// <summary>
+        /// share onnx runtime thread pool between models
+        /// </summary>
+        [DataMember]
+        public bool use_global_thread_pool;
+        /// <summary>
+        /// file to cache optimized onnx model
+        /// </summary>
+        [DataMember]
+        public string optimized_model_file;
 
         public BrainFlowModelParams (int metric, int classifier)
         {
@@ -52,6 +77,11 @@ namespace brainflow
             other_info = "";
             output_name = "";
             max_array_size = 8192;
+            intra_op_num_threads = 0;
+            inter_op_num_threads = 0;
+            graph_optimization_level = 99;
+            use_global_thread_pool = false;
+            optimized_model_file = "";
         }
 
         public string to_json ()
@@ -187,6 +187,177 @@ namespace brainflow
             return filtered_data;
         }
 
+        /// <summary>
+        /// create stateful lowpass filter, it keeps history between calls of process_filter
+        /// </summary>
+        /// <param name="sampling_rate"></param>
+        /// <param name="cutoff"></param>
+        /// <param name="order"></param>
+        /// <param name="filter_type"></param>
+        /// <param name="ripple"></param>
+        /// <param name="num_channels"></param>
+        /// <returns>filter id</returns>
+        public static int create_lowpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels = 1)
+        {
+            int[] filter_id = new int[1];
+            int res = DataHandlerLibrary.create_lowpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return filter_id[0];
+        }
+
+        /// <summary>
+        /// create stateful highpass filter, it keeps history between calls of process_filter
+        /// </summary>
+        /// <param name="sampling_rate"></param>
+        /// <param name="cutoff"></param>
+        /// <param name="order"></param>
+        /// <param name="filter_type"></param>
+        /// <param name="ripple"></param>
+        /// <param name="num_channels"></param>
+        /// <returns>filter id</returns>
+        public static int create_highpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels = 1)
+        {
+            int[] filter_id = new int[1];
+            int res = DataHandlerLibrary.create_highpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return filter_id[0];
+        }
+
+        /// <summary>
+        /// create stateful bandpass filter, it keeps history between calls of process_filter
+        /// </summary>
+        /// <param name="sampling_rate"></param>
+        /// <param name="start_freq"></param>
+        /// <param name="stop_freq"></param>
+        /// <param name="order"></param>
+        /// <param name="filter_type"></param>
+        /// <param name="ripple"></param>
+        /// <param name="num_channels"></param>
+        /// <returns>filter id</returns>
+        public static int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels = 1)
+        {
+            int[] filter_id = new int[1];
+            int res = DataHandlerLibrary.create_bandpass_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return filter_id[0];
+        }
+
+        /// <summary>
+        /// create stateful bandstop filter, it keeps history between calls of process_filter
+        /// </summary>
+        /// <param name="sampling_rate"></param>
+        /// <param name="start_freq"></param>
+        /// <param name="stop_freq"></param>
+        /// <param name="order"></param>
+        /// <param name="filter_type"></param>
+        /// <param name="ripple"></param>
+        /// <param name="num_channels"></param>
+        /// <returns>filter id</returns>
+        public static int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels = 1)
+        {
+            int[] filter_id = new int[1];
+            int res = DataHandlerLibrary.create_bandstop_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return filter_id[0];
+        }
+
+        /// <summary>
+        /// create stateful notch filter to remove env noise
+        /// </summary>
+        /// <param name="sampling_rate"></param>
+        /// <param name="noise_type"></param>
+        /// <param name="num_channels"></param>
+        /// <returns>filter id</returns>
+        public static int create_environmental_noise_filter (int sampling_rate, int noise_type, int num_channels = 1)
+        {
+            int[] filter_id = new int[1];
+            int res = DataHandlerLibrary.create_environmental_noise_filter (sampling_rate, noise_type, num_channels, filter_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return filter_id[0];
+        }
+
+        /// <summary>
+        /// filter next chunk of a channel, history is kept between calls, unlike other bindings instead in-place calculation it returns new array
+        /// </summary>
+        /// <param name="filter_id">id from create_*_filter methods</param>
+        /// <param name="channel">channel of filter</param>
+        /// <param name="data"></param>
+        /// <returns>filtered data</returns>
+        public static double[] process_filter (int filter_id, int channel, double[] data)
+        {
+            double[] filtered_data = new double[data.Length];
+            Array.Copy (data, filtered_data, data.Length);
+            int res = DataHandlerLibrary.process_filter (filter_id, channel, filtered_data, data.Length);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return filtered_data;
+        }
+
+        /// <summary>
+        /// filter next chunk of all channels, unlike other bindings instead in-place calculation it returns new array
+        /// </summary>
+        /// <param name="filter_id">id from create_*_filter methods</param>
+        /// <param name="data">2d array with a row per channel of filter</param>
+        /// <returns>filtered data</returns>
+        public static double[,] process_filter_block (int filter_id, double[,] data)
+        {
+            int rows = data.GetLength (0);
+            int cols = data.GetLength (1);
+            double[] data_1d = new double[rows * cols];
+            Buffer.BlockCopy (data, 0, data_1d, 0, rows * cols * sizeof (double));
+            int res = DataHandlerLibrary.process_filter_block (filter_id, data_1d, rows, cols);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            double[,] filtered_data = new double[rows, cols];
+            Buffer.BlockCopy (data_1d, 0, filtered_data, 0, rows * cols * sizeof (double));
+            return filtered_data;
+        }
+
+        /// <summary>
+        /// clear history of all channels of a filter
+        /// </summary>
+        /// <param name="filter_id">id from create_*_filter methods</param>
+        public static void reset_filter (int filter_id)
+        {
+            int res = DataHandlerLibrary.reset_filter (filter_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+        }
+
+        /// <summary>
+        /// release filter created by create_*_filter methods
+        /// </summary>
+        /// <param name="filter_id">id from create_*_filter methods</param>
+        public static void release_filter (int filter_id)
+        {
+            int res = DataHandlerLibrary.release_filter (filter_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+        }
+
         /// <summary>
         /// perform moving average or moving median filter, unlike other bindings instead in-place calculation it returns new array
         /// </summary>
@@ -264,6 +435,47 @@ namespace brainflow
             return peaks;
         }
 
+        /// <summary>
+        /// create z score peak detector which keeps its state between calls
+        /// </summary>
+        /// <returns>detector id</returns>
+        public static int create_z_score_peak_detector (int lag, double threshold, double influence)
+        {
+            int[] detector_id = new int[1];
+            int res = DataHandlerLibrary.create_z_score_peak_detector (lag, threshold, influence, detector_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return detector_id[0];
+        }
+
+        /// <summary>
+        /// detect peaks in the next chunk of data, state is kept between calls
+        /// </summary>
+        public static double[] process_z_score_peak_detector (int detector_id, double[] data)
+        {
+            double[] peaks = new double[data.Length];
+            int res = DataHandlerLibrary.process_z_score_peak_detector (detector_id, data, data.Length, peaks);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return peaks;
+        }
+
+        /// <summary>
+        /// release z score peak detector
+        /// </summary>
+        public static void release_z_score_peak_detector (int detector_id)
+        {
+            int res = DataHandlerLibrary.release_z_score_peak_detector (detector_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+        }
+
         /// <summary>
         /// calc stddev
         /// </summary>
@@ -419,13 +631,72 @@ namespace brainflow
             return filtered_data;
         }
 
+        /// <summary>
+        /// perform wavelet transform of each row of data
+        /// </summary>
+        /// <param name="data">data for wavelet transform, each row is transformed separately</param>
+        /// <param name="wavelet">use WaveletTypes enum</param>
+        /// <param name="decomposition_level">decomposition level</param>
+        /// <param name="extension">use WaveletExtensionTypes enum</param>
+        /// <returns>tuple of wavelet coeffs for each row in the same format as for perform_wavelet_transform and array with lengths for each block, it's the same for all rows</returns>
+        public static Tuple<double[,], int[]> perform_wavelet_transform_block (double[,] data, int wavelet, int decomposition_level, int extension)
+        {
+            int rows = data.GetLength (0);
+            int cols = data.GetLength (1);
+            double[] wavelet_coeffs = new double[rows * (cols + 2 * decomposition_level * (40 + 1))];
+            int[] lengths = new int[decomposition_level + 1];
+            int res = DataHandlerLibrary.perform_wavelet_transform_block (data.Flatten (), rows, cols, wavelet, decomposition_level, extension, wavelet_coeffs, lengths);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            int total_length = 0;
+            foreach (int val in lengths)
+            {
+                total_length += val;
+            }
+            double[,] coeffs = new double[rows, total_length];
+            Buffer.BlockCopy (wavelet_coeffs, 0, coeffs, 0, rows * total_length * sizeof (double));
+            return new Tuple<double[,], int[]> (coeffs, lengths);
+        }
+
+        /// <summary>
+        /// perform wavelet based denoising of each row of data
+        /// </summary>
+        /// <param name="data">data for denoising</param>
+        /// <param name="wavelet">use WaveletTypes enum</param>
+        /// <param name="decomposition_level">level of decomposition in wavelet transform</param>
+        /// <param name="wavelet_denoising">use WaveletDenoisingTypes enum</param>
+        /// <param name="threshold">use ThresholdTypes enum</param>
+        /// <param name="extenstion_type">use WaveletExtensionTypes enum</param>
+        /// <param name="noise_level">use NoiseEstimationLevelTypes enum</param>
+        /// <returns>denoised data</returns>
+        public static double[,] perform_wavelet_denoising_block (double[,] data, int wavelet, int decomposition_level,
+                                                            int wavelet_denoising = (int)WaveletDenoisingTypes.SURESHRINK, int threshold = (int)ThresholdTypes.HARD,
+                                                            int extenstion_type = (int)WaveletExtensionTypes.SYMMETRIC, int noise_level = (int)NoiseEstimationLevelTypes.FIRST_LEVEL)
+        {
+            int rows = data.GetLength (0);
+            int cols = data.GetLength (1);
+            double[] filtered_data = data.Flatten ();
+            int res = DataHandlerLibrary.perform_wavelet_denoising_block (filtered_data, rows, cols, wavelet, decomposition_level,
+                                                                    wavelet_denoising, threshold, extenstion_type, noise_level);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            double[,] output = new double[rows, cols];
+            Buffer.BlockCopy (filtered_data, 0, output, 0, filtered_data.Length * sizeof (double));
+            return output;
+        }
+
         /// <summary>
         /// get common spatial patterns
         /// </summary>
         /// <param name="data">data for csp</param>
         /// <param name="labels">labels for each class</param>
+        /// <param name="shrinkage">shrinkage of class covariances towards identity in range [0, 1], 0 means no regularization</param>
         /// <returns>Tuple of two arrays: [n_channels x n_channels] shaped array of filters and n_channels length array of eigenvalues</returns>
-        public static Tuple<double[,], double[]> get_csp (double[,,] data, double[] labels)
+        public static Tuple<double[,], double[]> get_csp (double[,,] data, double[] labels, double shrinkage = 0.0)
         {
             int n_epochs = data.GetLength (0);
             int n_channels = data.GetLength (1);
@@ -447,7 +718,7 @@ namespace brainflow
             double[] temp_filters = new double[n_channels * n_channels];
             double[] output_eigenvalues = new double[n_channels];
 
-            int res = DataHandlerLibrary.get_csp (temp_data1d, labels, n_epochs, n_channels, n_times, temp_filters, output_eigenvalues);
+            int res = DataHandlerLibrary.get_regularized_csp (temp_data1d, labels, n_epochs, n_channels, n_times, shrinkage, temp_filters, output_eigenvalues);
             if (res != (int)BrainFlowExitCodes.STATUS_OK)
             {
                 throw new BrainFlowError (res);
@@ -466,6 +737,30 @@ namespace brainflow
             return return_data;
         }
 
+        /// <summary>
+        /// apply filters from get_csp to data
+        /// </summary>
+        /// <param name="filters">[n_filters x n_channels] shaped array, rows of filters returned by get_csp</param>
+        /// <param name="data">[n_channels x n_times] shaped array of data</param>
+        /// <returns>[n_filters x n_times] shaped array of filtered data</returns>
+        public static double[,] apply_csp_filters (double[,] filters, double[,] data)
+        {
+            int n_filters = filters.GetLength (0);
+            int n_channels = filters.GetLength (1);
+            int n_times = data.GetLength (1);
+            if (data.GetLength (0) != n_channels)
+            {
+                throw new BrainFlowError ((int)BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR);
+            }
+            double[] output = new double[n_filters * n_times];
+            int res = DataHandlerLibrary.apply_csp_filters (filters.Flatten (), n_filters, n_channels, data.Flatten (), n_times, output);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return output.Reshape (n_filters, n_times);
+        }
+
         /// <summary>
         /// perform windowing
         /// </summary>
@@ -483,6 +778,46 @@ namespace brainflow
             return window_data;
         }
 
+        /// <summary>
+        /// perform windowing with custom window param
+        /// </summary>
+        /// <param name="window_function">window function</param>
+        /// <param name="window_len">len of the window</param>
+        /// <param name="param">alpha for TUKEY and beta for KAISER, ignored by other windows</param>
+        /// <returns>array of the size specified in window_len</returns>
+        public static double[] get_custom_window (int window_function, int window_len, double param)
+        {
+            double[] window_data = new double[window_len];
+            int res = DataHandlerLibrary.get_custom_window (window_function, window_len, param, window_data);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return window_data;
+        }
+
+        /// <summary>
+        /// calculate DPSS tapers for multitaper spectral estimation
+        /// </summary>
+        /// <param name="window_len">len of each taper</param>
+        /// <param name="nw">time half bandwidth product</param>
+        /// <param name="num_tapers">number of tapers, usually 2 * nw - 1</param>
+        /// <returns>[num_tapers x window_len] shaped array of tapers with unit energy</returns>
+        public static double[,] get_dpss_tapers (int window_len, double nw, int num_tapers)
+        {
+            if ((window_len < 2) || (num_tapers < 1))
+            {
+                throw new BrainFlowError ((int)BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR);
+            }
+            double[] tapers = new double[num_tapers * window_len];
+            int res = DataHandlerLibrary.get_dpss_tapers (window_len, nw, num_tapers, tapers);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return tapers.Reshape (num_tapers, window_len);
+        }
+
         /// <summary>
         /// perform direct fft
         /// </summary>
@@ -692,6 +1027,48 @@ namespace brainflow
             return return_data;
         }
 
+        /// <summary>
+        /// Calculate ICA with custom convergence settings
+        /// </summary>
+        /// <param name="data"></param>
+        /// <param name="num_components"></param>
+        /// <param name="channels"></param>
+        /// <param name="max_iterations">max number of iterations</param>
+        /// <param name="tolerance">convergence tolerance</param>
+        /// <param name="w_init">num_components x num_components unmixing matrix to start from, null for random</param>
+        /// <param name="use_float32">compute in single precision</param>
+        /// <returns></returns>
+        public static Tuple<double[,], double[,], double[,], double[,]> perform_custom_ica (double[,] data, int num_components, int[] channels,
+                                                                                        int max_iterations = 300, double tolerance = 0.0001,
+                                                                                        double[,] w_init = null, bool use_float32 = false)
+        {
+            if ((num_components < 1) || (data == null) || (channels == null) ||
+                ((w_init != null) && ((w_init.GetLength (0) != num_components) || (w_init.GetLength (1) != num_components))))
+            {
+                throw new BrainFlowError ((int)BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR);
+            }
+            int cols = data.GetLength (1);
+            double[] data_1d = new double[cols * channels.Length];
+            for (int i = 0; i < channels.Length; i++)
+            {
+                Array.Copy (data.GetRow (channels[i]), 0, data_1d, i * cols, cols);
+            }
+            int channels_len = channels.Length;
+            double[] w = new double[num_components * num_components];
+            double[] k = new double[channels_len * num_components];
+            double[] a = new double[channels_len * num_components];
+            double[] s = new double[cols * num_components];
+
+            int res = DataHandlerLibrary.perform_custom_ica (data_1d, channels_len, cols, num_components, max_iterations, tolerance,
+                                                            (w_init == null) ? null : w_init.Flatten (), use_float32 ? 1 : 0, w, k, a, s);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return new Tuple<double[,], double[,], double[,], double[,]> (w.Reshape (num_components, num_components),
+                k.Reshape (num_components, channels_len), a.Reshape (channels_len, num_components), s.Reshape (num_components, cols));
+        }
+
         /// <summary>
         /// calculate avg and stddev bandpowers across channels
         /// </summary>
@@ -712,6 +1089,127 @@ namespace brainflow
             return get_custom_band_powers (data, bands, channels, sampling_rate, apply_filters);
         }
 
+        /// <summary>
+        /// create stateful band power calculator for the last window_len datapoints
+        /// </summary>
+        /// <param name="sampling_rate">sampling rate</param>
+        /// <param name="window_len">number of the last datapoints used for calculation</param>
+        /// <param name="num_channels">number of channels added on each call</param>
+        /// <param name="apply_filters">apply bandpass and bandstop filters before calculation</param>
+        /// <returns>stream id</returns>
+        public static int create_band_power_stream (int sampling_rate, int window_len, int num_channels, bool apply_filters)
+        {
+            int[] stream_id = new int[1];
+            int res = DataHandlerLibrary.create_band_power_stream (sampling_rate, window_len, num_channels, (apply_filters) ? 1 : 0, stream_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return stream_id[0];
+        }
+
+        /// <summary>
+        /// add new datapoints of channels to band power stream
+        /// </summary>
+        /// <param name="stream_id">id from create_band_power_stream</param>
+        /// <param name="data">2d array with values</param>
+        /// <param name="channels">rows of data array to add, number of channels must match the stream</param>
+        public static void add_band_power_stream_data (int stream_id, double[,] data, int[] channels)
+        {
+            double[] data_1d = new double[data.GetRow (0).Length * channels.Length];
+            for (int i = 0; i < channels.Length; i++)
+            {
+                Array.Copy (data.GetRow (channels[i]), 0, data_1d, i * data.GetRow (channels[i]).Length, data.GetRow (channels[i]).Length);
+            }
+            int res = DataHandlerLibrary.add_band_power_stream_data (stream_id, data_1d, channels.Length, data.GetRow (0).Length);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+        }
+
+        /// <summary>
+        /// calculate avg and stddev bandpowers for the last window of band power stream
+        /// </summary>
+        /// <param name="stream_id">id from create_band_power_stream</param>
+        /// <param name="bands">bands to calculate</param>
+        /// <returns>Tuple of avgs and stddev arrays</returns>
+        public static Tuple<double[], double[]> get_band_power_stream_powers (int stream_id, Tuple<double, double>[] bands)
+        {
+            double[] avgs = new double[bands.Length];
+            double[] stddevs = new double[bands.Length];
+            double[] start_freqs = new double[bands.Length];
+            double[] stop_freqs = new double[bands.Length];
+            for (int i = 0; i < bands.Length; i++)
+            {
+                start_freqs[i] = bands[i].Item1;
+                stop_freqs[i] = bands[i].Item2;
+            }
+
+            int res = DataHandlerLibrary.get_band_power_stream_powers (stream_id, start_freqs, stop_freqs, bands.Length, avgs, stddevs);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            Tuple<double[], double[]> return_data = new Tuple<double[], double[]> (avgs, stddevs);
+            return return_data;
+        }
+
+        /// <summary>
+        /// release band power stream
+        /// </summary>
+        /// <param name="stream_id">id from create_band_power_stream</param>
+        public static void release_band_power_stream (int stream_id)
+        {
+            int res = DataHandlerLibrary.release_band_power_stream (stream_id);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+        }
+
+        /// <summary>
+        /// calculate mindfulness or restfulness score from eeg channels in a single call, features and model are the same as for MLModel with default classifier
+        /// </summary>
+        /// <param name="data">data to process</param>
+        /// <param name="channels">rows of data arrays which should be used in calculation</param>
+        /// <param name="sampling_rate">sampling rate</param>
+        /// <param name="metric">MINDFULNESS or RESTFULNESS from BrainFlowMetrics</param>
+        /// <param name="apply_filters">apply bandpass and bandstop filters before calculation</param>
+        /// <returns>metric value</returns>
+        public static double get_eeg_metric (double[,] data, int[] channels, int sampling_rate, int metric, bool apply_filters)
+        {
+            double[] data_1d = new double[data.GetRow (0).Length * channels.Length];
+            for (int i = 0; i < channels.Length; i++)
+            {
+                Array.Copy (data.GetRow (channels[i]), 0, data_1d, i * data.GetRow (channels[i]).Length, data.GetRow (channels[i]).Length);
+            }
+            double[] output = new double[1];
+            int res = DataHandlerLibrary.get_eeg_metric (data_1d, channels.Length, data.GetRow (0).Length, sampling_rate, metric, (apply_filters) ? 1 : 0, output);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return output[0];
+        }
+
+        /// <summary>
+        /// calculate mindfulness or restfulness score for the last window of band power stream
+        /// </summary>
+        /// <param name="stream_id">id from create_band_power_stream</param>
+        /// <param name="metric">MINDFULNESS or RESTFULNESS from BrainFlowMetrics</param>
+        /// <returns>metric value</returns>
+        public static double get_band_power_stream_metric (int stream_id, int metric)
+        {
+            double[] output = new double[1];
+            int res = DataHandlerLibrary.get_band_power_stream_metric (stream_id, metric, output);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return output[0];
+        }
+
         /// <summary>
         /// calculate PSD
         /// </summary>
@@ -746,6 +1244,31 @@ namespace brainflow
             return return_data;
         }
 
+        /// <summary>
+        /// calculate multitaper PSD, average of PSDs with DPSS tapers
+        /// </summary>
+        /// <param name="data">data for PSD, len must be even</param>
+        /// <param name="sampling_rate">sampling rate</param>
+        /// <param name="nw">time half bandwidth product</param>
+        /// <param name="num_tapers">number of tapers, usually 2 * nw - 1</param>
+        /// <returns>Tuple of ampls and freqs arrays of size N / 2 + 1</returns>
+        public static Tuple<double[], double[]> get_psd_multitaper (double[] data, int sampling_rate, double nw, int num_tapers)
+        {
+            if (data.Length % 2 == 1)
+            {
+                throw new BrainFlowError ((int)BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR);
+            }
+            double[] temp_ampls = new double[data.Length / 2 + 1];
+            double[] temp_freqs = new double[data.Length / 2 + 1];
+
+            int res = DataHandlerLibrary.get_psd_multitaper (data, data.Length, sampling_rate, nw, num_tapers, temp_ampls, temp_freqs);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return new Tuple<double[], double[]> (temp_ampls, temp_freqs);
+        }
+
         /// <summary>
         /// calculate PSD using Welch method
         /// </summary>
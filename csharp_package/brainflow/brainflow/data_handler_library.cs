@@ -13,7 +13,11 @@ namespace brainflow
     {
         MEAN = 0,
         MEDIAN = 1,
-        EACH = 2
+        EACH = 2,
+        STDDEV = 3,
+        MIN = 4,
+        MAX = 5,
+        RMS = 6
     };
 
     public enum WindowOperations
@@ -21,7 +25,10 @@ namespace brainflow
         NO_WINDOW = 0,
         HANNING = 1,
         HAMMING = 2,
-        BLACKMAN_HARRIS = 3
+        BLACKMAN_HARRIS = 3,
+        TUKEY = 4,
+        KAISER = 5,
+        FLAT_TOP = 6
     };
 
     public enum DetrendOperations
@@ -184,6 +191,58 @@ namespace brainflow
         public static extern int get_heart_rate (double[] ppg_ir, double[] ppg_red, int data_size, int sampling_rate, int fft_size, double[] output);
         [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int perform_ica (double[] data, int rows, int cols, int num_components, double[] w, double[] k, double[] a, double[] s);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_lowpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_highpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_environmental_noise_filter (int sampling_rate, int noise_type, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_filter (int filter_id, int channel, double[] data, int data_len);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int reset_filter (int filter_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_filter (int filter_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_filter_block (int filter_id, double[] data, int rows, int cols);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_band_power_stream (int sampling_rate, int window_len, int num_channels, int apply_filters, int[] stream_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int add_band_power_stream_data (int stream_id, double[] data, int rows, int cols);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_band_power_stream_powers (int stream_id, double[] start_freqs, double[] stop_freqs, int num_bands, double[] avgs, double[] stddevs);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_band_power_stream (int stream_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_z_score_peak_detector (int lag, double threshold, double influence, int[] detector_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_z_score_peak_detector (int detector_id, double[] data, int data_len, double[] output);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_z_score_peak_detector (int detector_id);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_wavelet_transform_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int extension, double[] output_data, int[] decomposition_lengths);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_wavelet_denoising_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type, int noise_level);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_regularized_csp (double[] data, double[] labels, int n_epochs, int n_channels, int n_times, double shrinkage, double[] output_w, double[] output_d);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int apply_csp_filters (double[] filters, int n_filters, int n_channels, double[] data, int n_times, double[] output);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_custom_ica (double[] data, int rows, int cols, int num_components, int max_iterations, double tolerance, double[] w_init, int use_float32, double[] w_mat, double[] k_mat, double[] a_mat, double[] s_mat);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_custom_window (int window_function, int window_len, double param, double[] output_window);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_dpss_tapers (int window_len, double nw, int num_tapers, double[] output_tapers);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_psd_multitaper (double[] data, int data_len, int sampling_rate, double nw, int num_tapers, double[] output_ampl, double[] output_freq);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_eeg_metric (double[] data, int rows, int cols, int sampling_rate, int metric, int apply_filters, double[] output);
+        [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_band_power_stream_metric (int stream_id, int metric, double[] output);
         // unsafe methods working with pointers
         [DllImport ("DataHandler.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static unsafe extern int perform_lowpass (double* data, int len, int sampling_rate, double cutoff, int order, int filter_type, double ripple);
@@ -294,6 +353,58 @@ namespace brainflow
         public static extern int get_heart_rate (double[] ppg_ir, double[] ppg_red, int data_size, int sampling_rate, int fft_size, double[] output);
         [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int perform_ica (double[] data, int rows, int cols, int num_components, double[] w, double[] k, double[] a, double[] s);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_lowpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_highpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_environmental_noise_filter (int sampling_rate, int noise_type, int num_channels, int[] filter_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_filter (int filter_id, int channel, double[] data, int data_len);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int reset_filter (int filter_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_filter (int filter_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_filter_block (int filter_id, double[] data, int rows, int cols);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_band_power_stream (int sampling_rate, int window_len, int num_channels, int apply_filters, int[] stream_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int add_band_power_stream_data (int stream_id, double[] data, int rows, int cols);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_band_power_stream_powers (int stream_id, double[] start_freqs, double[] stop_freqs, int num_bands, double[] avgs, double[] stddevs);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_band_power_stream (int stream_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_z_score_peak_detector (int lag, double threshold, double influence, int[] detector_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_z_score_peak_detector (int detector_id, double[] data, int data_len, double[] output);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_z_score_peak_detector (int detector_id);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_wavelet_transform_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int extension, double[] output_data, int[] decomposition_lengths);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_wavelet_denoising_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type, int noise_level);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_regularized_csp (double[] data, double[] labels, int n_epochs, int n_channels, int n_times, double shrinkage, double[] output_w, double[] output_d);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int apply_csp_filters (double[] filters, int n_filters, int n_channels, double[] data, int n_times, double[] output);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_custom_ica (double[] data, int rows, int cols, int num_components, int max_iterations, double tolerance, double[] w_init, int use_float32, double[] w_mat, double[] k_mat, double[] a_mat, double[] s_mat);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_custom_window (int window_function, int window_len, double param, double[] output_window);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_dpss_tapers (int window_len, double nw, int num_tapers, double[] output_tapers);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_psd_multitaper (double[] data, int data_len, int sampling_rate, double nw, int num_tapers, double[] output_ampl, double[] output_freq);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_eeg_metric (double[] data, int rows, int cols, int sampling_rate, int metric, int apply_filters, double[] output);
+        [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_band_power_stream_metric (int stream_id, int metric, double[] output);
         // unsafe methods working with pointers
         [DllImport ("DataHandler32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static unsafe extern int perform_lowpass (double* data, int len, int sampling_rate, double cutoff, int order, int filter_type, double ripple);
@@ -404,6 +515,58 @@ namespace brainflow
         public static extern int get_heart_rate (double[] ppg_ir, double[] ppg_red, int data_size, int sampling_rate, int fft_size, double[] output);
         [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int perform_ica (double[] data, int rows, int cols, int num_components, double[] w, double[] k, double[] a, double[] s);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_lowpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_highpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_environmental_noise_filter (int sampling_rate, int noise_type, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_filter (int filter_id, int channel, double[] data, int data_len);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int reset_filter (int filter_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_filter (int filter_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_filter_block (int filter_id, double[] data, int rows, int cols);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_band_power_stream (int sampling_rate, int window_len, int num_channels, int apply_filters, int[] stream_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int add_band_power_stream_data (int stream_id, double[] data, int rows, int cols);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_band_power_stream_powers (int stream_id, double[] start_freqs, double[] stop_freqs, int num_bands, double[] avgs, double[] stddevs);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_band_power_stream (int stream_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_z_score_peak_detector (int lag, double threshold, double influence, int[] detector_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_z_score_peak_detector (int detector_id, double[] data, int data_len, double[] output);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_z_score_peak_detector (int detector_id);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_wavelet_transform_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int extension, double[] output_data, int[] decomposition_lengths);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_wavelet_denoising_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type, int noise_level);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_regularized_csp (double[] data, double[] labels, int n_epochs, int n_channels, int n_times, double shrinkage, double[] output_w, double[] output_d);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int apply_csp_filters (double[] filters, int n_filters, int n_channels, double[] data, int n_times, double[] output);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_custom_ica (double[] data, int rows, int cols, int num_components, int max_iterations, double tolerance, double[] w_init, int use_float32, double[] w_mat, double[] k_mat, double[] a_mat, double[] s_mat);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_custom_window (int window_function, int window_len, double param, double[] output_window);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_dpss_tapers (int window_len, double nw, int num_tapers, double[] output_tapers);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_psd_multitaper (double[] data, int data_len, int sampling_rate, double nw, int num_tapers, double[] output_ampl, double[] output_freq);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_eeg_metric (double[] data, int rows, int cols, int sampling_rate, int metric, int apply_filters, double[] output);
+        [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_band_power_stream_metric (int stream_id, int metric, double[] output);
         // unsafe methods working with pointers
         [DllImport ("libDataHandler.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static unsafe extern int perform_lowpass (double* data, int len, int sampling_rate, double cutoff, int order, int filter_type, double ripple);
@@ -514,6 +677,58 @@ namespace brainflow
         public static extern int get_heart_rate (double[] ppg_ir, double[] ppg_red, int data_size, int sampling_rate, int fft_size, double[] output);
         [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int perform_ica (double[] data, int rows, int cols, int num_components, double[] w, double[] k, double[] a, double[] s);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_lowpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_highpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_environmental_noise_filter (int sampling_rate, int noise_type, int num_channels, int[] filter_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_filter (int filter_id, int channel, double[] data, int data_len);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int reset_filter (int filter_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_filter (int filter_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_filter_block (int filter_id, double[] data, int rows, int cols);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_band_power_stream (int sampling_rate, int window_len, int num_channels, int apply_filters, int[] stream_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int add_band_power_stream_data (int stream_id, double[] data, int rows, int cols);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_band_power_stream_powers (int stream_id, double[] start_freqs, double[] stop_freqs, int num_bands, double[] avgs, double[] stddevs);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_band_power_stream (int stream_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int create_z_score_peak_detector (int lag, double threshold, double influence, int[] detector_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int process_z_score_peak_detector (int detector_id, double[] data, int data_len, double[] output);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_z_score_peak_detector (int detector_id);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_wavelet_transform_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int extension, double[] output_data, int[] decomposition_lengths);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_wavelet_denoising_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type, int noise_level);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_regularized_csp (double[] data, double[] labels, int n_epochs, int n_channels, int n_times, double shrinkage, double[] output_w, double[] output_d);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int apply_csp_filters (double[] filters, int n_filters, int n_channels, double[] data, int n_times, double[] output);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int perform_custom_ica (double[] data, int rows, int cols, int num_components, int max_iterations, double tolerance, double[] w_init, int use_float32, double[] w_mat, double[] k_mat, double[] a_mat, double[] s_mat);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_custom_window (int window_function, int window_len, double param, double[] output_window);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_dpss_tapers (int window_len, double nw, int num_tapers, double[] output_tapers);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_psd_multitaper (double[] data, int data_len, int sampling_rate, double nw, int num_tapers, double[] output_ampl, double[] output_freq);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_eeg_metric (double[] data, int rows, int cols, int sampling_rate, int metric, int apply_filters, double[] output);
+        [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int get_band_power_stream_metric (int stream_id, int metric, double[] output);
         // unsafe methods working with pointers
         [DllImport ("libDataHandler.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static unsafe extern int perform_lowpass (double* data, int len, int sampling_rate, double cutoff, int order, int filter_type, double ripple);
@@ -1137,6 +1352,448 @@ namespace brainflow
             return (int)BrainFlowExitCodes.GENERAL_ERROR;
         }
 
+        public static int create_lowpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.create_lowpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.create_lowpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.create_lowpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.create_lowpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int create_highpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple, int num_channels, int[] filter_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.create_highpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.create_highpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.create_highpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.create_highpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels, filter_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.create_bandpass_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.create_bandpass_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.create_bandpass_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.create_bandpass_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type, double ripple, int num_channels, int[] filter_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.create_bandstop_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.create_bandstop_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.create_bandstop_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.create_bandstop_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels, filter_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int create_environmental_noise_filter (int sampling_rate, int noise_type, int num_channels, int[] filter_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.create_environmental_noise_filter (sampling_rate, noise_type, num_channels, filter_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.create_environmental_noise_filter (sampling_rate, noise_type, num_channels, filter_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.create_environmental_noise_filter (sampling_rate, noise_type, num_channels, filter_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.create_environmental_noise_filter (sampling_rate, noise_type, num_channels, filter_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int process_filter (int filter_id, int channel, double[] data, int data_len)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.process_filter (filter_id, channel, data, data_len);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.process_filter (filter_id, channel, data, data_len);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.process_filter (filter_id, channel, data, data_len);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.process_filter (filter_id, channel, data, data_len);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int reset_filter (int filter_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.reset_filter (filter_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.reset_filter (filter_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.reset_filter (filter_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.reset_filter (filter_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int release_filter (int filter_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.release_filter (filter_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.release_filter (filter_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.release_filter (filter_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.release_filter (filter_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int process_filter_block (int filter_id, double[] data, int rows, int cols)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.process_filter_block (filter_id, data, rows, cols);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.process_filter_block (filter_id, data, rows, cols);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.process_filter_block (filter_id, data, rows, cols);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.process_filter_block (filter_id, data, rows, cols);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int create_band_power_stream (int sampling_rate, int window_len, int num_channels, int apply_filters, int[] stream_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.create_band_power_stream (sampling_rate, window_len, num_channels, apply_filters, stream_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.create_band_power_stream (sampling_rate, window_len, num_channels, apply_filters, stream_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.create_band_power_stream (sampling_rate, window_len, num_channels, apply_filters, stream_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.create_band_power_stream (sampling_rate, window_len, num_channels, apply_filters, stream_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int add_band_power_stream_data (int stream_id, double[] data, int rows, int cols)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.add_band_power_stream_data (stream_id, data, rows, cols);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.add_band_power_stream_data (stream_id, data, rows, cols);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.add_band_power_stream_data (stream_id, data, rows, cols);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.add_band_power_stream_data (stream_id, data, rows, cols);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int get_band_power_stream_powers (int stream_id, double[] start_freqs, double[] stop_freqs, int num_bands, double[] avgs, double[] stddevs)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.get_band_power_stream_powers (stream_id, start_freqs, stop_freqs, num_bands, avgs, stddevs);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.get_band_power_stream_powers (stream_id, start_freqs, stop_freqs, num_bands, avgs, stddevs);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.get_band_power_stream_powers (stream_id, start_freqs, stop_freqs, num_bands, avgs, stddevs);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.get_band_power_stream_powers (stream_id, start_freqs, stop_freqs, num_bands, avgs, stddevs);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int release_band_power_stream (int stream_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.release_band_power_stream (stream_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.release_band_power_stream (stream_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.release_band_power_stream (stream_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.release_band_power_stream (stream_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int create_z_score_peak_detector (int lag, double threshold, double influence, int[] detector_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.create_z_score_peak_detector (lag, threshold, influence, detector_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.create_z_score_peak_detector (lag, threshold, influence, detector_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.create_z_score_peak_detector (lag, threshold, influence, detector_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.create_z_score_peak_detector (lag, threshold, influence, detector_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int process_z_score_peak_detector (int detector_id, double[] data, int data_len, double[] output)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.process_z_score_peak_detector (detector_id, data, data_len, output);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.process_z_score_peak_detector (detector_id, data, data_len, output);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.process_z_score_peak_detector (detector_id, data, data_len, output);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.process_z_score_peak_detector (detector_id, data, data_len, output);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int release_z_score_peak_detector (int detector_id)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.release_z_score_peak_detector (detector_id);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.release_z_score_peak_detector (detector_id);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.release_z_score_peak_detector (detector_id);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.release_z_score_peak_detector (detector_id);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int perform_wavelet_transform_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int extension, double[] output_data, int[] decomposition_lengths)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.perform_wavelet_transform_block (data, rows, cols, wavelet, decomposition_level, extension, output_data, decomposition_lengths);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.perform_wavelet_transform_block (data, rows, cols, wavelet, decomposition_level, extension, output_data, decomposition_lengths);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.perform_wavelet_transform_block (data, rows, cols, wavelet, decomposition_level, extension, output_data, decomposition_lengths);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.perform_wavelet_transform_block (data, rows, cols, wavelet, decomposition_level, extension, output_data, decomposition_lengths);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int perform_wavelet_denoising_block (double[] data, int rows, int cols, int wavelet, int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type, int noise_level)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.perform_wavelet_denoising_block (data, rows, cols, wavelet, decomposition_level, wavelet_denoising, threshold, extenstion_type, noise_level);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.perform_wavelet_denoising_block (data, rows, cols, wavelet, decomposition_level, wavelet_denoising, threshold, extenstion_type, noise_level);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.perform_wavelet_denoising_block (data, rows, cols, wavelet, decomposition_level, wavelet_denoising, threshold, extenstion_type, noise_level);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.perform_wavelet_denoising_block (data, rows, cols, wavelet, decomposition_level, wavelet_denoising, threshold, extenstion_type, noise_level);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int get_regularized_csp (double[] data, double[] labels, int n_epochs, int n_channels, int n_times, double shrinkage, double[] output_w, double[] output_d)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.get_regularized_csp (data, labels, n_epochs, n_channels, n_times, shrinkage, output_w, output_d);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.get_regularized_csp (data, labels, n_epochs, n_channels, n_times, shrinkage, output_w, output_d);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.get_regularized_csp (data, labels, n_epochs, n_channels, n_times, shrinkage, output_w, output_d);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.get_regularized_csp (data, labels, n_epochs, n_channels, n_times, shrinkage, output_w, output_d);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int apply_csp_filters (double[] filters, int n_filters, int n_channels, double[] data, int n_times, double[] output)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.apply_csp_filters (filters, n_filters, n_channels, data, n_times, output);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.apply_csp_filters (filters, n_filters, n_channels, data, n_times, output);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.apply_csp_filters (filters, n_filters, n_channels, data, n_times, output);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.apply_csp_filters (filters, n_filters, n_channels, data, n_times, output);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int perform_custom_ica (double[] data, int rows, int cols, int num_components, int max_iterations, double tolerance, double[] w_init, int use_float32, double[] w_mat, double[] k_mat, double[] a_mat, double[] s_mat)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.perform_custom_ica (data, rows, cols, num_components, max_iterations, tolerance, w_init, use_float32, w_mat, k_mat, a_mat, s_mat);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.perform_custom_ica (data, rows, cols, num_components, max_iterations, tolerance, w_init, use_float32, w_mat, k_mat, a_mat, s_mat);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.perform_custom_ica (data, rows, cols, num_components, max_iterations, tolerance, w_init, use_float32, w_mat, k_mat, a_mat, s_mat);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.perform_custom_ica (data, rows, cols, num_components, max_iterations, tolerance, w_init, use_float32, w_mat, k_mat, a_mat, s_mat);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int get_custom_window (int window_function, int window_len, double param, double[] output_window)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.get_custom_window (window_function, window_len, param, output_window);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.get_custom_window (window_function, window_len, param, output_window);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.get_custom_window (window_function, window_len, param, output_window);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.get_custom_window (window_function, window_len, param, output_window);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int get_dpss_tapers (int window_len, double nw, int num_tapers, double[] output_tapers)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.get_dpss_tapers (window_len, nw, num_tapers, output_tapers);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.get_dpss_tapers (window_len, nw, num_tapers, output_tapers);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.get_dpss_tapers (window_len, nw, num_tapers, output_tapers);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.get_dpss_tapers (window_len, nw, num_tapers, output_tapers);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int get_psd_multitaper (double[] data, int data_len, int sampling_rate, double nw, int num_tapers, double[] output_ampl, double[] output_freq)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.get_psd_multitaper (data, data_len, sampling_rate, nw, num_tapers, output_ampl, output_freq);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.get_psd_multitaper (data, data_len, sampling_rate, nw, num_tapers, output_ampl, output_freq);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.get_psd_multitaper (data, data_len, sampling_rate, nw, num_tapers, output_ampl, output_freq);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.get_psd_multitaper (data, data_len, sampling_rate, nw, num_tapers, output_ampl, output_freq);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int get_eeg_metric (double[] data, int rows, int cols, int sampling_rate, int metric, int apply_filters, double[] output)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.get_eeg_metric (data, rows, cols, sampling_rate, metric, apply_filters, output);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.get_eeg_metric (data, rows, cols, sampling_rate, metric, apply_filters, output);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.get_eeg_metric (data, rows, cols, sampling_rate, metric, apply_filters, output);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.get_eeg_metric (data, rows, cols, sampling_rate, metric, apply_filters, output);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int get_band_power_stream_metric (int stream_id, int metric, double[] output)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return DataHandlerLibrary64.get_band_power_stream_metric (stream_id, metric, output);
+                case LibraryEnvironment.x86:
+                    return DataHandlerLibrary32.get_band_power_stream_metric (stream_id, metric, output);
+                case LibraryEnvironment.Linux:
+                    return DataHandlerLibraryLinux.get_band_power_stream_metric (stream_id, metric, output);
+                case LibraryEnvironment.MacOS:
+                    return DataHandlerLibraryMac.get_band_power_stream_metric (stream_id, metric, output);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
         public static unsafe int remove_environmental_noise (double* data, int len, int sampling_rate, int noise_type)
         {
             switch (PlatformHelper.get_library_environment ())
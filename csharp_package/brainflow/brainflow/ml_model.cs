@@ -1,4 +1,6 @@
-﻿using System;
+﻿using brainflow.math;
+
+using System;
 using System.Collections.Generic;
 using System.Linq;
 using System.Text;
@@ -11,6 +13,8 @@ namespace brainflow
     {
         private string input_json;
         BrainFlowModelParams input_params;
+        // set by prepare, predict methods skip params lookup if it is not zero
+        private IntPtr handle = IntPtr.Zero;
 
 
         /// <summary>
@@ -104,11 +108,13 @@ namespace brainflow
         /// </summary>
         public void prepare ()
         {
-            int res = MLModuleLibrary.prepare (input_json);
+            IntPtr model_handle;
+            int res = MLModuleLibrary.prepare_with_handle (input_json, out model_handle);
             if (res != (int)BrainFlowExitCodes.STATUS_OK)
             {
                 throw new BrainFlowError (res);
             }
+            handle = model_handle;
         }
 
         /// <summary>
@@ -116,7 +122,16 @@ namespace brainflow
         /// </summary>
         public void release ()
         {
-            int res = MLModuleLibrary.release (input_json);
+            int res = (int)BrainFlowExitCodes.STATUS_OK;
+            if (handle != IntPtr.Zero)
+            {
+                res = MLModuleLibrary.release_with_handle (handle);
+                handle = IntPtr.Zero;
+            }
+            else
+            {
+                res = MLModuleLibrary.release (input_json);
+            }
             if (res != (int)BrainFlowExitCodes.STATUS_OK)
             {
                 throw new BrainFlowError (res);
@@ -130,7 +145,9 @@ namespace brainflow
         {
             double[] val = new double[input_params.max_array_size];
             int[] val_len = new int[1];
-            int res = MLModuleLibrary.predict (data, data.Length, val, val_len, input_json);
+            int res = (handle != IntPtr.Zero) ?
+                MLModuleLibrary.predict_with_handle (handle, data, data.Length, val, val_len) :
+                MLModuleLibrary.predict (data, data.Length, val, val_len, input_json);
             if (res != (int)BrainFlowExitCodes.STATUS_OK)
             {
                 throw new BrainFlowError (res);
@@ -143,6 +160,100 @@ namespace brainflow
             return result;
         }
 
+        /// <summary>
+        /// Get score of classifier for each row of data in a single call
+        /// </summary>
+        /// <param name="data">rows of input data</param>
+        /// <returns>rows of output match rows of data</returns>
+        public double[,] predict_batch (double[,] data)
+        {
+            int batch_size = data.GetLength (0);
+            double[] val = new double[batch_size * input_params.max_array_size];
+            int[] val_len = new int[1];
+            int res = (handle != IntPtr.Zero) ?
+                MLModuleLibrary.predict_batch_with_handle (handle, data.Flatten (), batch_size, data.GetLength (1), val, val_len) :
+                MLModuleLibrary.predict_batch (data.Flatten (), batch_size, data.GetLength (1), val, val_len, input_json);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return val.Reshape (batch_size, val_len[0] / batch_size);
+        }
+
+        /// <summary>
+        /// Get score of classifier with several inputs and outputs
+        /// </summary>
+        /// <param name="inputs">batch_size x input_len arrays in model order</param>
+        /// <param name="num_outputs">number of model outputs</param>
+        /// <returns>batch_size x output_len array per output</returns>
+        public List<double[,]> predict_multi (double[][,] inputs, int num_outputs = 1)
+        {
+            int[] input_lens = get_input_lens (inputs);
+            int batch_size = inputs[0].GetLength (0);
+            double[] data = inputs.SelectMany (input => input.Flatten ()).ToArray ();
+            double[] val = new double[batch_size * input_params.max_array_size];
+            int[] output_lens = new int[num_outputs];
+            int res = MLModuleLibrary.predict_multi (data, batch_size, input_lens, inputs.Length, val, output_lens, num_outputs, input_json);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return unpack_outputs (val, output_lens, batch_size);
+        }
+
+        /// <summary>
+        /// Get score of classifier with several float32 inputs, float models use them without conversion
+        /// </summary>
+        /// <param name="inputs">batch_size x input_len arrays in model order</param>
+        /// <param name="num_outputs">number of model outputs</param>
+        /// <returns>batch_size x output_len array per output</returns>
+        public List<double[,]> predict_multi (float[][,] inputs, int num_outputs = 1)
+        {
+            int[] input_lens = get_input_lens (inputs);
+            int batch_size = inputs[0].GetLength (0);
+            float[] data = inputs.SelectMany (input => input.Flatten ()).ToArray ();
+            double[] val = new double[batch_size * input_params.max_array_size];
+            int[] output_lens = new int[num_outputs];
+            int res = MLModuleLibrary.predict_multi_float32 (data, batch_size, input_lens, inputs.Length, val, output_lens, num_outputs, input_json);
+            if (res != (int)BrainFlowExitCodes.STATUS_OK)
+            {
+                throw new BrainFlowError (res);
+            }
+            return unpack_outputs (val, output_lens, batch_size);
+        }
+
+        private static int[] get_input_lens<T> (T[][,] inputs)
+        {
+            if ((inputs == null) || (inputs.Length == 0))
+            {
+                throw new BrainFlowError ((int)BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR);
+            }
+            int[] input_lens = new int[inputs.Length];
+            for (int i = 0; i < inputs.Length; i++)
+            {
+                if ((inputs[i].GetLength (0) == 0) || (inputs[i].GetLength (0) != inputs[0].GetLength (0)))
+                {
+                    throw new BrainFlowError ((int)BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR);
+                }
+                input_lens[i] = inputs[i].GetLength (1);
+            }
+            return input_lens;
+        }
+
+        private static List<double[,]> unpack_outputs (double[] val, int[] output_lens, int batch_size)
+        {
+            List<double[,]> result = new List<double[,]> ();
+            int offset = 0;
+            foreach (int len in output_lens)
+            {
+                double[] output = new double[len];
+                Array.Copy (val, offset, output, 0, len);
+                result.Add (output.Reshape (batch_size, len / batch_size));
+                offset += len;
+            }
+            return result;
+        }
+
         /// <summary>
         /// get version
         /// </summary>
@@ -40,6 +40,20 @@ namespace brainflow
         public static extern int release_all ();
         [DllImport ("MLModule.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int get_version_ml_module (byte[] version, int[] len, int max_len);
+        [DllImport ("MLModule.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_batch (double[] data, int batch_size, int data_len, double[] output, int[] output_len, string input_json);
+        [DllImport ("MLModule.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_multi (double[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json);
+        [DllImport ("MLModule.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_multi_float32 (float[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json);
+        [DllImport ("MLModule.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int prepare_with_handle (string input_json, out IntPtr handle);
+        [DllImport ("MLModule.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_with_handle (IntPtr handle, double[] data, int data_len, double[] output, int[] output_len);
+        [DllImport ("MLModule.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_batch_with_handle (IntPtr handle, double[] data, int batch_size, int data_len, double[] output, int[] output_len);
+        [DllImport ("MLModule.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_with_handle (IntPtr handle);
     }
 
     public static class MLModuleLibrary32
@@ -60,6 +74,20 @@ namespace brainflow
         public static extern int release_all ();
         [DllImport ("MLModule32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int get_version_ml_module (byte[] version, int[] len, int max_len);
+        [DllImport ("MLModule32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_batch (double[] data, int batch_size, int data_len, double[] output, int[] output_len, string input_json);
+        [DllImport ("MLModule32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_multi (double[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json);
+        [DllImport ("MLModule32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_multi_float32 (float[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json);
+        [DllImport ("MLModule32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int prepare_with_handle (string input_json, out IntPtr handle);
+        [DllImport ("MLModule32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_with_handle (IntPtr handle, double[] data, int data_len, double[] output, int[] output_len);
+        [DllImport ("MLModule32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_batch_with_handle (IntPtr handle, double[] data, int batch_size, int data_len, double[] output, int[] output_len);
+        [DllImport ("MLModule32.dll", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_with_handle (IntPtr handle);
     }
 
     public static class MLModuleLibraryLinux
@@ -80,6 +108,20 @@ namespace brainflow
         public static extern int release_all ();
         [DllImport ("libMLModule.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int get_version_ml_module (byte[] version, int[] len, int max_len);
+        [DllImport ("libMLModule.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_batch (double[] data, int batch_size, int data_len, double[] output, int[] output_len, string input_json);
+        [DllImport ("libMLModule.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_multi (double[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json);
+        [DllImport ("libMLModule.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_multi_float32 (float[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json);
+        [DllImport ("libMLModule.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int prepare_with_handle (string input_json, out IntPtr handle);
+        [DllImport ("libMLModule.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_with_handle (IntPtr handle, double[] data, int data_len, double[] output, int[] output_len);
+        [DllImport ("libMLModule.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_batch_with_handle (IntPtr handle, double[] data, int batch_size, int data_len, double[] output, int[] output_len);
+        [DllImport ("libMLModule.so", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_with_handle (IntPtr handle);
     }
 
     public static class MLModuleLibraryMac
@@ -100,6 +142,20 @@ namespace brainflow
         public static extern int release_all ();
         [DllImport ("libMLModule.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
         public static extern int get_version_ml_module (byte[] version, int[] len, int max_len);
+        [DllImport ("libMLModule.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_batch (double[] data, int batch_size, int data_len, double[] output, int[] output_len, string input_json);
+        [DllImport ("libMLModule.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_multi (double[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json);
+        [DllImport ("libMLModule.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_multi_float32 (float[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json);
+        [DllImport ("libMLModule.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int prepare_with_handle (string input_json, out IntPtr handle);
+        [DllImport ("libMLModule.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_with_handle (IntPtr handle, double[] data, int data_len, double[] output, int[] output_len);
+        [DllImport ("libMLModule.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int predict_batch_with_handle (IntPtr handle, double[] data, int batch_size, int data_len, double[] output, int[] output_len);
+        [DllImport ("libMLModule.dylib", SetLastError = true, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int release_with_handle (IntPtr handle);
     }
 
 
@@ -241,5 +297,125 @@ namespace brainflow
 
             return (int)BrainFlowExitCodes.GENERAL_ERROR;
         }
+
+        public static int predict_batch (double[] data, int batch_size, int data_len, double[] output, int[] output_len, string input_json)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return MLModuleLibrary64.predict_batch (data, batch_size, data_len, output, output_len, input_json);
+                case LibraryEnvironment.x86:
+                    return MLModuleLibrary32.predict_batch (data, batch_size, data_len, output, output_len, input_json);
+                case LibraryEnvironment.Linux:
+                    return MLModuleLibraryLinux.predict_batch (data, batch_size, data_len, output, output_len, input_json);
+                case LibraryEnvironment.MacOS:
+                    return MLModuleLibraryMac.predict_batch (data, batch_size, data_len, output, output_len, input_json);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int predict_multi (double[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return MLModuleLibrary64.predict_multi (data, batch_size, input_lens, num_inputs, output, output_lens, num_outputs, input_json);
+                case LibraryEnvironment.x86:
+                    return MLModuleLibrary32.predict_multi (data, batch_size, input_lens, num_inputs, output, output_lens, num_outputs, input_json);
+                case LibraryEnvironment.Linux:
+                    return MLModuleLibraryLinux.predict_multi (data, batch_size, input_lens, num_inputs, output, output_lens, num_outputs, input_json);
+                case LibraryEnvironment.MacOS:
+                    return MLModuleLibraryMac.predict_multi (data, batch_size, input_lens, num_inputs, output, output_lens, num_outputs, input_json);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int predict_multi_float32 (float[] data, int batch_size, int[] input_lens, int num_inputs, double[] output, int[] output_lens, int num_outputs, string input_json)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return MLModuleLibrary64.predict_multi_float32 (data, batch_size, input_lens, num_inputs, output, output_lens, num_outputs, input_json);
+                case LibraryEnvironment.x86:
+                    return MLModuleLibrary32.predict_multi_float32 (data, batch_size, input_lens, num_inputs, output, output_lens, num_outputs, input_json);
+                case LibraryEnvironment.Linux:
+                    return MLModuleLibraryLinux.predict_multi_float32 (data, batch_size, input_lens, num_inputs, output, output_lens, num_outputs, input_json);
+                case LibraryEnvironment.MacOS:
+                    return MLModuleLibraryMac.predict_multi_float32 (data, batch_size, input_lens, num_inputs, output, output_lens, num_outputs, input_json);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int prepare_with_handle (string input_json, out IntPtr handle)
+        {
+            handle = IntPtr.Zero;
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return MLModuleLibrary64.prepare_with_handle (input_json, out handle);
+                case LibraryEnvironment.x86:
+                    return MLModuleLibrary32.prepare_with_handle (input_json, out handle);
+                case LibraryEnvironment.Linux:
+                    return MLModuleLibraryLinux.prepare_with_handle (input_json, out handle);
+                case LibraryEnvironment.MacOS:
+                    return MLModuleLibraryMac.prepare_with_handle (input_json, out handle);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int predict_with_handle (IntPtr handle, double[] data, int data_len, double[] output, int[] output_len)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return MLModuleLibrary64.predict_with_handle (handle, data, data_len, output, output_len);
+                case LibraryEnvironment.x86:
+                    return MLModuleLibrary32.predict_with_handle (handle, data, data_len, output, output_len);
+                case LibraryEnvironment.Linux:
+                    return MLModuleLibraryLinux.predict_with_handle (handle, data, data_len, output, output_len);
+                case LibraryEnvironment.MacOS:
+                    return MLModuleLibraryMac.predict_with_handle (handle, data, data_len, output, output_len);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int predict_batch_with_handle (IntPtr handle, double[] data, int batch_size, int data_len, double[] output, int[] output_len)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return MLModuleLibrary64.predict_batch_with_handle (handle, data, batch_size, data_len, output, output_len);
+                case LibraryEnvironment.x86:
+                    return MLModuleLibrary32.predict_batch_with_handle (handle, data, batch_size, data_len, output, output_len);
+                case LibraryEnvironment.Linux:
+                    return MLModuleLibraryLinux.predict_batch_with_handle (handle, data, batch_size, data_len, output, output_len);
+                case LibraryEnvironment.MacOS:
+                    return MLModuleLibraryMac.predict_batch_with_handle (handle, data, batch_size, data_len, output, output_len);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
+
+        public static int release_with_handle (IntPtr handle)
+        {
+            switch (PlatformHelper.get_library_environment ())
+            {
+                case LibraryEnvironment.x64:
+                    return MLModuleLibrary64.release_with_handle (handle);
+                case LibraryEnvironment.x86:
+                    return MLModuleLibrary32.release_with_handle (handle);
+                case LibraryEnvironment.Linux:
+                    return MLModuleLibraryLinux.release_with_handle (handle);
+                case LibraryEnvironment.MacOS:
+                    return MLModuleLibraryMac.release_with_handle (handle);
+            }
+
+            return (int)BrainFlowExitCodes.GENERAL_ERROR;
+        }
     }
 }
@@ -11,7 +11,11 @@ public enum AggOperations
 
     MEAN (0),
     MEDIAN (1),
-    EACH (2);
+    EACH (2),
+    STDDEV (3),
+    MIN (4),
+    MAX (5),
+    RMS (6);
 
     private final int agg_operation;
     private static final Map<Integer, AggOperations> ao_map = new HashMap<Integer, AggOperations> ();
@@ -32,6 +32,9 @@ public class BoardShim
 
         int delete_streamer (String streamer, int preset, int board_id, String params);
 
+        int get_streamer_stats (String streamer, int preset, byte[] stats, int[] len, int board_id,
+                String params);
+
         int start_stream (int buffer_size, String streamer_params, int board_id, String params);
 
         int stop_stream (int board_id, String params);
@@ -1418,6 +1421,35 @@ public class BoardShim
         delete_streamer (streamer, BrainFlowPresets.DEFAULT_PRESET);
     }
 
+    /**
+     * get streamer queue counters
+     * 
+     * @return json string with queued, queue_size, streamed, dropped and
+     *         max_latency_ms fields
+     */
+    public String get_streamer_stats (String streamer, int preset) throws BrainFlowError
+    {
+        int[] len = new int[1];
+        byte[] str = new byte[8192];
+        int ec = instance.get_streamer_stats (streamer, preset, str, len, board_id, input_json);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Error in get_streamer_stats", ec);
+        }
+        String resp = new String (str, 0, len[0]);
+        return resp;
+    }
+
+    public String get_streamer_stats (String streamer, BrainFlowPresets preset) throws BrainFlowError
+    {
+        return get_streamer_stats (streamer, preset.get_code ());
+    }
+
+    public String get_streamer_stats (String streamer) throws BrainFlowError
+    {
+        return get_streamer_stats (streamer, BrainFlowPresets.DEFAULT_PRESET);
+    }
+
     /**
      * send string to a board, use this method carefully and only if you understand
      * what you are doing
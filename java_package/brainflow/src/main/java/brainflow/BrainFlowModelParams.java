@@ -13,6 +13,11 @@ public class BrainFlowModelParams
     public String other_info;
     public String output_name;
     public int max_array_size;
+    public int intra_op_num_threads;
+    public int inter_op_num_threads;
+    public int graph_optimization_level;
+    public boolean use_global_thread_pool;
+    public String optimized_model_file;
 
     public BrainFlowModelParams (int metric, int classifier)
     {
@@ -22,6 +27,11 @@ public class BrainFlowModelParams
         this.other_info = "";
         this.output_name = "";
         this.max_array_size = 8192;
+        this.intra_op_num_threads = 0;
+        this.inter_op_num_threads = 0;
+        this.graph_optimization_level = 99;
+        this.use_global_thread_pool = false;
+        this.optimized_model_file = "";
     }
 
     public BrainFlowModelParams (BrainFlowMetrics metric, BrainFlowClassifiers classifier)
@@ -32,6 +42,11 @@ public class BrainFlowModelParams
         this.other_info = "";
         this.output_name = "";
         this.max_array_size = 8192;
+        this.intra_op_num_threads = 0;
+        this.inter_op_num_threads = 0;
+        this.graph_optimization_level = 99;
+        this.use_global_thread_pool = false;
+        this.optimized_model_file = "";
     }
 
     public int get_metric ()
@@ -104,6 +119,56 @@ public class BrainFlowModelParams
         this.max_array_size = max_array_size;
     }
 
+    public int get_intra_op_num_threads ()
+    {
+        return intra_op_num_threads;
+    }
+
+    public void set_intra_op_num_threads (int intra_op_num_threads)
+    {
+        this.intra_op_num_threads = intra_op_num_threads;
+    }
+
+    public int get_inter_op_num_threads ()
+    {
+        return inter_op_num_threads;
+    }
+
+    public void set_inter_op_num_threads (int inter_op_num_threads)
+    {
+        this.inter_op_num_threads = inter_op_num_threads;
+    }
+
+    public int get_graph_optimization_level ()
+    {
+        return graph_optimization_level;
+    }
+
+    public void set_graph_optimization_level (int graph_optimization_level)
+    {
+        this.graph_optimization_level = graph_optimization_level;
+    }
+
+    public boolean is_use_global_thread_pool ()
+    {
+        return use_global_thread_pool;
+    }
+
+    public void set_use_global_thread_pool (boolean use_global_thread_pool)
+    {
+        this.use_global_thread_pool = use_global_thread_pool;
+    }
+
+    public String get_optimized_model_file ()
+    {
+        return optimized_model_file;
+    }
+
+    public void set_optimized_model_file (String optimized_model_file)
+    {
+        this.optimized_model_file = optimized_model_file;
+    }
+
     public String to_json ()
     {
         return new Gson ().toJson (this);
@@ -51,8 +51,36 @@ public class DataFilter
         int detect_peaks_z_score (double[] data, int data_len, int lag, double threshold, double influence,
                 double[] output);
 
+        int create_z_score_peak_detector (int lag, double threshold, double influence, int[] detector_id);
+
+        int process_z_score_peak_detector (int detector_id, double[] data, int data_len, double[] output);
+
+        int release_z_score_peak_detector (int detector_id);
+
         int remove_environmental_noise (double[] data, int data_len, int sampling_rate, int noise_type);
 
+        int create_lowpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple,
+                int num_channels, int[] filter_id);
+
+        int create_highpass_filter (int sampling_rate, double cutoff, int order, int filter_type, double ripple,
+                int num_channels, int[] filter_id);
+
+        int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type,
+                double ripple, int num_channels, int[] filter_id);
+
+        int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order, int filter_type,
+                double ripple, int num_channels, int[] filter_id);
+
+        int create_environmental_noise_filter (int sampling_rate, int noise_type, int num_channels, int[] filter_id);
+
+        int process_filter (int filter_id, int channel, double[] data, int data_len);
+
+        int process_filter_block (int filter_id, double[] data, int rows, int cols);
+
+        int reset_filter (int filter_id);
+
+        int release_filter (int filter_id);
+
         int perform_wavelet_transform (double[] data, int data_len, int wavelet, int decomposition_level, int extention,
                 double[] output_data, int[] decomposition_lengths);
 
@@ -62,11 +90,27 @@ public class DataFilter
         int perform_wavelet_denoising (double[] data, int data_len, int wavelet, int decomposition_level,
                 int wavelet_denoising, int threshold, int extenstion_type, int noise_level);
 
+        int perform_wavelet_transform_block (double[] data, int rows, int cols, int wavelet, int decomposition_level,
+                int extention, double[] output_data, int[] decomposition_lengths);
+
+        int perform_wavelet_denoising_block (double[] data, int rows, int cols, int wavelet, int decomposition_level,
+                int wavelet_denoising, int threshold, int extenstion_type, int noise_level);
+
         int get_csp (double[] data, double[] labels, int n_epochs, int n_channels, int n_times, double[] output_filters,
                 double[] output_eigenvalues);
 
+        int get_regularized_csp (double[] data, double[] labels, int n_epochs, int n_channels, int n_times,
+                double shrinkage, double[] output_filters, double[] output_eigenvalues);
+
+        int apply_csp_filters (double[] filters, int n_filters, int n_channels, double[] data, int n_times,
+                double[] output);
+
         int get_window (int window_function, int window_len, double[] window_data);
 
+        int get_custom_window (int window_function, int window_len, double param, double[] window_data);
+
+        int get_dpss_tapers (int window_len, double nw, int num_tapers, double[] tapers);
+
         int perform_fft (double[] data, int data_len, int window, double[] output_re, double[] output_im);
 
         int perform_ifft (double[] re, double[] im, int data_len, double[] data);
@@ -89,12 +133,30 @@ public class DataFilter
 
         int get_psd (double[] data, int len, int sampling_rate, int window, double[] ampls, double[] freqs);
 
+        int get_psd_multitaper (double[] data, int len, int sampling_rate, double nw, int num_tapers, double[] ampls,
+                double[] freqs);
+
         int get_psd_welch (double[] data, int len, int nfft, int overlap, int sampling_rate, int window, double[] ampls,
                 double[] freqs);
 
         int get_custom_band_powers (double[] data, int rows, int cols, double[] start_freqs, double[] stop_freqs,
                 int num_bands, int sampling_rate, int apply_filters, double[] avgs, double[] stddevs);
 
+        int create_band_power_stream (int sampling_rate, int window_len, int num_channels, int apply_filters,
+                int[] stream_id);
+
+        int add_band_power_stream_data (int stream_id, double[] data, int rows, int cols);
+
+        int get_band_power_stream_powers (int stream_id, double[] start_freqs, double[] stop_freqs, int num_bands,
+                double[] avgs, double[] stddevs);
+
+        int release_band_power_stream (int stream_id);
+
+        int get_eeg_metric (double[] data, int rows, int cols, int sampling_rate, int metric, int apply_filters,
+                double[] output);
+
+        int get_band_power_stream_metric (int stream_id, int metric, double[] output);
+
         int get_band_power (double[] ampls, double[] freqs, int len, double start_freq, double stop_freq,
                 double[] output);
 
@@ -107,6 +169,9 @@ public class DataFilter
         int perform_ica (double[] data, int rows, int cols, int num_components, double[] w, double[] k, double[] a,
                 double[] s);
 
+        int perform_custom_ica (double[] data, int rows, int cols, int num_components, int max_iterations,
+                double tolerance, double[] w_init, int use_float32, double[] w, double[] k, double[] a, double[] s);
+
         int get_version_data_handler (byte[] version, int[] len, int max_len);
 
         int log_message_data_handler (int log_level, String message);
@@ -513,6 +578,49 @@ public class DataFilter
         return peaks;
     }
 
+    /**
+     * create z score peak detector which keeps its state between calls
+     *
+     * @return detector id
+     */
+    public static int create_z_score_peak_detector (int lag, double threshold, double influence)
+            throws BrainFlowError
+    {
+        int[] detector_id = new int[1];
+        int ec = instance.create_z_score_peak_detector (lag, threshold, influence, detector_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create z score peak detector", ec);
+        }
+        return detector_id[0];
+    }
+
+    /**
+     * detect peaks in the next chunk of data, state is kept between calls
+     */
+    public static double[] process_z_score_peak_detector (int detector_id, double[] data) throws BrainFlowError
+    {
+        double[] peaks = new double[data.length];
+        int ec = instance.process_z_score_peak_detector (detector_id, data, data.length, peaks);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to detect peaks", ec);
+        }
+        return peaks;
+    }
+
+    /**
+     * release z score peak detector
+     */
+    public static void release_z_score_peak_detector (int detector_id) throws BrainFlowError
+    {
+        int ec = instance.release_z_score_peak_detector (detector_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to release z score peak detector", ec);
+        }
+    }
+
     /**
      * perform data downsampling, it doesnt apply lowpass filter for you, it just
      * aggregates several data points
@@ -545,6 +653,214 @@ public class DataFilter
         remove_environmental_noise (data, sampling_rate, noise_type.get_code ());
     }
 
+    /**
+     * create stateful lowpass filter, it keeps history between calls of process_filter
+     *
+     * @return filter id
+     */
+    public static int create_lowpass_filter (int sampling_rate, double cutoff, int order, int filter_type,
+            double ripple, int num_channels) throws BrainFlowError
+    {
+        int[] filter_id = new int[1];
+        int ec = instance.create_lowpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels,
+                filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create filter", ec);
+        }
+        return filter_id[0];
+    }
+
+    /**
+     * create stateful lowpass filter, it keeps history between calls of process_filter
+     *
+     * @return filter id
+     */
+    public static int create_lowpass_filter (int sampling_rate, double cutoff, int order, FilterTypes filter_type,
+            double ripple, int num_channels) throws BrainFlowError
+    {
+        return create_lowpass_filter (sampling_rate, cutoff, order, filter_type.get_code (), ripple, num_channels);
+    }
+
+    /**
+     * create stateful highpass filter, it keeps history between calls of process_filter
+     *
+     * @return filter id
+     */
+    public static int create_highpass_filter (int sampling_rate, double cutoff, int order, int filter_type,
+            double ripple, int num_channels) throws BrainFlowError
+    {
+        int[] filter_id = new int[1];
+        int ec = instance.create_highpass_filter (sampling_rate, cutoff, order, filter_type, ripple, num_channels,
+                filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create filter", ec);
+        }
+        return filter_id[0];
+    }
+
+    /**
+     * create stateful highpass filter, it keeps history between calls of process_filter
+     *
+     * @return filter id
+     */
+    public static int create_highpass_filter (int sampling_rate, double cutoff, int order, FilterTypes filter_type,
+            double ripple, int num_channels) throws BrainFlowError
+    {
+        return create_highpass_filter (sampling_rate, cutoff, order, filter_type.get_code (), ripple, num_channels);
+    }
+
+    /**
+     * create stateful bandpass filter, it keeps history between calls of process_filter
+     *
+     * @return filter id
+     */
+    public static int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order,
+            int filter_type, double ripple, int num_channels) throws BrainFlowError
+    {
+        int[] filter_id = new int[1];
+        int ec = instance.create_bandpass_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple,
+                num_channels, filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create filter", ec);
+        }
+        return filter_id[0];
+    }
+
+    /**
+     * create stateful bandpass filter, it keeps history between calls of process_filter
+     *
+     * @return filter id
+     */
+    public static int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order,
+            FilterTypes filter_type, double ripple, int num_channels) throws BrainFlowError
+    {
+        return create_bandpass_filter (sampling_rate, start_freq, stop_freq, order, filter_type.get_code (), ripple,
+                num_channels);
+    }
+
+    /**
+     * create stateful bandstop filter, it keeps history between calls of process_filter
+     *
+     * @return filter id
+     */
+    public static int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order,
+            int filter_type, double ripple, int num_channels) throws BrainFlowError
+    {
+        int[] filter_id = new int[1];
+        int ec = instance.create_bandstop_filter (sampling_rate, start_freq, stop_freq, order, filter_type, ripple,
+                num_channels, filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create filter", ec);
+        }
+        return filter_id[0];
+    }
+
+    /**
+     * create stateful bandstop filter, it keeps history between calls of process_filter
+     *
+     * @return filter id
+     */
+    public static int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order,
+            FilterTypes filter_type, double ripple, int num_channels) throws BrainFlowError
+    {
+        return create_bandstop_filter (sampling_rate, start_freq, stop_freq, order, filter_type.get_code (), ripple,
+                num_channels);
+    }
+
+    /**
+     * create stateful notch filter to remove env noise
+     *
+     * @return filter id
+     */
+    public static int create_environmental_noise_filter (int sampling_rate, int noise_type, int num_channels)
+            throws BrainFlowError
+    {
+        int[] filter_id = new int[1];
+        int ec = instance.create_environmental_noise_filter (sampling_rate, noise_type, num_channels, filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create filter", ec);
+        }
+        return filter_id[0];
+    }
+
+    /**
+     * create stateful notch filter to remove env noise
+     *
+     * @return filter id
+     */
+    public static int create_environmental_noise_filter (int sampling_rate, NoiseTypes noise_type, int num_channels)
+            throws BrainFlowError
+    {
+        return create_environmental_noise_filter (sampling_rate, noise_type.get_code (), num_channels);
+    }
+
+    /**
+     * filter next chunk of a channel in-place, history is kept between calls
+     */
+    public static void process_filter (int filter_id, int channel, double[] data) throws BrainFlowError
+    {
+        int ec = instance.process_filter (filter_id, channel, data, data.length);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to apply filter", ec);
+        }
+    }
+
+    /**
+     * filter next chunk of all channels in-place, rows of data must match channels of filter
+     */
+    public static void process_filter_block (int filter_id, double[][] data) throws BrainFlowError
+    {
+        if ((data == null) || (data.length == 0))
+        {
+            throw new BrainFlowError ("data is empty", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int cols = data[0].length;
+        double[] data_1d = new double[data.length * cols];
+        for (int i = 0; i < data.length; i++)
+        {
+            System.arraycopy (data[i], 0, data_1d, i * cols, cols);
+        }
+        int ec = instance.process_filter_block (filter_id, data_1d, data.length, cols);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to apply filter", ec);
+        }
+        for (int i = 0; i < data.length; i++)
+        {
+            System.arraycopy (data_1d, i * cols, data[i], 0, cols);
+        }
+    }
+
+    /**
+     * clear history of all channels of a filter
+     */
+    public static void reset_filter (int filter_id) throws BrainFlowError
+    {
+        int ec = instance.reset_filter (filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to reset filter", ec);
+        }
+    }
+
+    /**
+     * release filter created by create_*_filter methods
+     */
+    public static void release_filter (int filter_id) throws BrainFlowError
+    {
+        int ec = instance.release_filter (filter_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to release filter", ec);
+        }
+    }
+
     /**
      * perform wavelet based denoising in-place
      */
@@ -609,6 +925,98 @@ public class DataFilter
 
     }
 
+    /**
+     * perform wavelet transform of each row of data
+     *
+     * @return pair of coeffs of each row in the same format as for
+     *         perform_wavelet_transform and lengths for each block, they are the
+     *         same for all rows
+     */
+    public static Pair<double[][], int[]> perform_wavelet_transform_block (double[][] data, int wavelet,
+            int decomposition_level, int extension) throws BrainFlowError
+    {
+        if ((data == null) || (data.length == 0) || (decomposition_level <= 0))
+        {
+            throw new BrainFlowError ("Invalid input params", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int rows = data.length;
+        int cols = data[0].length;
+        double[] data_1d = new double[rows * cols];
+        for (int i = 0; i < rows; i++)
+        {
+            System.arraycopy (data[i], 0, data_1d, i * cols, cols);
+        }
+        int[] lengths = new int[decomposition_level + 1];
+        double[] output_array = new double[rows * (cols + 2 * decomposition_level * (40 + 1))];
+        int ec = instance.perform_wavelet_transform_block (data_1d, rows, cols, wavelet, decomposition_level, extension,
+                output_array, lengths);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to perform wavelet transform", ec);
+        }
+        int total_sum = 0;
+        for (int val : lengths)
+        {
+            total_sum += val;
+        }
+        double[][] coeffs = new double[rows][];
+        for (int i = 0; i < rows; i++)
+        {
+            coeffs[i] = Arrays.copyOfRange (output_array, i * total_sum, (i + 1) * total_sum);
+        }
+        return new MutablePair<double[][], int[]> (coeffs, lengths);
+    }
+
+    /**
+     * perform wavelet transform of each row of data
+     */
+    public static Pair<double[][], int[]> perform_wavelet_transform_block (double[][] data, WaveletTypes wavelet,
+            int decomposition_level, WaveletExtensionTypes extension) throws BrainFlowError
+    {
+        return perform_wavelet_transform_block (data, wavelet.get_code (), decomposition_level,
+                extension.get_code ());
+    }
+
+    /**
+     * perform wavelet based denoising of each row of data in-place
+     */
+    public static void perform_wavelet_denoising_block (double[][] data, int wavelet, int decomposition_level,
+            int wavelet_denoising, int threshold, int extenstion_type, int noise_level) throws BrainFlowError
+    {
+        if ((data == null) || (data.length == 0))
+        {
+            throw new BrainFlowError ("data is empty", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int rows = data.length;
+        int cols = data[0].length;
+        double[] data_1d = new double[rows * cols];
+        for (int i = 0; i < rows; i++)
+        {
+            System.arraycopy (data[i], 0, data_1d, i * cols, cols);
+        }
+        int ec = instance.perform_wavelet_denoising_block (data_1d, rows, cols, wavelet, decomposition_level,
+                wavelet_denoising, threshold, extenstion_type, noise_level);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to perform denoising", ec);
+        }
+        for (int i = 0; i < rows; i++)
+        {
+            System.arraycopy (data_1d, i * cols, data[i], 0, cols);
+        }
+    }
+
+    /**
+     * perform wavelet based denoising of each row of data in-place
+     */
+    public static void perform_wavelet_denoising_block (double[][] data, WaveletTypes wavelet,
+            int decomposition_level, WaveletDenoisingTypes wavelet_denoising, ThresholdTypes threshold,
+            WaveletExtensionTypes extenstion_type, NoiseEstimationLevelTypes noise_level) throws BrainFlowError
+    {
+        perform_wavelet_denoising_block (data, wavelet.get_code (), decomposition_level, wavelet_denoising.get_code (),
+                threshold.get_code (), extenstion_type.get_code (), noise_level.get_code ());
+    }
+
     /**
      * perform inverse wavelet transform
      */
@@ -645,6 +1053,17 @@ public class DataFilter
      * get common spatial filters
      */
     public static Pair<double[][], double[]> get_csp (double[][][] data, double[] labels) throws BrainFlowError
+    {
+        return get_csp (data, labels, 0.0);
+    }
+
+    /**
+     * get common spatial filters with class covariances shrunk towards identity
+     * 
+     * @param shrinkage value in range [0, 1], 0 means no regularization
+     */
+    public static Pair<double[][], double[]> get_csp (double[][][] data, double[] labels, double shrinkage)
+            throws BrainFlowError
     {
         int n_epochs = data.length;
         int n_channels = data[0].length;
@@ -666,8 +1085,8 @@ public class DataFilter
         double[] temp_filters = new double[n_channels * n_channels];
         double[] output_eigenvalues = new double[n_channels];
 
-        int ec = instance.get_csp (temp_data1d, labels, n_epochs, n_channels, n_times, temp_filters,
-                output_eigenvalues);
+        int ec = instance.get_regularized_csp (temp_data1d, labels, n_epochs, n_channels, n_times, shrinkage,
+                temp_filters, output_eigenvalues);
         if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
         {
             throw new BrainFlowError ("Failed to get the CSP filters", ec);
@@ -686,6 +1105,47 @@ public class DataFilter
         return res;
     }
 
+    /**
+     * apply filters from get_csp to data
+     * 
+     * @param filters [n_filters x n_channels] rows of filters returned by get_csp
+     * @param data    [n_channels x n_times] data
+     * @return [n_filters x n_times] filtered data
+     */
+    public static double[][] apply_csp_filters (double[][] filters, double[][] data) throws BrainFlowError
+    {
+        if ((filters == null) || (data == null) || (filters.length == 0) || (data.length == 0)
+                || (filters[0].length != data.length))
+        {
+            throw new BrainFlowError ("Invalid input params", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int n_filters = filters.length;
+        int n_channels = data.length;
+        int n_times = data[0].length;
+        double[] filters_1d = new double[n_filters * n_channels];
+        for (int i = 0; i < n_filters; i++)
+        {
+            System.arraycopy (filters[i], 0, filters_1d, i * n_channels, n_channels);
+        }
+        double[] data_1d = new double[n_channels * n_times];
+        for (int i = 0; i < n_channels; i++)
+        {
+            System.arraycopy (data[i], 0, data_1d, i * n_times, n_times);
+        }
+        double[] output_1d = new double[n_filters * n_times];
+        int ec = instance.apply_csp_filters (filters_1d, n_filters, n_channels, data_1d, n_times, output_1d);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to apply the CSP filters", ec);
+        }
+        double[][] output = new double[n_filters][];
+        for (int i = 0; i < n_filters; i++)
+        {
+            output[i] = Arrays.copyOfRange (output_1d, i * n_times, (i + 1) * n_times);
+        }
+        return output;
+    }
+
     /**
      * perform data windowing
      * 
@@ -716,6 +1176,58 @@ public class DataFilter
         return get_window (window.get_code (), window_len);
     }
 
+    /**
+     * perform data windowing with custom window param
+     * 
+     * @param window     window function
+     * @param window_len lenght of the window function
+     * @param param      alpha for TUKEY and beta for KAISER, ignored by other
+     *                   windows
+     * @return array of the size specified in window_len
+     */
+    public static double[] get_custom_window (int window, int window_len, double param) throws BrainFlowError
+    {
+        double[] window_data = new double[window_len];
+        int ec = instance.get_custom_window (window, window_len, param, window_data);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to perform windowing", ec);
+        }
+        return window_data;
+    }
+
+    /**
+     * perform data windowing with custom window param
+     */
+    public static double[] get_custom_window (WindowOperations window, int window_len, double param)
+            throws BrainFlowError
+    {
+        return get_custom_window (window.get_code (), window_len, param);
+    }
+
+    /**
+     * calculate DPSS tapers for multitaper spectral estimation
+     * 
+     * @param window_len len of each taper
+     * @param nw         time half bandwidth product
+     * @param num_tapers number of tapers, usually 2 * nw - 1
+     * @return tapers in rows with unit energy
+     */
+    public static double[][] get_dpss_tapers (int window_len, double nw, int num_tapers) throws BrainFlowError
+    {
+        if ((window_len < 2) || (num_tapers < 1))
+        {
+            throw new BrainFlowError ("Invalid input params", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        double[] tapers = new double[num_tapers * window_len];
+        int ec = instance.get_dpss_tapers (window_len, nw, num_tapers, tapers);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to get dpss tapers", ec);
+        }
+        return reshape_data_to_2d (num_tapers, window_len, tapers);
+    }
+
     /**
      * perform direct fft
      * 
@@ -806,6 +1318,155 @@ public class DataFilter
         return get_custom_band_powers (data, bands, channels, sampling_rate, apply_filters);
     }
 
+    /**
+     * create stateful band power calculator for the last window_len datapoints
+     *
+     * @return stream id
+     */
+    public static int create_band_power_stream (int sampling_rate, int window_len, int num_channels,
+            boolean apply_filters) throws BrainFlowError
+    {
+        int[] stream_id = new int[1];
+        int filters = (apply_filters) ? 1 : 0;
+        int ec = instance.create_band_power_stream (sampling_rate, window_len, num_channels, filters, stream_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to create band power stream", ec);
+        }
+        return stream_id[0];
+    }
+
+    /**
+     * add new datapoints of channels, number of channels must match the stream
+     */
+    public static void add_band_power_stream_data (int stream_id, double[][] data, int[] channels)
+            throws BrainFlowError
+    {
+        if ((data == null) || (channels == null) || (channels.length == 0))
+        {
+            throw new BrainFlowError ("data or channels are null", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int cols = data[channels[0]].length;
+        double[] data_1d = new double[channels.length * cols];
+        for (int i = 0; i < channels.length; i++)
+        {
+            System.arraycopy (data[channels[i]], 0, data_1d, i * cols, cols);
+        }
+        int ec = instance.add_band_power_stream_data (stream_id, data_1d, channels.length, cols);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to add data to band power stream", ec);
+        }
+    }
+
+    /**
+     * calculate avg and stddev of BandPowers for the last window of band power stream
+     */
+    public static Pair<double[], double[]> get_band_power_stream_powers (int stream_id,
+            List<Pair<Double, Double>> bands) throws BrainFlowError
+    {
+        if ((bands == null) || (bands.size () == 0))
+        {
+            throw new BrainFlowError ("bands are empty", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        double[] avgs = new double[bands.size ()];
+        double[] stddevs = new double[bands.size ()];
+        double[] start_freqs = new double[bands.size ()];
+        double[] stop_freqs = new double[bands.size ()];
+        for (int i = 0; i < bands.size (); i++)
+        {
+            start_freqs[i] = bands.get (i).getKey ();
+            stop_freqs[i] = bands.get (i).getValue ();
+        }
+        int ec = instance.get_band_power_stream_powers (stream_id, start_freqs, stop_freqs, bands.size (), avgs,
+                stddevs);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to get band powers from stream", ec);
+        }
+        return new MutablePair<double[], double[]> (avgs, stddevs);
+    }
+
+    /**
+     * release band power stream
+     */
+    public static void release_band_power_stream (int stream_id) throws BrainFlowError
+    {
+        int ec = instance.release_band_power_stream (stream_id);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to release band power stream", ec);
+        }
+    }
+
+    /**
+     * calculate mindfulness or restfulness score from eeg channels in a single
+     * call, features and model are the same as for MLModel with default classifier
+     * 
+     * @param data          data to process
+     * @param channels      rows of data arrays which should be used in calculation
+     * @param sampling_rate sampling rate
+     * @param metric        MINDFULNESS or RESTFULNESS
+     * @param apply_filters apply bandpass and bandstop filters before calculation
+     * @return metric value
+     */
+    public static double get_eeg_metric (double[][] data, int[] channels, int sampling_rate, int metric,
+            boolean apply_filters) throws BrainFlowError
+    {
+        if ((data == null) || (channels == null) || (channels.length == 0))
+        {
+            throw new BrainFlowError ("data or channels are null", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int cols = data[channels[0]].length;
+        double[] data_1d = new double[channels.length * cols];
+        for (int i = 0; i < channels.length; i++)
+        {
+            System.arraycopy (data[channels[i]], 0, data_1d, i * cols, cols);
+        }
+        double[] output = new double[1];
+        int filters = (apply_filters) ? 1 : 0;
+        int ec = instance.get_eeg_metric (data_1d, channels.length, cols, sampling_rate, metric, filters, output);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to get eeg metric", ec);
+        }
+        return output[0];
+    }
+
+    /**
+     * calculate mindfulness or restfulness score from eeg channels in a single
+     * call, features and model are the same as for MLModel with default classifier
+     */
+    public static double get_eeg_metric (double[][] data, int[] channels, int sampling_rate,
+            BrainFlowMetrics metric, boolean apply_filters) throws BrainFlowError
+    {
+        return get_eeg_metric (data, channels, sampling_rate, metric.get_code (), apply_filters);
+    }
+
+    /**
+     * calculate mindfulness or restfulness score for the last window of band
+     * power stream
+     */
+    public static double get_band_power_stream_metric (int stream_id, int metric) throws BrainFlowError
+    {
+        double[] output = new double[1];
+        int ec = instance.get_band_power_stream_metric (stream_id, metric, output);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to get eeg metric from stream", ec);
+        }
+        return output[0];
+    }
+
+    /**
+     * calculate mindfulness or restfulness score for the last window of band
+     * power stream
+     */
+    public static double get_band_power_stream_metric (int stream_id, BrainFlowMetrics metric) throws BrainFlowError
+    {
+        return get_band_power_stream_metric (stream_id, metric.get_code ());
+    }
+
     /**
      * calc average and stddev of band powers across all channels
      * 
@@ -922,6 +1583,89 @@ public class DataFilter
         return res;
     }
 
+    /**
+     * calculates ICA with custom convergence settings
+     * 
+     * @param data
+     * @param num_components
+     * @param channels
+     * @param max_iterations max number of iterations
+     * @param tolerance      convergence tolerance
+     * @return
+     * @throws BrainFlowError
+     */
+    public static List<double[][]> perform_custom_ica (double[][] data, int num_components, int[] channels,
+            int max_iterations, double tolerance) throws BrainFlowError
+    {
+        return perform_custom_ica (data, num_components, channels, max_iterations, tolerance, null, false);
+    }
+
+    /**
+     * calculates ICA with custom convergence settings
+     * 
+     * @param data
+     * @param num_components
+     * @param channels
+     * @param max_iterations max number of iterations
+     * @param tolerance      convergence tolerance
+     * @param w_init         num_components x num_components unmixing matrix to start
+     *                       from, null for random
+     * @param use_float32    compute in single precision
+     * @return
+     * @throws BrainFlowError
+     */
+    public static List<double[][]> perform_custom_ica (double[][] data, int num_components, int[] channels,
+            int max_iterations, double tolerance, double[][] w_init, boolean use_float32) throws BrainFlowError
+    {
+        if ((data == null) || (channels == null) || (num_components < 1)
+                || ((w_init != null) && (w_init.length != num_components)))
+        {
+            throw new BrainFlowError ("invalid args for perform_custom_ica",
+                    BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        double[] data_1d = new double[channels.length * data[channels[0]].length];
+        for (int i = 0; i < channels.length; i++)
+        {
+            for (int j = 0; j < data[channels[i]].length; j++)
+            {
+                data_1d[j + i * data[channels[i]].length] = data[channels[i]][j];
+            }
+        }
+        double[] w_init_1d = null;
+        if (w_init != null)
+        {
+            w_init_1d = new double[num_components * num_components];
+            for (int i = 0; i < num_components; i++)
+            {
+                if (w_init[i].length != num_components)
+                {
+                    throw new BrainFlowError ("invalid args for perform_custom_ica",
+                            BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+                }
+                System.arraycopy (w_init[i], 0, w_init_1d, i * num_components, num_components);
+            }
+        }
+        int cols = data[0].length;
+        int channels_len = channels.length;
+        double[] w = new double[num_components * num_components];
+        double[] k = new double[channels_len * num_components];
+        double[] a = new double[num_components * channels_len];
+        double[] s = new double[cols * num_components];
+
+        int ec = instance.perform_custom_ica (data_1d, channels.length, data[channels[0]].length, num_components,
+                max_iterations, tolerance, w_init_1d, use_float32 ? 1 : 0, w, k, a, s);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to perform_custom_ica", ec);
+        }
+        List<double[][]> res = new ArrayList<double[][]> ();
+        res.add (reshape_data_to_2d (num_components, num_components, w));
+        res.add (reshape_data_to_2d (num_components, channels_len, k));
+        res.add (reshape_data_to_2d (channels_len, num_components, a));
+        res.add (reshape_data_to_2d (num_components, cols, s));
+        return res;
+    }
+
     /**
      * get PSD
      * 
@@ -975,6 +1719,33 @@ public class DataFilter
         return get_psd (data, start_pos, end_pos, sampling_rate, window.get_code ());
     }
 
+    /**
+     * get multitaper PSD, average of PSDs with DPSS tapers
+     * 
+     * @param data          data to process, len must be even
+     * @param sampling_rate sampling rate
+     * @param nw            time half bandwidth product
+     * @param num_tapers    number of tapers, usually 2 * nw - 1
+     * @return pair of ampl and freq arrays with len N / 2 + 1
+     */
+    public static Pair<double[], double[]> get_psd_multitaper (double[] data, int sampling_rate, double nw,
+            int num_tapers) throws BrainFlowError
+    {
+        if (data.length % 2 == 1)
+        {
+            throw new BrainFlowError ("data len must be even", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        double[] ampls = new double[data.length / 2 + 1];
+        double[] freqs = new double[data.length / 2 + 1];
+        int ec = instance.get_psd_multitaper (data, data.length, sampling_rate, nw, num_tapers, ampls, freqs);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Failed to get psd", ec);
+        }
+        Pair<double[], double[]> res = new MutablePair<double[], double[]> (ampls, freqs);
+        return res;
+    }
+
     /**
      * get PSD using Welch Method
      * 
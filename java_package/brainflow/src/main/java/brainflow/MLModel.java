@@ -4,12 +4,16 @@ import java.io.File;
 import java.io.InputStream;
 import java.nio.file.Files;
 import java.nio.file.Path;
+import java.util.ArrayList;
 import java.util.Arrays;
+import java.util.List;
 
 import org.apache.commons.lang3.SystemUtils;
 
 import com.sun.jna.Library;
 import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+import com.sun.jna.ptr.PointerByReference;
 
 @SuppressWarnings ("deprecation")
 public class MLModel
@@ -29,6 +33,24 @@ public class MLModel
 
         int predict (double[] data, int data_len, double[] output, int[] output_len, String params);
 
+        int predict_batch (double[] data, int batch_size, int data_len, double[] output, int[] output_len,
+                String params);
+
+        int predict_multi (double[] data, int batch_size, int[] input_lens, int num_inputs, double[] output,
+                int[] output_lens, int num_outputs, String params);
+
+        int predict_multi_float32 (float[] data, int batch_size, int[] input_lens, int num_inputs, double[] output,
+                int[] output_lens, int num_outputs, String params);
+
+        int prepare_with_handle (String params, PointerByReference handle);
+
+        int predict_with_handle (Pointer handle, double[] data, int data_len, double[] output, int[] output_len);
+
+        int predict_batch_with_handle (Pointer handle, double[] data, int batch_size, int data_len, double[] output,
+                int[] output_len);
+
+        int release_with_handle (Pointer handle);
+
         int release_all ();
 
         int get_version_ml_module (byte[] version, int[] len, int max_len);
@@ -100,6 +122,9 @@ public class MLModel
 
     private BrainFlowModelParams params;
 
+    // set by prepare, predict methods skip params lookup if it is not null
+    private Pointer handle = null;
+
     /**
      * Create MLModel object
      */
@@ -212,11 +237,13 @@ public class MLModel
      */
     public void prepare () throws BrainFlowError
     {
-        int ec = instance.prepare (input_params);
+        PointerByReference handle_ref = new PointerByReference ();
+        int ec = instance.prepare_with_handle (input_params, handle_ref);
         if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
         {
             throw new BrainFlowError ("Error in prepare", ec);
         }
+        handle = handle_ref.getValue ();
     }
 
     /**
@@ -226,7 +253,15 @@ public class MLModel
      */
     public void release () throws BrainFlowError
     {
-        int ec = instance.release (input_params);
+        int ec = BrainFlowExitCode.STATUS_OK.get_code ();
+        if (handle != null)
+        {
+            ec = instance.release_with_handle (handle);
+            handle = null;
+        } else
+        {
+            ec = instance.release (input_params);
+        }
         if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
         {
             throw new BrainFlowError ("Error in release", ec);
@@ -242,11 +277,178 @@ public class MLModel
     {
         double[] val = new double[params.max_array_size];
         int[] val_len = new int[1];
-        int ec = instance.predict (data, data.length, val, val_len, input_params);
+        int ec = (handle != null) ? instance.predict_with_handle (handle, data, data.length, val, val_len)
+                : instance.predict (data, data.length, val, val_len, input_params);
         if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
         {
             throw new BrainFlowError ("Error in predict", ec);
         }
         return Arrays.copyOfRange (val, 0, val_len[0]);
     }
+
+    /**
+     * calculate metric for each row of data in a single call
+     * 
+     * @param data rows of input data, all rows must have the same length
+     * @return rows of output match rows of data
+     */
+    public double[][] predict_batch (double[][] data) throws BrainFlowError
+    {
+        if ((data == null) || (data.length == 0))
+        {
+            throw new BrainFlowError ("data is empty", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int batch_size = data.length;
+        int data_len = data[0].length;
+        double[] data_1d = new double[batch_size * data_len];
+        for (int i = 0; i < batch_size; i++)
+        {
+            if (data[i].length != data_len)
+            {
+                throw new BrainFlowError ("rows of data must have the same length",
+                        BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+            }
+            System.arraycopy (data[i], 0, data_1d, i * data_len, data_len);
+        }
+        double[] val = new double[batch_size * params.max_array_size];
+        int[] val_len = new int[1];
+        int ec = (handle != null)
+                ? instance.predict_batch_with_handle (handle, data_1d, batch_size, data_len, val, val_len)
+                : instance.predict_batch (data_1d, batch_size, data_len, val, val_len, input_params);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Error in predict_batch", ec);
+        }
+        int output_len = val_len[0] / batch_size;
+        double[][] output = new double[batch_size][];
+        for (int i = 0; i < batch_size; i++)
+        {
+            output[i] = Arrays.copyOfRange (val, i * output_len, (i + 1) * output_len);
+        }
+        return output;
+    }
+
+    /**
+     * calculate metric for model with several inputs and outputs
+     * 
+     * @param inputs      batch_size x input_len arrays in model order
+     * @param num_outputs number of model outputs
+     * @return batch_size x output_len array per output
+     */
+    public List<double[][]> predict_multi (double[][][] inputs, int num_outputs) throws BrainFlowError
+    {
+        int[] input_lens = get_input_lens (inputs);
+        int batch_size = inputs[0].length;
+        double[] data = new double[batch_size * Arrays.stream (input_lens).sum ()];
+        int offset = 0;
+        for (double[][] input : inputs)
+        {
+            for (double[] row : input)
+            {
+                System.arraycopy (row, 0, data, offset, row.length);
+                offset += row.length;
+            }
+        }
+        double[] val = new double[batch_size * params.max_array_size];
+        int[] output_lens = new int[num_outputs];
+        int ec = instance.predict_multi (data, batch_size, input_lens, inputs.length, val, output_lens, num_outputs,
+                input_params);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Error in predict_multi", ec);
+        }
+        return unpack_outputs (val, output_lens, batch_size);
+    }
+
+    /**
+     * calculate metric for model with several inputs and a single output
+     */
+    public List<double[][]> predict_multi (double[][][] inputs) throws BrainFlowError
+    {
+        return predict_multi (inputs, 1);
+    }
+
+    /**
+     * the same for float32 inputs, float models use them without conversion
+     */
+    public List<double[][]> predict_multi (float[][][] inputs, int num_outputs) throws BrainFlowError
+    {
+        int[] input_lens = get_input_lens (inputs);
+        int batch_size = inputs[0].length;
+        float[] data = new float[batch_size * Arrays.stream (input_lens).sum ()];
+        int offset = 0;
+        for (float[][] input : inputs)
+        {
+            for (float[] row : input)
+            {
+                System.arraycopy (row, 0, data, offset, row.length);
+                offset += row.length;
+            }
+        }
+        double[] val = new double[batch_size * params.max_array_size];
+        int[] output_lens = new int[num_outputs];
+        int ec = instance.predict_multi_float32 (data, batch_size, input_lens, inputs.length, val, output_lens,
+                num_outputs, input_params);
+        if (ec != BrainFlowExitCode.STATUS_OK.get_code ())
+        {
+            throw new BrainFlowError ("Error in predict_multi", ec);
+        }
+        return unpack_outputs (val, output_lens, batch_size);
+    }
+
+    /**
+     * the same for float32 inputs with a single output
+     */
+    public List<double[][]> predict_multi (float[][][] inputs) throws BrainFlowError
+    {
+        return predict_multi (inputs, 1);
+    }
+
+    // all inputs must be non empty with the same batch size and rows of the same length
+    private static int[] get_input_lens (Object[] inputs) throws BrainFlowError
+    {
+        if ((inputs == null) || (inputs.length == 0))
+        {
+            throw new BrainFlowError ("inputs are empty", BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+        }
+        int[] input_lens = new int[inputs.length];
+        int batch_size = ((Object[]) inputs[0]).length;
+        for (int i = 0; i < inputs.length; i++)
+        {
+            Object[] rows = (Object[]) inputs[i];
+            if ((rows.length == 0) || (rows.length != batch_size))
+            {
+                throw new BrainFlowError ("inputs must have the same batch size",
+                        BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+            }
+            input_lens[i] = java.lang.reflect.Array.getLength (rows[0]);
+            for (Object row : rows)
+            {
+                if (java.lang.reflect.Array.getLength (row) != input_lens[i])
+                {
+                    throw new BrainFlowError ("rows of input must have the same length",
+                            BrainFlowExitCode.INVALID_ARGUMENTS_ERROR.get_code ());
+                }
+            }
+        }
+        return input_lens;
+    }
+
+    private static List<double[][]> unpack_outputs (double[] val, int[] output_lens, int batch_size)
+    {
+        List<double[][]> result = new ArrayList<double[][]> ();
+        int offset = 0;
+        for (int len : output_lens)
+        {
+            int output_len = len / batch_size;
+            double[][] output = new double[batch_size][];
+            for (int i = 0; i < batch_size; i++)
+            {
+                output[i] = Arrays.copyOfRange (val, offset + i * output_len, offset + (i + 1) * output_len);
+            }
+            result.add (output);
+            offset += len;
+        }
+        return result;
+    }
 }
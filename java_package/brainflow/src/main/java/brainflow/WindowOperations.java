@@ -9,7 +9,10 @@ public enum WindowOperations
     NO_WINDOW (0),
     HANNING (1),
     HAMMING (2),
-    BLACKMAN_HARRIS (3);
+    BLACKMAN_HARRIS (3),
+    TUKEY (4),
+    KAISER (5),
+    FLAT_TOP (6);
 
     private final int window;
     private static final Map<Integer, WindowOperations> window_map = new HashMap<Integer, WindowOperations> ();
@@ -278,6 +278,16 @@ end
             streamer_params, Int32(preset), board_shim.board_id, board_shim.input_json)
 end
 
+@brainflow_rethrow function get_streamer_stats(streamer_params::String, board_shim::BoardShim, preset::PresetType=Integer(DEFAULT_PRESET))
+    stats_string = Vector{Cuchar}(undef, 8192)
+    len = Vector{Cint}(undef, 1)
+    ccall((:get_streamer_stats, BOARD_CONTROLLER_INTERFACE), Cint, (Ptr{UInt8}, Cint, Ptr{UInt8}, Ptr{Cint}, Cint, Ptr{UInt8}),
+            streamer_params, Int32(preset), stats_string, len, board_shim.board_id, board_shim.input_json)
+    sub_string = String(stats_string)[1:len[1]]
+    value = JSON.parse(sub_string)
+    return value
+end
+
 @brainflow_rethrow function config_board(config::String, board_shim::BoardShim)
     resp_string = Vector{Cuchar}(undef, 4096)
     len = Vector{Cint}(undef, 1)
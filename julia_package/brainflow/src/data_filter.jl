@@ -3,6 +3,10 @@
     MEAN = 0
     MEDIAN = 1
     EACH = 2
+    STDDEV = 3
+    MIN = 4
+    MAX = 5
+    RMS = 6
 
 end
 
@@ -24,6 +28,9 @@ FiltType = Union{FilterTypes, Integer}
     HANNING = 1
     HAMMING = 2
     BLACKMAN_HARRIS = 3
+    TUKEY = 4
+    KAISER = 5
+    FLAT_TOP = 6
 
 end
 
@@ -173,6 +180,72 @@ end
     return
 end
 
+@brainflow_rethrow function create_lowpass_filter(sampling_rate::Integer, cutoff::Float64, order::Integer,
+    filter_type::FiltType, ripple::Float64, num_channels::Integer=1)
+    filter_id = Vector{Cint}(undef, 1)
+    ccall((:create_lowpass_filter, DATA_HANDLER_INTERFACE), Cint, (Cint, Float64, Cint, Cint, Float64, Cint, Ptr{Cint}),
+            Int32(sampling_rate), Float64(cutoff), Int32(order), Int32(filter_type), Float64(ripple), Int32(num_channels), filter_id)
+    return filter_id[1]
+end
+
+@brainflow_rethrow function create_highpass_filter(sampling_rate::Integer, cutoff::Float64, order::Integer,
+    filter_type::FiltType, ripple::Float64, num_channels::Integer=1)
+    filter_id = Vector{Cint}(undef, 1)
+    ccall((:create_highpass_filter, DATA_HANDLER_INTERFACE), Cint, (Cint, Float64, Cint, Cint, Float64, Cint, Ptr{Cint}),
+            Int32(sampling_rate), Float64(cutoff), Int32(order), Int32(filter_type), Float64(ripple), Int32(num_channels), filter_id)
+    return filter_id[1]
+end
+
+@brainflow_rethrow function create_bandpass_filter(sampling_rate::Integer, start_freq::Float64, stop_freq::Float64,
+    order::Integer, filter_type::FiltType, ripple::Float64, num_channels::Integer=1)
+    filter_id = Vector{Cint}(undef, 1)
+    ccall((:create_bandpass_filter, DATA_HANDLER_INTERFACE), Cint, (Cint, Float64, Float64, Cint, Cint, Float64, Cint, Ptr{Cint}),
+            Int32(sampling_rate), Float64(start_freq), Float64(stop_freq), Int32(order), Int32(filter_type), Float64(ripple),
+            Int32(num_channels), filter_id)
+    return filter_id[1]
+end
+
+@brainflow_rethrow function create_bandstop_filter(sampling_rate::Integer, start_freq::Float64, stop_freq::Float64,
+    order::Integer, filter_type::FiltType, ripple::Float64, num_channels::Integer=1)
+    filter_id = Vector{Cint}(undef, 1)
+    ccall((:create_bandstop_filter, DATA_HANDLER_INTERFACE), Cint, (Cint, Float64, Float64, Cint, Cint, Float64, Cint, Ptr{Cint}),
+            Int32(sampling_rate), Float64(start_freq), Float64(stop_freq), Int32(order), Int32(filter_type), Float64(ripple),
+            Int32(num_channels), filter_id)
+    return filter_id[1]
+end
+
+@brainflow_rethrow function create_environmental_noise_filter(sampling_rate::Integer, noise_type::EnvNoiseType, num_channels::Integer=1)
+    filter_id = Vector{Cint}(undef, 1)
+    ccall((:create_environmental_noise_filter, DATA_HANDLER_INTERFACE), Cint, (Cint, Cint, Cint, Ptr{Cint}),
+            Int32(sampling_rate), Int32(noise_type), Int32(num_channels), filter_id)
+    return filter_id[1]
+end
+
+@brainflow_rethrow function process_filter(filter_id::Integer, channel::Integer, data)
+    ccall((:process_filter, DATA_HANDLER_INTERFACE), Cint, (Cint, Cint, Ptr{Float64}, Cint),
+            Int32(filter_id), Int32(channel), data, length(data))
+    return
+end
+
+@brainflow_rethrow function process_filter_block(filter_id::Integer, data)
+    shape = size(data)
+    data_1d = copy(reshape(transpose(data), (1, shape[1] * shape[2])))
+    ccall((:process_filter_block, DATA_HANDLER_INTERFACE), Cint, (Cint, Ptr{Float64}, Cint, Cint),
+            Int32(filter_id), data_1d, shape[1], shape[2])
+    data .= transpose(reshape(data_1d, (shape[2], shape[1])))
+    return
+end
+
+@brainflow_rethrow function reset_filter(filter_id::Integer)
+    ccall((:reset_filter, DATA_HANDLER_INTERFACE), Cint, (Cint,), Int32(filter_id))
+    return
+end
+
+@brainflow_rethrow function release_filter(filter_id::Integer)
+    ccall((:release_filter, DATA_HANDLER_INTERFACE), Cint, (Cint,), Int32(filter_id))
+    return
+end
+
 @brainflow_rethrow function perform_rolling_filter(data, period::Integer, operation::AggType)
     ccall((:perform_rolling_filter, DATA_HANDLER_INTERFACE), Cint, (Ptr{Float64}, Cint, Cint, Cint),
             data, length(data), Int32(period), Int32(operation))
@@ -203,6 +276,25 @@ end
     return peaks
 end
 
+@brainflow_rethrow function create_z_score_peak_detector(lag::Integer, threshold::Float64, influence::Float64)
+    detector_id = Vector{Cint}(undef, 1)
+    ccall((:create_z_score_peak_detector, DATA_HANDLER_INTERFACE), Cint, (Cint, Float64, Float64, Ptr{Cint}),
+            Int32(lag), threshold, influence, detector_id)
+    return detector_id[1]
+end
+
+@brainflow_rethrow function process_z_score_peak_detector(detector_id::Integer, data)
+    peaks = Vector{Float64}(undef, length(data))
+    ccall((:process_z_score_peak_detector, DATA_HANDLER_INTERFACE), Cint, (Cint, Ptr{Float64}, Cint, Ptr{Float64}),
+            Int32(detector_id), data, length(data), peaks)
+    return peaks
+end
+
+@brainflow_rethrow function release_z_score_peak_detector(detector_id::Integer)
+    ccall((:release_z_score_peak_detector, DATA_HANDLER_INTERFACE), Cint, (Cint,), Int32(detector_id))
+    return
+end
+
 @brainflow_rethrow function perform_wavelet_denoising(data, wavelet::WaveletType, decomposition_level::Integer,
                                                       wavelet_denoising::WaveletDenoisingType,
                                                       threshold::ThresholdType,
@@ -214,6 +306,20 @@ end
     return
 end
 
+@brainflow_rethrow function perform_wavelet_denoising_block(data, wavelet::WaveletType, decomposition_level::Integer,
+                                                            wavelet_denoising::WaveletDenoisingType,
+                                                            threshold::ThresholdType,
+                                                            extension::WaveletExtensionType,
+                                                            noise_level::NoiseEstimationLevelType)
+    shape = size(data)
+    data_1d = copy(reshape(transpose(data), (1, shape[1] * shape[2])))
+    ccall((:perform_wavelet_denoising_block, DATA_HANDLER_INTERFACE), Cint, (Ptr{Float64}, Cint, Cint, Cint, Cint, Cint, Cint, Cint, Cint),
+            data_1d, shape[1], shape[2], Int32(wavelet), Int32(decomposition_level), Int32(wavelet_denoising),
+            Int32(threshold), Int32(extension), Int32(noise_level))
+    data .= transpose(reshape(data_1d, (shape[2], shape[1])))
+    return
+end
+
 @brainflow_rethrow function perform_downsampling(data, period::Integer, operation::AggType)
     len = Integer(floor(length(data) / period))
     downsampled_data = Vector{Float64}(undef, len)
@@ -301,6 +407,17 @@ end
     return wavelet_coeffs[1:sum(lengths)], lengths
 end
 
+@brainflow_rethrow function perform_wavelet_transform_block(data, wavelet::WaveletType, decomposition_level::Integer, extension::WaveletExtensionType)
+    shape = size(data)
+    data_1d = copy(reshape(transpose(data), (1, shape[1] * shape[2])))
+    wavelet_coeffs = Vector{Float64}(undef, shape[1] * (shape[2] + 2 * decomposition_level * (40 + 1)))
+    lengths = Vector{Cint}(undef, decomposition_level + 1)
+    ccall((:perform_wavelet_transform_block, DATA_HANDLER_INTERFACE), Cint, (Ptr{Float64}, Cint, Cint, Cint, Cint, Cint, Ptr{Float64}, Ptr{Cint}),
+            data_1d, shape[1], shape[2], Int32(wavelet), Int32(decomposition_level), Int32(extension), wavelet_coeffs, lengths)
+    total_length = sum(lengths)
+    return transpose(reshape(wavelet_coeffs[1:shape[1] * total_length], (total_length, shape[1]))), lengths
+end
+
 
 @brainflow_rethrow function perform_inverse_wavelet_transform(wavelet_output, original_data_len::Integer, wavelet::WaveletType, decomposition_level::Integer, extension::WaveletExtensionType)
     original_data = Vector{Float64}(undef, original_data_len)
@@ -309,7 +426,7 @@ end
     return original_data
 end
 
-@brainflow_rethrow function get_csp(data, labels)
+@brainflow_rethrow function get_csp(data, labels, shrinkage::Real=0.0)
     n_epochs = size(data, 1)
     n_channels = size(data, 2)
     n_times = size(data, 3)
@@ -326,7 +443,7 @@ end
     temp_filters = Vector{Float64}(undef, Integer(n_channels * n_channels))
     output_eigenvalues = Vector{Float64}(undef, Integer(n_channels))
 
-    ccall((:get_csp, DATA_HANDLER_INTERFACE), Cint, (Ptr{Float64}, Ptr{Float64}, Cint, Cint, Cint, Ptr{Float64}, Ptr{Float64}), temp_data1d, labels, Int32(n_epochs), Int32(n_channels), Int32(n_times), temp_filters, output_eigenvalues)
+    ccall((:get_regularized_csp, DATA_HANDLER_INTERFACE), Cint, (Ptr{Float64}, Ptr{Float64}, Cint, Cint, Cint, Float64, Ptr{Float64}, Ptr{Float64}), temp_data1d, labels, Int32(n_epochs), Int32(n_channels), Int32(n_times), Float64(shrinkage), temp_filters, output_eigenvalues)
 
     output_filters = Array{Float64,2}(undef, n_channels, n_channels)
     for i=1:n_channels
@@ -337,6 +454,18 @@ end
     return output_filters, output_eigenvalues
 end
 
+@brainflow_rethrow function apply_csp_filters(filters, data)
+    n_filters = size(filters, 1)
+    n_channels = size(filters, 2)
+    n_times = size(data, 2)
+    filters_1d = copy(reshape(transpose(filters), (1, n_filters * n_channels)))
+    data_1d = copy(reshape(transpose(data), (1, n_channels * n_times)))
+    output = Vector{Float64}(undef, Integer(n_filters * n_times))
+    ccall((:apply_csp_filters, DATA_HANDLER_INTERFACE), Cint, (Ptr{Float64}, Cint, Cint, Ptr{Float64}, Cint, Ptr{Float64}),
+            filters_1d, Int32(n_filters), Int32(n_channels), data_1d, Int32(n_times), output)
+    return transpose(reshape(output, (n_times, n_filters)))
+end
+
 @brainflow_rethrow function get_window(window_function::WinType, window_len::Integer)
     window_data = Vector{Float64}(undef, Integer(window_len))
     ccall((:get_window, DATA_HANDLER_INTERFACE), Cint, (Cint, Cint, Ptr{Float64}),
@@ -344,6 +473,20 @@ end
     return window_data
 end
 
+@brainflow_rethrow function get_custom_window(window_function::WinType, window_len::Integer, param::Real)
+    window_data = Vector{Float64}(undef, Integer(window_len))
+    ccall((:get_custom_window, DATA_HANDLER_INTERFACE), Cint, (Cint, Cint, Float64, Ptr{Float64}),
+    Int32(window_function), Int32(window_len), Float64(param), window_data)
+    return window_data
+end
+
+@brainflow_rethrow function get_dpss_tapers(window_len::Integer, nw::Real, num_tapers::Integer)
+    tapers = Vector{Float64}(undef, Integer(num_tapers * window_len))
+    ccall((:get_dpss_tapers, DATA_HANDLER_INTERFACE), Cint, (Cint, Float64, Cint, Ptr{Float64}),
+    Int32(window_len), Float64(nw), Int32(num_tapers), tapers)
+    return transpose(reshape(tapers, (window_len, num_tapers)))
+end
+
 @brainflow_rethrow function perform_fft(data, window::WinType)
 
     if (length(data) % 2 == 1)
@@ -400,6 +543,57 @@ end
     return temp_avgs, temp_stddevs
 end
 
+@brainflow_rethrow function create_band_power_stream(sampling_rate::Integer, window_len::Integer, num_channels::Integer, apply_filter::Bool)
+    stream_id = Vector{Cint}(undef, 1)
+    ccall((:create_band_power_stream, DATA_HANDLER_INTERFACE), Cint, (Cint, Cint, Cint, Cint, Ptr{Cint}),
+            Int32(sampling_rate), Int32(window_len), Int32(num_channels), Int32(apply_filter), stream_id)
+    return stream_id[1]
+end
+
+@brainflow_rethrow function add_band_power_stream_data(stream_id::Integer, data, channels)
+    shape = size(data)
+    data_1d = reshape(transpose(data[channels,:]), (1, size(channels)[1] * shape[2]))
+    data_1d = copy(data_1d)
+    ccall((:add_band_power_stream_data, DATA_HANDLER_INTERFACE), Cint, (Cint, Ptr{Float64}, Cint, Cint),
+            Int32(stream_id), data_1d, size(channels)[1], shape[2])
+    return
+end
+
+@brainflow_rethrow function get_band_power_stream_powers(stream_id::Integer, bands)
+    start_freqs = [first(p) for p in bands]
+    stop_freqs = [last(p) for p in bands]
+
+    temp_avgs = Vector{Float64}(undef, length(start_freqs))
+    temp_stddevs = Vector{Float64}(undef, length(start_freqs))
+
+    ccall((:get_band_power_stream_powers, DATA_HANDLER_INTERFACE), Cint, (Cint, Ptr{Float64}, Ptr{Float64}, Cint, Ptr{Float64}, Ptr{Float64}),
+            Int32(stream_id), start_freqs, stop_freqs, length(start_freqs), temp_avgs, temp_stddevs)
+    return temp_avgs, temp_stddevs
+end
+
+@brainflow_rethrow function release_band_power_stream(stream_id::Integer)
+    ccall((:release_band_power_stream, DATA_HANDLER_INTERFACE), Cint, (Cint,), Int32(stream_id))
+    return
+end
+
+# metric is BrainFlowMetrics or Integer, MetricType is declared in ml_model.jl
+@brainflow_rethrow function get_eeg_metric(data, channels, sampling_rate::Integer, metric, apply_filter::Bool)
+    shape = size(data)
+    data_1d = reshape(transpose(data[channels,:]), (1, size(channels)[1] * shape[2]))
+    data_1d = copy(data_1d)
+    output = Vector{Float64}(undef, 1)
+    ccall((:get_eeg_metric, DATA_HANDLER_INTERFACE), Cint, (Ptr{Float64}, Cint, Cint, Cint, Cint, Cint, Ptr{Float64}),
+            data_1d, size(channels)[1], shape[2], Int32(sampling_rate), Int32(metric), Int32(apply_filter), output)
+    return output[1]
+end
+
+@brainflow_rethrow function get_band_power_stream_metric(stream_id::Integer, metric)
+    output = Vector{Float64}(undef, 1)
+    ccall((:get_band_power_stream_metric, DATA_HANDLER_INTERFACE), Cint, (Cint, Cint, Ptr{Float64}),
+            Int32(stream_id), Int32(metric), output)
+    return output[1]
+end
+
 @brainflow_rethrow function perform_ica_select_channels(data, num_components::Integer, channels)
     shape = size(data)
     data_1d = reshape(transpose(data[channels,:]), (1, size(channels)[1] * shape[2]))
@@ -424,6 +618,27 @@ function perform_ica(data, num_components::Integer)
     return perform_ica_select_channels(data, num_components, channels)
 end
 
+@brainflow_rethrow function perform_custom_ica(data, num_components::Integer, channels, max_iterations::Integer=300,
+                                               tolerance::Real=0.0001, w_init=nothing, use_float32::Bool=false)
+    shape = size(data)
+    data_1d = copy(reshape(transpose(data[channels,:]), (1, length(channels) * shape[2])))
+    w_init_1d = isnothing(w_init) ? C_NULL : copy(reshape(transpose(w_init), (1, num_components * num_components)))
+
+    temp_w = Vector{Float64}(undef, num_components * num_components)
+    temp_k = Vector{Float64}(undef, length(channels) * num_components)
+    temp_a = Vector{Float64}(undef, num_components * length(channels))
+    temp_s = Vector{Float64}(undef, num_components * shape[2])
+
+    ccall((:perform_custom_ica, DATA_HANDLER_INTERFACE), Cint, (Ptr{Float64}, Cint, Cint, Cint, Cint, Float64, Ptr{Float64}, Cint, Ptr{Float64}, Ptr{Float64}, Ptr{Float64}, Ptr{Float64}),
+            data_1d, length(channels), shape[2], Int32(num_components), Int32(max_iterations), Float64(tolerance), w_init_1d,
+            Int32(use_float32), temp_w, temp_k, temp_a, temp_s)
+    w = transpose(reshape(temp_w, (num_components, num_components)))
+    k = transpose(reshape(temp_k, (length(channels), num_components)))
+    a = transpose(reshape(temp_a, (num_components, length(channels))))
+    s = transpose(reshape(temp_s, (shape[2], num_components)))
+    return w, k, a, s
+end
+
 @brainflow_rethrow function get_psd(data, sampling_rate::Integer, window::WinType)
 
     if (length(data) % 2 == 1)
@@ -438,6 +653,20 @@ end
     return temp_ampls, temp_freqs
 end
 
+@brainflow_rethrow function get_psd_multitaper(data, sampling_rate::Integer, nw::Real, num_tapers::Integer)
+
+    if (length(data) % 2 == 1)
+        throw(BrainFlowError(string("Data Len must be even ", INVALID_ARGUMENTS_ERROR), Integer(INVALID_ARGUMENTS_ERROR)))
+    end
+
+    temp_ampls = Vector{Float64}(undef, Integer(length(data) / 2) + 1)
+    temp_freqs = Vector{Float64}(undef, Integer(length(data) / 2) + 1)
+
+    ccall((:get_psd_multitaper, DATA_HANDLER_INTERFACE), Cint, (Ptr{Float64}, Cint, Cint, Float64, Cint, Ptr{Float64}, Ptr{Float64}),
+            data, length(data), Int32(sampling_rate), Float64(nw), Int32(num_tapers), temp_ampls, temp_freqs)
+    return temp_ampls, temp_freqs
+end
+
 @brainflow_rethrow function get_psd_welch(data, nfft::Integer, overlap::Integer, sampling_rate::Integer, window::WinType)
 
     if (length(data) % 2 == 1)
@@ -28,9 +28,14 @@ mutable struct BrainFlowModelParams
     other_info::String
     output_name::String
     max_array_size::Int32
+    intra_op_num_threads::Int32
+    inter_op_num_threads::Int32
+    graph_optimization_level::Int32
+    use_global_thread_pool::Bool
+    optimized_model_file::String
 
     function BrainFlowModelParams(metric_::MetricType, classifier_::ClassifierType)
-        new(metric_, classifier_, "", "", "", 8192)
+        new(metric_, classifier_, "", "", "", 8192, 0, 0, 99, false, "")
     end
 
 end
@@ -43,32 +48,126 @@ function JSON.json(params::BrainFlowModelParams)
         "other_info" => params.other_info,
         "output_name" => params.output_name,
         "max_array_size" => params.max_array_size, 
+        "intra_op_num_threads" => params.intra_op_num_threads,
+        "inter_op_num_threads" => params.inter_op_num_threads,
+        "graph_optimization_level" => params.graph_optimization_level,
+        "use_global_thread_pool" => params.use_global_thread_pool,
+        "optimized_model_file" => params.optimized_model_file,
         )
     return JSON.json(d)
 end
 
+# handles from prepare_with_handle by model params, predict calls skip params lookup if handle exists
+const model_handles = Dict{String, Ptr{Cvoid}}()
+
 @brainflow_rethrow function prepare(params::BrainFlowModelParams)
     input_json = JSON.json(params)
-    ccall((:prepare, ML_MODULE_INTERFACE), Cint, (Ptr{UInt8},), input_json)
+    handle = Ref{Ptr{Cvoid}}(C_NULL)
+    ccall((:prepare_with_handle, ML_MODULE_INTERFACE), Cint, (Ptr{UInt8}, Ptr{Ptr{Cvoid}}), input_json, handle)
+    model_handles[input_json] = handle[]
     return
 end
 
 @brainflow_rethrow function release(params::BrainFlowModelParams)
     input_json = JSON.json(params)
+    if haskey(model_handles, input_json)
+        return release(pop!(model_handles, input_json))
+    end
     ccall((:release, ML_MODULE_INTERFACE), Cint, (Ptr{UInt8},), input_json)
     return
 end
 
+@brainflow_rethrow function release(handle::Ptr{Cvoid})
+    ccall((:release_with_handle, ML_MODULE_INTERFACE), Cint, (Ptr{Cvoid},), handle)
+    return
+end
+
 @brainflow_rethrow function predict(data, params::BrainFlowModelParams)
     input_json = JSON.json(params)
+    if haskey(model_handles, input_json)
+        return predict(data, model_handles[input_json], params)
+    end
     val = Vector{Float64}(undef, params.max_array_size)
-    val_len = Vector{Float64}(undef, 1)
+    val_len = Vector{Cint}(undef, 1)
     ccall((:predict, ML_MODULE_INTERFACE), Cint, (Ptr{Float64}, Cint, Ptr{Float64}, Ptr{Cint}, Ptr{UInt8}),
         data, length(data), val, val_len, input_json)
     value = val[1:val_len[1]]
     return value
 end
 
+@brainflow_rethrow function predict(data, handle::Ptr{Cvoid}, params::BrainFlowModelParams)
+    val = Vector{Float64}(undef, params.max_array_size)
+    val_len = Vector{Cint}(undef, 1)
+    ccall((:predict_with_handle, ML_MODULE_INTERFACE), Cint, (Ptr{Cvoid}, Ptr{Float64}, Cint, Ptr{Float64}, Ptr{Cint}),
+        handle, data, length(data), val, val_len)
+    value = val[1:val_len[1]]
+    return value
+end
+
+@brainflow_rethrow function predict_batch(data, params::BrainFlowModelParams)
+    input_json = JSON.json(params)
+    if haskey(model_handles, input_json)
+        return predict_batch(data, model_handles[input_json], params)
+    end
+    shape = size(data)
+    data_1d = copy(reshape(transpose(data), (1, shape[1] * shape[2])))
+    val = Vector{Float64}(undef, shape[1] * params.max_array_size)
+    val_len = Vector{Cint}(undef, 1)
+    ccall((:predict_batch, ML_MODULE_INTERFACE), Cint, (Ptr{Float64}, Cint, Cint, Ptr{Float64}, Ptr{Cint}, Ptr{UInt8}),
+        data_1d, shape[1], shape[2], val, val_len, input_json)
+    output_len = div(val_len[1], shape[1])
+    value = transpose(reshape(val[1:val_len[1]], (output_len, shape[1])))
+    return value
+end
+
+@brainflow_rethrow function predict_batch(data, handle::Ptr{Cvoid}, params::BrainFlowModelParams)
+    shape = size(data)
+    data_1d = copy(reshape(transpose(data), (1, shape[1] * shape[2])))
+    val = Vector{Float64}(undef, shape[1] * params.max_array_size)
+    val_len = Vector{Cint}(undef, 1)
+    ccall((:predict_batch_with_handle, ML_MODULE_INTERFACE), Cint, (Ptr{Cvoid}, Ptr{Float64}, Cint, Cint, Ptr{Float64}, Ptr{Cint}),
+        handle, data_1d, shape[1], shape[2], val, val_len)
+    output_len = div(val_len[1], shape[1])
+    value = transpose(reshape(val[1:val_len[1]], (output_len, shape[1])))
+    return value
+end
+
+# inputs are batch_size x input_len arrays in model order, returns batch_size x output_len array per output
+@brainflow_rethrow function predict_multi(inputs, params::BrainFlowModelParams, num_outputs::Integer=1)
+    input_json = JSON.json(params)
+    batch_size = size(inputs[1], 1)
+    input_lens = Vector{Cint}([size(input, 2) for input in inputs])
+    data = Vector{Float64}(vcat([vec(transpose(input)) for input in inputs]...))
+    val = Vector{Float64}(undef, batch_size * params.max_array_size)
+    output_lens = Vector{Cint}(undef, num_outputs)
+    ccall((:predict_multi, ML_MODULE_INTERFACE), Cint, (Ptr{Float64}, Cint, Ptr{Cint}, Cint, Ptr{Float64}, Ptr{Cint}, Cint, Ptr{UInt8}),
+        data, batch_size, input_lens, length(inputs), val, output_lens, num_outputs, input_json)
+    return unpack_outputs(val, output_lens, batch_size)
+end
+
+# the same for Float32 inputs, float models use them without conversion
+@brainflow_rethrow function predict_multi(inputs::AbstractVector{<:AbstractMatrix{Float32}}, params::BrainFlowModelParams, num_outputs::Integer=1)
+    input_json = JSON.json(params)
+    batch_size = size(inputs[1], 1)
+    input_lens = Vector{Cint}([size(input, 2) for input in inputs])
+    data = Vector{Float32}(vcat([vec(transpose(input)) for input in inputs]...))
+    val = Vector{Float64}(undef, batch_size * params.max_array_size)
+    output_lens = Vector{Cint}(undef, num_outputs)
+    ccall((:predict_multi_float32, ML_MODULE_INTERFACE), Cint, (Ptr{Float32}, Cint, Ptr{Cint}, Cint, Ptr{Float64}, Ptr{Cint}, Cint, Ptr{UInt8}),
+        data, batch_size, input_lens, length(inputs), val, output_lens, num_outputs, input_json)
+    return unpack_outputs(val, output_lens, batch_size)
+end
+
+function unpack_outputs(val, output_lens, batch_size)
+    offsets = cumsum(vcat(0, output_lens))
+    return [transpose(reshape(val[offsets[i] + 1:offsets[i + 1]], (div(output_lens[i], batch_size), batch_size))) for i in 1:length(output_lens)]
+end
+
 @brainflow_rethrow function release_all()
+    # handles are freed by release_with_handle only
+    for handle in values(model_handles)
+        ccall((:release_with_handle, ML_MODULE_INTERFACE), Cint, (Ptr{Cvoid},), handle)
+    end
+    empty!(model_handles)
     ccall((:release_all, ML_MODULE_INTERFACE), Cint, ())
 end
\ No newline at end of file
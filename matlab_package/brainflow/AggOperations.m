@@ -4,5 +4,9 @@ classdef AggOperations < int32
         MEAN(0)
         MEDIAN(1)
         EACH(2)
+        STDDEV(3)
+        MIN(4)
+        MAX(5)
+        RMS(6)
     end
 end
\ No newline at end of file
@@ -395,6 +395,17 @@ classdef BoardShim
             BoardShim.check_ec(exit_code, task_name);
         end
 
+        function stats = get_streamer_stats(obj, streamer, preset)
+            % get counters of streamer
+            task_name = 'get_streamer_stats';
+            lib_name = BoardShim.load_lib();
+            % no way to understand how it works in matlab used this link
+            % https://nl.mathworks.com/matlabcentral/answers/131446-what-data-type-do-i-need-to-calllib-with-pointer-argument-char%
+            [exit_code, tmp, stats] = calllib(lib_name, task_name, streamer, preset, blanks(8192), 8192, obj.board_id, obj.input_params_json);
+            BoardShim.check_ec(exit_code, task_name);
+            stats = jsondecode(stats);
+        end
+
         function start_stream(obj, buffer_size, streamer_params)
             % start data acqusition
             task_name = 'start_stream';
@@ -7,6 +7,11 @@ classdef BrainFlowModelParams
         other_info
         output_name
         max_array_size
+        intra_op_num_threads
+        inter_op_num_threads
+        graph_optimization_level
+        use_global_thread_pool
+        optimized_model_file
     end
     methods
         function obj = BrainFlowModelParams(metric, classifier)
@@ -16,6 +21,11 @@ classdef BrainFlowModelParams
             obj.other_info = '';
             obj.output_name = '';
             obj.max_array_size = 8192;
+            obj.intra_op_num_threads = 0;
+            obj.inter_op_num_threads = 0;
+            obj.graph_optimization_level = 99;
+            obj.use_global_thread_pool = false;
+            obj.optimized_model_file = '';
         end
         function json_string = to_json(obj)
             json_string = jsonencode(obj);
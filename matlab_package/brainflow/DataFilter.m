@@ -128,6 +128,94 @@ classdef DataFilter
             filtered_data = temp.Value;
         end
 
+        function filter_id = create_lowpass_filter(sampling_rate, cutoff, order, filter_type, ripple, num_channels)
+            % create stateful lowpass filter, it keeps history between calls of process_filter
+            task_name = 'create_lowpass_filter';
+            lib_name = DataFilter.load_lib();
+            temp = libpointer('int32Ptr', 0);
+            exit_code = calllib(lib_name, task_name, sampling_rate, cutoff, order, int32(filter_type), ripple, num_channels, temp);
+            DataFilter.check_ec(exit_code, task_name);
+            filter_id = temp.Value;
+        end
+
+        function filter_id = create_highpass_filter(sampling_rate, cutoff, order, filter_type, ripple, num_channels)
+            % create stateful highpass filter, it keeps history between calls of process_filter
+            task_name = 'create_highpass_filter';
+            lib_name = DataFilter.load_lib();
+            temp = libpointer('int32Ptr', 0);
+            exit_code = calllib(lib_name, task_name, sampling_rate, cutoff, order, int32(filter_type), ripple, num_channels, temp);
+            DataFilter.check_ec(exit_code, task_name);
+            filter_id = temp.Value;
+        end
+
+        function filter_id = create_bandpass_filter(sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels)
+            % create stateful bandpass filter, it keeps history between calls of process_filter
+            task_name = 'create_bandpass_filter';
+            lib_name = DataFilter.load_lib();
+            temp = libpointer('int32Ptr', 0);
+            exit_code = calllib(lib_name, task_name, sampling_rate, start_freq, stop_freq, order, int32(filter_type), ripple, num_channels, temp);
+            DataFilter.check_ec(exit_code, task_name);
+            filter_id = temp.Value;
+        end
+
+        function filter_id = create_bandstop_filter(sampling_rate, start_freq, stop_freq, order, filter_type, ripple, num_channels)
+            % create stateful bandstop filter, it keeps history between calls of process_filter
+            task_name = 'create_bandstop_filter';
+            lib_name = DataFilter.load_lib();
+            temp = libpointer('int32Ptr', 0);
+            exit_code = calllib(lib_name, task_name, sampling_rate, start_freq, stop_freq, order, int32(filter_type), ripple, num_channels, temp);
+            DataFilter.check_ec(exit_code, task_name);
+            filter_id = temp.Value;
+        end
+
+        function filter_id = create_environmental_noise_filter(sampling_rate, noise_type, num_channels)
+            % create stateful notch filter to remove env noise
+            task_name = 'create_environmental_noise_filter';
+            lib_name = DataFilter.load_lib();
+            temp = libpointer('int32Ptr', 0);
+            exit_code = calllib(lib_name, task_name, sampling_rate, int32(noise_type), num_channels, temp);
+            DataFilter.check_ec(exit_code, task_name);
+            filter_id = temp.Value;
+        end
+
+        function filtered_data = process_filter(filter_id, channel, data)
+            % filter next chunk of a channel, history is kept between calls
+            task_name = 'process_filter';
+            temp = libpointer('doublePtr', data);
+            lib_name = DataFilter.load_lib();
+            exit_code = calllib(lib_name, task_name, filter_id, channel, temp, size(data, 2));
+            DataFilter.check_ec(exit_code, task_name);
+            filtered_data = temp.Value;
+        end
+
+        function filtered_data = process_filter_block(filter_id, data)
+            % filter next chunk of all channels, rows of data must match channels of filter
+            task_name = 'process_filter_block';
+            data_1d = transpose(data);
+            data_1d = data_1d(:);
+            temp = libpointer('doublePtr', data_1d);
+            lib_name = DataFilter.load_lib();
+            exit_code = calllib(lib_name, task_name, filter_id, temp, size(data, 1), size(data, 2));
+            DataFilter.check_ec(exit_code, task_name);
+            filtered_data = transpose(reshape(temp.Value, [size(data, 2), size(data, 1)]));
+        end
+
+        function reset_filter(filter_id)
+            % clear history of all channels of a filter
+            task_name = 'reset_filter';
+            lib_name = DataFilter.load_lib();
+            exit_code = calllib(lib_name, task_name, filter_id);
+            DataFilter.check_ec(exit_code, task_name);
+        end
+
+        function release_filter(filter_id)
+            % release filter created by create_*_filter methods
+            task_name = 'release_filter';
+            lib_name = DataFilter.load_lib();
+            exit_code = calllib(lib_name, task_name, filter_id);
+            DataFilter.check_ec(exit_code, task_name);
+        end
+
         function filtered_data = perform_rolling_filter(data, period, operation)
             % apply rolling filter
             task_name = 'perform_rolling_filter';
@@ -180,6 +268,35 @@ classdef DataFilter
             DataFilter.check_ec(exit_code, task_name);
             peaks = temp_output.Value;
         end
+
+        function detector_id = create_z_score_peak_detector(lag, threshold, influence)
+            % create z score peak detector which keeps its state between calls
+            task_name = 'create_z_score_peak_detector';
+            lib_name = DataFilter.load_lib();
+            temp = libpointer('int32Ptr', 0);
+            exit_code = calllib(lib_name, task_name, int32(lag), threshold, influence, temp);
+            DataFilter.check_ec(exit_code, task_name);
+            detector_id = temp.Value;
+        end
+
+        function peaks = process_z_score_peak_detector(detector_id, data)
+            % detect peaks in the next chunk of data
+            task_name = 'process_z_score_peak_detector';
+            temp_input = libpointer('doublePtr', data);
+            lib_name = DataFilter.load_lib();
+            temp_output = libpointer('doublePtr', zeros(1, int32(size(data,2))));
+            exit_code = calllib(lib_name, task_name, detector_id, temp_input, size(data, 2), temp_output);
+            DataFilter.check_ec(exit_code, task_name);
+            peaks = temp_output.Value;
+        end
+
+        function release_z_score_peak_detector(detector_id)
+            % release z score peak detector
+            task_name = 'release_z_score_peak_detector';
+            lib_name = DataFilter.load_lib();
+            exit_code = calllib(lib_name, task_name, detector_id);
+            DataFilter.check_ec(exit_code, task_name);
+        end
         
         function [wavelet_data, wavelet_sizes] = perform_wavelet_transform(data, wavelet, decomposition_level, extension)
             % perform wavelet transform
@@ -215,10 +332,41 @@ classdef DataFilter
             DataFilter.check_ec(exit_code, task_name);
             denoised_data = temp.Value;
         end
+
+        function [wavelet_data, wavelet_sizes] = perform_wavelet_transform_block(data, wavelet, decomposition_level, extension)
+            % perform wavelet transform of each row of data
+            task_name = 'perform_wavelet_transform_block';
+            data_1d = transpose(data);
+            data_1d = data_1d(:);
+            temp_input = libpointer('doublePtr', data_1d);
+            lib_name = DataFilter.load_lib();
+            temp_output = libpointer('doublePtr', zeros(1, int32(size(data, 1) * (size(data, 2) + 2 * decomposition_level * (40 + 1)))));
+            lenghts = libpointer('int32Ptr', zeros(1, decomposition_level + 1));
+            exit_code = calllib(lib_name, task_name, temp_input, size(data, 1), size(data, 2), wavelet, decomposition_level, extension, temp_output, lenghts);
+            DataFilter.check_ec(exit_code, task_name);
+            total_length = double(sum(lenghts.Value));
+            wavelet_data = transpose(reshape(temp_output.Value(1, 1:size(data, 1) * total_length), [total_length, size(data, 1)]));
+            wavelet_sizes = lenghts.Value;
+        end
+
+        function denoised_data = perform_wavelet_denoising_block(data, wavelet, decomposition_level, denoising, threshold, extention, noise_level)
+            % perform wavelet denoising of each row of data
+            task_name = 'perform_wavelet_denoising_block';
+            data_1d = transpose(data);
+            data_1d = data_1d(:);
+            temp = libpointer('doublePtr', data_1d);
+            lib_name = DataFilter.load_lib();
+            exit_code = calllib(lib_name, task_name, temp, size(data, 1), size(data, 2), wavelet, decomposition_level, denoising, threshold, extention, noise_level);
+            DataFilter.check_ec(exit_code, task_name);
+            denoised_data = transpose(reshape(temp.Value, [size(data, 2), size(data, 1)]));
+        end
         
-        function [filters, eigenvalues] = get_csp(data, labels)
-            % get common spatial patterns
-            task_name = 'get_csp';
+        function [filters, eigenvalues] = get_csp(data, labels, shrinkage)
+            % get common spatial patterns, shrinkage in range [0, 1] regularizes class covariances
+            if nargin < 3
+                shrinkage = 0.0;
+            end
+            task_name = 'get_regularized_csp';
             n_epochs = size(data, 1);
             n_channels = size(data, 2);
             n_times = size(data, 3);
@@ -236,7 +384,7 @@ classdef DataFilter
             labels_ptr = libpointer('doublePtr', labels);
             output_filters_ptr = libpointer('doublePtr', zeros(1, n_channels * n_channels));
             output_eigenvalues_ptr = libpointer('doublePtr', zeros(1, int32(n_channels)));
-            exit_code = calllib(lib_name, task_name, data1d_ptr, labels_ptr, n_epochs, n_channels, n_times, output_filters_ptr, output_eigenvalues_ptr);
+            exit_code = calllib(lib_name, task_name, data1d_ptr, labels_ptr, n_epochs, n_channels, n_times, shrinkage, output_filters_ptr, output_eigenvalues_ptr);
             DataFilter.check_ec(exit_code, task_name);
             filters = zeros(n_channels, n_channels);
             for i=1:n_channels
@@ -247,6 +395,24 @@ classdef DataFilter
             eigenvalues = output_eigenvalues_ptr.Value;
         end
 
+        function output = apply_csp_filters(filters, data)
+            % apply [n_filters x n_channels] filters from get_csp to [n_channels x n_times] data
+            task_name = 'apply_csp_filters';
+            n_filters = size(filters, 1);
+            n_times = size(data, 2);
+            filters_1d = transpose(filters);
+            filters_1d = filters_1d(:);
+            data_1d = transpose(data);
+            data_1d = data_1d(:);
+            filters_ptr = libpointer('doublePtr', filters_1d);
+            data_ptr = libpointer('doublePtr', data_1d);
+            output_ptr = libpointer('doublePtr', zeros(1, n_filters * n_times));
+            lib_name = DataFilter.load_lib();
+            exit_code = calllib(lib_name, task_name, filters_ptr, n_filters, size(filters, 2), data_ptr, n_times, output_ptr);
+            DataFilter.check_ec(exit_code, task_name);
+            output = transpose(reshape(output_ptr.Value, [n_times, n_filters]));
+        end
+
         function window_data = get_window(window_function, window_len)
             % get window
             task_name = 'get_window';
@@ -257,6 +423,26 @@ classdef DataFilter
             window_data = temp_output.Value;
         end
 
+        function window_data = get_custom_window(window_function, window_len, param)
+            % get window, param is alpha for TUKEY and beta for KAISER
+            task_name = 'get_custom_window';
+            lib_name = DataFilter.load_lib();
+            temp_output = libpointer('doublePtr', zeros(1, int32(window_len)));
+            exit_code = calllib(lib_name, task_name, window_function, window_len, param, temp_output);
+            DataFilter.check_ec(exit_code, task_name);
+            window_data = temp_output.Value;
+        end
+
+        function tapers = get_dpss_tapers(window_len, nw, num_tapers)
+            % calculate dpss tapers with unit energy, each taper is a row
+            task_name = 'get_dpss_tapers';
+            lib_name = DataFilter.load_lib();
+            temp_output = libpointer('doublePtr', zeros(1, int32(window_len * num_tapers)));
+            exit_code = calllib(lib_name, task_name, window_len, nw, num_tapers, temp_output);
+            DataFilter.check_ec(exit_code, task_name);
+            tapers = transpose(reshape(temp_output.Value, [window_len, num_tapers]));
+        end
+
         function stddev = calc_stddev(data)
             % calc stddev
             task_name = 'calc_stddev';
@@ -355,6 +541,74 @@ classdef DataFilter
             stddev_bands = temp_stddevs.Value;
         end
         
+        function stream_id = create_band_power_stream(sampling_rate, window_len, num_channels, apply_filters)
+            % create stateful band power calculator for the last window_len datapoints
+            task_name = 'create_band_power_stream';
+            lib_name = DataFilter.load_lib();
+            temp = libpointer('int32Ptr', 0);
+            exit_code = calllib(lib_name, task_name, sampling_rate, window_len, num_channels, int32(apply_filters), temp);
+            DataFilter.check_ec(exit_code, task_name);
+            stream_id = temp.Value;
+        end
+
+        function add_band_power_stream_data(stream_id, data, channels)
+            % add new datapoints of channels, number of channels must match the stream
+            task_name = 'add_band_power_stream_data';
+            data_1d = data(channels, :);
+            data_1d = transpose(data_1d);
+            data_1d = data_1d(:);
+            temp_input = libpointer('doublePtr', data_1d);
+            lib_name = DataFilter.load_lib();
+            exit_code = calllib(lib_name, task_name, stream_id, temp_input, size(channels, 2), size(data, 2));
+            DataFilter.check_ec(exit_code, task_name);
+        end
+
+        function [avg_bands, stddev_bands] = get_band_power_stream_powers(stream_id, start_freqs, stop_freqs)
+            % calculate average band powers for the last window of band power stream
+            task_name = 'get_band_power_stream_powers';
+            lib_name = DataFilter.load_lib();
+            temp_avgs = libpointer('doublePtr', zeros(1, size(start_freqs, 2)));
+            temp_stddevs = libpointer('doublePtr', zeros(1, size(start_freqs, 2)));
+            temp_start = libpointer('doublePtr', start_freqs);
+            temp_stop = libpointer('doublePtr', stop_freqs);
+            exit_code = calllib(lib_name, task_name, stream_id, temp_start, temp_stop, size(start_freqs, 2), temp_avgs, temp_stddevs);
+            DataFilter.check_ec(exit_code, task_name);
+            avg_bands = temp_avgs.Value;
+            stddev_bands = temp_stddevs.Value;
+        end
+
+        function release_band_power_stream(stream_id)
+            % release band power stream
+            task_name = 'release_band_power_stream';
+            lib_name = DataFilter.load_lib();
+            exit_code = calllib(lib_name, task_name, stream_id);
+            DataFilter.check_ec(exit_code, task_name);
+        end
+
+        function value = get_eeg_metric(data, channels, sampling_rate, metric, apply_filters)
+            % calculate mindfulness or restfulness score from eeg channels in a single call
+            task_name = 'get_eeg_metric';
+            data_1d = data(channels, :);
+            data_1d = transpose(data_1d);
+            data_1d = data_1d(:);
+            temp_input = libpointer('doublePtr', data_1d);
+            lib_name = DataFilter.load_lib();
+            temp_output = libpointer('doublePtr', 0);
+            exit_code = calllib(lib_name, task_name, temp_input, size(channels, 2), size(data, 2), sampling_rate, metric, int32(apply_filters), temp_output);
+            DataFilter.check_ec(exit_code, task_name);
+            value = temp_output.Value;
+        end
+
+        function value = get_band_power_stream_metric(stream_id, metric)
+            % calculate mindfulness or restfulness score for the last window of band power stream
+            task_name = 'get_band_power_stream_metric';
+            lib_name = DataFilter.load_lib();
+            temp_output = libpointer('doublePtr', 0);
+            exit_code = calllib(lib_name, task_name, stream_id, metric, temp_output);
+            DataFilter.check_ec(exit_code, task_name);
+            value = temp_output.Value;
+        end
+
         function [w_mat, k_mat, a_mat, s_mat] = perform_ica_select_channels(data, num_components, channels)
             % calculate ica
             task_name = 'perform_ica';
@@ -380,6 +634,38 @@ classdef DataFilter
             channels = uint32(1):uint32(size(data,1));
             [w_mat, k_mat, a_mat, s_mat] = DataFilter.perform_ica_select_channels(data, num_components, channels);
         end
+
+        function [w_mat, k_mat, a_mat, s_mat] = perform_custom_ica(data, num_components, channels, max_iterations, tolerance, w_init, use_float32)
+            % calculate ica with custom convergence settings, w_init is optional start unmixing matrix
+            if nargin < 6
+                w_init = [];
+            end
+            if nargin < 7
+                use_float32 = false;
+            end
+            task_name = 'perform_custom_ica';
+            data_1d = data(channels, :);
+            data_1d = transpose(data_1d);
+            data_1d = data_1d(:);
+            temp_input = libpointer('doublePtr', data_1d);
+            if isempty(w_init)
+                temp_w_init = libpointer('doublePtr');
+            else
+                w_init_1d = transpose(w_init);
+                temp_w_init = libpointer('doublePtr', w_init_1d(:));
+            end
+            lib_name = DataFilter.load_lib();
+            temp_w = libpointer('doublePtr', zeros(1, num_components * num_components));
+            temp_k = libpointer('doublePtr', zeros(1, size(channels, 2) * num_components));
+            temp_a = libpointer('doublePtr', zeros(1, num_components * size(channels, 2)));
+            temp_s = libpointer('doublePtr', zeros(1, size(data, 2) * num_components));
+            exit_code = calllib(lib_name, task_name, temp_input, size(channels, 2), size(data, 2), num_components, max_iterations, tolerance, temp_w_init, int32(use_float32), temp_w, temp_k, temp_a, temp_s);
+            DataFilter.check_ec(exit_code, task_name);
+            w_mat = transpose(reshape(temp_w.Value, [num_components, num_components]));
+            k_mat = transpose(reshape(temp_k.Value, [size(channels,2), num_components]));
+            a_mat = transpose(reshape(temp_a.Value, [num_components, size(channels, 2)]));
+            s_mat = transpose(reshape(temp_s.Value, [size(data, 2), num_components]));
+        end
         
         function [ampls, freqs] = get_psd(data, sampling_rate, window)
             % calculate PSD
@@ -394,6 +680,20 @@ classdef DataFilter
             ampls = temp_ampls.Value;
             freqs = temp_freqs.Value;
         end
+
+        function [ampls, freqs] = get_psd_multitaper(data, sampling_rate, nw, num_tapers)
+            % calculate multitaper PSD, average of PSDs with DPSS tapers
+            task_name = 'get_psd_multitaper';
+            n = size(data, 2);
+            temp_input = libpointer('doublePtr', data);
+            lib_name = DataFilter.load_lib();
+            temp_ampls = libpointer('doublePtr', zeros(1, int32(n / 2 + 1)));
+            temp_freqs = libpointer('doublePtr', zeros(1, int32(n / 2 + 1)));
+            exit_code = calllib(lib_name, task_name, temp_input, n, sampling_rate, nw, num_tapers, temp_ampls, temp_freqs);
+            DataFilter.check_ec(exit_code, task_name);
+            ampls = temp_ampls.Value;
+            freqs = temp_freqs.Value;
+        end
         
         function [ampls, freqs] = get_psd_welch(data, nfft, overlap, sampling_rate, window)
             % calculate PSD using welch method
@@ -33,11 +33,27 @@ classdef MLModel
                 error('Non zero ec: %d, for task: %s', ec, task_name)
             end
         end
+
+        function handles = model_handles()
+            % handles from prepare_with_handle by model params, shared by copies of MLModel
+            persistent registry
+            if isempty(registry)
+                registry = containers.Map();
+            end
+            handles = registry;
+        end
         
         function release_all()
             % release all sessions
             task_name = 'release_all';
             lib_name = MLModel.load_lib();
+            % handles are freed by release_with_handle only
+            handles = MLModel.model_handles();
+            handle_values = values(handles);
+            for i = 1:numel(handle_values)
+                calllib(lib_name, 'release_with_handle', handle_values{i});
+            end
+            remove(handles, keys(handles));
             exit_code = calllib(lib_name, task_name);
             MLModel.check_ec(exit_code, task_name);
         end
@@ -102,17 +118,27 @@ classdef MLModel
 
         function prepare(obj)
             % prepare model
-            task_name = 'prepare';
+            task_name = 'prepare_with_handle';
             lib_name = MLModel.load_lib();
-            exit_code = calllib(lib_name, task_name, obj.input_json);
+            handle_temp = libpointer('voidPtrPtr');
+            exit_code = calllib(lib_name, task_name, obj.input_json, handle_temp);
             MLModel.check_ec(exit_code, task_name);
+            handles = MLModel.model_handles();
+            handles(obj.input_json) = handle_temp.Value;
         end
         
         function release(obj)
             % release model
-            task_name = 'release';
             lib_name = MLModel.load_lib();
-            exit_code = calllib(lib_name, task_name, obj.input_json);
+            handles = MLModel.model_handles();
+            if isKey(handles, obj.input_json)
+                task_name = 'release_with_handle';
+                exit_code = calllib(lib_name, task_name, handles(obj.input_json));
+                remove(handles, obj.input_json);
+            else
+                task_name = 'release';
+                exit_code = calllib(lib_name, task_name, obj.input_json);
+            end
             MLModel.check_ec(exit_code, task_name);
         end
 
@@ -123,10 +149,81 @@ classdef MLModel
             score_temp = libpointer('doublePtr', obj.input_params.max_array_size);
             len = libpointer('int32Ptr', 0);
             input_data_temp = libpointer('doublePtr', input_data);
-            exit_code = calllib(lib_name, task_name, input_data_temp, size(input_data, 2), score_temp, len, obj.input_json);
+            handles = MLModel.model_handles();
+            if isKey(handles, obj.input_json)
+                task_name = 'predict_with_handle';
+                exit_code = calllib(lib_name, task_name, handles(obj.input_json), input_data_temp, size(input_data, 2), score_temp, len);
+            else
+                exit_code = calllib(lib_name, task_name, input_data_temp, size(input_data, 2), score_temp, len, obj.input_json);
+            end
             MLModel.check_ec(exit_code, task_name);
             score = score_temp.Value(1,1:len.Value);
         end
+
+        function scores = predict_batch(obj, input_data)
+            % perform inference for each row of input data in a single call
+            task_name = 'predict_batch';
+            lib_name = MLModel.load_lib();
+            batch_size = size(input_data, 1);
+            score_temp = libpointer('doublePtr', zeros(1, batch_size * obj.input_params.max_array_size));
+            len = libpointer('int32Ptr', 0);
+            input_data_1d = transpose(input_data);
+            input_data_temp = libpointer('doublePtr', input_data_1d(:));
+            handles = MLModel.model_handles();
+            if isKey(handles, obj.input_json)
+                task_name = 'predict_batch_with_handle';
+                exit_code = calllib(lib_name, task_name, handles(obj.input_json), input_data_temp, batch_size, size(input_data, 2), score_temp, len);
+            else
+                exit_code = calllib(lib_name, task_name, input_data_temp, batch_size, size(input_data, 2), score_temp, len, obj.input_json);
+            end
+            MLModel.check_ec(exit_code, task_name);
+            output_len = double(len.Value) / batch_size;
+            scores = transpose(reshape(score_temp.Value(1, 1:len.Value), [output_len, batch_size]));
+        end
+
+        function scores = predict_multi(obj, inputs, num_outputs)
+            % perform inference for model with several inputs and outputs
+            % inputs is a cell array of batch_size x input_len matrices in model order, single inputs
+            % are passed without conversion, returns cell array of batch_size x output_len matrices
+            if nargin < 3
+                num_outputs = 1;
+            end
+            use_float32 = all(cellfun(@(x) isa(x, 'single'), inputs));
+            if use_float32
+                task_name = 'predict_multi_float32';
+                ptr_type = 'singlePtr';
+            else
+                task_name = 'predict_multi';
+                ptr_type = 'doublePtr';
+            end
+            lib_name = MLModel.load_lib();
+            batch_size = size(inputs{1}, 1);
+            input_lens = zeros(1, numel(inputs));
+            data = [];
+            for i = 1:numel(inputs)
+                input_lens(i) = size(inputs{i}, 2);
+                input_1d = transpose(inputs{i});
+                data = [data; input_1d(:)];
+            end
+            if use_float32
+                data = single(data);
+            else
+                data = double(data);
+            end
+            data_temp = libpointer(ptr_type, data);
+            input_lens_temp = libpointer('int32Ptr', input_lens);
+            score_temp = libpointer('doublePtr', zeros(1, batch_size * obj.input_params.max_array_size));
+            output_lens = libpointer('int32Ptr', zeros(1, num_outputs));
+            exit_code = calllib(lib_name, task_name, data_temp, batch_size, input_lens_temp, numel(inputs), score_temp, output_lens, num_outputs, obj.input_json);
+            MLModel.check_ec(exit_code, task_name);
+            scores = cell(1, num_outputs);
+            offset = 0;
+            for i = 1:num_outputs
+                len = double(output_lens.Value(i));
+                scores{i} = transpose(reshape(score_temp.Value(1, offset + 1:offset + len), [len / batch_size, batch_size]));
+                offset = offset + len;
+            end
+        end
         
     end
     
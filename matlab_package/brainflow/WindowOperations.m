@@ -5,5 +5,8 @@ classdef WindowOperations < int32
         HANNING(1)
         HAMMING(2)
         BLACKMAN_HARRIS(3)
+        TUKEY(4)
+        KAISER(5)
+        FLAT_TOP(6)
     end
 end
\ No newline at end of file
@@ -229,6 +229,17 @@ class BoardControllerDLL(object):
             ctypes.c_char_p
         ]
 
+        self.get_streamer_stats = self.lib.get_streamer_stats
+        self.get_streamer_stats.restype = ctypes.c_int
+        self.get_streamer_stats.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_int,
+            ndpointer(ctypes.c_ubyte),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
         self.stop_stream = self.lib.stop_stream
         self.stop_stream.restype = ctypes.c_int
         self.stop_stream.argtypes = [
@@ -1191,6 +1202,30 @@ class BoardShim(object):
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to delete streamer', res)
 
+    def get_streamer_stats(self, streamer_params: str, preset: int = BrainFlowPresets.DEFAULT_PRESET):
+        """Get queue counters of a streamer
+
+        :param streamer_params: the same string which was used to add streamer
+        :type streamer_params: str
+        :param preset: preset
+        :type preset: int
+        :return: queued, queue_size, streamed, dropped and max_latency_ms fields
+        :rtype: json
+        """
+
+        try:
+            streamer = streamer_params.encode()
+        except BaseException:
+            streamer = streamer_params
+        string = numpy.zeros(8192).astype(numpy.ubyte)
+        string_len = numpy.zeros(1).astype(numpy.int32)
+
+        res = BoardControllerDLL.get_instance().get_streamer_stats(streamer, preset, string, string_len,
+                                                                   self.board_id, self.input_json)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to get streamer stats', res)
+        return json.loads(string.tobytes().decode('utf-8')[0:string_len[0]])
+
     def start_stream(self, num_samples: int = 1800 * 250, streamer_params: str = None) -> None:
         """Start streaming data, this methods stores data in ringbuffer
 
@@ -27,6 +27,10 @@ class AggOperations(enum.IntEnum):
     MEAN = 0  #:
     MEDIAN = 1  #:
     EACH = 2  #:
+    STDDEV = 3  #:
+    MIN = 4  #:
+    MAX = 5  #:
+    RMS = 6  #:
 
 
 class WindowOperations(enum.IntEnum):
@@ -36,6 +40,9 @@ class WindowOperations(enum.IntEnum):
     HANNING = 1  #:
     HAMMING = 2  #:
     BLACKMAN_HARRIS = 3  #:
+    TUKEY = 4  #:
+    KAISER = 5  #:
+    FLAT_TOP = 6  #:
 
 
 class DetrendOperations(enum.IntEnum):
@@ -258,6 +265,95 @@ class DataHandlerDLL(object):
             ctypes.c_int
         ]
 
+        self.create_lowpass_filter = self.lib.create_lowpass_filter
+        self.create_lowpass_filter.restype = ctypes.c_int
+        self.create_lowpass_filter.argtypes = [
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.create_highpass_filter = self.lib.create_highpass_filter
+        self.create_highpass_filter.restype = ctypes.c_int
+        self.create_highpass_filter.argtypes = [
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.create_bandpass_filter = self.lib.create_bandpass_filter
+        self.create_bandpass_filter.restype = ctypes.c_int
+        self.create_bandpass_filter.argtypes = [
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.create_bandstop_filter = self.lib.create_bandstop_filter
+        self.create_bandstop_filter.restype = ctypes.c_int
+        self.create_bandstop_filter.argtypes = [
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.create_environmental_noise_filter = self.lib.create_environmental_noise_filter
+        self.create_environmental_noise_filter.restype = ctypes.c_int
+        self.create_environmental_noise_filter.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.process_filter = self.lib.process_filter
+        self.process_filter.restype = ctypes.c_int
+        self.process_filter.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int
+        ]
+
+        self.process_filter_block = self.lib.process_filter_block
+        self.process_filter_block.restype = ctypes.c_int
+        self.process_filter_block.argtypes = [
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.reset_filter = self.lib.reset_filter
+        self.reset_filter.restype = ctypes.c_int
+        self.reset_filter.argtypes = [
+            ctypes.c_int
+        ]
+
+        self.release_filter = self.lib.release_filter
+        self.release_filter.restype = ctypes.c_int
+        self.release_filter.argtypes = [
+            ctypes.c_int
+        ]
+
         self.write_file = self.lib.write_file
         self.write_file.restype = ctypes.c_int
         self.write_file.argtypes = [
@@ -268,6 +364,17 @@ class DataHandlerDLL(object):
             ctypes.c_char_p
         ]
 
+        self.write_file_with_index = self.lib.write_file_with_index
+        self.write_file_with_index.restype = ctypes.c_int
+        self.write_file_with_index.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_char_p,
+            ctypes.c_char_p,
+            ctypes.c_int
+        ]
+
         self.read_file = self.lib.read_file
         self.read_file.restype = ctypes.c_int
         self.read_file.argtypes = [
@@ -357,6 +464,30 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_double)
         ]
 
+        self.create_z_score_peak_detector = self.lib.create_z_score_peak_detector
+        self.create_z_score_peak_detector.restype = ctypes.c_int
+        self.create_z_score_peak_detector.argtypes = [
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_double,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.process_z_score_peak_detector = self.lib.process_z_score_peak_detector
+        self.process_z_score_peak_detector.restype = ctypes.c_int
+        self.process_z_score_peak_detector.argtypes = [
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ndpointer(ctypes.c_double)
+        ]
+
+        self.release_z_score_peak_detector = self.lib.release_z_score_peak_detector
+        self.release_z_score_peak_detector.restype = ctypes.c_int
+        self.release_z_score_peak_detector.argtypes = [
+            ctypes.c_int
+        ]
+
         self.restore_data_from_wavelet_detailed_coeffs = self.lib.restore_data_from_wavelet_detailed_coeffs
         self.restore_data_from_wavelet_detailed_coeffs.restype = ctypes.c_int
         self.restore_data_from_wavelet_detailed_coeffs.argtypes = [
@@ -392,6 +523,30 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_double)
         ]
 
+        self.get_regularized_csp = self.lib.get_regularized_csp
+        self.get_regularized_csp.restype = ctypes.c_int
+        self.get_regularized_csp.argtypes = [
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double)
+        ]
+
+        self.apply_csp_filters = self.lib.apply_csp_filters
+        self.apply_csp_filters.restype = ctypes.c_int
+        self.apply_csp_filters.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ndpointer(ctypes.c_double)
+        ]
+
         self.get_window = self.lib.get_window
         self.get_window.restype = ctypes.c_int
         self.get_window.argtypes = [
@@ -400,6 +555,24 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_double)
         ]
 
+        self.get_custom_window = self.lib.get_custom_window
+        self.get_custom_window.restype = ctypes.c_int
+        self.get_custom_window.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ndpointer(ctypes.c_double)
+        ]
+
+        self.get_dpss_tapers = self.lib.get_dpss_tapers
+        self.get_dpss_tapers.restype = ctypes.c_int
+        self.get_dpss_tapers.argtypes = [
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double)
+        ]
+
         self.perform_fft = self.lib.perform_fft
         self.perform_fft.restype = ctypes.c_int
         self.perform_fft.argtypes = [
@@ -454,6 +627,62 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_float),
         ]
 
+        self.create_band_power_stream = self.lib.create_band_power_stream
+        self.create_band_power_stream.restype = ctypes.c_int
+        self.create_band_power_stream.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.add_band_power_stream_data = self.lib.add_band_power_stream_data
+        self.add_band_power_stream_data.restype = ctypes.c_int
+        self.add_band_power_stream_data.argtypes = [
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.get_band_power_stream_powers = self.lib.get_band_power_stream_powers
+        self.get_band_power_stream_powers.restype = ctypes.c_int
+        self.get_band_power_stream_powers.argtypes = [
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double)
+        ]
+
+        self.release_band_power_stream = self.lib.release_band_power_stream
+        self.release_band_power_stream.restype = ctypes.c_int
+        self.release_band_power_stream.argtypes = [
+            ctypes.c_int
+        ]
+
+        self.get_eeg_metric = self.lib.get_eeg_metric
+        self.get_eeg_metric.restype = ctypes.c_int
+        self.get_eeg_metric.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double)
+        ]
+
+        self.get_band_power_stream_metric = self.lib.get_band_power_stream_metric
+        self.get_band_power_stream_metric.restype = ctypes.c_int
+        self.get_band_power_stream_metric.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double)
+        ]
+
         self.perform_ica = self.lib.perform_ica
         self.perform_ica.restype = ctypes.c_int
         self.perform_ica.argtypes = [
@@ -467,6 +696,50 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_double)
         ]
 
+        self.perform_custom_ica = self.lib.perform_custom_ica
+        self.perform_custom_ica.restype = ctypes.c_int
+        self.perform_custom_ica.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_void_p,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double)
+        ]
+
+        self.perform_wavelet_transform_block = self.lib.perform_wavelet_transform_block
+        self.perform_wavelet_transform_block.restype = ctypes.c_int
+        self.perform_wavelet_transform_block.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.perform_wavelet_denoising_block = self.lib.perform_wavelet_denoising_block
+        self.perform_wavelet_denoising_block.restype = ctypes.c_int
+        self.perform_wavelet_denoising_block.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
         self.get_custom_band_powers = self.lib.get_custom_band_powers
         self.get_custom_band_powers.restype = ctypes.c_int
         self.get_custom_band_powers.argtypes = [
@@ -482,6 +755,18 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_double),
         ]
 
+        self.get_psd_multitaper = self.lib.get_psd_multitaper
+        self.get_psd_multitaper.restype = ctypes.c_int
+        self.get_psd_multitaper.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_double,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_double)
+        ]
+
         self.get_psd = self.lib.get_psd
         self.get_psd.restype = ctypes.c_int
         self.get_psd.argtypes = [
@@ -685,35 +970,239 @@ class DataFilter(object):
         :param ripple: ripple value for Chebyshev filter
         :type ripple: float
         """
-        check_memory_layout_row_major(data, 1)
+        check_memory_layout_row_major(data, 1)
+        if not isinstance(sampling_rate, int):
+            raise BrainFlowError('wrong type for sampling rate', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance(filter_type, int):
+            raise BrainFlowError('wrong type for filter type', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        res = DataHandlerDLL.get_instance().perform_bandstop(data, data.shape[0], sampling_rate, start_freq,
+                                                             stop_freq, order, filter_type, ripple)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to apply band stop filter', res)
+
+    @classmethod
+    def remove_environmental_noise(cls, data: NDArray[Float64], sampling_rate: int, noise_type: float) -> None:
+        """remove env noise using notch filter
+
+        :param data: data to filter, filter works in-place
+        :type data: NDArray[Float64]
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param noise_type: noise type
+        :type noise_type: int
+        """
+        check_memory_layout_row_major(data, 1)
+        if not isinstance(sampling_rate, int):
+            raise BrainFlowError('wrong type for sampling rate', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance(noise_type, int):
+            raise BrainFlowError('wrong type for noise type', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        res = DataHandlerDLL.get_instance().remove_environmental_noise(data, data.shape[0], sampling_rate, noise_type)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to apply notch filter', res)
+
+    @classmethod
+    def create_lowpass_filter(cls, sampling_rate: int, cutoff: float, order: int, filter_type: int,
+                              ripple: float, num_channels: int = 1) -> int:
+        """create stateful low pass filter, it keeps history between calls of process_filter
+
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param cutoff: cutoff frequency
+        :type cutoff: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        :param num_channels: number of channels with separate history
+        :type num_channels: int
+        :return: filter id
+        :rtype: int
+        """
+        if not isinstance(sampling_rate, int):
+            raise BrainFlowError('wrong type for sampling rate', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance(filter_type, int):
+            raise BrainFlowError('wrong type for filter type', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        filter_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_lowpass_filter(sampling_rate, cutoff, order, filter_type,
+                                                                  ripple, num_channels, filter_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to create filter', res)
+        return int(filter_id[0])
+
+    @classmethod
+    def create_highpass_filter(cls, sampling_rate: int, cutoff: float, order: int, filter_type: int,
+                               ripple: float, num_channels: int = 1) -> int:
+        """create stateful high pass filter, it keeps history between calls of process_filter
+
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param cutoff: cutoff frequency
+        :type cutoff: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        :param num_channels: number of channels with separate history
+        :type num_channels: int
+        :return: filter id
+        :rtype: int
+        """
+        if not isinstance(sampling_rate, int):
+            raise BrainFlowError('wrong type for sampling rate', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance(filter_type, int):
+            raise BrainFlowError('wrong type for filter type', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        filter_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_highpass_filter(sampling_rate, cutoff, order, filter_type,
+                                                                   ripple, num_channels, filter_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to create filter', res)
+        return int(filter_id[0])
+
+    @classmethod
+    def create_bandpass_filter(cls, sampling_rate: int, start_freq: float, stop_freq: float, order: int,
+                               filter_type: int, ripple: float, num_channels: int = 1) -> int:
+        """create stateful band pass filter, it keeps history between calls of process_filter
+
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param start_freq: start frequency
+        :type start_freq: float
+        :param stop_freq: stop frequency
+        :type stop_freq: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        :param num_channels: number of channels with separate history
+        :type num_channels: int
+        :return: filter id
+        :rtype: int
+        """
+        if not isinstance(sampling_rate, int):
+            raise BrainFlowError('wrong type for sampling rate', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        if not isinstance(filter_type, int):
+            raise BrainFlowError('wrong type for filter type', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        filter_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_bandpass_filter(sampling_rate, start_freq, stop_freq, order,
+                                                                   filter_type, ripple, num_channels, filter_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to create filter', res)
+        return int(filter_id[0])
+
+    @classmethod
+    def create_bandstop_filter(cls, sampling_rate: int, start_freq: float, stop_freq: float, order: int,
+                               filter_type: int, ripple: float, num_channels: int = 1) -> int:
+        """create stateful band stop filter, it keeps history between calls of process_filter
+
+        :param sampling_rate: board's sampling rate
+        :type sampling_rate: int
+        :param start_freq: start frequency
+        :type start_freq: float
+        :param stop_freq: stop frequency
+        :type stop_freq: float
+        :param order: filter order
+        :type order: int
+        :param filter_type: filter type from special enum
+        :type filter_type: int
+        :param ripple: ripple value for Chebyshev filter
+        :type ripple: float
+        :param num_channels: number of channels with separate history
+        :type num_channels: int
+        :return: filter id
+        :rtype: int
+        """
         if not isinstance(sampling_rate, int):
             raise BrainFlowError('wrong type for sampling rate', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
         if not isinstance(filter_type, int):
             raise BrainFlowError('wrong type for filter type', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
-        res = DataHandlerDLL.get_instance().perform_bandstop(data, data.shape[0], sampling_rate, start_freq,
-                                                             stop_freq, order, filter_type, ripple)
+        filter_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_bandstop_filter(sampling_rate, start_freq, stop_freq, order,
+                                                                   filter_type, ripple, num_channels, filter_id)
         if res != BrainFlowExitCodes.STATUS_OK.value:
-            raise BrainFlowError('unable to apply band stop filter', res)
+            raise BrainFlowError('unable to create filter', res)
+        return int(filter_id[0])
 
     @classmethod
-    def remove_environmental_noise(cls, data: NDArray[Float64], sampling_rate: int, noise_type: float) -> None:
-        """remove env noise using notch filter
+    def create_environmental_noise_filter(cls, sampling_rate: int, noise_type: int, num_channels: int = 1) -> int:
+        """create stateful notch filter to remove env noise, it keeps history between calls of process_filter
 
-        :param data: data to filter, filter works in-place
-        :type data: NDArray[Float64]
         :param sampling_rate: board's sampling rate
         :type sampling_rate: int
         :param noise_type: noise type
         :type noise_type: int
+        :param num_channels: number of channels with separate history
+        :type num_channels: int
+        :return: filter id
+        :rtype: int
         """
-        check_memory_layout_row_major(data, 1)
         if not isinstance(sampling_rate, int):
             raise BrainFlowError('wrong type for sampling rate', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
         if not isinstance(noise_type, int):
             raise BrainFlowError('wrong type for noise type', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
-        res = DataHandlerDLL.get_instance().remove_environmental_noise(data, data.shape[0], sampling_rate, noise_type)
+        filter_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_environmental_noise_filter(sampling_rate, noise_type,
+                                                                              num_channels, filter_id)
         if res != BrainFlowExitCodes.STATUS_OK.value:
-            raise BrainFlowError('unable to apply notch filter', res)
+            raise BrainFlowError('unable to create filter', res)
+        return int(filter_id[0])
+
+    @classmethod
+    def process_filter(cls, filter_id: int, channel: int, data: NDArray[Float64]) -> None:
+        """filter next chunk of a channel, history is kept between calls
+
+        :param filter_id: id from create_*_filter methods
+        :type filter_id: int
+        :param channel: channel of filter in range [0, num_channels)
+        :type channel: int
+        :param data: data to filter, filter works in-place
+        :type data: NDArray[Float64]
+        """
+        check_memory_layout_row_major(data, 1)
+        res = DataHandlerDLL.get_instance().process_filter(filter_id, channel, data, data.shape[0])
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to filter data', res)
+
+    @classmethod
+    def process_filter_block(cls, filter_id: int, data: NDArray[Float64]) -> None:
+        """filter next chunk of all channels of a filter, history is kept between calls
+
+        :param filter_id: id from create_*_filter methods
+        :type filter_id: int
+        :param data: 2d array with a row per channel of filter, filter works in-place
+        :type data: NDArray[Float64]
+        """
+        check_memory_layout_row_major(data, 2)
+        res = DataHandlerDLL.get_instance().process_filter_block(filter_id, data, data.shape[0], data.shape[1])
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to filter data', res)
+
+    @classmethod
+    def reset_filter(cls, filter_id: int) -> None:
+        """clear history of all channels of a filter
+
+        :param filter_id: id from create_*_filter methods
+        :type filter_id: int
+        """
+        res = DataHandlerDLL.get_instance().reset_filter(filter_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to reset filter', res)
+
+    @classmethod
+    def release_filter(cls, filter_id: int) -> None:
+        """release filter created by create_*_filter methods
+
+        :param filter_id: id from create_*_filter methods
+        :type filter_id: int
+        """
+        res = DataHandlerDLL.get_instance().release_filter(filter_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to release filter', res)
 
     @classmethod
     def perform_rolling_filter(cls, data: NDArray[Float64], period: int, operation: int) -> None:
@@ -927,6 +1416,56 @@ class DataFilter(object):
 
         return output
 
+    @classmethod
+    def create_z_score_peak_detector(cls, lag=5, threshold=3.5, influence=0.1) -> int:
+        """create z score peak detector which keeps its state between calls to process new data as it arrives
+
+        :param lag: window size for averaging
+        :type lag: int
+        :param threshold: in stddev units
+        :type threshold: float
+        :param influence: contribution of peaks to mean value, between 0 and 1
+        :type influence: float
+        :return: detector id
+        :rtype: int
+        """
+        detector_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_z_score_peak_detector(lag, threshold, influence, detector_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to create z score peak detector', res)
+        return int(detector_id[0])
+
+    @classmethod
+    def process_z_score_peak_detector(cls, detector_id: int, data: NDArray[Float64]) -> NDArray[Float64]:
+        """detect peaks in the next chunk of data
+
+        :param detector_id: id from create_z_score_peak_detector
+        :type detector_id: int
+        :param data: next chunk of data
+        :type data: NDArray[Float64]
+        :return: peaks for each datapoint of data
+        :rtype: NDArray[Float64]
+        """
+        check_memory_layout_row_major(data, 1)
+
+        output = numpy.zeros(data.shape[0])
+        res = DataHandlerDLL.get_instance().process_z_score_peak_detector(detector_id, data, data.shape[0], output)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to detect peaks', res)
+
+        return output
+
+    @classmethod
+    def release_z_score_peak_detector(cls, detector_id: int) -> None:
+        """release z score peak detector
+
+        :param detector_id: id from create_z_score_peak_detector
+        :type detector_id: int
+        """
+        res = DataHandlerDLL.get_instance().release_z_score_peak_detector(detector_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to release z score peak detector', res)
+
     @classmethod
     def perform_inverse_wavelet_transform(cls, wavelet_output: Tuple, original_data_len: int, wavelet: int,
                                           decomposition_level: int, extension_type=WaveletExtensionTypes.SYMMETRIC) -> \
@@ -988,13 +1527,75 @@ class DataFilter(object):
             raise BrainFlowError('unable to denoise data', res)
 
     @classmethod
-    def get_csp(cls, data: NDArray[Float64], labels: NDArray[Float64]) -> Tuple:
+    def perform_wavelet_transform_block(cls, data: NDArray[Float64], wavelet: int, decomposition_level: int,
+                                        extension_type=WaveletExtensionTypes.SYMMETRIC) -> Tuple:
+        """perform wavelet transform of each row of data
+
+        :param data: 2d array, each row is transformed separately
+        :type data: NDArray[Float64]
+        :param wavelet: use WaveletTypes enum
+        :type wavelet: int
+        :param decomposition_level: level of decomposition
+        :type decomposition_level: int
+        :param extension_type: extension type, use WaveletExtensionTypes
+        :type extension_type: int
+        :return: tuple of 2d array with wavelet coeffs of each row in the same format as for perform_wavelet_transform and array with lengths for each block, it's the same for all rows
+        :rtype: tuple
+        """
+        check_memory_layout_row_major(data, 2)
+
+        rows, cols = data.shape[0], data.shape[1]
+        wavelet_coeffs = numpy.zeros(rows * (cols + 2 * decomposition_level * (40 + 1))).astype(numpy.float64)
+        lengths = numpy.zeros(decomposition_level + 1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().perform_wavelet_transform_block(data, rows, cols, wavelet,
+                                                                            decomposition_level, extension_type,
+                                                                            wavelet_coeffs, lengths)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to perform wavelet transform', res)
+
+        return wavelet_coeffs[0: rows * sum(lengths)].reshape(rows, sum(lengths)), lengths
+
+    @classmethod
+    def perform_wavelet_denoising_block(cls, data: NDArray[Float64], wavelet: int, decomposition_level: int,
+                                        wavelet_denoising=WaveletDenoisingTypes.SURESHRINK,
+                                        threshold=ThresholdTypes.HARD,
+                                        extension_type=WaveletExtensionTypes.SYMMETRIC,
+                                        noise_level=NoiseEstimationLevelTypes.FIRST_LEVEL) -> None:
+        """perform wavelet denoising of each row of data
+
+        :param data: 2d array to denoise, it works in-place
+        :type data: NDArray[Float64]
+        :param wavelet: use WaveletTypes enum
+        :type wavelet: int
+        :param decomposition_level: decomposition level
+        :type decomposition_level: int
+        :param wavelet_denoising: use WaveletDenoisingTypes enum
+        :type wavelet_denoising: int
+        :param threshold: use ThresholdTypes enum
+        :type threshold: int
+        :param extension_type: use WaveletExtensionTypes enum
+        :type extension_type: int
+        :param noise_level: use NoiseEstimationLevelTypes enum
+        :type noise_level: int
+        """
+        check_memory_layout_row_major(data, 2)
+
+        res = DataHandlerDLL.get_instance().perform_wavelet_denoising_block(data, data.shape[0], data.shape[1], wavelet,
+                                                                            decomposition_level, wavelet_denoising,
+                                                                            threshold, extension_type, noise_level)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to denoise data', res)
+
+    @classmethod
+    def get_csp(cls, data: NDArray[Float64], labels: NDArray[Float64], shrinkage: float = 0.0) -> Tuple:
         """calculate filters and the corresponding eigenvalues using the Common Spatial Patterns
 
         :param data: [epochs x channels x times]-shaped 3D array of data for two classes
         :type data: NDArray[Float64]
         :param labels: n_epochs-length 1D array of zeros and ones that assigns class labels for each epoch. Zero corresponds to the first class
         :type labels: NDArray[Int64] 
+        :param shrinkage: shrinkage of class covariances towards identity in range [0, 1], 0 means no regularization
+        :type shrinkage: float
         :return: [channels x channels]-shaped 2D array of filters and [channels]-length 1D array of the corresponding eigenvalues
         :rtype: Tuple
         """
@@ -1011,8 +1612,8 @@ class DataFilter(object):
         output_filters = numpy.zeros(int(n_channels * n_channels)).astype(numpy.float64)
         output_eigenvalues = numpy.zeros(int(n_channels)).astype(numpy.float64)
 
-        res = DataHandlerDLL.get_instance().get_csp(temp_data1d, labels, n_epochs, n_channels, n_times, output_filters,
-                                                    output_eigenvalues)
+        res = DataHandlerDLL.get_instance().get_regularized_csp(temp_data1d, labels, n_epochs, n_channels, n_times,
+                                                                shrinkage, output_filters, output_eigenvalues)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to calc csp', res)
 
@@ -1020,6 +1621,31 @@ class DataFilter(object):
 
         return output_filters, output_eigenvalues
 
+    @classmethod
+    def apply_csp_filters(cls, filters: NDArray[Float64], data: NDArray[Float64]) -> NDArray[Float64]:
+        """apply filters from get_csp to data
+
+        :param filters: [n_filters x channels]-shaped 2D array, rows of filters returned by get_csp
+        :type filters: NDArray[Float64]
+        :param data: [channels x times]-shaped 2D array
+        :type data: NDArray[Float64]
+        :return: [n_filters x times]-shaped 2D array of filtered data
+        :rtype: NDArray[Float64]
+        """
+        check_memory_layout_row_major(filters, 2)
+        check_memory_layout_row_major(data, 2)
+        if filters.shape[1] != data.shape[0]:
+            raise BrainFlowError('Invalid shape of array <filters>', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+
+        n_filters, n_channels = filters.shape
+        n_times = data.shape[1]
+        output = numpy.zeros(int(n_filters * n_times)).astype(numpy.float64)
+        res = DataHandlerDLL.get_instance().apply_csp_filters(filters, n_filters, n_channels, data, n_times, output)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to apply csp filters', res)
+
+        return output.reshape(n_filters, n_times)
+
     @classmethod
     def get_window(cls, window_function: int, window_len: int) -> NDArray[Float64]:
         """perform data windowing
@@ -1037,6 +1663,46 @@ class DataFilter(object):
 
         return window_data
 
+    @classmethod
+    def get_custom_window(cls, window_function: int, window_len: int, param: float) -> NDArray[Float64]:
+        """perform data windowing with custom window param
+
+        :param window_function: window function
+        :type window_function: int
+        :param window_len: len of the window function
+        :type window_len: int
+        :param param: alpha for TUKEY and beta for KAISER, ignored by other windows
+        :type param: float
+        :return: numpy array, len of the array is the same as data
+        :rtype: NDArray[Float64]
+        """
+        window_data = numpy.zeros(int(window_len)).astype(numpy.float64)
+        res = DataHandlerDLL.get_instance().get_custom_window(window_function, window_len, param, window_data)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to perform windowing', res)
+
+        return window_data
+
+    @classmethod
+    def get_dpss_tapers(cls, window_len: int, nw: float, num_tapers: int) -> NDArray[Float64]:
+        """calculate DPSS tapers for multitaper spectral estimation
+
+        :param window_len: len of each taper
+        :type window_len: int
+        :param nw: time half bandwidth product
+        :type nw: float
+        :param num_tapers: number of tapers, usually 2 * nw - 1
+        :type num_tapers: int
+        :return: [num_tapers x window_len]-shaped 2D array of tapers with unit energy
+        :rtype: NDArray[Float64]
+        """
+        tapers = numpy.zeros(int(num_tapers * window_len)).astype(numpy.float64)
+        res = DataHandlerDLL.get_instance().get_dpss_tapers(window_len, nw, num_tapers, tapers)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to calc dpss tapers', res)
+
+        return tapers.reshape(num_tapers, window_len)
+
     @classmethod
     def perform_fft(cls, data: NDArray[Float64], window: int) -> NDArray[Complex128]:
         """perform direct fft
@@ -1087,6 +1753,33 @@ class DataFilter(object):
 
         return ampls, freqs
 
+    @classmethod
+    def get_psd_multitaper(cls, data: NDArray[Float64], sampling_rate: int, nw: float, num_tapers: int) -> Tuple:
+        """calculate multitaper PSD, average of PSDs with DPSS tapers
+
+        :param data: data to calc psd, len of data must be even
+        :type data: NDArray[Float64]
+        :param sampling_rate: sampling rate
+        :type sampling_rate: int
+        :param nw: time half bandwidth product
+        :type nw: float
+        :param num_tapers: number of tapers, usually 2 * nw - 1
+        :type num_tapers: int
+        :return: amplitude and frequency arrays of len N / 2 + 1
+        :rtype: tuple
+        """
+
+        check_memory_layout_row_major(data, 1)
+
+        ampls = numpy.zeros(int(data.shape[0] / 2 + 1)).astype(numpy.float64)
+        freqs = numpy.zeros(int(data.shape[0] / 2 + 1)).astype(numpy.float64)
+        res = DataHandlerDLL.get_instance().get_psd_multitaper(data, data.shape[0], sampling_rate, nw, num_tapers,
+                                                               ampls, freqs)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to calc psd', res)
+
+        return ampls, freqs
+
     @classmethod
     def get_psd_welch(cls, data: NDArray[Float64], nfft: int, overlap: int, sampling_rate: int, window: int) -> Tuple:
         """calculate PSD using Welch method
@@ -1214,6 +1907,135 @@ class DataFilter(object):
 
         return avg_bands, stddev_bands
 
+    @classmethod
+    def create_band_power_stream(cls, sampling_rate: int, window_len: int, num_channels: int,
+                                 apply_filter: bool) -> int:
+        """create stateful band power calculator for the last window_len datapoints
+
+        :param sampling_rate: sampling rate
+        :type sampling_rate: int
+        :param window_len: number of the last datapoints used for calculation
+        :type window_len: int
+        :param num_channels: number of channels added on each call
+        :type num_channels: int
+        :param apply_filter: apply bandpass and bandstop filtrers or not
+        :type apply_filter: bool
+        :return: stream id
+        :rtype: int
+        """
+        stream_id = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().create_band_power_stream(sampling_rate, window_len, num_channels,
+                                                                     int(apply_filter), stream_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to create band power stream', res)
+        return int(stream_id[0])
+
+    @classmethod
+    def add_band_power_stream_data(cls, stream_id: int, data: NDArray, channels: List) -> None:
+        """add new datapoints to band power stream
+
+        :param stream_id: id from create_band_power_stream
+        :type stream_id: int
+        :param data: 2d array with new datapoints
+        :type data: NDArray
+        :param channels: rows of data array to add, number of channels must match the stream
+        :type channels: List
+        """
+        check_memory_layout_row_major(data, 2)
+        if len(channels) == 0:
+            raise BrainFlowError('wrong input for channels', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        data_1d = numpy.ascontiguousarray(data[channels], dtype=numpy.float64)
+        res = DataHandlerDLL.get_instance().add_band_power_stream_data(stream_id, data_1d, len(channels),
+                                                                       data.shape[1])
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to add data to band power stream', res)
+
+    @classmethod
+    def get_band_power_stream_powers(cls, stream_id: int, bands: List) -> Tuple:
+        """calculate avg and stddev of BandPowers for the last window of band power stream
+
+        :param stream_id: id from create_band_power_stream
+        :type stream_id: int
+        :param bands: List of typles with bands to use. E.g [(1.5, 4.0), (4.0, 8.0), (8.0, 13.0), (13.0, 30.0), (30.0, 45.0)]
+        :type bands: List
+        :return: avg and stddev arrays for bandpowers
+        :rtype: tuple
+        """
+        if len(bands) == 0:
+            raise BrainFlowError('wrong input for bands', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        num_bands = len(bands)
+        avg_bands = numpy.zeros(num_bands).astype(numpy.float64)
+        stddev_bands = numpy.zeros(num_bands).astype(numpy.float64)
+        start_freqs = numpy.zeros(num_bands)
+        stop_freqs = numpy.zeros(num_bands)
+        for i in range(num_bands):
+            start_freqs[i] = bands[i][0]
+            stop_freqs[i] = bands[i][1]
+        res = DataHandlerDLL.get_instance().get_band_power_stream_powers(stream_id, start_freqs, stop_freqs,
+                                                                         num_bands, avg_bands, stddev_bands)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to get band powers from stream', res)
+
+        return avg_bands, stddev_bands
+
+    @classmethod
+    def release_band_power_stream(cls, stream_id: int) -> None:
+        """release band power stream
+
+        :param stream_id: id from create_band_power_stream
+        :type stream_id: int
+        """
+        res = DataHandlerDLL.get_instance().release_band_power_stream(stream_id)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to release band power stream', res)
+
+    @classmethod
+    def get_eeg_metric(cls, data: NDArray, channels: List, sampling_rate: int, metric: int,
+                       apply_filter: bool) -> float:
+        """calculate mindfulness or restfulness score from eeg channels in a single call, features and model
+        are the same as for MLModel with default classifier
+
+        :param data: 2d array for calculation
+        :type data: NDArray
+        :param channels: channels - rows of data array which should be used for calculation
+        :type channels: List
+        :param sampling_rate: sampling rate
+        :type sampling_rate: int
+        :param metric: BrainFlowMetrics.MINDFULNESS or BrainFlowMetrics.RESTFULNESS
+        :type metric: int
+        :param apply_filter: apply bandpass and bandstop filtrers or not
+        :type apply_filter: bool
+        :return: metric value
+        :rtype: float
+        """
+        check_memory_layout_row_major(data, 2)
+        if len(channels) == 0:
+            raise BrainFlowError('wrong input for channels', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        data_1d = numpy.ascontiguousarray(data[channels], dtype=numpy.float64)
+        output = numpy.zeros(1).astype(numpy.float64)
+        res = DataHandlerDLL.get_instance().get_eeg_metric(data_1d, len(channels), data.shape[1], sampling_rate,
+                                                           metric, int(apply_filter), output)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to get eeg metric', res)
+        return output[0]
+
+    @classmethod
+    def get_band_power_stream_metric(cls, stream_id: int, metric: int) -> float:
+        """calculate mindfulness or restfulness score for the last window of band power stream
+
+        :param stream_id: id from create_band_power_stream
+        :type stream_id: int
+        :param metric: BrainFlowMetrics.MINDFULNESS or BrainFlowMetrics.RESTFULNESS
+        :type metric: int
+        :return: metric value
+        :rtype: float
+        """
+        output = numpy.zeros(1).astype(numpy.float64)
+        res = DataHandlerDLL.get_instance().get_band_power_stream_metric(stream_id, metric, output)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to get eeg metric from stream', res)
+        return output[0]
+
     @classmethod
     def perform_ica(cls, data: NDArray, num_components: int, channels=None) -> Tuple:
         """perform ICA
@@ -1261,6 +2083,65 @@ class DataFilter(object):
 
         return w, k, a, s
 
+    @classmethod
+    def perform_custom_ica(cls, data: NDArray, num_components: int, channels=None, max_iterations: int = 300,
+                           tolerance: float = 0.0001, w_init: NDArray[Float64] = None,
+                           use_float32: bool = False) -> Tuple:
+        """perform ICA with custom convergence settings
+
+        :param data: 2d array for calculation
+        :type data: NDArray
+        :param num_components: number of components
+        :type num_components: int
+        :param channels: channels - rows of data array which should be used for calculation, if None use all
+        :type channels: List
+        :param max_iterations: max number of iterations
+        :type max_iterations: int
+        :param tolerance: convergence tolerance
+        :type tolerance: float
+        :param w_init: num_components x num_components unmixing matrix to start from, if None use random
+        :type w_init: NDArray[Float64]
+        :param use_float32: compute in single precision
+        :type use_float32: bool
+        :return: w, k, a, s matrixes as a tuple
+        :rtype: tuple
+        """
+        check_memory_layout_row_major(data, 2)
+        if num_components < 1:
+            raise BrainFlowError('wrong number of components', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        w_init_ptr = None
+        if w_init is not None:
+            check_memory_layout_row_major(w_init, 2)
+            if w_init.shape != (num_components, num_components):
+                raise BrainFlowError('wrong shape of w_init', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+            w_init = w_init.astype(numpy.float64)
+            w_init_ptr = w_init.ctypes.data_as(ctypes.c_void_p)
+
+        if not channels:
+            channels_to_use = range(data.shape[0])
+        else:
+            channels_to_use = channels
+
+        data_1d = numpy.ascontiguousarray(data[list(channels_to_use)], dtype=numpy.float64).reshape(-1)
+
+        w = numpy.zeros(num_components * num_components).astype(numpy.float64)
+        k = numpy.zeros(len(channels_to_use) * num_components).astype(numpy.float64)
+        a = numpy.zeros(num_components * len(channels_to_use)).astype(numpy.float64)
+        s = numpy.zeros(data.shape[1] * num_components).astype(numpy.float64)
+
+        res = DataHandlerDLL.get_instance().perform_custom_ica(data_1d, len(channels_to_use), data.shape[1],
+                                                               num_components, max_iterations, tolerance, w_init_ptr,
+                                                               int(use_float32), w, k, a, s)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to calculate ICA', res)
+
+        w = w.reshape(num_components, num_components)
+        k = k.reshape(num_components, len(channels_to_use))
+        a = a.reshape(len(channels_to_use), num_components)
+        s = s.reshape(num_components, data.shape[1])
+
+        return w, k, a, s
+
     @classmethod
     def perform_ifft(cls, data: NDArray[Complex128]) -> NDArray[Float64]:
         """perform inverse fft
@@ -1300,7 +2181,7 @@ class DataFilter(object):
         return output[0]
 
     @classmethod
-    def write_file(cls, data, file_name: str, file_mode: str) -> None:
+    def write_file(cls, data, file_name: str, file_mode: str, timestamp_channel: int = -1) -> None:
         """write data to file, in file data will be transposed
 
         :param data: data to store in a file
@@ -1309,6 +2190,8 @@ class DataFilter(object):
         :type file_name: str
         :param file_mode: 'w' to rewrite file or 'a' to append data to file
         :type file_mode: str
+        :param timestamp_channel: for 'wb' and 'ab' modes row used to build timestamp index, -1 to skip it
+        :type timestamp_channel: int
         """
 
         check_memory_layout_row_major(data, 2)
@@ -1321,7 +2204,8 @@ class DataFilter(object):
         except BaseException:
             mode = file_mode
         data_flatten = data.flatten()
-        res = DataHandlerDLL.get_instance().write_file(data_flatten, data.shape[0], data.shape[1], file, mode)
+        res = DataHandlerDLL.get_instance().write_file_with_index(data_flatten, data.shape[0], data.shape[1], file,
+                                                                   mode, timestamp_channel)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to write file', res)
 
@@ -10,6 +10,7 @@ import numpy
 import pkg_resources
 from brainflow.board_shim import BrainFlowError, LogLevels
 from brainflow.exit_codes import BrainFlowExitCodes
+from brainflow.utils import check_memory_layout_row_major
 from nptyping import NDArray
 from numpy.ctypeslib import ndpointer
 
@@ -45,6 +46,16 @@ class BrainFlowModelParams(object):
     :type output_name: str
     :param max_array_size: max array size to preallocate
     :type max_array_size: int
+    :param intra_op_num_threads: onnx runtime intra op threads, 0 for default
+    :type intra_op_num_threads: int
+    :param inter_op_num_threads: onnx runtime inter op threads, 0 for default, >1 for parallel mode
+    :type inter_op_num_threads: int
+    :param graph_optimization_level: onnx runtime graph optimization level: 0, 1, 2 or 99
+    :type graph_optimization_level: int
+    :param use_global_thread_pool: share onnx runtime thread pool between models, all onnx models in a process must use the same value
+    :type use_global_thread_pool: bool
+    :param optimized_model_file: file to cache optimized onnx model
+    :type optimized_model_file: str
     """
 
     def __init__(self, metric, classifier) -> None:
@@ -54,6 +65,11 @@ class BrainFlowModelParams(object):
         self.other_info = ''
         self.output_name = ''
         self.max_array_size = 8192
+        self.intra_op_num_threads = 0
+        self.inter_op_num_threads = 0
+        self.graph_optimization_level = 99
+        self.use_global_thread_pool = False
+        self.optimized_model_file = ''
 
     def to_json(self) -> None:
         return json.dumps(self, default=lambda o: o.__dict__,
@@ -143,6 +159,77 @@ class MLModuleDLL(object):
             ctypes.c_char_p
         ]
 
+        self.predict_batch = self.lib.predict_batch
+        self.predict_batch.restype = ctypes.c_int
+        self.predict_batch.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_char_p
+        ]
+
+        self.predict_multi = self.lib.predict_multi
+        self.predict_multi.restype = ctypes.c_int
+        self.predict_multi.argtypes = [
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
+        self.predict_multi_float32 = self.lib.predict_multi_float32
+        self.predict_multi_float32.restype = ctypes.c_int
+        self.predict_multi_float32.argtypes = [
+            ndpointer(ctypes.c_float),
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
+        self.prepare_with_handle = self.lib.prepare_with_handle
+        self.prepare_with_handle.restype = ctypes.c_int
+        self.prepare_with_handle.argtypes = [
+            ctypes.c_char_p,
+            ctypes.POINTER(ctypes.c_void_p)
+        ]
+
+        self.predict_with_handle = self.lib.predict_with_handle
+        self.predict_with_handle.restype = ctypes.c_int
+        self.predict_with_handle.argtypes = [
+            ctypes.c_void_p,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.predict_batch_with_handle = self.lib.predict_batch_with_handle
+        self.predict_batch_with_handle.restype = ctypes.c_int
+        self.predict_batch_with_handle.argtypes = [
+            ctypes.c_void_p,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.release_with_handle = self.lib.release_with_handle
+        self.release_with_handle.restype = ctypes.c_int
+        self.release_with_handle.argtypes = [
+            ctypes.c_void_p
+        ]
+
         self.get_version_ml_module = self.lib.get_version_ml_module
         self.get_version_ml_module.restype = ctypes.c_int
         self.get_version_ml_module.argtypes = [
@@ -165,6 +252,8 @@ class MLModel(object):
             self.serialized_params = model_params.to_json().encode()
         except BaseException:
             self.serialized_params = model_params.to_json()
+        # handle from prepare_with_handle, predict methods skip params lookup if it is set
+        self.handle = ctypes.c_void_p()
 
     @classmethod
     def set_log_level(cls, log_level: int) -> None:
@@ -251,14 +340,20 @@ class MLModel(object):
     def prepare(self) -> None:
         """prepare classifier"""
 
-        res = MLModuleDLL.get_instance().prepare(self.serialized_params)
+        handle = ctypes.c_void_p()
+        res = MLModuleDLL.get_instance().prepare_with_handle(self.serialized_params, ctypes.byref(handle))
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to prepare classifier', res)
+        self.handle = handle
 
     def release(self) -> None:
         """release classifier"""
 
-        res = MLModuleDLL.get_instance().release(self.serialized_params)
+        if self.handle:
+            res = MLModuleDLL.get_instance().release_with_handle(self.handle)
+            self.handle = ctypes.c_void_p()
+        else:
+            res = MLModuleDLL.get_instance().release(self.serialized_params)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to release classifier', res)
 
@@ -272,7 +367,74 @@ class MLModel(object):
         """
         output = numpy.zeros(self.model_params.max_array_size).astype(numpy.float64)
         output_len = numpy.zeros(1).astype(numpy.int32)
-        res = MLModuleDLL.get_instance().predict(data, data.shape[0], output, output_len, self.serialized_params)
+        if self.handle:
+            res = MLModuleDLL.get_instance().predict_with_handle(self.handle, data, data.shape[0], output, output_len)
+        else:
+            res = MLModuleDLL.get_instance().predict(data, data.shape[0], output, output_len, self.serialized_params)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to calc metric', res)
         return output[0:output_len[0]]
+
+    def predict_batch(self, data: NDArray) -> NDArray:
+        """calculate metric for each row of data in a single call
+
+        :param data: 2d input array, each row is a separate input
+        :type data: NDArray
+        :return: 2d array, rows of output match rows of data
+        :rtype: NDArray
+        """
+        check_memory_layout_row_major(data, 2)
+        batch_size = data.shape[0]
+        output = numpy.zeros(batch_size * self.model_params.max_array_size).astype(numpy.float64)
+        output_len = numpy.zeros(1).astype(numpy.int32)
+        if self.handle:
+            res = MLModuleDLL.get_instance().predict_batch_with_handle(self.handle, data, batch_size, data.shape[1],
+                                                                       output, output_len)
+        else:
+            res = MLModuleDLL.get_instance().predict_batch(data, batch_size, data.shape[1], output, output_len,
+                                                           self.serialized_params)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to calc metric', res)
+        return output[0:output_len[0]].reshape(batch_size, output_len[0] // batch_size)
+
+    def predict_multi(self, inputs: List[NDArray], num_outputs: int = 1) -> List[NDArray]:
+        """calculate metric for model with several inputs and outputs
+
+        :param inputs: batch_size x input_len 2d arrays in model order, if all of them are float32 they are not converted to float64, several inputs are copied into a single buffer
+        :type inputs: List[NDArray]
+        :param num_outputs: number of model outputs
+        :type num_outputs: int
+        :return: batch_size x output_len 2d array per output
+        :rtype: List[NDArray]
+        """
+        if not inputs:
+            raise BrainFlowError('inputs are empty', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        batch_size = inputs[0].shape[0]
+        for data in inputs:
+            check_memory_layout_row_major(data, 2)
+            if data.shape[0] != batch_size:
+                raise BrainFlowError('inputs must have the same batch size',
+                                     BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+        use_float32 = all(data.dtype == numpy.float32 for data in inputs)
+        dtype = numpy.float32 if use_float32 else numpy.float64
+        # C api takes inputs one after another in a single buffer, a lone input is passed as is
+        flatten = [data.astype(dtype, copy=False).reshape(-1) for data in inputs]
+        packed = flatten[0] if len(flatten) == 1 else numpy.concatenate(flatten)
+        input_lens = numpy.array([data.shape[1] for data in inputs]).astype(numpy.int32)
+        output = numpy.zeros(batch_size * self.model_params.max_array_size).astype(numpy.float64)
+        output_lens = numpy.zeros(num_outputs).astype(numpy.int32)
+        if use_float32:
+            res = MLModuleDLL.get_instance().predict_multi_float32(packed, batch_size, input_lens, len(inputs),
+                                                                   output, output_lens, num_outputs,
+                                                                   self.serialized_params)
+        else:
+            res = MLModuleDLL.get_instance().predict_multi(packed, batch_size, input_lens, len(inputs), output,
+                                                           output_lens, num_outputs, self.serialized_params)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to calc metric', res)
+        result = list()
+        offset = 0
+        for output_len in output_lens:
+            result.append(output[offset:offset + output_len].reshape(batch_size, output_len // batch_size))
+            offset += output_len
+        return result
@@ -128,6 +128,31 @@ impl BoardShim {
         Ok(check_brainflow_exit_code(res)?)
     }
 
+    /// Get counters of a streamer as json string.
+    pub fn get_streamer_stats<S: AsRef<str>>(
+        &self,
+        streamer_params: S,
+        preset: BrainFlowPresets,
+    ) -> Result<String> {
+        let streamer_params = CString::new(streamer_params.as_ref())?;
+        let mut response_len = 0;
+        let mut result_char_buffer: [c_char; 8192] = [0; 8192];
+        let (res, response) = unsafe {
+            let res = board_controller::get_streamer_stats(
+                streamer_params.as_ptr(),
+                preset as c_int,
+                result_char_buffer.as_mut_ptr(),
+                &mut response_len,
+                self.board_id as c_int,
+                self.json_brainflow_input_params.as_ptr(),
+            );
+            let response = CStr::from_ptr(result_char_buffer.as_ptr());
+            (res, response)
+        };
+        check_brainflow_exit_code(res)?;
+        Ok(response.to_str()?.to_string())
+    }
+
     /// Stop streaming data.
     pub fn stop_stream(&self) -> Result<()> {
         let res = unsafe {
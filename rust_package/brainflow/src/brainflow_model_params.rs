@@ -13,6 +13,11 @@ pub struct BrainFlowModelParams {
     other_info: String,
     output_name: String,
     max_array_size: usize,
+    intra_op_num_threads: usize,
+    inter_op_num_threads: usize,
+    graph_optimization_level: usize,
+    use_global_thread_pool: bool,
+    optimized_model_file: String,
 }
 
 impl Serialize for BrainFlowModelParams {
@@ -20,13 +25,18 @@ impl Serialize for BrainFlowModelParams {
     where
         S: serde::Serializer,
     {
-        let mut state = serializer.serialize_struct("BrainFlowModelParams", 4)?;
+        let mut state = serializer.serialize_struct("BrainFlowModelParams", 11)?;
         state.serialize_field("metric", &(self.metric as usize))?;
         state.serialize_field("classifier", &(self.classifier as usize))?;
         state.serialize_field("file", &self.file.to_string())?;
         state.serialize_field("other_info", &self.other_info.to_string())?;
         state.serialize_field("output_name", &self.output_name.to_string())?;
         state.serialize_field("max_array_size", &self.max_array_size)?;
+        state.serialize_field("intra_op_num_threads", &self.intra_op_num_threads)?;
+        state.serialize_field("inter_op_num_threads", &self.inter_op_num_threads)?;
+        state.serialize_field("graph_optimization_level", &self.graph_optimization_level)?;
+        state.serialize_field("use_global_thread_pool", &self.use_global_thread_pool)?;
+        state.serialize_field("optimized_model_file", &self.optimized_model_file.to_string())?;
         state.end()
     }
 }
@@ -40,6 +50,11 @@ impl Default for BrainFlowModelParams {
             other_info: Default::default(),
             output_name: "".to_string(),
             max_array_size: 8192,
+            intra_op_num_threads: 0,
+            inter_op_num_threads: 0,
+            graph_optimization_level: 99,
+            use_global_thread_pool: false,
+            optimized_model_file: Default::default(),
         }
     }
 }
@@ -92,6 +107,36 @@ impl BrainFlowModelParamsBuilder {
         self
     }
 
+    /// ONNX Runtime intra op threads, 0 for default.
+    pub fn intra_op_num_threads(mut self, intra_op_num_threads: usize) -> Self {
+        self.params.intra_op_num_threads = intra_op_num_threads;
+        self
+    }
+
+    /// ONNX Runtime inter op threads, 0 for default, more than 1 enables parallel execution.
+    pub fn inter_op_num_threads(mut self, inter_op_num_threads: usize) -> Self {
+        self.params.inter_op_num_threads = inter_op_num_threads;
+        self
+    }
+
+    /// ONNX Runtime graph optimization level: 0, 1, 2 or 99.
+    pub fn graph_optimization_level(mut self, graph_optimization_level: usize) -> Self {
+        self.params.graph_optimization_level = graph_optimization_level;
+        self
+    }
+
+    /// Share ONNX Runtime thread pool between models.
+    pub fn use_global_thread_pool(mut self, use_global_thread_pool: bool) -> Self {
+        self.params.use_global_thread_pool = use_global_thread_pool;
+        self
+    }
+
+    /// File to cache optimized ONNX model.
+    pub fn optimized_model_file<S: AsRef<str>>(mut self, optimized_model_file: S) -> Self {
+        self.params.optimized_model_file = optimized_model_file.as_ref().to_string();
+        self
+    }
+
     /// Build BrainFlowModelParams with the given options.
     pub fn build(self) -> BrainFlowModelParams {
         self.params
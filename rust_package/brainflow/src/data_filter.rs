@@ -9,7 +9,7 @@ use std::os::raw::c_char;
 use crate::error::{BrainFlowError, Error};
 use crate::ffi::data_handler;
 use crate::{
-    check_brainflow_exit_code, AggOperations, DetrendOperations, FilterTypes, LogLevels,
+    check_brainflow_exit_code, AggOperations, BrainFlowMetrics, DetrendOperations, FilterTypes, LogLevels,
     NoiseTypes, Result, WindowOperations, WaveletTypes, WaveletExtensionTypes, WaveletDenoisingTypes, ThresholdTypes, NoiseEstimationLevelTypes,
 };
 
@@ -175,6 +175,174 @@ pub fn remove_environmental_noise(
     Ok(())
 }
 
+/// Create stateful low pass filter, it keeps history between calls of [process_filter].
+pub fn create_lowpass_filter(
+    sampling_rate: usize,
+    cutoff: f64,
+    order: usize,
+    filter_type: FilterTypes,
+    ripple: f64,
+    num_channels: usize,
+) -> Result<i32> {
+    let mut filter_id = 0;
+    let res = unsafe {
+        data_handler::create_lowpass_filter(
+            sampling_rate as c_int,
+            cutoff as c_double,
+            order as c_int,
+            filter_type as c_int,
+            ripple as c_double,
+            num_channels as c_int,
+            &mut filter_id,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(filter_id)
+}
+
+/// Create stateful high pass filter, it keeps history between calls of [process_filter].
+pub fn create_highpass_filter(
+    sampling_rate: usize,
+    cutoff: f64,
+    order: usize,
+    filter_type: FilterTypes,
+    ripple: f64,
+    num_channels: usize,
+) -> Result<i32> {
+    let mut filter_id = 0;
+    let res = unsafe {
+        data_handler::create_highpass_filter(
+            sampling_rate as c_int,
+            cutoff as c_double,
+            order as c_int,
+            filter_type as c_int,
+            ripple as c_double,
+            num_channels as c_int,
+            &mut filter_id,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(filter_id)
+}
+
+/// Create stateful band pass filter, it keeps history between calls of [process_filter].
+pub fn create_bandpass_filter(
+    sampling_rate: usize,
+    start_freq: f64,
+    stop_freq: f64,
+    order: usize,
+    filter_type: FilterTypes,
+    ripple: f64,
+    num_channels: usize,
+) -> Result<i32> {
+    let mut filter_id = 0;
+    let res = unsafe {
+        data_handler::create_bandpass_filter(
+            sampling_rate as c_int,
+            start_freq as c_double,
+            stop_freq as c_double,
+            order as c_int,
+            filter_type as c_int,
+            ripple as c_double,
+            num_channels as c_int,
+            &mut filter_id,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(filter_id)
+}
+
+/// Create stateful band stop filter, it keeps history between calls of [process_filter].
+pub fn create_bandstop_filter(
+    sampling_rate: usize,
+    start_freq: f64,
+    stop_freq: f64,
+    order: usize,
+    filter_type: FilterTypes,
+    ripple: f64,
+    num_channels: usize,
+) -> Result<i32> {
+    let mut filter_id = 0;
+    let res = unsafe {
+        data_handler::create_bandstop_filter(
+            sampling_rate as c_int,
+            start_freq as c_double,
+            stop_freq as c_double,
+            order as c_int,
+            filter_type as c_int,
+            ripple as c_double,
+            num_channels as c_int,
+            &mut filter_id,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(filter_id)
+}
+
+/// Create stateful notch filter to remove environmental noise.
+pub fn create_environmental_noise_filter(
+    sampling_rate: usize,
+    noise_type: NoiseTypes,
+    num_channels: usize,
+) -> Result<i32> {
+    let mut filter_id = 0;
+    let res = unsafe {
+        data_handler::create_environmental_noise_filter(
+            sampling_rate as c_int,
+            noise_type as c_int,
+            num_channels as c_int,
+            &mut filter_id,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(filter_id)
+}
+
+/// Filter next chunk of a channel in-place, history is kept between calls.
+pub fn process_filter(filter_id: i32, channel: usize, data: &mut [f64]) -> Result<()> {
+    let res = unsafe {
+        data_handler::process_filter(
+            filter_id as c_int,
+            channel as c_int,
+            data.as_mut_ptr() as *mut c_double,
+            data.len() as c_int,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(())
+}
+
+/// Filter next chunk of all channels in-place, rows of data must match channels of filter.
+pub fn process_filter_block(filter_id: i32, data: &mut Array2<f64>) -> Result<()> {
+    let (rows, cols) = (data.nrows(), data.ncols());
+    let mut raw_data = data.iter().copied().collect::<Vec<f64>>();
+    let res = unsafe {
+        data_handler::process_filter_block(
+            filter_id as c_int,
+            raw_data.as_mut_ptr() as *mut c_double,
+            rows as c_int,
+            cols as c_int,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    for (value, filtered) in data.iter_mut().zip(raw_data) {
+        *value = filtered;
+    }
+    Ok(())
+}
+
+/// Clear history of all channels of a filter.
+pub fn reset_filter(filter_id: i32) -> Result<()> {
+    let res = unsafe { data_handler::reset_filter(filter_id as c_int) };
+    Ok(check_brainflow_exit_code(res)?)
+}
+
+/// Release filter created by create_*_filter functions.
+pub fn release_filter(filter_id: i32) -> Result<()> {
+    let res = unsafe { data_handler::release_filter(filter_id as c_int) };
+    Ok(check_brainflow_exit_code(res)?)
+}
+
 /// Smooth data using moving average or median.
 pub fn perform_rolling_filter(
     data: &mut [f64],
@@ -437,6 +605,42 @@ pub fn detect_peaks_z_score(
     Ok(output)
 }
 
+/// Create z score peak detector which keeps its state between calls.
+pub fn create_z_score_peak_detector(lag: usize, threshold: f64, influence: f64) -> Result<i32> {
+    let mut detector_id = 0;
+    let res = unsafe {
+        data_handler::create_z_score_peak_detector(
+            lag as c_int,
+            threshold as c_double,
+            influence as c_double,
+            &mut detector_id,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(detector_id)
+}
+
+/// Detect peaks in the next chunk of data, state is kept between calls.
+pub fn process_z_score_peak_detector(detector_id: i32, data: &mut [f64]) -> Result<Vec<f64>> {
+    let mut output = vec![0.0; data.len()];
+    let res = unsafe {
+        data_handler::process_z_score_peak_detector(
+            detector_id as c_int,
+            data.as_mut_ptr() as *mut c_double,
+            data.len() as c_int,
+            output.as_mut_ptr() as *mut c_double,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(output)
+}
+
+/// Release z score peak detector.
+pub fn release_z_score_peak_detector(detector_id: i32) -> Result<()> {
+    let res = unsafe { data_handler::release_z_score_peak_detector(detector_id as c_int) };
+    Ok(check_brainflow_exit_code(res)?)
+}
+
 /// Perform inverse wavelet transform.
 pub fn perform_inverse_wavelet_transform(wavelet_transform: WaveletTransform) -> Result<Vec<f64>> {
     let mut wavelet_transform = wavelet_transform;
@@ -483,10 +687,84 @@ pub fn perform_wavelet_denoising(
     Ok(())
 }
 
+/// Perform wavelet transform of each row of data, returns coefficients of each row
+/// in the same format as [perform_wavelet_transform] and lengths of blocks which are the same for all rows.
+pub fn perform_wavelet_transform_block(
+    data: &Array2<f64>,
+    wavelet: WaveletTypes,
+    decomposition_level: usize,
+    extension: WaveletExtensionTypes,
+) -> Result<(Array2<f64>, Vec<i32>)> {
+    let (rows, cols) = (data.nrows(), data.ncols());
+    let mut raw_data = data.iter().copied().collect::<Vec<f64>>();
+    let mut coefficients = vec![0.0; rows * (cols + 2 * decomposition_level * (40 + 1))];
+    let mut decomposition_lengths = vec![0; decomposition_level + 1];
+    let res = unsafe {
+        data_handler::perform_wavelet_transform_block(
+            raw_data.as_mut_ptr() as *mut c_double,
+            rows as c_int,
+            cols as c_int,
+            wavelet as c_int,
+            decomposition_level as c_int,
+            extension as c_int,
+            coefficients.as_mut_ptr() as *mut c_double,
+            decomposition_lengths.as_mut_ptr() as *mut c_int,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    let total_length = decomposition_lengths.iter().sum::<i32>() as usize;
+    coefficients.truncate(rows * total_length);
+    let coefficients = ArrayBase::from_vec(coefficients);
+    let coefficients = coefficients.into_shape((rows, total_length)).unwrap();
+    Ok((coefficients, decomposition_lengths))
+}
+
+/// Perform wavelet denoising of each row of data.
+pub fn perform_wavelet_denoising_block(
+    data: &mut Array2<f64>,
+    wavelet: WaveletTypes,
+    decomposition_level: usize,
+    wavelet_denoising: WaveletDenoisingTypes,
+    wavelet_threshold: ThresholdTypes,
+    extension: WaveletExtensionTypes,
+    noise_level: NoiseEstimationLevelTypes,
+) -> Result<()> {
+    let (rows, cols) = (data.nrows(), data.ncols());
+    let mut raw_data = data.iter().copied().collect::<Vec<f64>>();
+    let res = unsafe {
+        data_handler::perform_wavelet_denoising_block(
+            raw_data.as_mut_ptr() as *mut c_double,
+            rows as c_int,
+            cols as c_int,
+            wavelet as c_int,
+            decomposition_level as c_int,
+            wavelet_denoising as c_int,
+            wavelet_threshold as c_int,
+            extension as c_int,
+            noise_level as c_int,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    for (value, denoised) in data.iter_mut().zip(raw_data) {
+        *value = denoised;
+    }
+    Ok(())
+}
+
 /// Calculate filters and the corresponding eigenvalues using the Common Spatial Patterns.
 pub fn get_csp<Labels>(
     data: &Array3<f64>,
     labels: &Array1<f64>,
+) -> Result<(Array2<f64>, Array1<f64>)> {
+    get_regularized_csp(data, labels, 0.0)
+}
+
+/// Calculate Common Spatial Patterns with class covariances shrunk towards identity,
+/// shrinkage is in range [0, 1] and 0 means no regularization.
+pub fn get_regularized_csp(
+    data: &Array3<f64>,
+    labels: &Array1<f64>,
+    shrinkage: f64,
 ) -> Result<(Array2<f64>, Array1<f64>)> {
     let shape = data.shape();
     let n_epochs = shape[0];
@@ -496,31 +774,54 @@ pub fn get_csp<Labels>(
 
     let labels: Vec<f64> = labels.into_iter().cloned().collect();
 
-    let mut output_filters = Vec::<f64>::with_capacity(n_channels * n_channels);
-    let mut output_eigenvalues = Vec::<f64>::with_capacity(n_channels);
+    let mut output_filters = vec![0.0; n_channels * n_channels];
+    let mut output_eigenvalues = vec![0.0; n_channels];
 
     let res = unsafe {
-        data_handler::get_csp(
+        data_handler::get_regularized_csp(
             data.as_ptr() as *const c_double,
             labels.as_ptr() as *const c_double,
             n_epochs as c_int,
             n_channels as c_int,
             n_times as c_int,
+            shrinkage as c_double,
             output_filters.as_mut_ptr() as *mut c_double,
             output_eigenvalues.as_mut_ptr() as *mut c_double,
         )
     };
     check_brainflow_exit_code(res)?;
 
-    unsafe { output_filters.set_len(n_channels * n_channels) };
-    unsafe { output_eigenvalues.set_len(n_channels) };
-
     let output_filters = ArrayBase::from_vec(output_filters);
     let output_filters = output_filters.into_shape((n_channels, n_channels)).unwrap();
     let output_eigenvalues = Array1::from(output_eigenvalues);
     Ok((output_filters, output_eigenvalues))
 }
 
+/// Apply [n_filters x n_channels] filters from [get_csp] to [n_channels x n_times] data.
+pub fn apply_csp_filters(filters: &Array2<f64>, data: &Array2<f64>) -> Result<Array2<f64>> {
+    let (n_filters, n_channels) = (filters.nrows(), filters.ncols());
+    let n_times = data.ncols();
+    if data.nrows() != n_channels {
+        return Err(Error::BrainFlowError(BrainFlowError::InvalidArgumentsError));
+    }
+    let filters: Vec<f64> = filters.iter().copied().collect();
+    let data: Vec<f64> = data.iter().copied().collect();
+    let mut output = vec![0.0; n_filters * n_times];
+    let res = unsafe {
+        data_handler::apply_csp_filters(
+            filters.as_ptr() as *const c_double,
+            n_filters as c_int,
+            n_channels as c_int,
+            data.as_ptr() as *const c_double,
+            n_times as c_int,
+            output.as_mut_ptr() as *mut c_double,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    let output = ArrayBase::from_vec(output);
+    Ok(output.into_shape((n_filters, n_times)).unwrap())
+}
+
 /// Perform data windowing.
 pub fn get_window(window_function: WindowOperations, window_len: usize) -> Result<Vec<f64>> {
     let mut output = Vec::<f64>::with_capacity(window_len);
@@ -537,6 +838,41 @@ pub fn get_window(window_function: WindowOperations, window_len: usize) -> Resul
     Ok(output)
 }
 
+/// Perform data windowing, param is alpha for TUKEY and beta for KAISER, ignored by other windows.
+pub fn get_custom_window(
+    window_function: WindowOperations,
+    window_len: usize,
+    param: f64,
+) -> Result<Vec<f64>> {
+    let mut output = vec![0.0; window_len];
+    let res = unsafe {
+        data_handler::get_custom_window(
+            window_function as c_int,
+            window_len as c_int,
+            param as c_double,
+            output.as_mut_ptr() as *mut c_double,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(output)
+}
+
+/// Calculate DPSS tapers for multitaper spectral estimation, returns tapers in rows with unit energy.
+pub fn get_dpss_tapers(window_len: usize, nw: f64, num_tapers: usize) -> Result<Array2<f64>> {
+    let mut tapers = vec![0.0; num_tapers * window_len];
+    let res = unsafe {
+        data_handler::get_dpss_tapers(
+            window_len as c_int,
+            nw as c_double,
+            num_tapers as c_int,
+            tapers.as_mut_ptr() as *mut c_double,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    let tapers = ArrayBase::from_vec(tapers);
+    Ok(tapers.into_shape((num_tapers, window_len)).unwrap())
+}
+
 /// Perform direct FFT.
 pub fn perform_fft(data: &mut [f64], window_function: WindowOperations) -> Result<Vec<Complex64>> {
     let mut output_re = Vec::<f64>::with_capacity(data.len() / 2 + 1);
@@ -629,6 +965,33 @@ pub fn get_psd(
     })
 }
 
+/// Calculate multitaper PSD, average of PSDs with DPSS tapers, num_tapers is usually 2 * nw - 1.
+pub fn get_psd_multitaper(
+    data: &mut [f64],
+    sampling_rate: usize,
+    nw: f64,
+    num_tapers: usize,
+) -> Result<Psd> {
+    let mut amplitude = vec![0.0; data.len() / 2 + 1];
+    let mut frequency = vec![0.0; data.len() / 2 + 1];
+    let res = unsafe {
+        data_handler::get_psd_multitaper(
+            data.as_mut_ptr() as *mut c_double,
+            data.len() as c_int,
+            sampling_rate as c_int,
+            nw as c_double,
+            num_tapers as c_int,
+            amplitude.as_mut_ptr() as *mut c_double,
+            frequency.as_mut_ptr() as *mut c_double,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(Psd {
+        amplitude,
+        frequency,
+    })
+}
+
 /// Calculate PSD using Welch method.
 pub fn get_psd_welch(
     data: &mut [f64],
@@ -722,6 +1085,62 @@ pub fn perform_ica(
     perform_ica_select_channels(data, num_components, channels)
 }
 
+/// Calculate ICA with custom convergence settings, w_init is num_components x num_components
+/// unmixing matrix to start from or None for random. Returns w, k, a and s matrices.
+pub fn perform_custom_ica(
+    data: &Array2<f64>,
+    num_components: usize,
+    channels: Vec<usize>,
+    max_iterations: usize,
+    tolerance: f64,
+    w_init: Option<&Array2<f64>>,
+    use_float32: bool,
+) -> Result<(Array2<f64>, Array2<f64>, Array2<f64>, Array2<f64>)> {
+    if let Some(w_init) = w_init {
+        if w_init.shape() != [num_components, num_components] {
+            return Err(Error::BrainFlowError(BrainFlowError::InvalidArgumentsError));
+        }
+    }
+    let (rows, cols) = (channels.len(), data.ncols());
+    let mut raw_data = channels
+        .iter()
+        .flat_map(|&channel| data.row(channel).to_vec())
+        .collect::<Vec<f64>>();
+    let w_init = w_init.map(|w_init| w_init.iter().copied().collect::<Vec<f64>>());
+    let w_init_ptr = match &w_init {
+        Some(w_init) => w_init.as_ptr() as *const c_double,
+        None => std::ptr::null(),
+    };
+
+    let mut w = vec![0.0; num_components * num_components];
+    let mut k = vec![0.0; rows * num_components];
+    let mut a = vec![0.0; num_components * rows];
+    let mut s = vec![0.0; cols * num_components];
+
+    let res = unsafe {
+        data_handler::perform_custom_ica(
+            raw_data.as_mut_ptr() as *mut c_double,
+            rows as c_int,
+            cols as c_int,
+            num_components as c_int,
+            max_iterations as c_int,
+            tolerance as c_double,
+            w_init_ptr,
+            use_float32 as c_int,
+            w.as_mut_ptr() as *mut c_double,
+            k.as_mut_ptr() as *mut c_double,
+            a.as_mut_ptr() as *mut c_double,
+            s.as_mut_ptr() as *mut c_double,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    let w = ArrayBase::from_vec(w).into_shape((num_components, num_components)).unwrap();
+    let k = ArrayBase::from_vec(k).into_shape((num_components, rows)).unwrap();
+    let a = ArrayBase::from_vec(a).into_shape((rows, num_components)).unwrap();
+    let s = ArrayBase::from_vec(s).into_shape((num_components, cols)).unwrap();
+    Ok((w, k, a, s))
+}
+
 /// Calculate avg and stddev of BandPowers across all channels, bands are 1-4,4-8,8-13,13-30,30-50.
 pub fn get_custom_band_powers(
     data: Array2<f64>,
@@ -783,6 +1202,116 @@ pub fn get_avg_band_powers(
     get_custom_band_powers(data, vector, eeg_channels, sampling_rate, apply_filters)
 }
 
+/// Create stateful band power calculator for the last window_len datapoints.
+pub fn create_band_power_stream(
+    sampling_rate: usize,
+    window_len: usize,
+    num_channels: usize,
+    apply_filters: bool,
+) -> Result<i32> {
+    let mut stream_id = 0;
+    let res = unsafe {
+        data_handler::create_band_power_stream(
+            sampling_rate as c_int,
+            window_len as c_int,
+            num_channels as c_int,
+            apply_filters as c_int,
+            &mut stream_id,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(stream_id)
+}
+
+/// Add new datapoints of channels, number of channels must match the stream.
+pub fn add_band_power_stream_data(
+    stream_id: i32,
+    data: &Array2<f64>,
+    eeg_channels: Vec<usize>,
+) -> Result<()> {
+    let (rows, cols) = (eeg_channels.len(), data.ncols());
+    let mut raw_data = eeg_channels
+        .iter()
+        .flat_map(|&channel| data.row(channel).to_vec())
+        .collect::<Vec<f64>>();
+    let res = unsafe {
+        data_handler::add_band_power_stream_data(
+            stream_id as c_int,
+            raw_data.as_mut_ptr() as *mut c_double,
+            rows as c_int,
+            cols as c_int,
+        )
+    };
+    Ok(check_brainflow_exit_code(res)?)
+}
+
+/// Calculate avg and stddev of BandPowers for the last window of band power stream.
+pub fn get_band_power_stream_powers(stream_id: i32, bands: Vec<Band>) -> Result<(Vec<f64>, Vec<f64>)> {
+    let (mut x, mut y): (Vec<_>, Vec<_>) = bands.into_iter().map(|Band{freq_start, freq_stop}| (freq_start, freq_stop)).unzip();
+
+    let mut avg_band_powers = vec![0.0; x.len()];
+    let mut stddev_band_powers = vec![0.0; x.len()];
+
+    let res = unsafe {
+        data_handler::get_band_power_stream_powers(
+            stream_id as c_int,
+            x.as_mut_ptr() as *mut c_double,
+            y.as_mut_ptr() as *mut c_double,
+            x.len() as c_int,
+            avg_band_powers.as_mut_ptr() as *mut c_double,
+            stddev_band_powers.as_mut_ptr() as *mut c_double,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok((avg_band_powers, stddev_band_powers))
+}
+
+/// Release band power stream.
+pub fn release_band_power_stream(stream_id: i32) -> Result<()> {
+    let res = unsafe { data_handler::release_band_power_stream(stream_id as c_int) };
+    Ok(check_brainflow_exit_code(res)?)
+}
+
+/// Calculate mindfulness or restfulness score from eeg channels in a single call,
+/// features and model are the same as for MlModel with default classifier.
+pub fn get_eeg_metric(
+    data: &Array2<f64>,
+    eeg_channels: Vec<usize>,
+    sampling_rate: usize,
+    metric: BrainFlowMetrics,
+    apply_filters: bool,
+) -> Result<f64> {
+    let (rows, cols) = (eeg_channels.len(), data.ncols());
+    let mut raw_data = eeg_channels
+        .iter()
+        .flat_map(|&channel| data.row(channel).to_vec())
+        .collect::<Vec<f64>>();
+    let mut output = 0.0;
+    let res = unsafe {
+        data_handler::get_eeg_metric(
+            raw_data.as_mut_ptr() as *mut c_double,
+            rows as c_int,
+            cols as c_int,
+            sampling_rate as c_int,
+            metric as c_int,
+            apply_filters as c_int,
+            &mut output,
+        )
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(output)
+}
+
+/// Calculate mindfulness or restfulness score for the last window of band power stream.
+pub fn get_band_power_stream_metric(stream_id: i32, metric: BrainFlowMetrics) -> Result<f64> {
+    let mut output = 0.0;
+    let res = unsafe {
+        data_handler::get_band_power_stream_metric(stream_id as c_int, metric as c_int, &mut output)
+    };
+    check_brainflow_exit_code(res)?;
+    Ok(output)
+}
+
 /// Calculate band power.
 pub fn get_band_power(psd: &mut Psd, band: Band) -> Result<f64> {
     let mut band_power = 0.0;
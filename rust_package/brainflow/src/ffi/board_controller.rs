@@ -281,6 +281,16 @@ extern "C" {
         json_brainflow_input_params: *const ::std::os::raw::c_char,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn get_streamer_stats(
+        streamer: *const ::std::os::raw::c_char,
+        preset: ::std::os::raw::c_int,
+        stats: *mut ::std::os::raw::c_char,
+        stats_len: *mut ::std::os::raw::c_int,
+        board_id: ::std::os::raw::c_int,
+        json_brainflow_input_params: *const ::std::os::raw::c_char,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn release_all_sessions() -> ::std::os::raw::c_int;
 }
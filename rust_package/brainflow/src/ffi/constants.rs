@@ -107,6 +107,10 @@ pub enum AggOperations {
     Mean = 0,
     Median = 1,
     Each = 2,
+    Stddev = 3,
+    Min = 4,
+    Max = 5,
+    Rms = 6,
 }
 #[repr(i32)]
 #[derive(FromPrimitive, ToPrimitive, Debug, Copy, Clone, Hash, PartialEq, Eq)]
@@ -115,6 +119,9 @@ pub enum WindowOperations {
     Hanning = 1,
     Hamming = 2,
     BlackmanHarris = 3,
+    Tukey = 4,
+    Kaiser = 5,
+    FlatTop = 6,
 }
 #[repr(i32)]
 #[derive(FromPrimitive, ToPrimitive, Debug, Copy, Clone, Hash, PartialEq, Eq)]
@@ -57,6 +57,86 @@ extern "C" {
         noise_type: ::std::os::raw::c_int,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn create_lowpass_filter(
+        sampling_rate: ::std::os::raw::c_int,
+        cutoff: f64,
+        order: ::std::os::raw::c_int,
+        filter_type: ::std::os::raw::c_int,
+        ripple: f64,
+        num_channels: ::std::os::raw::c_int,
+        filter_id: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn create_highpass_filter(
+        sampling_rate: ::std::os::raw::c_int,
+        cutoff: f64,
+        order: ::std::os::raw::c_int,
+        filter_type: ::std::os::raw::c_int,
+        ripple: f64,
+        num_channels: ::std::os::raw::c_int,
+        filter_id: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn create_bandpass_filter(
+        sampling_rate: ::std::os::raw::c_int,
+        start_freq: f64,
+        stop_freq: f64,
+        order: ::std::os::raw::c_int,
+        filter_type: ::std::os::raw::c_int,
+        ripple: f64,
+        num_channels: ::std::os::raw::c_int,
+        filter_id: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn create_bandstop_filter(
+        sampling_rate: ::std::os::raw::c_int,
+        start_freq: f64,
+        stop_freq: f64,
+        order: ::std::os::raw::c_int,
+        filter_type: ::std::os::raw::c_int,
+        ripple: f64,
+        num_channels: ::std::os::raw::c_int,
+        filter_id: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn create_environmental_noise_filter(
+        sampling_rate: ::std::os::raw::c_int,
+        noise_type: ::std::os::raw::c_int,
+        num_channels: ::std::os::raw::c_int,
+        filter_id: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn process_filter(
+        filter_id: ::std::os::raw::c_int,
+        channel: ::std::os::raw::c_int,
+        data: *mut f64,
+        data_len: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn process_filter_block(
+        filter_id: ::std::os::raw::c_int,
+        data: *mut f64,
+        rows: ::std::os::raw::c_int,
+        cols: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn reset_filter(
+        filter_id: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn release_filter(
+        filter_id: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn perform_rolling_filter(
         data: *mut f64,
@@ -85,6 +165,18 @@ extern "C" {
         decomposition_lengths: *mut ::std::os::raw::c_int,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn perform_wavelet_transform_block(
+        data: *mut f64,
+        rows: ::std::os::raw::c_int,
+        cols: ::std::os::raw::c_int,
+        wavelet: ::std::os::raw::c_int,
+        decomposition_level: ::std::os::raw::c_int,
+        extension: ::std::os::raw::c_int,
+        output_data: *mut f64,
+        decomposition_lengths: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn perform_inverse_wavelet_transform(
         wavelet_coeffs: *mut f64,
@@ -108,6 +200,19 @@ extern "C" {
         noise_level: ::std::os::raw::c_int,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn perform_wavelet_denoising_block(
+        data: *mut f64,
+        rows: ::std::os::raw::c_int,
+        cols: ::std::os::raw::c_int,
+        wavelet: ::std::os::raw::c_int,
+        decomposition_level: ::std::os::raw::c_int,
+        wavelet_denoising: ::std::os::raw::c_int,
+        threshold: ::std::os::raw::c_int,
+        extenstion_type: ::std::os::raw::c_int,
+        noise_level: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn get_csp(
         data: *const f64,
@@ -119,6 +224,28 @@ extern "C" {
         output_d: *mut f64,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn get_regularized_csp(
+        data: *const f64,
+        labels: *const f64,
+        n_epochs: ::std::os::raw::c_int,
+        n_channels: ::std::os::raw::c_int,
+        n_times: ::std::os::raw::c_int,
+        shrinkage: f64,
+        output_w: *mut f64,
+        output_d: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn apply_csp_filters(
+        filters: *const f64,
+        n_filters: ::std::os::raw::c_int,
+        n_channels: ::std::os::raw::c_int,
+        data: *const f64,
+        n_times: ::std::os::raw::c_int,
+        output: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn get_window(
         window_function: ::std::os::raw::c_int,
@@ -126,6 +253,22 @@ extern "C" {
         output_window: *mut f64,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn get_custom_window(
+        window_function: ::std::os::raw::c_int,
+        window_len: ::std::os::raw::c_int,
+        param: f64,
+        output_window: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn get_dpss_tapers(
+        window_len: ::std::os::raw::c_int,
+        nw: f64,
+        num_tapers: ::std::os::raw::c_int,
+        output_tapers: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn perform_fft(
         data: *mut f64,
@@ -159,6 +302,17 @@ extern "C" {
         output_freq: *mut f64,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn get_psd_multitaper(
+        data: *mut f64,
+        data_len: ::std::os::raw::c_int,
+        sampling_rate: ::std::os::raw::c_int,
+        nw: f64,
+        num_tapers: ::std::os::raw::c_int,
+        output_ampl: *mut f64,
+        output_freq: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn detrend(
         data: *mut f64,
@@ -210,6 +364,56 @@ extern "C" {
         stddev_band_powers: *mut f64,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn create_band_power_stream(
+        sampling_rate: ::std::os::raw::c_int,
+        window_len: ::std::os::raw::c_int,
+        num_channels: ::std::os::raw::c_int,
+        apply_filters: ::std::os::raw::c_int,
+        stream_id: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn add_band_power_stream_data(
+        stream_id: ::std::os::raw::c_int,
+        data: *mut f64,
+        rows: ::std::os::raw::c_int,
+        cols: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn get_band_power_stream_powers(
+        stream_id: ::std::os::raw::c_int,
+        start_freqs: *mut f64,
+        stop_freqs: *mut f64,
+        num_bands: ::std::os::raw::c_int,
+        avg_band_powers: *mut f64,
+        stddev_band_powers: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn release_band_power_stream(
+        stream_id: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn get_eeg_metric(
+        raw_data: *mut f64,
+        rows: ::std::os::raw::c_int,
+        cols: ::std::os::raw::c_int,
+        sampling_rate: ::std::os::raw::c_int,
+        metric: ::std::os::raw::c_int,
+        apply_filters: ::std::os::raw::c_int,
+        output: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn get_band_power_stream_metric(
+        stream_id: ::std::os::raw::c_int,
+        metric: ::std::os::raw::c_int,
+        output: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn get_railed_percentage(
         raw_data: *mut f64,
@@ -260,6 +464,27 @@ extern "C" {
         output: *mut f64,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn create_z_score_peak_detector(
+        lag: ::std::os::raw::c_int,
+        threshold: f64,
+        influence: f64,
+        detector_id: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn process_z_score_peak_detector(
+        detector_id: ::std::os::raw::c_int,
+        data: *mut f64,
+        data_len: ::std::os::raw::c_int,
+        output: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn release_z_score_peak_detector(
+        detector_id: ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn perform_ica(
         data: *mut f64,
@@ -272,6 +497,22 @@ extern "C" {
         s_mat: *mut f64,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn perform_custom_ica(
+        data: *mut f64,
+        rows: ::std::os::raw::c_int,
+        cols: ::std::os::raw::c_int,
+        num_components: ::std::os::raw::c_int,
+        max_iterations: ::std::os::raw::c_int,
+        tolerance: f64,
+        w_init: *const f64,
+        use_float32: ::std::os::raw::c_int,
+        w_mat: *mut f64,
+        k_mat: *mut f64,
+        a_mat: *mut f64,
+        s_mat: *mut f64,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn set_log_level_data_handler(log_level: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
 }
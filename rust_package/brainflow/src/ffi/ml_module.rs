@@ -15,12 +15,74 @@ extern "C" {
         json_params: *const ::std::os::raw::c_char,
     ) -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn predict_batch(
+        data: *mut f64,
+        batch_size: ::std::os::raw::c_int,
+        data_len: ::std::os::raw::c_int,
+        output: *mut f64,
+        output_len: *mut ::std::os::raw::c_int,
+        json_params: *const ::std::os::raw::c_char,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn predict_multi(
+        data: *mut f64,
+        batch_size: ::std::os::raw::c_int,
+        input_lens: *mut ::std::os::raw::c_int,
+        num_inputs: ::std::os::raw::c_int,
+        output: *mut f64,
+        output_lens: *mut ::std::os::raw::c_int,
+        num_outputs: ::std::os::raw::c_int,
+        json_params: *const ::std::os::raw::c_char,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn predict_multi_float32(
+        data: *mut f32,
+        batch_size: ::std::os::raw::c_int,
+        input_lens: *mut ::std::os::raw::c_int,
+        num_inputs: ::std::os::raw::c_int,
+        output: *mut f64,
+        output_lens: *mut ::std::os::raw::c_int,
+        num_outputs: ::std::os::raw::c_int,
+        json_params: *const ::std::os::raw::c_char,
+    ) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn release(json_params: *const ::std::os::raw::c_char) -> ::std::os::raw::c_int;
 }
 extern "C" {
     pub fn release_all() -> ::std::os::raw::c_int;
 }
+extern "C" {
+    pub fn prepare_with_handle(
+        json_params: *const ::std::os::raw::c_char,
+        handle: *mut *mut ::std::os::raw::c_void,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn predict_with_handle(
+        handle: *mut ::std::os::raw::c_void,
+        data: *mut f64,
+        data_len: ::std::os::raw::c_int,
+        output: *mut f64,
+        output_len: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn predict_batch_with_handle(
+        handle: *mut ::std::os::raw::c_void,
+        data: *mut f64,
+        batch_size: ::std::os::raw::c_int,
+        data_len: ::std::os::raw::c_int,
+        output: *mut f64,
+        output_len: *mut ::std::os::raw::c_int,
+    ) -> ::std::os::raw::c_int;
+}
+extern "C" {
+    pub fn release_with_handle(handle: *mut ::std::os::raw::c_void) -> ::std::os::raw::c_int;
+}
 extern "C" {
     pub fn set_log_level_ml_module(log_level: ::std::os::raw::c_int) -> ::std::os::raw::c_int;
 }
@@ -1,17 +1,29 @@
+use ndarray::{Array2, ArrayBase};
 use std::{
     ffi::{CString, CStr},
-    os::raw::{c_double, c_int, c_char},
+    os::raw::{c_double, c_float, c_int, c_char, c_void},
+    ptr,
+    sync::RwLock,
 };
 
+use crate::error::{BrainFlowError, Error};
 use crate::{
     brainflow_model_params::BrainFlowModelParams, check_brainflow_exit_code, LogLevels, Result,
 };
 
 use crate::ffi::ml_module;
 
+/// Handle from prepare_with_handle, null if classifier was not prepared by this model.
+struct ModelHandle(*mut c_void);
+
+// calls with the same handle are synchronized by BrainFlow, release takes the write lock
+unsafe impl Send for ModelHandle {}
+unsafe impl Sync for ModelHandle {}
+
 pub struct MlModel {
     model_params: BrainFlowModelParams,
     json_model_params: CString,
+    handle: RwLock<ModelHandle>,
 }
 
 impl MlModel {
@@ -19,27 +31,45 @@ impl MlModel {
     pub fn new(model_params: BrainFlowModelParams) -> Result<Self> {
         let json_model_params = serde_json::to_string(&model_params)?;
         let json_model_params = CString::new(json_model_params)?;
-        Ok(Self { model_params, json_model_params })
+        let handle = RwLock::new(ModelHandle(ptr::null_mut()));
+        Ok(Self { model_params, json_model_params, handle })
     }
 
     /// Prepare classifier.
     pub fn prepare(&self) -> Result<()> {
-        let res = unsafe { ml_module::prepare(self.json_model_params.as_ptr()) };
-        Ok(check_brainflow_exit_code(res)?)
+        let mut handle = self.handle.write().unwrap();
+        let mut model_handle = ptr::null_mut();
+        let res = unsafe {
+            ml_module::prepare_with_handle(self.json_model_params.as_ptr(), &mut model_handle)
+        };
+        check_brainflow_exit_code(res)?;
+        handle.0 = model_handle;
+        Ok(())
     }
 
     /// Calculate metric from data.
     pub fn predict(&self, data: &mut [f64]) -> Result<Vec<f64>> {
         let mut output: Vec<f64> = Vec::with_capacity(*self.model_params.max_array_size());
         let mut output_len = 0;
+        let handle = self.handle.read().unwrap();
         let res = unsafe {
-            ml_module::predict(
-                data.as_mut_ptr() as *mut c_double,
-                data.len() as c_int,
-                output.as_mut_ptr(),
-                &mut output_len,
-                self.json_model_params.as_ptr(),
-            )
+            if handle.0.is_null() {
+                ml_module::predict(
+                    data.as_mut_ptr() as *mut c_double,
+                    data.len() as c_int,
+                    output.as_mut_ptr(),
+                    &mut output_len,
+                    self.json_model_params.as_ptr(),
+                )
+            } else {
+                ml_module::predict_with_handle(
+                    handle.0,
+                    data.as_mut_ptr() as *mut c_double,
+                    data.len() as c_int,
+                    output.as_mut_ptr(),
+                    &mut output_len,
+                )
+            }
         };
         check_brainflow_exit_code(res)?;
         unsafe { output.set_len(output_len as usize) };
@@ -47,9 +77,134 @@ impl MlModel {
         Ok(output_casted)
     }
 
+    /// Calculate metric for each row of data in a single call, rows of output match rows of data.
+    pub fn predict_batch(&self, data: &Array2<f64>) -> Result<Array2<f64>> {
+        let (batch_size, data_len) = (data.nrows(), data.ncols());
+        let mut raw_data = data.iter().copied().collect::<Vec<f64>>();
+        let mut output = vec![0.0; batch_size * *self.model_params.max_array_size()];
+        let mut output_len = 0;
+        let handle = self.handle.read().unwrap();
+        let res = unsafe {
+            if handle.0.is_null() {
+                ml_module::predict_batch(
+                    raw_data.as_mut_ptr() as *mut c_double,
+                    batch_size as c_int,
+                    data_len as c_int,
+                    output.as_mut_ptr() as *mut c_double,
+                    &mut output_len,
+                    self.json_model_params.as_ptr(),
+                )
+            } else {
+                ml_module::predict_batch_with_handle(
+                    handle.0,
+                    raw_data.as_mut_ptr() as *mut c_double,
+                    batch_size as c_int,
+                    data_len as c_int,
+                    output.as_mut_ptr() as *mut c_double,
+                    &mut output_len,
+                )
+            }
+        };
+        check_brainflow_exit_code(res)?;
+        output.truncate(output_len as usize);
+        let output = ArrayBase::from_vec(output);
+        Ok(output.into_shape((batch_size, output_len as usize / batch_size)).unwrap())
+    }
+
+    /// Calculate metric for model with several inputs and outputs, inputs are batch_size x
+    /// input_len arrays in model order, returns batch_size x output_len array per output.
+    pub fn predict_multi(
+        &self,
+        inputs: &[Array2<f64>],
+        num_outputs: usize,
+    ) -> Result<Vec<Array2<f64>>> {
+        let (batch_size, input_lens) = Self::get_input_lens(inputs)?;
+        let mut raw_data = inputs
+            .iter()
+            .flat_map(|input| input.iter().copied())
+            .collect::<Vec<f64>>();
+        let mut output = vec![0.0; batch_size * *self.model_params.max_array_size()];
+        let mut output_lens = vec![0; num_outputs];
+        let res = unsafe {
+            ml_module::predict_multi(
+                raw_data.as_mut_ptr() as *mut c_double,
+                batch_size as c_int,
+                input_lens.as_ptr() as *mut c_int,
+                input_lens.len() as c_int,
+                output.as_mut_ptr() as *mut c_double,
+                output_lens.as_mut_ptr() as *mut c_int,
+                num_outputs as c_int,
+                self.json_model_params.as_ptr(),
+            )
+        };
+        check_brainflow_exit_code(res)?;
+        Ok(Self::unpack_outputs(&output, &output_lens, batch_size))
+    }
+
+    /// The same for float32 inputs, float models use them without conversion.
+    pub fn predict_multi_float32(
+        &self,
+        inputs: &[Array2<f32>],
+        num_outputs: usize,
+    ) -> Result<Vec<Array2<f64>>> {
+        let (batch_size, input_lens) = Self::get_input_lens(inputs)?;
+        let mut raw_data = inputs
+            .iter()
+            .flat_map(|input| input.iter().copied())
+            .collect::<Vec<f32>>();
+        let mut output = vec![0.0; batch_size * *self.model_params.max_array_size()];
+        let mut output_lens = vec![0; num_outputs];
+        let res = unsafe {
+            ml_module::predict_multi_float32(
+                raw_data.as_mut_ptr() as *mut c_float,
+                batch_size as c_int,
+                input_lens.as_ptr() as *mut c_int,
+                input_lens.len() as c_int,
+                output.as_mut_ptr() as *mut c_double,
+                output_lens.as_mut_ptr() as *mut c_int,
+                num_outputs as c_int,
+                self.json_model_params.as_ptr(),
+            )
+        };
+        check_brainflow_exit_code(res)?;
+        Ok(Self::unpack_outputs(&output, &output_lens, batch_size))
+    }
+
+    fn get_input_lens<T>(inputs: &[Array2<T>]) -> Result<(usize, Vec<c_int>)> {
+        let batch_size = inputs.first().map_or(0, |input| input.nrows());
+        if batch_size == 0 || inputs.iter().any(|input| input.nrows() != batch_size) {
+            return Err(Error::BrainFlowError(BrainFlowError::InvalidArgumentsError));
+        }
+        let input_lens = inputs.iter().map(|input| input.ncols() as c_int).collect();
+        Ok((batch_size, input_lens))
+    }
+
+    fn unpack_outputs(output: &[f64], output_lens: &[c_int], batch_size: usize) -> Vec<Array2<f64>> {
+        let mut offset = 0;
+        output_lens
+            .iter()
+            .map(|&len| {
+                let len = len as usize;
+                let values = output[offset..offset + len].to_vec();
+                offset += len;
+                ArrayBase::from_vec(values)
+                    .into_shape((batch_size, len / batch_size))
+                    .unwrap()
+            })
+            .collect()
+    }
+
     /// Release classifier.
     pub fn release(&self) -> Result<()> {
-        let res = unsafe { ml_module::release(self.json_model_params.as_ptr()) };
+        let mut handle = self.handle.write().unwrap();
+        let res = unsafe {
+            if handle.0.is_null() {
+                ml_module::release(self.json_model_params.as_ptr())
+            } else {
+                ml_module::release_with_handle(handle.0)
+            }
+        };
+        handle.0 = ptr::null_mut();
         Ok(check_brainflow_exit_code(res)?)
     }
 }
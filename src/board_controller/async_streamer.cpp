@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <string.h>
+
+#include "async_streamer.h"
+#include "board.h"
+#include "brainflow_constants.h"
+
+// max number of packages passed to the wrapped streamer at once
+#define ASYNC_STREAMER_MAX_BATCH 1024
+
+
+AsyncStreamer::AsyncStreamer (Streamer *streamer, int data_len, size_t queue_size,
+    StreamerOverflowPolicy overflow_policy)
+    : Streamer (data_len, "async", "", "")
+{
+    this->streamer = streamer;
+    this->queue_size = std::max<size_t> (queue_size, 1);
+    this->overflow_policy = overflow_policy;
+    max_batch_size = std::min<size_t> (this->queue_size, ASYNC_STREAMER_MAX_BATCH);
+    first = 0;
+    count = 0;
+    streamed = 0;
+    dropped = 0;
+    max_latency_ms = 0.0;
+    is_streaming = false;
+}
+
+AsyncStreamer::~AsyncStreamer ()
+{
+    if (streaming_thread.joinable ())
+    {
+        {
+            std::lock_guard<std::mutex> lk (m);
+            is_streaming = false;
+        }
+        cv_not_empty.notify_one ();
+        cv_not_full.notify_all ();
+        // thread drains the queue before exit
+        streaming_thread.join ();
+    }
+    if (dropped > 0)
+    {
+        LOG_F(WARNING, "{} packages were dropped by streamer queue", dropped);
+    }
+    delete streamer;
+    streamer = NULL;
+}
+
+int AsyncStreamer::parse_options (
+    const std::string &options, size_t &queue_size, StreamerOverflowPolicy &overflow_policy)
+{
+    size_t start = 0;
+    while (start < options.size ())
+    {
+        size_t end = options.find ('&', start);
+        if (end == std::string::npos)
+        {
+            end = options.size ();
+        }
+        std::string option = options.substr (start, end - start);
+        start = end + 1;
+        if (option.empty ())
+        {
+            continue;
+        }
+        size_t eq = option.find ('=');
+        if (eq == std::string::npos)
+        {
+            LOG_F(ERROR, "streamer option {} has no value", option.c_str ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        std::string key = option.substr (0, eq);
+        std::string value = option.substr (eq + 1);
+        if (key == "queue_size")
+        {
+            int parsed_size = 0;
+            try
+            {
+                parsed_size = std::stoi (value);
+            }
+            catch (const std::exception &e)
+            {
+                LOG_F(ERROR, e.what ());
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+            if (parsed_size < 1)
+            {
+                LOG_F(ERROR, "queue_size must be positive");
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+            queue_size = (size_t)parsed_size;
+        }
+        else if (key == "overflow")
+        {
+            if (value == "block")
+            {
+                overflow_policy = StreamerOverflowPolicy::BLOCK;
+            }
+            else if (value == "drop_oldest")
+            {
+                overflow_policy = StreamerOverflowPolicy::DROP_OLDEST;
+            }
+            else if (value == "drop_newest")
+            {
+                overflow_policy = StreamerOverflowPolicy::DROP_NEWEST;
+            }
+            else
+            {
+                LOG_F(ERROR, "unsupported overflow policy {}, use block, drop_oldest or drop_newest",
+                    value.c_str ());
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+        }
+        else
+        {
+            LOG_F(ERROR, "unsupported streamer option {}", key.c_str ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int AsyncStreamer::init_streamer ()
+{
+    if (is_streaming)
+    {
+        LOG_F(ERROR, "async streamer is running");
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    int res = streamer->init_streamer ();
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    try
+    {
+        queue.resize (queue_size * len);
+        push_times.resize (queue_size);
+        batch.resize (max_batch_size * len);
+    }
+    catch (const std::bad_alloc &)
+    {
+        LOG_F(ERROR, "unable to allocate streamer queue of {} packages", queue_size);
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    is_streaming = true;
+    streaming_thread = std::thread ([this] { this->thread_worker (); });
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void AsyncStreamer::stream_data (double *data)
+{
+    stream_data (data, 1);
+}
+
+void AsyncStreamer::stream_data (double *data, int num_packages)
+{
+    auto now = std::chrono::steady_clock::now ();
+    {
+        std::unique_lock<std::mutex> lk (m);
+        for (int i = 0; i < num_packages; i++)
+        {
+            if (count == queue_size)
+            {
+                if (overflow_policy == StreamerOverflowPolicy::DROP_NEWEST)
+                {
+                    dropped += num_packages - i;
+                    break;
+                }
+                if (overflow_policy == StreamerOverflowPolicy::DROP_OLDEST)
+                {
+                    first = (first + 1) % queue_size;
+                    count--;
+                    dropped++;
+                }
+                else
+                {
+                    // acquisition thread waits for the streamer like before
+                    cv_not_empty.notify_one ();
+                    cv_not_full.wait (lk, [this] { return (count < queue_size) || (!is_streaming); });
+                    if (!is_streaming)
+                    {
+                        dropped += num_packages - i;
+                        break;
+                    }
+                }
+            }
+            size_t pos = (first + count) % queue_size;
+            memcpy (&queue[pos * len], data + (size_t)i * len, sizeof (double) * len);
+            push_times[pos] = now;
+            count++;
+        }
+    }
+    cv_not_empty.notify_one ();
+}
+
+void AsyncStreamer::thread_worker ()
+{
+    std::unique_lock<std::mutex> lk (m);
+    while (true)
+    {
+        cv_not_empty.wait (lk, [this] { return (count > 0) || (!is_streaming); });
+        if (count == 0)
+        {
+            break; // stopped and drained
+        }
+        size_t num_packages = std::min (count, max_batch_size);
+        size_t first_part = std::min (num_packages, queue_size - first);
+        memcpy (batch.data (), &queue[first * len], sizeof (double) * first_part * len);
+        if (first_part < num_packages)
+        {
+            memcpy (batch.data () + first_part * len, queue.data (),
+                sizeof (double) * (num_packages - first_part) * len);
+        }
+        // oldest package in a batch always has the max latency
+        auto oldest = push_times[first];
+        first = (first + num_packages) % queue_size;
+        count -= num_packages;
+        lk.unlock ();
+        cv_not_full.notify_all ();
+
+        streamer->stream_data (batch.data (), (int)num_packages);
+
+        double latency =
+            std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now () - oldest)
+                .count ();
+        lk.lock ();
+        streamed += (long long)num_packages;
+        max_latency_ms = std::max (max_latency_ms, latency);
+    }
+}
+
+bool AsyncStreamer::check_equals (std::string type, std::string dest, std::string mods)
+{
+    return streamer->check_equals (type, dest, mods);
+}
+
+StreamerStats AsyncStreamer::get_stats ()
+{
+    std::lock_guard<std::mutex> lk (m);
+    StreamerStats stats;
+    stats.queued = count;
+    stats.queue_size = queue_size;
+    stats.streamed = streamed;
+    stats.dropped = dropped;
+    stats.max_latency_ms = max_latency_ms;
+    return stats;
+}
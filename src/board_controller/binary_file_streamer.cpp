@@ -0,0 +1,65 @@
+#include "binary_file_streamer.h"
+#include "board.h"
+#include "brainflow_constants.h"
+
+
+BinaryFileStreamer::BinaryFileStreamer (
+    const char *file, const char *file_mode, const BinaryFileHeader &header)
+    : Streamer (header.num_rows, "binary_file", file, file_mode)
+{
+    this->file = file;
+    this->file_mode = file_mode;
+    this->header = header;
+}
+
+BinaryFileStreamer::~BinaryFileStreamer ()
+{
+    if (writer.close () != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        LOG_F(ERROR, "failed to write timestamp index to {}", file.c_str ());
+    }
+}
+
+int BinaryFileStreamer::init_streamer ()
+{
+    if (writer.is_open ())
+    {
+        LOG_F(ERROR, "binary file streamer is running");
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    if ((file_mode == "w") || (file_mode == "a"))
+    {
+        header.value_size = (int32_t)sizeof (double);
+    }
+    else if ((file_mode == "w_float32") || (file_mode == "a_float32"))
+    {
+        header.value_size = (int32_t)sizeof (float);
+    }
+    else
+    {
+        LOG_F(ERROR, "unsupported binary file mode {}, use w, a, w_float32 or a_float32",
+            file_mode.c_str ());
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int res = writer.open (file.c_str (), header, file_mode[0] == 'a');
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        LOG_F(ERROR, "failed to open {}, appending is allowed only to a binary file with the same "
+                     "num_rows and value size",
+            file.c_str ());
+    }
+    return res;
+}
+
+void BinaryFileStreamer::stream_data (double *data)
+{
+    stream_data (data, 1);
+}
+
+void BinaryFileStreamer::stream_data (double *data, int num_packages)
+{
+    if (writer.write_packages (data, (size_t)num_packages) != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        LOG_F(ERROR, "failed to write {} packages to {}", num_packages, file.c_str ());
+    }
+}
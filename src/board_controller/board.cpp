@@ -1,7 +1,10 @@
 #include <algorithm>
+#include <chrono>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "binary_file_streamer.h"
 #include "board.h"
 #include "board_controller.h"
 #include "custom_cast.h"
@@ -142,6 +145,12 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
         }
     }
 
+    preset_layouts.clear ();
+    for (auto &el : board_descr.items ())
+    {
+        preset_layouts[preset_to_int (el.key ())] = PresetLayout (el.value ());
+    }
+
     if ((streamer_params != NULL) && (streamer_params[0] != '\0'))
     {
         res = add_streamer (streamer_params, (int)BrainFlowPresets::DEFAULT_PRESET);
@@ -179,46 +188,64 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
 
 void Board::push_package (double *package, int preset)
 {
-    std::string preset_str = preset_to_string (preset);
-    if ((board_descr.find (preset_str) == board_descr.end ()) || (dbs.find (preset) == dbs.end ()))
+    push_packages (package, 1, preset);
+}
+
+void Board::push_packages (double *packages, int num_packages, int preset)
+{
+    auto layout = preset_layouts.find (preset);
+    auto db = dbs.find (preset);
+    if ((layout == preset_layouts.end ()) || (db == dbs.end ()))
     {
         LOG_F(ERROR, "invalid json or push_package args, no such key");
         return;
     }
+    if (num_packages <= 0)
+    {
+        return;
+    }
+    int num_rows = layout->second.num_rows;
+    int marker_channel = layout->second.marker_channel;
 
     lock.lock ();
-    json board_preset = board_descr[preset_str];
-    try
+    // layout without marker channel, packages are stored as is
+    if ((marker_channel >= 0) && (marker_channel < num_rows))
     {
-        int marker_channel = board_preset["marker_channel"];
-        if (marker_queues[preset].empty ())
+        std::deque<double> &markers = marker_queues[preset];
+        for (int i = 0; i < num_packages; i++)
         {
-            package[marker_channel] = 0.0;
-        }
-        else
-        {
-            double marker = marker_queues[preset].at (0);
-            package[marker_channel] = marker;
-            marker_queues[preset].pop_front ();
+            if (markers.empty ())
+            {
+                packages[i * num_rows + marker_channel] = 0.0;
+            }
+            else
+            {
+                packages[i * num_rows + marker_channel] = markers.front ();
+                markers.pop_front ();
+            }
         }
     }
-    catch (...)
+
+    if (db->second != NULL)
     {
-        LOG_F(ERROR, "Failed to get marker channel/value");
+        db->second->add_data (packages, num_packages);
     }
+    lock.unlock ();
 
-    if (dbs[preset] != NULL)
+    // streamer with block policy may wait for queue space, dont hold the lock here
+    if (num_streamers.load () == 0)
     {
-        dbs[preset]->add_data (package);
+        return;
     }
-    if (streamers.find (preset) != streamers.end ())
+    std::shared_ptr<const StreamerMap> current_streamers = std::atomic_load (&streamers);
+    auto preset_streamers = current_streamers->find (preset);
+    if (preset_streamers != current_streamers->end ())
     {
-        for (auto &streamer : streamers[preset])
+        for (auto &streamer : preset_streamers->second)
         {
-            streamer->stream_data (package);
+            streamer->stream_data (packages, num_packages);
         }
     }
-    lock.unlock ();
 }
 
 int Board::insert_marker (double value, int preset)
@@ -235,6 +262,13 @@ int Board::insert_marker (double value, int preset)
         LOG_F(ERROR, "invalid preset");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    auto layout = preset_layouts.find (preset);
+    if ((layout == preset_layouts.end ()) || (layout->second.marker_channel < 0) ||
+        (layout->second.marker_channel >= layout->second.num_rows))
+    {
+        LOG_F(ERROR, "no marker channel for preset {}", preset_str);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
     lock.lock ();
     marker_queues[preset].push_back (value);
     lock.unlock ();
@@ -257,17 +291,37 @@ void Board::free_packages ()
         marker_queues.erase (it);
     }
 
-    for (auto it = streamers.begin (), next_it = it; it != streamers.end (); it = next_it)
+    std::lock_guard<std::mutex> streamers_lock (streamers_mutex);
+    std::shared_ptr<const StreamerMap> old_streamers =
+        publish_streamers (std::make_shared<const StreamerMap> ());
+    for (auto &preset_streamers : *old_streamers)
     {
-        ++next_it;
-        for (auto &streamer : it->second)
+        for (auto &streamer : preset_streamers.second)
         {
             delete streamer;
         }
-        streamers.erase (it);
     }
 }
 
+std::shared_ptr<const Board::StreamerMap> Board::publish_streamers (
+    std::shared_ptr<const StreamerMap> new_streamers)
+{
+    int count = 0;
+    for (auto &preset_streamers : *new_streamers)
+    {
+        count += (int)preset_streamers.second.size ();
+    }
+    std::shared_ptr<const StreamerMap> old_streamers = std::atomic_load (&streamers);
+    std::atomic_store (&streamers, new_streamers);
+    num_streamers = count;
+    // old snapshot can not be loaded anymore, wait for threads which still use it
+    while (old_streamers.use_count () > 1)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (1));
+    }
+    return old_streamers;
+}
+
 int Board::add_streamer (const char *streamer_params, int preset)
 {
 
@@ -277,11 +331,22 @@ int Board::add_streamer (const char *streamer_params, int preset)
         LOG_F(ERROR, "invalid preset");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
+    PresetLayout layout (board_descr[preset_str]);
+    int num_rows = layout.num_rows;
     std::string streamer_type = "";
     std::string streamer_dest = "";
     std::string streamer_mods = "";
-    int res = parse_streamer_params (streamer_params, streamer_type, streamer_dest, streamer_mods);
+    std::string streamer_options = "";
+    int res = parse_streamer_params (
+        streamer_params, streamer_type, streamer_dest, streamer_mods, streamer_options);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    // by default queue keeps 10 seconds of data and acquisition waits if it overflows
+    size_t queue_size = std::max (layout.sampling_rate * 10, 1000);
+    StreamerOverflowPolicy overflow_policy = StreamerOverflowPolicy::BLOCK;
+    res = AsyncStreamer::parse_options (streamer_options, queue_size, overflow_policy);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
@@ -294,6 +359,19 @@ int Board::add_streamer (const char *streamer_params, int preset)
             streamer_dest.c_str (), streamer_mods.c_str ());
         streamer = new FileStreamer (streamer_dest.c_str (), streamer_mods.c_str (), num_rows);
     }
+    if (streamer_type == "binary_file")
+    {
+        LOG_F(2, "Binary File Streamer, file: {}, mods: {}", streamer_dest.c_str (),
+            streamer_mods.c_str ());
+        BinaryFileHeader header;
+        header.board_id = board_id;
+        header.preset = preset;
+        header.num_rows = num_rows;
+        header.sampling_rate = layout.sampling_rate;
+        header.timestamp_channel = layout.timestamp_channel;
+        streamer = new BinaryFileStreamer (
+            streamer_dest.c_str (), streamer_mods.c_str (), header);
+    }
     if (streamer_type == "streaming_board")
     {
         int port = 0;
@@ -317,18 +395,22 @@ int Board::add_streamer (const char *streamer_params, int preset)
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    res = streamer->init_streamer ();
+    AsyncStreamer *async_streamer =
+        new AsyncStreamer (streamer, num_rows, queue_size, overflow_policy);
+    res = async_streamer->init_streamer ();
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         LOG_F(ERROR, "failed to init streamer");
-        delete streamer;
-        streamer = NULL;
+        delete async_streamer;
+        async_streamer = NULL;
     }
     else
     {
-        lock.lock ();
-        streamers[preset].push_back (streamer);
-        lock.unlock ();
+        std::lock_guard<std::mutex> streamers_lock (streamers_mutex);
+        std::shared_ptr<StreamerMap> new_streamers =
+            std::make_shared<StreamerMap> (*std::atomic_load (&streamers));
+        (*new_streamers)[preset].push_back (async_streamer);
+        publish_streamers (new_streamers);
     }
 
     return res;
@@ -336,49 +418,89 @@ int Board::add_streamer (const char *streamer_params, int preset)
 
 int Board::delete_streamer (const char *streamer_params, int preset)
 {
-    if (streamers.find (preset) == streamers.end ())
-    {
-        LOG_F(ERROR, "no such streaming preset");
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-    }
     std::string streamer_type = "";
     std::string streamer_dest = "";
     std::string streamer_mods = "";
-    int res = parse_streamer_params (streamer_params, streamer_type, streamer_dest, streamer_mods);
+    std::string streamer_options = "";
+    int res = parse_streamer_params (
+        streamer_params, streamer_type, streamer_dest, streamer_mods, streamer_options);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
 
-    std::vector<Streamer *>::iterator it = streamers[preset].begin ();
-    res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-    while (it != streamers[preset].end ())
+    AsyncStreamer *streamer = NULL;
     {
-        if ((*it)->check_equals (streamer_type, streamer_dest, streamer_mods))
+        std::lock_guard<std::mutex> streamers_lock (streamers_mutex);
+        std::shared_ptr<StreamerMap> new_streamers =
+            std::make_shared<StreamerMap> (*std::atomic_load (&streamers));
+        auto preset_streamers = new_streamers->find (preset);
+        if (preset_streamers == new_streamers->end ())
         {
-            lock.lock ();
-            delete *it;
-            it = streamers[preset].erase (it);
-            lock.unlock ();
-            res = (int)BrainFlowExitCodes::STATUS_OK;
-            LOG_F(INFO, "streamer {} removed", streamer_params);
-            break;
+            LOG_F(ERROR, "no such streaming preset");
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
-        else
+        std::vector<AsyncStreamer *> &preset_list = preset_streamers->second;
+        for (auto it = preset_list.begin (); it != preset_list.end (); it++)
         {
-            it++;
+            if ((*it)->check_equals (streamer_type, streamer_dest, streamer_mods))
+            {
+                streamer = *it;
+                preset_list.erase (it);
+                break;
+            }
+        }
+        if (streamer == NULL)
+        {
+            LOG_F(ERROR, "no such streamer found");
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
+        publish_streamers (new_streamers);
     }
+    // flushing queue may take a while, dont block acquisition thread
+    delete streamer;
+    LOG_F(INFO, "streamer {} removed", streamer_params);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
+int Board::get_streamer_stats (const char *streamer_params, int preset, std::string &stats)
+{
+    std::string streamer_type = "";
+    std::string streamer_dest = "";
+    std::string streamer_mods = "";
+    std::string streamer_options = "";
+    int res = parse_streamer_params (
+        streamer_params, streamer_type, streamer_dest, streamer_mods, streamer_options);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        LOG_F(ERROR, "no such streamer found");
+        return res;
     }
-    return res;
+    std::shared_ptr<const StreamerMap> current_streamers = std::atomic_load (&streamers);
+    auto preset_streamers = current_streamers->find (preset);
+    if (preset_streamers != current_streamers->end ())
+    {
+        for (auto &streamer : preset_streamers->second)
+        {
+            if (streamer->check_equals (streamer_type, streamer_dest, streamer_mods))
+            {
+                StreamerStats streamer_stats = streamer->get_stats ();
+                json j;
+                j["queued"] = streamer_stats.queued;
+                j["queue_size"] = streamer_stats.queue_size;
+                j["streamed"] = streamer_stats.streamed;
+                j["dropped"] = streamer_stats.dropped;
+                j["max_latency_ms"] = streamer_stats.max_latency_ms;
+                stats = j.dump ();
+                return (int)BrainFlowExitCodes::STATUS_OK;
+            }
+        }
+    }
+    LOG_F(ERROR, "no such streamer found");
+    return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
 }
 
 int Board::parse_streamer_params (const char *streamer_params, std::string &streamer_type,
-    std::string &streamer_dest, std::string &streamer_mods)
+    std::string &streamer_dest, std::string &streamer_mods, std::string &streamer_options)
 {
     if ((streamer_params == NULL) || (streamer_params[0] == '\0'))
     {
@@ -388,6 +510,14 @@ int Board::parse_streamer_params (const char *streamer_params, std::string &stre
 
     // parse string, sscanf doesnt work
     std::string streamer_params_str = streamer_params;
+    // optional queue settings: streamer_type://streamer_dest:streamer_args?key=value&key=value
+    streamer_options = "";
+    size_t options_idx = streamer_params_str.find_last_of ("?");
+    if (options_idx != std::string::npos)
+    {
+        streamer_options = streamer_params_str.substr (options_idx + 1);
+        streamer_params_str = streamer_params_str.substr (0, options_idx);
+    }
     size_t idx1 = streamer_params_str.find ("://");
     if (idx1 == std::string::npos)
     {
@@ -432,12 +562,8 @@ int Board::get_current_board_data (
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
-
-    double *buf = new double[num_samples * num_rows];
-    int num_data_points = (int)dbs[preset]->get_current_data (num_samples, buf);
-    reshape_data (num_data_points, preset, buf, data_buf);
-    delete[] buf;
+    // swap rows and columns while copying from the ring, no intermediate buffer
+    int num_data_points = (int)dbs[preset]->get_current_data_transposed (num_samples, data_buf);
     *returned_samples = num_data_points;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -485,34 +611,27 @@ int Board::get_board_data (int data_count, int preset, double *data_buf)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
-
 #ifdef BRAINFLOW_NO_RESHAPE
     // do not swap rows and columns
-    int num_data_points = (int)dbs[preset]->get_data (data_count, data_buf);
+    dbs[preset]->get_data (data_count, data_buf);
 #else
-    // default brainflow behavior: swap rows and columns
-    double *buf = new double[data_count * num_rows];
-    int num_data_points = (int)dbs[preset]->get_data (data_count, buf);
-    reshape_data (num_data_points, preset, buf, data_buf);
-    delete[] buf;
+    // default brainflow behavior: swap rows and columns while copying from the ring
+    dbs[preset]->get_data_transposed (data_count, data_buf);
 #endif
 
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-void Board::reshape_data (int data_count, int preset, const double *buf, double *output_buf)
+const PresetLayout &Board::get_preset_layout (int preset)
 {
-    std::string preset_str = preset_to_string (preset);
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
-
-    for (int i = 0; i < data_count; i++)
+    static const PresetLayout empty_layout;
+    auto layout = preset_layouts.find (preset);
+    if (layout == preset_layouts.end ())
     {
-        for (int j = 0; j < num_rows; j++)
-        {
-            output_buf[j * data_count + i] = buf[i * num_rows + j];
-        }
+        LOG_F(ERROR, "no layout for preset {}, stream is not prepared", preset);
+        return empty_layout;
     }
+    return layout->second;
 }
 
 std::string Board::preset_to_string (int preset)
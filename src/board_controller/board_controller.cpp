@@ -13,6 +13,7 @@
 #include <string.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "ant_neuro.h"
 #include "board.h"
@@ -45,6 +46,7 @@
 #include "muse_bled.h"
 #include "notion_osc.h"
 #include "playback_file_board.h"
+#include "shared_mutex.h"
 #include "streaming_board.h"
 #include "synthetic_board.h"
 #include "unicorn_board.h"
@@ -55,21 +57,38 @@
 using json = nlohmann::json;
 
 
-std::map<std::pair<int, struct BrainFlowInputParams>, std::shared_ptr<Board>> boards;
+// control calls (prepare, start, stop, config, release...) take session mutex exclusively, data
+// calls share it. So slow config_board for one device doesnt block data access for others
+struct BoardSession
+{
+    std::pair<int, struct BrainFlowInputParams> key;
+    std::shared_ptr<Board> board;
+    SharedMutex mutex;
+    bool prepared; // false while prepare_session is running and after release_session
+    // json strings already resolved to this session, protected by boards_mutex
+    std::vector<std::pair<int, std::string>> aliases;
+};
+
+std::map<std::pair<int, struct BrainFlowInputParams>, std::shared_ptr<BoardSession>> boards;
+// lookup by raw input json to avoid json parsing for each call
+std::map<std::pair<int, std::string>, std::shared_ptr<BoardSession>> board_aliases;
+// protects boards and board_aliases only, never held during calls to Board methods
+SharedMutex boards_mutex;
+// serializes log settings
 std::mutex mutex;
 
 std::pair<int, struct BrainFlowInputParams> get_key (
     int board_id, struct BrainFlowInputParams params);
-static int check_board_session (int board_id, const char *json_brainflow_input_params,
-    std::pair<int, struct BrainFlowInputParams> &key, bool log_error = true);
+static int get_board_session (int board_id, const char *json_brainflow_input_params,
+    std::shared_ptr<BoardSession> &session, bool log_error = true);
+static void remove_board_session (const std::shared_ptr<BoardSession> &session);
+static std::shared_ptr<Board> create_board (int board_id, struct BrainFlowInputParams params);
 static int string_to_brainflow_input_params (
     const char *json_brainflow_input_params, struct BrainFlowInputParams *params);
 
 
 int prepare_session (int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
     LOG_F (INFO, "incoming json: {}", json_brainflow_input_params);
     struct BrainFlowInputParams params;
     int res = string_to_brainflow_input_params (json_brainflow_input_params, &params);
@@ -78,221 +97,51 @@ int prepare_session (int board_id, const char *json_brainflow_input_params)
         return res;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key = get_key (board_id, params);
-    if (boards.find (key) != boards.end ())
+    // register session before preparing the board, it may take a while and other sessions
+    // should stay accessible, calls to this session wait for its mutex
+    std::shared_ptr<BoardSession> session (new BoardSession ());
+    session->key = get_key (board_id, params);
+    session->prepared = false;
+    std::lock_guard<SharedMutex> session_lock (session->mutex);
     {
-        LOG_F (ERROR, "Board with id {} and the same config already exists", board_id);
-        return (int)BrainFlowExitCodes::ANOTHER_BOARD_IS_CREATED_ERROR;
+        std::lock_guard<SharedMutex> lock (boards_mutex);
+        if (boards.find (session->key) != boards.end ())
+        {
+            LOG_F (ERROR, "Board with id {} and the same config already exists", board_id);
+            return (int)BrainFlowExitCodes::ANOTHER_BOARD_IS_CREATED_ERROR;
+        }
+        boards[session->key] = session;
     }
 
-    std::shared_ptr<Board> board = NULL;
-    switch (static_cast<BoardIds> (board_id))
+    std::shared_ptr<Board> board = create_board (board_id, params);
+    if (board == NULL)
     {
-        case BoardIds::PLAYBACK_FILE_BOARD:
-            board = std::shared_ptr<Board> (new PlaybackFileBoard (params));
-            break;
-        case BoardIds::STREAMING_BOARD:
-            board = std::shared_ptr<Board> (new StreamingBoard (params));
-            break;
-        case BoardIds::SYNTHETIC_BOARD:
-            board = std::shared_ptr<Board> (new SyntheticBoard (params));
-            break;
-        case BoardIds::CYTON_BOARD:
-            board = std::shared_ptr<Board> (new Cyton (params));
-            break;
-        case BoardIds::GANGLION_BOARD:
-            board = std::shared_ptr<Board> (new Ganglion (params));
-            break;
-        case BoardIds::CYTON_DAISY_BOARD:
-            board = std::shared_ptr<Board> (new CytonDaisy (params));
-            break;
-        case BoardIds::GALEA_BOARD:
-            board = std::shared_ptr<Board> (new Galea (params));
-            break;
-        case BoardIds::GANGLION_WIFI_BOARD:
-            board = std::shared_ptr<Board> (new GanglionWifi (params));
-            break;
-        case BoardIds::CYTON_WIFI_BOARD:
-            board = std::shared_ptr<Board> (new CytonWifi (params));
-            break;
-        case BoardIds::CYTON_DAISY_WIFI_BOARD:
-            board = std::shared_ptr<Board> (new CytonDaisyWifi (params));
-            break;
-        case BoardIds::BRAINBIT_BOARD:
-            board = std::shared_ptr<Board> (new BrainBit (params));
-            break;
-        case BoardIds::UNICORN_BOARD:
-            board = std::shared_ptr<Board> (new UnicornBoard (params));
-            break;
-        case BoardIds::CALLIBRI_EEG_BOARD:
-            board = std::shared_ptr<Board> (new CallibriEEG (params));
-            break;
-        case BoardIds::CALLIBRI_EMG_BOARD:
-            board = std::shared_ptr<Board> (new CallibriEMG (params));
-            break;
-        case BoardIds::CALLIBRI_ECG_BOARD:
-            board = std::shared_ptr<Board> (new CallibriECG (params));
-            break;
-        // notion 1, notion 2 and crown have the same class
-        // the only difference are get_eeg_names and sampling_rate
-        case BoardIds::NOTION_1_BOARD:
-            board = std::shared_ptr<Board> (new NotionOSC (board_id, params));
-            break;
-        case BoardIds::NOTION_2_BOARD:
-            board = std::shared_ptr<Board> (new NotionOSC (board_id, params));
-            break;
-        case BoardIds::CROWN_BOARD:
-            board = std::shared_ptr<Board> (new NotionOSC (board_id, params));
-            break;
-        case BoardIds::GFORCE_PRO_BOARD:
-            board = std::shared_ptr<Board> (new GforcePro (params));
-            break;
-        case BoardIds::FREEEEG32_BOARD:
-            board = std::shared_ptr<Board> (new FreeEEG32 (params));
-            break;
-        case BoardIds::BRAINBIT_BLED_BOARD:
-            board = std::shared_ptr<Board> (new BrainBitBLED (params));
-            break;
-        case BoardIds::GFORCE_DUAL_BOARD:
-            board = std::shared_ptr<Board> (new GforceDual (params));
-            break;
-        case BoardIds::GALEA_SERIAL_BOARD:
-            board = std::shared_ptr<Board> (new GaleaSerial (params));
-            break;
-        case BoardIds::MUSE_S_BLED_BOARD:
-            board = std::shared_ptr<Board> (new MuseBLED (board_id, params));
-            break;
-        case BoardIds::MUSE_2_BLED_BOARD:
-            board = std::shared_ptr<Board> (new MuseBLED (board_id, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_410_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_410_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_411_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_411_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_430_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_430_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_211_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_211_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_212_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_212_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_213_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_213_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_214_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_214_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_215_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_215_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_221_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_221_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_222_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_222_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_223_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_223_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_224_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_224_BOARD, params));
-            break;
-        case BoardIds::ANT_NEURO_EE_225_BOARD:
-            board = std::shared_ptr<Board> (
-                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_225_BOARD, params));
-            break;
-        case BoardIds::ENOPHONE_BOARD:
-            board = std::shared_ptr<Board> (new Enophone (params));
-            break;
-        case BoardIds::MUSE_2_BOARD:
-            board = std::shared_ptr<Board> (new Muse (board_id, params));
-            break;
-        case BoardIds::MUSE_S_BOARD:
-            board = std::shared_ptr<Board> (new Muse (board_id, params));
-            break;
-        case BoardIds::MUSE_2016_BOARD:
-            board = std::shared_ptr<Board> (new Muse (board_id, params));
-            break;
-        case BoardIds::MUSE_2016_BLED_BOARD:
-            board = std::shared_ptr<Board> (new MuseBLED (board_id, params));
-            break;
-        case BoardIds::EXPLORE_4_CHAN_BOARD:
-            board = std::shared_ptr<Board> (new Explore (board_id, params));
-            break;
-        case BoardIds::EXPLORE_8_CHAN_BOARD:
-            board = std::shared_ptr<Board> (new Explore (board_id, params));
-            break;
-        case BoardIds::GANGLION_NATIVE_BOARD:
-            board = std::shared_ptr<Board> (new GanglionNative (params));
-            break;
-        case BoardIds::EMOTIBIT_BOARD:
-            board = std::shared_ptr<Board> (new Emotibit (params));
-            break;
-        case BoardIds::DAWNEEG4_BOARD:
-            board = std::shared_ptr<Board> (new DawnEEG4 (params));
-            break;
-        case BoardIds::DAWNEEG6_BOARD:
-            board = std::shared_ptr<Board> (new DawnEEG6 (params));
-            break;
-        case BoardIds::DAWNEEG8_BOARD:
-            board = std::shared_ptr<Board> (new DawnEEG8 (params));
-            break;
-        case BoardIds::DAWNEEG12_BOARD:
-            board = std::shared_ptr<Board> (new DawnEEG12 (params));
-            break;
-        case BoardIds::DAWNEEG16_BOARD:
-            board = std::shared_ptr<Board> (new DawnEEG16 (params));
-            break;
-        case BoardIds::DAWNEEG18_BOARD:
-            board = std::shared_ptr<Board> (new DawnEEG18 (params));
-            break;
-        case BoardIds::DAWNEEG24_BOARD:
-            board = std::shared_ptr<Board> (new DawnEEG24 (params));
-            break;
-        case BoardIds::DAWNEEG32_BOARD:
-            board = std::shared_ptr<Board> (new DawnEEG32 (params));
-            break;
-        default:
-            return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
+        remove_board_session (session);
+        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
     LOG_F (1, "Board object created {}", board->get_board_id ());
     res = board->prepare_session ();
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        board = NULL;
+        remove_board_session (session);
     }
     else
     {
-        boards[key] = board;
+        session->board = board;
+        session->prepared = true;
     }
     return res;
 }
 
 int is_prepared (int *prepared, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    // not created board is a valid state here
+    int res = get_board_session (board_id, json_brainflow_input_params, session, false);
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
-        *prepared = 1;
+        SharedLockGuard lock (session->mutex);
+        *prepared = session->prepared ? 1 : 0;
     }
     if (res == (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR)
     {
@@ -305,106 +154,123 @@ int is_prepared (int *prepared, int board_id, const char *json_brainflow_input_p
 int start_stream (int buffer_size, const char *streamer_params, int board_id,
     const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->start_stream (buffer_size, streamer_params);
+    std::lock_guard<SharedMutex> lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->start_stream (buffer_size, streamer_params);
 }
 
 int stop_stream (int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->stop_stream ();
+    std::lock_guard<SharedMutex> lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->stop_stream ();
 }
 
 int insert_marker (double value, int preset, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->insert_marker (value, preset);
+    SharedLockGuard lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->insert_marker (value, preset);
 }
 
 int release_session (int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    res = board_it->second->release_session ();
-    boards.erase (board_it);
+    std::lock_guard<SharedMutex> lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    res = session->board->release_session ();
+    session->prepared = false;
+    session->board = NULL;
+    // keep the entry until the device is released, so prepare_session can't open it twice
+    remove_board_session (session);
     return res;
 }
 
 int get_current_board_data (int num_samples, int preset, double *data_buf, int *returned_samples,
     int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_current_board_data (
+    SharedLockGuard lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->get_current_board_data (
         num_samples, preset, data_buf, returned_samples);
 }
 
 int get_board_data_count (
     int preset, int *result, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_board_data_count (preset, result);
+    SharedLockGuard lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->get_board_data_count (preset, result);
 }
 
 int get_board_data (int data_count, int preset, double *data_buf, int board_id,
     const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_board_data (data_count, preset, data_buf);
+    SharedLockGuard lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->get_board_data (data_count, preset, data_buf);
 }
 
 int set_log_level_board_controller (int log_level)
@@ -455,22 +321,25 @@ int java_set_jnienv (JNIEnv *java_jnienv)
 int config_board (const char *config, char *response, int *response_len, int board_id,
     const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
     if ((config == NULL) || (response == NULL) || (response_len == NULL))
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
+    std::lock_guard<SharedMutex> lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
     std::string conf = config;
     std::string resp = "";
-    res = board_it->second->config_board (conf, resp);
+    res = session->board->config_board (conf, resp);
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
         *response_len = (int)resp.length ();
@@ -482,50 +351,95 @@ int config_board (const char *config, char *response, int *response_len, int boa
 int add_streamer (
     const char *streamer, int preset, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
     if (streamer == NULL)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->add_streamer (streamer, preset);
+    std::lock_guard<SharedMutex> lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->add_streamer (streamer, preset);
 }
 
 int delete_streamer (
     const char *streamer, int preset, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
     if (streamer == NULL)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    std::lock_guard<SharedMutex> lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->delete_streamer (streamer, preset);
+}
+
+int get_streamer_stats (const char *streamer, int preset, char *stats, int *stats_len,
+    int board_id, const char *json_brainflow_input_params)
+{
+    if ((streamer == NULL) || (stats == NULL) || (stats_len == NULL))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    std::shared_ptr<BoardSession> session;
+    int res = get_board_session (board_id, json_brainflow_input_params, session);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->delete_streamer (streamer, preset);
+    SharedLockGuard lock (session->mutex);
+    if (!session->prepared)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::string streamer_stats = "";
+    res = session->board->get_streamer_stats (streamer, preset, streamer_stats);
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        *stats_len = (int)streamer_stats.length ();
+        strcpy (stats, streamer_stats.c_str ());
+    }
+    return res;
 }
 
 int release_all_sessions ()
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    std::map<std::pair<int, struct BrainFlowInputParams>, std::shared_ptr<BoardSession>>
+        all_boards;
+    {
+        SharedLockGuard lock (boards_mutex);
+        all_boards = boards;
+    }
 
-    for (auto it = boards.begin (), next_it = it; it != boards.end (); it = next_it)
+    for (auto &it : all_boards)
     {
-        ++next_it;
-        it->second->release_session ();
-        boards.erase (it);
+        std::lock_guard<SharedMutex> lock (it.second->mutex);
+        if (it.second->prepared)
+        {
+            it.second->board->release_session ();
+            it.second->prepared = false;
+            it.second->board = NULL;
+        }
+        remove_board_session (it.second);
     }
 
     return (int)BrainFlowExitCodes::STATUS_OK;
@@ -542,6 +456,197 @@ int get_version_board_controller (char *version, int *num_chars, int max_chars)
 //////////////////// helpers ////////////////////
 /////////////////////////////////////////////////
 
+std::shared_ptr<Board> create_board (int board_id, struct BrainFlowInputParams params)
+{
+    std::shared_ptr<Board> board = NULL;
+    switch (static_cast<BoardIds> (board_id))
+    {
+        case BoardIds::PLAYBACK_FILE_BOARD:
+            board = std::shared_ptr<Board> (new PlaybackFileBoard (params));
+            break;
+        case BoardIds::STREAMING_BOARD:
+            board = std::shared_ptr<Board> (new StreamingBoard (params));
+            break;
+        case BoardIds::SYNTHETIC_BOARD:
+            board = std::shared_ptr<Board> (new SyntheticBoard (params));
+            break;
+        case BoardIds::CYTON_BOARD:
+            board = std::shared_ptr<Board> (new Cyton (params));
+            break;
+        case BoardIds::GANGLION_BOARD:
+            board = std::shared_ptr<Board> (new Ganglion (params));
+            break;
+        case BoardIds::CYTON_DAISY_BOARD:
+            board = std::shared_ptr<Board> (new CytonDaisy (params));
+            break;
+        case BoardIds::GALEA_BOARD:
+            board = std::shared_ptr<Board> (new Galea (params));
+            break;
+        case BoardIds::GANGLION_WIFI_BOARD:
+            board = std::shared_ptr<Board> (new GanglionWifi (params));
+            break;
+        case BoardIds::CYTON_WIFI_BOARD:
+            board = std::shared_ptr<Board> (new CytonWifi (params));
+            break;
+        case BoardIds::CYTON_DAISY_WIFI_BOARD:
+            board = std::shared_ptr<Board> (new CytonDaisyWifi (params));
+            break;
+        case BoardIds::BRAINBIT_BOARD:
+            board = std::shared_ptr<Board> (new BrainBit (params));
+            break;
+        case BoardIds::UNICORN_BOARD:
+            board = std::shared_ptr<Board> (new UnicornBoard (params));
+            break;
+        case BoardIds::CALLIBRI_EEG_BOARD:
+            board = std::shared_ptr<Board> (new CallibriEEG (params));
+            break;
+        case BoardIds::CALLIBRI_EMG_BOARD:
+            board = std::shared_ptr<Board> (new CallibriEMG (params));
+            break;
+        case BoardIds::CALLIBRI_ECG_BOARD:
+            board = std::shared_ptr<Board> (new CallibriECG (params));
+            break;
+        // notion 1, notion 2 and crown have the same class
+        // the only difference are get_eeg_names and sampling_rate
+        case BoardIds::NOTION_1_BOARD:
+            board = std::shared_ptr<Board> (new NotionOSC (board_id, params));
+            break;
+        case BoardIds::NOTION_2_BOARD:
+            board = std::shared_ptr<Board> (new NotionOSC (board_id, params));
+            break;
+        case BoardIds::CROWN_BOARD:
+            board = std::shared_ptr<Board> (new NotionOSC (board_id, params));
+            break;
+        case BoardIds::GFORCE_PRO_BOARD:
+            board = std::shared_ptr<Board> (new GforcePro (params));
+            break;
+        case BoardIds::FREEEEG32_BOARD:
+            board = std::shared_ptr<Board> (new FreeEEG32 (params));
+            break;
+        case BoardIds::BRAINBIT_BLED_BOARD:
+            board = std::shared_ptr<Board> (new BrainBitBLED (params));
+            break;
+        case BoardIds::GFORCE_DUAL_BOARD:
+            board = std::shared_ptr<Board> (new GforceDual (params));
+            break;
+        case BoardIds::GALEA_SERIAL_BOARD:
+            board = std::shared_ptr<Board> (new GaleaSerial (params));
+            break;
+        case BoardIds::MUSE_S_BLED_BOARD:
+            board = std::shared_ptr<Board> (new MuseBLED (board_id, params));
+            break;
+        case BoardIds::MUSE_2_BLED_BOARD:
+            board = std::shared_ptr<Board> (new MuseBLED (board_id, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_410_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_410_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_411_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_411_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_430_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_430_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_211_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_211_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_212_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_212_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_213_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_213_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_214_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_214_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_215_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_215_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_221_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_221_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_222_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_222_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_223_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_223_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_224_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_224_BOARD, params));
+            break;
+        case BoardIds::ANT_NEURO_EE_225_BOARD:
+            board = std::shared_ptr<Board> (
+                new AntNeuroBoard ((int)BoardIds::ANT_NEURO_EE_225_BOARD, params));
+            break;
+        case BoardIds::ENOPHONE_BOARD:
+            board = std::shared_ptr<Board> (new Enophone (params));
+            break;
+        case BoardIds::MUSE_2_BOARD:
+            board = std::shared_ptr<Board> (new Muse (board_id, params));
+            break;
+        case BoardIds::MUSE_S_BOARD:
+            board = std::shared_ptr<Board> (new Muse (board_id, params));
+            break;
+        case BoardIds::MUSE_2016_BOARD:
+            board = std::shared_ptr<Board> (new Muse (board_id, params));
+            break;
+        case BoardIds::MUSE_2016_BLED_BOARD:
+            board = std::shared_ptr<Board> (new MuseBLED (board_id, params));
+            break;
+        case BoardIds::EXPLORE_4_CHAN_BOARD:
+            board = std::shared_ptr<Board> (new Explore (board_id, params));
+            break;
+        case BoardIds::EXPLORE_8_CHAN_BOARD:
+            board = std::shared_ptr<Board> (new Explore (board_id, params));
+            break;
+        case BoardIds::GANGLION_NATIVE_BOARD:
+            board = std::shared_ptr<Board> (new GanglionNative (params));
+            break;
+        case BoardIds::EMOTIBIT_BOARD:
+            board = std::shared_ptr<Board> (new Emotibit (params));
+            break;
+        case BoardIds::DAWNEEG4_BOARD:
+            board = std::shared_ptr<Board> (new DawnEEG4 (params));
+            break;
+        case BoardIds::DAWNEEG6_BOARD:
+            board = std::shared_ptr<Board> (new DawnEEG6 (params));
+            break;
+        case BoardIds::DAWNEEG8_BOARD:
+            board = std::shared_ptr<Board> (new DawnEEG8 (params));
+            break;
+        case BoardIds::DAWNEEG12_BOARD:
+            board = std::shared_ptr<Board> (new DawnEEG12 (params));
+            break;
+        case BoardIds::DAWNEEG16_BOARD:
+            board = std::shared_ptr<Board> (new DawnEEG16 (params));
+            break;
+        case BoardIds::DAWNEEG18_BOARD:
+            board = std::shared_ptr<Board> (new DawnEEG18 (params));
+            break;
+        case BoardIds::DAWNEEG24_BOARD:
+            board = std::shared_ptr<Board> (new DawnEEG24 (params));
+            break;
+        case BoardIds::DAWNEEG32_BOARD:
+            board = std::shared_ptr<Board> (new DawnEEG32 (params));
+            break;
+        default:
+            break;
+    }
+    return board;
+}
+
 std::pair<int, struct BrainFlowInputParams> get_key (
     int board_id, struct BrainFlowInputParams params)
 {
@@ -549,29 +654,67 @@ std::pair<int, struct BrainFlowInputParams> get_key (
     return key;
 }
 
-int check_board_session (int board_id, const char *json_brainflow_input_params,
-    std::pair<int, struct BrainFlowInputParams> &key, bool log_error)
+int get_board_session (int board_id, const char *json_brainflow_input_params,
+    std::shared_ptr<BoardSession> &session, bool log_error)
 {
+    if (json_brainflow_input_params == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::pair<int, std::string> alias = std::make_pair (board_id, json_brainflow_input_params);
+    {
+        SharedLockGuard lock (boards_mutex);
+        auto alias_it = board_aliases.find (alias);
+        if (alias_it != board_aliases.end ())
+        {
+            session = alias_it->second;
+            return (int)BrainFlowExitCodes::STATUS_OK;
+        }
+    }
+
+    // first call with this json string, parse it and remember the result
     struct BrainFlowInputParams params;
     int res = string_to_brainflow_input_params (json_brainflow_input_params, &params);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-
-    key = get_key (board_id, params);
-
-    if (boards.find (key) == boards.end ())
+    std::lock_guard<SharedMutex> lock (boards_mutex);
+    auto board_it = boards.find (get_key (board_id, params));
+    if (board_it == boards.end ())
     {
         if (log_error)
         {
-            LOG_F(ERROR, "Board with id {} and port provided config is not created", key.first);
+            LOG_F (ERROR, "Board with id {} and port provided config is not created", board_id);
         }
         return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
+    session = board_it->second;
+    board_aliases[alias] = session;
+    session->aliases.push_back (alias);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+void remove_board_session (const std::shared_ptr<BoardSession> &session)
+{
+    std::lock_guard<SharedMutex> lock (boards_mutex);
+    auto board_it = boards.find (session->key);
+    // a new session with the same key may be created already
+    if ((board_it != boards.end ()) && (board_it->second == session))
+    {
+        boards.erase (board_it);
+    }
+    for (const auto &alias : session->aliases)
+    {
+        auto alias_it = board_aliases.find (alias);
+        if ((alias_it != board_aliases.end ()) && (alias_it->second == session))
+        {
+            board_aliases.erase (alias_it);
+        }
+    }
+    session->aliases.clear ();
+}
+
 int string_to_brainflow_input_params (
     const char *json_brainflow_input_params, struct BrainFlowInputParams *params)
 {
@@ -25,6 +25,9 @@ endif (CMAKE_SIZEOF_VOID_P EQUAL 8)
 SET (BOARD_CONTROLLER_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/timestamp.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/binary_file.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/mapped_file.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/tsv_file.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/os_serial.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/os_serial_ioctl.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/serial.cpp
@@ -50,6 +53,7 @@ SET (BOARD_CONTROLLER_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board_controller.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board_info_getter.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/preset_layout.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/brainflow_boards.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/streaming_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/synthetic_board.cpp
@@ -58,6 +62,8 @@ SET (BOARD_CONTROLLER_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/playback_file_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/openbci/galea.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/file_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/async_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/binary_file_streamer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/multicast_streamer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/gtec/unicorn_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/neuromd/neuromd_board.cpp
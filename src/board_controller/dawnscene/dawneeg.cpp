@@ -414,8 +414,10 @@ void DawnEEG::read_thread ()
     int buf_length = NUM_SAMPLE_NUMBER_BYTES + NUM_DATA_BYTES_PER_CHANNEL * num_eeg_channels + NUM_AUX_BYTES + NUM_FOOTER_BYTES;
     unsigned char *buf = new unsigned char[buf_length];
 
-    int num_rows = board_descr["default"]["num_rows"];
-    int num_rows_aux = board_descr["auxiliary"]["num_rows"];
+    const PresetLayout &layout = get_preset_layout ((int)BrainFlowPresets::DEFAULT_PRESET);
+    const PresetLayout &aux_layout = get_preset_layout ((int)BrainFlowPresets::AUXILIARY_PRESET);
+    int num_rows = layout.num_rows;
+    int num_rows_aux = aux_layout.num_rows;
 
     double *package = new double[num_rows];
     double *package_aux = new double[num_rows_aux];
@@ -429,8 +431,8 @@ void DawnEEG::read_thread ()
         package_aux[i] = 0.0;
     }
 
-    std::vector<int> eeg_channels = board_descr["default"]["eeg_channels"];
-    std::vector<int> temperature_channels = board_descr["auxiliary"]["temperature_channels"];
+    const std::vector<int> &eeg_channels = layout.eeg_channels;
+    const std::vector<int> &temperature_channels = aux_layout.temperature_channels;
 
     while (keep_alive)
     {
@@ -478,7 +480,7 @@ void DawnEEG::read_thread ()
 
         // package num
         int package_num = buf[0];
-        package[board_descr["default"]["package_num_channel"].get<int> ()] = (double)package_num;
+        package[layout.package_num_channel] = (double)package_num;
 
         // eeg
         for (unsigned int i = 0; i < eeg_channels.size (); i++)
@@ -492,15 +494,12 @@ void DawnEEG::read_thread ()
         double device_timestamp = 
             ((buf[buf_length - 5] << 24) | (buf[buf_length - 4] << 16) | (buf[buf_length - 3] << 8) | (buf[buf_length - 2])) / 1000.0   // millisecond part
             + (((buf[buf_length - 7] & 0x03) << 8) | (buf[buf_length - 6])) / 1000000.0;  // microsecond part
-        package[board_descr["default"]["timestamp_channel"].get<int> ()] = device_timestamp + time_correction;
+        package[layout.timestamp_channel] = device_timestamp + time_correction;
 
         // marker & triggers
-        package[board_descr["default"]["marker_channel"].get<int> ()] =
-            (buf[buf_length - 7] >> 4) & 0x0F;
-        package[board_descr["default"]["trigger1_channel"].get<int> ()] =
-            (buf[buf_length - 7] >> 2) & 0x01;
-        package[board_descr["default"]["trigger2_channel"].get<int> ()] =
-            (buf[buf_length - 7] >> 3) & 0x01;
+        package[layout.marker_channel] = (buf[buf_length - 7] >> 4) & 0x0F;
+        package[layout.trigger1_channel] = (buf[buf_length - 7] >> 2) & 0x01;
+        package[layout.trigger2_channel] = (buf[buf_length - 7] >> 3) & 0x01;
 
         push_package (package);
 
@@ -509,12 +508,9 @@ void DawnEEG::read_thread ()
             package_num_aux = (double)(package_num / 8);
             battery_temperature = 0.0;
             battery_voltage = 0.0;
-            package_aux[board_descr["auxiliary"]["package_num_channel"].get<int> ()] =
-                package_num_aux;
-            package_aux[board_descr["auxiliary"]["timestamp_channel"].get<int> ()] =
-                device_timestamp + time_correction;
-            package_aux[board_descr["auxiliary"]["marker_channel"].get<int> ()] =
-                (buf[buf_length - 7] >> 4) & 0x0F;
+            package_aux[aux_layout.package_num_channel] = package_num_aux;
+            package_aux[aux_layout.timestamp_channel] = device_timestamp + time_correction;
+            package_aux[aux_layout.marker_channel] = (buf[buf_length - 7] >> 4) & 0x0F;
             battery_temperature = buf[buf_length - 8] * 256; // temperature MSB
         }
         else if (package_num % 8 == 1)
@@ -529,8 +525,7 @@ void DawnEEG::read_thread ()
         else if (package_num % 8 == 3)
         {
             battery_voltage += buf[buf_length - 8]; // voltage LSB
-            package_aux[board_descr["auxiliary"]["battery_channel"].get<int> ()] =
-                battery_voltage / 1000.0;
+            package_aux[aux_layout.battery_channel] = battery_voltage / 1000.0;
             push_package (package_aux, (int)BrainFlowPresets::AUXILIARY_PRESET);
         }
     }
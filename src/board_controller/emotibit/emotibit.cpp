@@ -190,9 +190,12 @@ void Emotibit::read_thread ()
     double *default_packages[max_datapoints_in_package];
     double *aux_packages[max_datapoints_in_package];
     double *anc_packages[max_datapoints_in_package];
-    int num_default_rows = board_descr["default"]["num_rows"];
-    int num_aux_rows = board_descr["auxiliary"]["num_rows"];
-    int num_anc_rows = board_descr["ancillary"]["num_rows"];
+    const PresetLayout &default_layout = get_preset_layout ((int)BrainFlowPresets::DEFAULT_PRESET);
+    const PresetLayout &aux_layout = get_preset_layout ((int)BrainFlowPresets::AUXILIARY_PRESET);
+    const PresetLayout &anc_layout = get_preset_layout ((int)BrainFlowPresets::ANCILLARY_PRESET);
+    int num_default_rows = default_layout.num_rows;
+    int num_aux_rows = aux_layout.num_rows;
+    int num_anc_rows = anc_layout.num_rows;
 
     for (int cur_package = 0; cur_package < max_datapoints_in_package; cur_package++)
     {
@@ -236,50 +239,47 @@ void Emotibit::read_thread ()
                 int channel = -1;
                 if (type_tag == ACCELEROMETER_X)
                 {
-                    channel = board_descr["default"]["accel_channels"][0];
+                    channel = default_layout.accel_channels[0];
                 }
                 if (type_tag == ACCELEROMETER_Y)
                 {
-                    channel = board_descr["default"]["accel_channels"][1];
+                    channel = default_layout.accel_channels[1];
                 }
                 if (type_tag == ACCELEROMETER_Z)
                 {
-                    channel = board_descr["default"]["accel_channels"][2];
+                    channel = default_layout.accel_channels[2];
                 }
                 if (type_tag == GYROSCOPE_X)
                 {
-                    channel = board_descr["default"]["gyro_channels"][0];
+                    channel = default_layout.gyro_channels[0];
                 }
                 if (type_tag == GYROSCOPE_Y)
                 {
-                    channel = board_descr["default"]["gyro_channels"][1];
+                    channel = default_layout.gyro_channels[1];
                 }
                 if (type_tag == GYROSCOPE_Z)
                 {
-                    channel = board_descr["default"]["gyro_channels"][2];
+                    channel = default_layout.gyro_channels[2];
                 }
                 if (type_tag == MAGNETOMETER_X)
                 {
-                    channel = board_descr["default"]["magnetometer_channels"][0];
+                    channel = default_layout.magnetometer_channels[0];
                 }
                 if (type_tag == MAGNETOMETER_Y)
                 {
-                    channel = board_descr["default"]["magnetometer_channels"][1];
+                    channel = default_layout.magnetometer_channels[1];
                 }
                 if (type_tag == MAGNETOMETER_Z)
                 {
-                    channel = board_descr["default"]["magnetometer_channels"][2];
+                    channel = default_layout.magnetometer_channels[2];
                 }
                 if (channel > 0)
                 {
                     for (int i = 0; i < std::min ((int)payload.size (), max_datapoints_in_package);
                          i++)
                     {
-                        default_packages[i]
-                                        [board_descr["default"]["timestamp_channel"].get<int> ()] =
-                                            get_timestamp ();
-                        default_packages[i][board_descr["default"]["package_num_channel"]
-                                                .get<int> ()] = package_num;
+                        default_packages[i][default_layout.timestamp_channel] = get_timestamp ();
+                        default_packages[i][default_layout.package_num_channel] = package_num;
                         try
                         {
                             default_packages[i][channel] = std::stod (payload[i]);
@@ -303,26 +303,23 @@ void Emotibit::read_thread ()
                 // auxuliary package
                 if (type_tag == PPG_INFRARED)
                 {
-                    channel = board_descr["auxiliary"]["ppg_channels"][0];
+                    channel = aux_layout.ppg_channels[0];
                 }
                 if (type_tag == PPG_RED)
                 {
-                    channel = board_descr["auxiliary"]["ppg_channels"][1];
+                    channel = aux_layout.ppg_channels[1];
                 }
                 if (type_tag == PPG_GREEN)
                 {
-                    channel = board_descr["auxiliary"]["ppg_channels"][2];
+                    channel = aux_layout.ppg_channels[2];
                 }
                 if (channel > 0)
                 {
                     for (int i = 0; i < std::min ((int)payload.size (), max_datapoints_in_package);
                          i++)
                     {
-                        aux_packages[i][board_descr["auxiliary"]["timestamp_channel"].get<int> ()] =
-                            get_timestamp ();
-                        aux_packages[i]
-                                    [board_descr["auxiliary"]["package_num_channel"].get<int> ()] =
-                                        package_num;
+                        aux_packages[i][aux_layout.timestamp_channel] = get_timestamp ();
+                        aux_packages[i][aux_layout.package_num_channel] = package_num;
                         try
                         {
                             aux_packages[i][channel] = std::stod (payload[i]);
@@ -349,11 +346,11 @@ void Emotibit::read_thread ()
                     int temperature_channel = 0;
                     if (type_tag == TEMPERATURE_1)
                     {
-                        temperature_channel = board_descr["ancillary"]["temperature_channels"][0];
+                        temperature_channel = anc_layout.temperature_channels[0];
                     }
                     if (type_tag == THERMOPILE)
                     {
-                        temperature_channel = board_descr["ancillary"]["other_channels"][0];
+                        temperature_channel = anc_layout.other_channels[0];
                     }
                     // upsample temperature data 2x to match eda
                     if (payload.size () < max_datapoints_in_package / 2)
@@ -393,14 +390,11 @@ void Emotibit::read_thread ()
                 }
                 if (type_tag == EDA)
                 {
-                    int eda_channel = board_descr["ancillary"]["eda_channels"][0];
+                    int eda_channel = anc_layout.eda_channels[0];
                     for (int i = 0; i < (int)payload.size (); i++)
                     {
-                        anc_packages[i][board_descr["ancillary"]["timestamp_channel"].get<int> ()] =
-                            get_timestamp ();
-                        anc_packages[i]
-                                    [board_descr["ancillary"]["package_num_channel"].get<int> ()] =
-                                        package_num;
+                        anc_packages[i][anc_layout.timestamp_channel] = get_timestamp ();
+                        anc_packages[i][anc_layout.package_num_channel] = package_num;
                         try
                         {
                             anc_packages[i][eda_channel] = std::stod (payload[i]);
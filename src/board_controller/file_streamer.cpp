@@ -1,4 +1,5 @@
 #include <string.h>
+#include <string>
 #include <typeinfo>
 
 #include "brainflow_constants.h"
@@ -45,3 +46,21 @@ void FileStreamer::stream_data (double *data)
     }
     fprintf (fp, "%lf\n", data[len - 1]);
 }
+
+void FileStreamer::stream_data (double *data, int num_packages)
+{
+    // format the whole block first and write it with a single call
+    std::string block;
+    block.reserve (num_packages * len * 12);
+    char value[400]; // enough for any double in %lf format
+    for (int i = 0; i < num_packages * len; i++)
+    {
+        int res =
+            snprintf (value, sizeof (value), "%lf%c", data[i], ((i + 1) % len == 0) ? '\n' : '\t');
+        if ((res > 0) && (res < (int)sizeof (value)))
+        {
+            block.append (value, res);
+        }
+    }
+    fwrite (block.data (), 1, block.size (), fp);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "streamer.h"
+
+
+enum class StreamerOverflowPolicy : int
+{
+    BLOCK = 0,
+    DROP_OLDEST = 1,
+    DROP_NEWEST = 2
+};
+
+struct StreamerStats
+{
+    size_t queued;         // packages waiting in the queue right now
+    size_t queue_size;     // capacity of the queue in packages
+    long long streamed;    // packages passed to the streamer
+    long long dropped;     // packages lost because of overflow policy
+    double max_latency_ms; // max time between push and stream_data call
+};
+
+// Decouples a streamer from the acquisition thread: packages are copied into a bounded queue
+// and a dedicated thread passes them to the wrapped streamer. Takes ownership of the streamer.
+class AsyncStreamer : public Streamer
+{
+
+public:
+    AsyncStreamer (Streamer *streamer, int data_len, size_t queue_size,
+        StreamerOverflowPolicy overflow_policy);
+    ~AsyncStreamer ();
+
+    // parses options like "queue_size=1000&overflow=drop_oldest"
+    static int parse_options (const std::string &options, size_t &queue_size,
+        StreamerOverflowPolicy &overflow_policy);
+
+    int init_streamer ();
+    void stream_data (double *data);
+    void stream_data (double *data, int num_packages);
+    bool check_equals (std::string type, std::string dest, std::string mods);
+    StreamerStats get_stats ();
+
+private:
+    Streamer *streamer;
+    StreamerOverflowPolicy overflow_policy;
+    size_t queue_size;
+    size_t max_batch_size;
+
+    std::vector<double> queue;
+    std::vector<std::chrono::steady_clock::time_point> push_times;
+    size_t first;
+    size_t count;
+    long long streamed;
+    long long dropped;
+    double max_latency_ms;
+
+    std::vector<double> batch;
+    std::mutex m;
+    std::condition_variable cv_not_empty;
+    std::condition_variable cv_not_full;
+    bool is_streaming;
+    std::thread streaming_thread;
+
+    void thread_worker ();
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include "binary_file.h"
+#include "streamer.h"
+
+
+// Writes packages in BrainFlow binary format with timestamp index, file mode is "w" or "a" for
+// float64 values and "w_float32" or "a_float32" for float32 values. Like other streamers it is
+// called from AsyncStreamer thread, so disk writes dont block acquisition.
+class BinaryFileStreamer : public Streamer
+{
+
+public:
+    // header describes board and preset, value size is set from file mode
+    BinaryFileStreamer (const char *file, const char *file_mode, const BinaryFileHeader &header);
+    ~BinaryFileStreamer ();
+
+    int init_streamer ();
+    void stream_data (double *data);
+    void stream_data (double *data, int num_packages);
+
+private:
+    std::string file;
+    std::string file_mode;
+    BinaryFileHeader header;
+    BinaryFileWriter writer;
+};
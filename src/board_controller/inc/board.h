@@ -1,17 +1,22 @@
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <deque>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <stdio.h>
 
+#include "async_streamer.h"
 #include "board_controller.h"
 #include "brainflow_boards.h"
 #include "brainflow_constants.h"
 #include "brainflow_input_params.h"
 #include "data_buffer.h"
+#include "preset_layout.h"
 #include "spinlock.h"
 #include "streamer.h"
 
@@ -36,6 +41,8 @@ public:
     Board (int board_id, struct BrainFlowInputParams params)
     {
         skip_logs = false;
+        streamers = std::make_shared<const StreamerMap> ();
+        num_streamers = 0;
         this->board_id = board_id;
         this->params = params;
         try
@@ -60,6 +67,8 @@ public:
     int insert_marker (double value, int preset);
     int add_streamer (const char *streamer_params, int preset);
     int delete_streamer (const char *streamer_params, int preset);
+    // returns queue counters of a streamer as json string
+    int get_streamer_stats (const char *streamer_params, int preset, std::string &stats);
 
     int get_board_id ()
     {
@@ -67,24 +76,37 @@ public:
     }
 
 protected:
+    typedef std::map<int, std::vector<AsyncStreamer *>> StreamerMap;
+
     std::map<int, DataBuffer *> dbs;
-    std::map<int, std::vector<Streamer *>> streamers;
+    // immutable snapshot, acquisition thread loads it with std::atomic_load and streams without
+    // locks, add and delete streamer publish a modified copy
+    std::shared_ptr<const StreamerMap> streamers;
+    // checked before loading the snapshot, pushing packages without streamers costs one load
+    std::atomic<int> num_streamers;
+    // serializes add and delete streamer
+    std::mutex streamers_mutex;
     bool skip_logs;
     int board_id;
     struct BrainFlowInputParams params;
     json board_descr;
     SpinLock lock;
     std::map<int, std::deque<double>> marker_queues;
+    std::map<int, PresetLayout> preset_layouts;
 
     int prepare_for_acquisition (int buffer_size, const char *streamer_params);
     void free_packages ();
     void push_package (double *package, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    // packages are stored one after another, the whole block is pushed under a single lock
+    void push_packages (
+        double *packages, int num_packages, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    // resolved in prepare_for_acquisition, use it instead board_descr in read threads
+    const PresetLayout &get_preset_layout (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    // returns the old snapshot once nobody else uses it, call it under streamers_mutex
+    std::shared_ptr<const StreamerMap> publish_streamers (
+        std::shared_ptr<const StreamerMap> new_streamers);
     std::string preset_to_string (int preset);
     int preset_to_int (std::string preset);
     int parse_streamer_params (const char *streamer_params, std::string &streamer_type,
-        std::string &streamer_dest, std::string &streamer_mods);
-
-private:
-    // reshapes data from DataBuffer format where all channels are mixed to linear buffer
-    void reshape_data (int data_count, int preset, const double *buf, double *output_buf);
+        std::string &streamer_dest, std::string &streamer_mods, std::string &streamer_options);
 };
@@ -14,6 +14,7 @@ public:
 
     int init_streamer ();
     void stream_data (double *data);
+    void stream_data (double *data, int num_packages);
 
 private:
     char file[128];
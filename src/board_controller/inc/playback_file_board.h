@@ -1,12 +1,15 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
 #include <vector>
 
 #include "board.h"
+#include "binary_file.h"
 #include "board_controller.h"
+#include "tsv_file.h"
 
 
 class PlaybackFileBoard : public Board
@@ -16,13 +19,24 @@ private:
     volatile bool keep_alive;
     volatile bool loopback;
     volatile bool use_new_timestamps;
-    std::vector<double> pos_percentage;
+    // multiplier for recorded time deltas, 0 means no pacing: buffer is filled as fast as
+    // consumers drain it, playback stops while it is full
+    std::atomic<double> playback_speed;
+    std::vector<long long> seek_positions; // package to jump to for each preset, -1 if none
     std::vector<std::thread> streaming_threads;
     bool initialized;
-    std::vector<std::vector<long int>> file_offsets;
-
-    void read_thread (int preset, std::string filename);
-    int get_file_offsets (std::string filename, std::vector<long int> &offsets);
+    // one file per preset mapped in prepare_session, tsv or binary
+    TsvFile tsv_files[3];
+    BinaryFileReader binary_files[3];
+    bool is_binary[3];
+
+    void read_thread (int preset);
+    int open_file (std::string filename, int preset);
+    void close_files ();
+    size_t get_num_packages (int preset);
+    bool read_package (int preset, size_t package_num, double *package, int num_rows);
+    // first package with timestamp >= timestamp
+    size_t find_package (int preset, double timestamp);
 
 public:
     PlaybackFileBoard (struct BrainFlowInputParams params);
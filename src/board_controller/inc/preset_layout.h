@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+
+#include "brainflow_boards.h"
+
+
+// Channel layout of a single preset resolved from brainflow_boards json once, json lookups are
+// too slow to be done per package. Optional fields which are not present for a board are set to
+// -1 for channels, 0 for sampling rate and empty vectors for channel lists.
+struct PresetLayout
+{
+    int num_rows;
+    int sampling_rate;
+    int timestamp_channel;
+    int marker_channel;
+    int package_num_channel;
+    int battery_channel;
+    int trigger1_channel;
+    int trigger2_channel;
+    std::vector<int> eeg_channels;
+    std::vector<int> emg_channels;
+    std::vector<int> ecg_channels;
+    std::vector<int> eog_channels;
+    std::vector<int> eda_channels;
+    std::vector<int> ppg_channels;
+    std::vector<int> accel_channels;
+    std::vector<int> gyro_channels;
+    std::vector<int> magnetometer_channels;
+    std::vector<int> temperature_channels;
+    std::vector<int> resistance_channels;
+    std::vector<int> analog_channels;
+    std::vector<int> other_channels;
+
+    PresetLayout ();
+    explicit PresetLayout (const json &board_preset);
+};
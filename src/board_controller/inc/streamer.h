@@ -20,6 +20,15 @@ public:
     virtual int init_streamer () = 0;
     virtual void stream_data (double *data) = 0;
 
+    // data contains num_packages packages of len elements one after another
+    virtual void stream_data (double *data, int num_packages)
+    {
+        for (int i = 0; i < num_packages; i++)
+        {
+            stream_data (data + i * len);
+        }
+    }
+
     virtual bool check_equals (std::string type, std::string dest, std::string mods)
     {
         return ((streamer_type == type) && (streamer_dest == dest) && (streamer_mods == mods));
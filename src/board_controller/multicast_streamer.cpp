@@ -77,6 +77,11 @@ void MultiCastStreamer::stream_data (double *data)
     db->add_data (data);
 }
 
+void MultiCastStreamer::stream_data (double *data, int num_packages)
+{
+    db->add_data (data, num_packages);
+}
+
 void MultiCastStreamer::thread_worker ()
 {
     int num_packages = get_brainflow_batch_size ();
@@ -20,9 +20,17 @@ protected:
     std::condition_variable cv;
     std::vector<std::pair<simpleble_uuid_t, simpleble_uuid_t>> notified_characteristics;
     std::pair<simpleble_uuid_t, simpleble_uuid_t> control_characteristics;
-    std::vector<std::vector<double>> current_default_buf;
-    std::vector<std::vector<double>> current_aux_buf;
-    std::vector<std::vector<double>> current_anc_buf;
+    // packages from single ble transaction stored one after another to push them at once
+    std::vector<double> current_default_buf;
+    std::vector<double> current_aux_buf;
+    std::vector<double> current_anc_buf;
+    int num_default_rows;
+    int num_aux_rows;
+    int num_anc_rows;
+    // copies of board layouts, set under callback_lock once buffers are ready in start_stream
+    PresetLayout default_layout;
+    PresetLayout aux_layout;
+    PresetLayout anc_layout;
     std::vector<bool> new_eeg_data;
     std::vector<bool> new_ppg_data;
     double last_fifth_chan_timestamp; // used to determine 4 or 5 channels used
@@ -30,6 +38,8 @@ protected:
     double last_eeg_timestamp;        // used for timestamp correction
     double last_aux_timestamp;        // used for timestamp correction
 
+    void set_layouts (bool is_ready);
+
 public:
     Muse (int board_id, struct BrainFlowInputParams params);
     ~Muse ();
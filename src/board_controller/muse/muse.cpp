@@ -85,6 +85,9 @@ Muse::Muse (int board_id, struct BrainFlowInputParams params) : BLELibBoard (boa
     last_ppg_timestamp = -1.0;
     last_eeg_timestamp = -1.0;
     last_aux_timestamp = -1.0;
+    num_default_rows = 0;
+    num_aux_rows = 0;
+    num_anc_rows = 0;
 }
 
 Muse::~Muse ()
@@ -387,32 +390,20 @@ int Muse::prepare_session ()
 
     if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (control_characteristics_found))
     {
-        int eeg_buffer_size = board_descr["default"]["num_rows"].get<int> ();
-        int aux_buffer_size = board_descr["auxiliary"]["num_rows"].get<int> ();
-        current_default_buf.resize (12); // 12 eeg packages in single ble transaction
-        new_eeg_data.resize (5);         // 5 eeg channels total
-        current_aux_buf.resize (3);      // 3 samples in each message for gyro and accel
-        for (int i = 0; i < 12; i++)
-        {
-            current_default_buf[i].resize (eeg_buffer_size);
-            std::fill (current_default_buf[i].begin (), current_default_buf[i].end (), 0.0);
-        }
+        num_default_rows = board_descr["default"]["num_rows"].get<int> ();
+        num_aux_rows = board_descr["auxiliary"]["num_rows"].get<int> ();
+        // 12 eeg packages in single ble transaction
+        current_default_buf.assign (12 * num_default_rows, 0.0);
+        new_eeg_data.resize (5); // 5 eeg channels total
         std::fill (new_eeg_data.begin (), new_eeg_data.end (), false);
-        for (int i = 0; i < 3; i++)
-        {
-            current_aux_buf[i].resize (aux_buffer_size);
-            std::fill (current_aux_buf[i].begin (), current_aux_buf[i].end (), 0.0);
-        }
+        // 3 samples in each message for gyro and accel
+        current_aux_buf.assign (3 * num_aux_rows, 0.0);
         // muse 2016 has no ppg
         if (board_id != (int)BoardIds::MUSE_2016_BOARD)
         {
-            int anc_buffer_size = board_descr["ancillary"]["num_rows"].get<int> ();
-            current_anc_buf.resize (6); // 6 ppg packages in single transaction
-            for (int i = 0; i < 6; i++)
-            {
-                current_anc_buf[i].resize (anc_buffer_size);
-                std::fill (current_anc_buf[i].begin (), current_anc_buf[i].end (), 0.0);
-            }
+            num_anc_rows = board_descr["ancillary"]["num_rows"].get<int> ();
+            // 6 ppg packages in single transaction
+            current_anc_buf.assign (6 * num_anc_rows, 0.0);
             new_ppg_data.resize (3); // 3 ppg chars
             std::fill (new_ppg_data.begin (), new_ppg_data.end (), false);
         }
@@ -443,9 +434,12 @@ int Muse::start_stream (int buffer_size, const char *streamer_params)
         return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
 
+    // callbacks dont push packages while buffers are recreated
+    set_layouts (false);
     int res = prepare_for_acquisition (buffer_size, streamer_params);
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
+        set_layouts (true);
         res = config_board ("d");
     }
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
@@ -504,6 +498,7 @@ int Muse::release_session ()
                 }
             }
         }
+        set_layouts (false);
         free_packages ();
         initialized = false;
     }
@@ -526,27 +521,34 @@ int Muse::release_session ()
         muse_adapter = NULL;
     }
 
-    for (size_t i = 0; i < current_default_buf.size (); i++)
-    {
-        current_default_buf[i].clear ();
-    }
     current_default_buf.clear ();
     new_eeg_data.clear ();
-    for (size_t i = 0; i < current_aux_buf.size (); i++)
-    {
-        current_aux_buf[i].clear ();
-    }
     current_aux_buf.clear ();
-    for (size_t i = 0; i < current_anc_buf.size (); i++)
-    {
-        current_anc_buf[i].clear ();
-    }
     current_anc_buf.clear ();
     new_ppg_data.clear ();
 
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+void Muse::set_layouts (bool is_ready)
+{
+    std::lock_guard<std::mutex> callback_guard (callback_lock);
+    if (!is_ready)
+    {
+        default_layout = PresetLayout ();
+        aux_layout = PresetLayout ();
+        anc_layout = PresetLayout ();
+        return;
+    }
+    default_layout = get_preset_layout ((int)BrainFlowPresets::DEFAULT_PRESET);
+    aux_layout = get_preset_layout ((int)BrainFlowPresets::AUXILIARY_PRESET);
+    // muse 2016 has no ppg
+    if (board_id != (int)BoardIds::MUSE_2016_BOARD)
+    {
+        anc_layout = get_preset_layout ((int)BrainFlowPresets::ANCILLARY_PRESET);
+    }
+}
+
 int Muse::config_board (std::string config, std::string &response)
 {
     return config_board (config);
@@ -634,6 +636,13 @@ void Muse::peripheral_on_eeg (simpleble_uuid_t service, simpleble_uuid_t charact
         return;
     }
 
+    // notifications are enabled in prepare_session, layouts are set only in start_stream
+    const PresetLayout &layout = default_layout;
+    if (layout.num_rows == 0)
+    {
+        return;
+    }
+
     /* 5th(aux) channel is off by default, need to enable p50 preset. Need to handle both cases, use
      * timestamps to determine if its on or not */
     if (channel_num == 4)
@@ -642,7 +651,8 @@ void Muse::peripheral_on_eeg (simpleble_uuid_t service, simpleble_uuid_t charact
     }
     new_eeg_data[channel_num] = true;
 
-    std::vector<int> eeg_channels = board_descr["default"]["eeg_channels"];
+    const std::vector<int> &eeg_channels = layout.eeg_channels;
+    int num_packages = (int)current_default_buf.size () / num_default_rows;
     unsigned int package_num = data[0] * 256 + data[1];
     for (size_t i = 2, counter = 0; i < size; i += 3, counter += 2)
     {
@@ -653,13 +663,13 @@ void Muse::peripheral_on_eeg (simpleble_uuid_t service, simpleble_uuid_t charact
         // place optional aux channel to other channels
         if (channel_num == 4)
         {
-            try
+            if (!layout.other_channels.empty ())
             {
-                std::vector<int> other_channels = board_descr["default"]["other_channels"];
-                current_default_buf[counter][other_channels[0]] = val1;
-                current_default_buf[counter + 1][other_channels[0]] = val2;
+                int other_channel = layout.other_channels[0];
+                current_default_buf[counter * num_default_rows + other_channel] = val1;
+                current_default_buf[(counter + 1) * num_default_rows + other_channel] = val2;
             }
-            catch (...)
+            else
             {
                 LOG_F(2,
                     "no other_channels for this board"); // should not get here
@@ -667,13 +677,13 @@ void Muse::peripheral_on_eeg (simpleble_uuid_t service, simpleble_uuid_t charact
         }
         else
         {
-            current_default_buf[counter][eeg_channels[channel_num]] = val1;
-            current_default_buf[counter + 1][eeg_channels[channel_num]] = val2;
+            current_default_buf[counter * num_default_rows + eeg_channels[channel_num]] = val1;
+            current_default_buf[(counter + 1) * num_default_rows + eeg_channels[channel_num]] =
+                val2;
         }
-        current_default_buf[counter][board_descr["default"]["package_num_channel"].get<int> ()] =
+        current_default_buf[counter * num_default_rows + layout.package_num_channel] = package_num;
+        current_default_buf[(counter + 1) * num_default_rows + layout.package_num_channel] =
             package_num;
-        current_default_buf[counter +
-            1][board_descr["default"]["package_num_channel"].get<int> ()] = package_num;
     }
 
     int num_trues = 0;
@@ -694,13 +704,13 @@ void Muse::peripheral_on_eeg (simpleble_uuid_t service, simpleble_uuid_t charact
         // skip one package to setup timestamp correction
         if (last_eeg_timestamp > 0)
         {
-            double step = (current_timestamp - last_eeg_timestamp) / current_default_buf.size ();
-            for (size_t i = 0; i < current_default_buf.size (); i++)
+            double step = (current_timestamp - last_eeg_timestamp) / num_packages;
+            for (int i = 0; i < num_packages; i++)
             {
-                current_default_buf[i][board_descr["default"]["timestamp_channel"].get<int> ()] =
+                current_default_buf[i * num_default_rows + layout.timestamp_channel] =
                     last_eeg_timestamp + step * (i + 1);
-                push_package (&current_default_buf[i][0]);
             }
+            push_packages (&current_default_buf[0], num_packages);
         }
         last_eeg_timestamp = current_timestamp;
         std::fill (new_eeg_data.begin (), new_eeg_data.end (), false);
@@ -717,14 +727,20 @@ void Muse::peripheral_on_accel (
         return;
     }
 
+    const PresetLayout &layout = aux_layout;
+    if (layout.num_rows == 0)
+    {
+        return;
+    }
     for (int i = 0; i < 3; i++)
     {
+        double *package = &current_aux_buf[i * num_aux_rows];
         double accel_valx = (double)cast_16bit_to_int32 ((unsigned char *)&data[2 + i * 6]) / 16384;
         double accel_valy = (double)cast_16bit_to_int32 ((unsigned char *)&data[4 + i * 6]) / 16384;
         double accel_valz = (double)cast_16bit_to_int32 ((unsigned char *)&data[6 + i * 6]) / 16384;
-        current_aux_buf[i][board_descr["auxiliary"]["accel_channels"][0].get<int> ()] = accel_valx;
-        current_aux_buf[i][board_descr["auxiliary"]["accel_channels"][1].get<int> ()] = accel_valy;
-        current_aux_buf[i][board_descr["auxiliary"]["accel_channels"][2].get<int> ()] = accel_valz;
+        package[layout.accel_channels[0]] = accel_valx;
+        package[layout.accel_channels[1]] = accel_valy;
+        package[layout.accel_channels[2]] = accel_valz;
     }
 }
 
@@ -740,32 +756,38 @@ void Muse::peripheral_on_gyro (
 
     unsigned int package_num = data[0] * 256 + data[1];
     double current_timestamp = get_timestamp ();
+    const PresetLayout &layout = aux_layout;
+    if (layout.num_rows == 0)
+    {
+        return;
+    }
+    int num_packages = (int)current_aux_buf.size () / num_aux_rows;
 
     for (int i = 0; i < 3; i++)
     {
+        double *package = &current_aux_buf[i * num_aux_rows];
         double gyro_valx = (double)cast_16bit_to_int32 ((unsigned char *)&data[2 + i * 6]) *
             MUSE_GYRO_SCALE_FACTOR;
         double gyro_valy = (double)cast_16bit_to_int32 ((unsigned char *)&data[4 + i * 6]) *
             MUSE_GYRO_SCALE_FACTOR;
         double gyro_valz = (double)cast_16bit_to_int32 ((unsigned char *)&data[6 + i * 6]) *
             MUSE_GYRO_SCALE_FACTOR;
-        current_aux_buf[i][board_descr["auxiliary"]["gyro_channels"][0].get<int> ()] = gyro_valx;
-        current_aux_buf[i][board_descr["auxiliary"]["gyro_channels"][1].get<int> ()] = gyro_valy;
-        current_aux_buf[i][board_descr["auxiliary"]["gyro_channels"][2].get<int> ()] = gyro_valz;
-        current_aux_buf[i][board_descr["auxiliary"]["package_num_channel"].get<int> ()] =
-            (double)package_num;
+        package[layout.gyro_channels[0]] = gyro_valx;
+        package[layout.gyro_channels[1]] = gyro_valy;
+        package[layout.gyro_channels[2]] = gyro_valz;
+        package[layout.package_num_channel] = (double)package_num;
     }
 
     if (last_aux_timestamp > 0)
     {
-        double step = (current_timestamp - last_aux_timestamp) / current_aux_buf.size ();
+        double step = (current_timestamp - last_aux_timestamp) / num_packages;
         // push aux packages from gyro callback
-        for (size_t i = 0; i < current_aux_buf.size (); i++)
+        for (int i = 0; i < num_packages; i++)
         {
-            current_aux_buf[i][board_descr["auxiliary"]["timestamp_channel"].get<int> ()] =
+            current_aux_buf[i * num_aux_rows + layout.timestamp_channel] =
                 last_aux_timestamp + step * (i + 1);
-            push_package (&current_aux_buf[i][0], (int)BrainFlowPresets::AUXILIARY_PRESET);
         }
+        push_packages (&current_aux_buf[0], num_packages, (int)BrainFlowPresets::AUXILIARY_PRESET);
     }
     last_aux_timestamp = current_timestamp;
 }
@@ -779,14 +801,19 @@ void Muse::peripheral_on_ppg (simpleble_uuid_t service, simpleble_uuid_t charact
         LOG_F(WARNING, "unknown size for ppg callback: {}", size);
         return;
     }
+    const PresetLayout &layout = anc_layout;
+    if (layout.num_rows == 0)
+    {
+        return;
+    }
     unsigned int package_num = data[0] * 256 + data[1];
     new_ppg_data[ppg_num] = true;
-    std::vector<int> ppg_channels = board_descr["ancillary"]["ppg_channels"];
+    int num_packages = (int)current_anc_buf.size () / num_anc_rows;
     // format is: 2 bytes for package num, 6 int24 values for actual data
     for (int i = 0; i < 6; i++)
     {
         double ppg_val = (double)cast_24bit_to_int32 ((unsigned char *)&data[2 + i * 3]);
-        current_anc_buf[i][ppg_channels[ppg_num]] = ppg_val;
+        current_anc_buf[i * num_anc_rows + layout.ppg_channels[ppg_num]] = ppg_val;
     }
     int num_trues = 0;
     for (size_t i = 0; i < new_ppg_data.size (); i++)
@@ -805,13 +832,14 @@ void Muse::peripheral_on_ppg (simpleble_uuid_t service, simpleble_uuid_t charact
         // skip one package to setup timestamp correction
         if (last_ppg_timestamp > 0)
         {
-            double step = (current_timestamp - last_ppg_timestamp) / current_anc_buf.size ();
-            for (size_t i = 0; i < current_anc_buf.size (); i++)
+            double step = (current_timestamp - last_ppg_timestamp) / num_packages;
+            for (int i = 0; i < num_packages; i++)
             {
-                current_anc_buf[i][board_descr["ancillary"]["timestamp_channel"].get<int> ()] =
+                current_anc_buf[i * num_anc_rows + layout.timestamp_channel] =
                     last_ppg_timestamp + step * (i + 1);
-                push_package (&current_anc_buf[i][0], (int)BrainFlowPresets::ANCILLARY_PRESET);
             }
+            push_packages (
+                &current_anc_buf[0], num_packages, (int)BrainFlowPresets::ANCILLARY_PRESET);
         }
         last_ppg_timestamp = current_timestamp;
         std::fill (new_ppg_data.begin (), new_ppg_data.end (), false);
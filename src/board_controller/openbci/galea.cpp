@@ -347,17 +347,20 @@ void Galea::read_thread ()
         b[i] = 0;
     }
 
-    int num_exg_rows = board_descr["default"]["num_rows"];
-    int num_aux_rows = board_descr["auxiliary"]["num_rows"];
-    double *exg_package = new double[num_exg_rows];
-    double *aux_package = new double[num_aux_rows];
-    for (int i = 0; i < num_exg_rows; i++)
+    const PresetLayout &exg_layout = get_preset_layout ((int)BrainFlowPresets::DEFAULT_PRESET);
+    const PresetLayout &aux_layout = get_preset_layout ((int)BrainFlowPresets::AUXILIARY_PRESET);
+    int num_exg_rows = exg_layout.num_rows;
+    int num_aux_rows = aux_layout.num_rows;
+    // all packages from single transaction are pushed at once
+    double *exg_packages = new double[num_exg_rows * Galea::max_num_packages];
+    double *aux_packages = new double[num_aux_rows * Galea::max_num_packages];
+    for (int i = 0; i < num_exg_rows * Galea::max_num_packages; i++)
     {
-        exg_package[i] = 0.0;
+        exg_packages[i] = 0.0;
     }
-    for (int i = 0; i < num_aux_rows; i++)
+    for (int i = 0; i < num_aux_rows * Galea::max_num_packages; i++)
     {
-        aux_package[i] = 0.0;
+        aux_packages[i] = 0.0;
     }
 
     while (keep_alive)
@@ -415,12 +418,13 @@ void Galea::read_thread ()
                 LOG_F(1, "start streaming");
             }
 
+            int num_aux_packages = 0;
             for (int cur_package = 0; cur_package < num_packages; cur_package++)
             {
                 int offset = cur_package * package_size;
+                double *exg_package = exg_packages + cur_package * num_exg_rows;
                 // exg (default preset)
-                exg_package[board_descr["default"]["package_num_channel"].get<int> ()] =
-                    (double)b[0 + offset];
+                exg_package[exg_layout.package_num_channel] = (double)b[0 + offset];
                 for (int i = 4, tmp_counter = 0; i < 20; i++, tmp_counter++)
                 {
                     double exg_scale = (double)(4.5 / float ((pow (2, 23) - 1)) /
@@ -432,18 +436,16 @@ void Galea::read_thread ()
                 memcpy (&timestamp_device, b + 64 + offset, 8);
                 timestamp_device /= 1000; // from ms to seconds
 
-                exg_package[board_descr["default"]["timestamp_channel"].get<int> ()] =
+                exg_package[exg_layout.timestamp_channel] =
                     timestamp_device + time_delta - half_rtt;
-                exg_package[board_descr["default"]["other_channels"][0].get<int> ()] = pc_timestamp;
-                exg_package[board_descr["default"]["other_channels"][1].get<int> ()] =
-                    timestamp_device;
-                push_package (exg_package);
+                exg_package[exg_layout.other_channels[0]] = pc_timestamp;
+                exg_package[exg_layout.other_channels[1]] = timestamp_device;
 
                 // aux, 5 times smaller sampling rate
                 if (((int)b[0 + offset]) % 5 == 0)
                 {
-                    aux_package[board_descr["auxiliary"]["package_num_channel"].get<int> ()] =
-                        (double)b[0 + offset];
+                    double *aux_package = aux_packages + num_aux_packages * num_aux_rows;
+                    aux_package[aux_layout.package_num_channel] = (double)b[0 + offset];
                     uint16_t temperature = 0;
                     int32_t ppg_ir = 0;
                     int32_t ppg_red = 0;
@@ -453,33 +455,27 @@ void Galea::read_thread ()
                     memcpy (&ppg_red, b + 56 + offset, 4);
                     memcpy (&ppg_ir, b + 60 + offset, 4);
                     // ppg
-                    aux_package[board_descr["auxiliary"]["ppg_channels"][0].get<int> ()] =
-                        (double)ppg_red;
-                    aux_package[board_descr["auxiliary"]["ppg_channels"][1].get<int> ()] =
-                        (double)ppg_ir;
+                    aux_package[aux_layout.ppg_channels[0]] = (double)ppg_red;
+                    aux_package[aux_layout.ppg_channels[1]] = (double)ppg_ir;
                     // eda
-                    aux_package[board_descr["auxiliary"]["eda_channels"][0].get<int> ()] =
-                        (double)eda;
+                    aux_package[aux_layout.eda_channels[0]] = (double)eda;
                     // temperature
-                    aux_package[board_descr["auxiliary"]["temperature_channels"][0].get<int> ()] =
-                        temperature / 100.0;
+                    aux_package[aux_layout.temperature_channels[0]] = temperature / 100.0;
                     // battery
-                    aux_package[board_descr["auxiliary"]["battery_channel"].get<int> ()] =
-                        (double)b[53 + offset];
-                    aux_package[board_descr["auxiliary"]["timestamp_channel"].get<int> ()] =
+                    aux_package[aux_layout.battery_channel] = (double)b[53 + offset];
+                    aux_package[aux_layout.timestamp_channel] =
                         timestamp_device + time_delta - half_rtt;
-                    aux_package[board_descr["auxiliary"]["other_channels"][0].get<int> ()] =
-                        pc_timestamp;
-                    aux_package[board_descr["auxiliary"]["other_channels"][1].get<int> ()] =
-                        timestamp_device;
-
-                    push_package (aux_package, (int)BrainFlowPresets::AUXILIARY_PRESET);
+                    aux_package[aux_layout.other_channels[0]] = pc_timestamp;
+                    aux_package[aux_layout.other_channels[1]] = timestamp_device;
+                    num_aux_packages++;
                 }
             }
+            push_packages (exg_packages, num_packages);
+            push_packages (aux_packages, num_aux_packages, (int)BrainFlowPresets::AUXILIARY_PRESET);
         }
     }
-    delete[] exg_package;
-    delete[] aux_package;
+    delete[] exg_packages;
+    delete[] aux_packages;
 }
 
 int Galea::calc_time (std::string &resp)
@@ -1,6 +1,5 @@
 #include <algorithm>
 #include <chrono>
-#include <sstream>
 #include <stdio.h>
 #include <string.h>
 #include <string>
@@ -19,7 +18,10 @@
 #define NEW_TIMESTAMPS "new_timestamps"
 #define OLD_TIMESTAMPS "old_timestamps"
 #define SET_INDEX_PREFIX "set_index_percentage:"
-#define MAX_LINE_LENGTH 8192
+#define SET_INDEX_SAMPLE_PREFIX "set_index_sample:"
+#define SET_INDEX_TIMESTAMP_PREFIX "set_index_timestamp:"
+#define SET_SPEED_PREFIX "set_speed:"
+#define MAX_SPEED "max"
 
 
 PlaybackFileBoard::PlaybackFileBoard (struct BrainFlowInputParams params)
@@ -32,8 +34,13 @@ PlaybackFileBoard::PlaybackFileBoard (struct BrainFlowInputParams params)
     loopback = false;
     initialized = false;
     use_new_timestamps = true;
-    pos_percentage.resize (3);
-    std::fill (pos_percentage.begin (), pos_percentage.end (), -1);
+    playback_speed = 1.0;
+    seek_positions.resize (3);
+    std::fill (seek_positions.begin (), seek_positions.end (), -1);
+    for (int i = 0; i < 3; i++)
+    {
+        is_binary[i] = false;
+    }
 }
 
 PlaybackFileBoard::~PlaybackFileBoard ()
@@ -73,44 +80,23 @@ int PlaybackFileBoard::prepare_session ()
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
     if (!params.file.empty ())
     {
-        std::vector<long int> offsets;
-        int res = get_file_offsets (params.file, offsets);
-        if (res != (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            return res;
-        }
-        else
-        {
-            file_offsets.push_back (offsets);
-        }
+        res = open_file (params.file, (int)BrainFlowPresets::DEFAULT_PRESET);
     }
-    if (!params.file_aux.empty ())
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (!params.file_aux.empty ()))
     {
-        std::vector<long int> offsets;
-        int res = get_file_offsets (params.file_aux, offsets);
-        if (res != (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            return res;
-        }
-        else
-        {
-            file_offsets.push_back (offsets);
-        }
+        res = open_file (params.file_aux, (int)BrainFlowPresets::AUXILIARY_PRESET);
     }
-    if (!params.file_anc.empty ())
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (!params.file_anc.empty ()))
     {
-        std::vector<long int> offsets;
-        int res = get_file_offsets (params.file_anc, offsets);
-        if (res != (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            return res;
-        }
-        else
-        {
-            file_offsets.push_back (offsets);
-        }
+        res = open_file (params.file_anc, (int)BrainFlowPresets::ANCILLARY_PRESET);
+    }
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        close_files ();
+        return res;
     }
 
     initialized = true;
@@ -135,18 +121,18 @@ int PlaybackFileBoard::start_stream (int buffer_size, const char *streamer_param
     keep_alive = true;
     if (!params.file.empty ())
     {
-        streaming_threads.push_back (std::thread (
-            [this] { this->read_thread ((int)BrainFlowPresets::DEFAULT_PRESET, params.file); }));
+        streaming_threads.push_back (
+            std::thread ([this] { this->read_thread ((int)BrainFlowPresets::DEFAULT_PRESET); }));
     }
     if (!params.file_aux.empty ())
     {
-        streaming_threads.push_back (std::thread ([this]
-            { this->read_thread ((int)BrainFlowPresets::AUXILIARY_PRESET, params.file_aux); }));
+        streaming_threads.push_back (
+            std::thread ([this] { this->read_thread ((int)BrainFlowPresets::AUXILIARY_PRESET); }));
     }
     if (!params.file_anc.empty ())
     {
-        streaming_threads.push_back (std::thread ([this]
-            { this->read_thread ((int)BrainFlowPresets::ANCILLARY_PRESET, params.file_anc); }));
+        streaming_threads.push_back (
+            std::thread ([this] { this->read_thread ((int)BrainFlowPresets::ANCILLARY_PRESET); }));
     }
 
     return (int)BrainFlowExitCodes::STATUS_OK;
@@ -178,11 +164,11 @@ int PlaybackFileBoard::release_session ()
         free_packages ();
         initialized = false;
     }
-    file_offsets.clear ();
+    close_files ();
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-void PlaybackFileBoard::read_thread (int preset, std::string file)
+void PlaybackFileBoard::read_thread (int preset)
 {
     std::string preset_str = preset_to_string (preset);
     if (board_descr.find (preset_str) == board_descr.end ())
@@ -191,58 +177,47 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
         return;
     }
 
-    FILE *fp;
-    fp = fopen (file.c_str (), "rb");
-    if (fp == NULL)
-    {
-        LOG_F(ERROR, "failed to open file in thread");
-        return;
-    }
-
-    json board_preset = board_descr[preset_str];
-    int num_rows = board_preset["num_rows"];
-    double *package = new double[num_rows];
-    for (int i = 0; i < num_rows; i++)
+    size_t num_packages = get_num_packages (preset);
+    const PresetLayout &layout = get_preset_layout (preset);
+    int num_rows = layout.num_rows;
+    // in max speed mode packages are pushed in blocks
+    const size_t max_block_size = 256;
+    double *packages = new double[num_rows * max_block_size];
+    for (size_t i = 0; i < num_rows * max_block_size; i++)
     {
-        package[i] = 0.0;
+        packages[i] = 0.0;
     }
-    char buf[MAX_LINE_LENGTH];
+    double *package = packages;
+    auto db_it = dbs.find (preset);
+    DataBuffer *db = (db_it == dbs.end ()) ? NULL : db_it->second;
+    size_t cur_package = 0;
     double last_timestamp = -1.0;
     bool new_timestamps = use_new_timestamps; // to prevent changing during streaming
-    int timestamp_channel = board_preset["timestamp_channel"];
+    int timestamp_channel = layout.timestamp_channel;
     double accumulated_time_delta = 0.0;
+    double last_speed = playback_speed.load ();
+    bool is_buffer_full = false;
 
     while (keep_alive)
     {
         auto start = std::chrono::high_resolution_clock::now ();
         // prevent race condition with another config_board method call
         lock.lock ();
-        double cur_index = pos_percentage[preset];
-        if ((int)cur_index >= 0)
+        if (seek_positions[preset] >= 0)
         {
-            int new_pos = (int)(cur_index * (file_offsets[preset].size () / 100.0));
-            try
-            {
-                fseek (fp, file_offsets[preset][new_pos], SEEK_SET);
-                LOG_F(2, "set position in a file to {}", new_pos);
-            }
-            catch (...)
-            {
-                // should never happen since input is already validated
-                LOG_F(WARNING, "invalid position in a file");
-            }
+            cur_package = (size_t)seek_positions[preset];
+            LOG_F(2, "set position in a file to {}", cur_package);
             last_timestamp = -1;
-            pos_percentage[preset] = -1;
+            seek_positions[preset] = -1;
         }
         lock.unlock ();
-        char *res = fgets (buf, sizeof (buf), fp);
-        if ((loopback) && (res == NULL))
+        if ((loopback) && (cur_package >= num_packages))
         {
-            fseek (fp, 0, SEEK_SET); // go to beginning'
+            cur_package = 0; // go to beginning
             last_timestamp = -1.0;
             continue;
         }
-        if ((!loopback) && (res == NULL))
+        if ((!loopback) && (cur_package >= num_packages))
         {
 // busy wait instead exit
 #ifdef _WIN32
@@ -252,44 +227,79 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
 #endif
             continue;
         }
-        // res not NULL
-        std::string tsv_string (buf);
-        std::stringstream ss (tsv_string);
-        std::vector<std::string> splitted;
-        std::string tmp;
-        char sep = '\t';
-        if (tsv_string.find ('\t') == std::string::npos)
+        double speed = playback_speed.load ();
+        if (speed != last_speed)
         {
-            sep = ',';
+            // restart pacing from the next package
+            last_speed = speed;
+            last_timestamp = -1.0;
+            accumulated_time_delta = 0.0;
         }
-        while (std::getline (ss, tmp, sep))
+
+        if (speed <= 0.0)
         {
-            if (tmp != "\n")
+            // max speed, dont overwrite samples which are not consumed yet
+            size_t block_size = std::min (max_block_size, num_packages - cur_package);
+            if (db != NULL)
             {
-                splitted.push_back (tmp);
+                block_size = std::min (block_size, db->get_free_space ());
             }
-        }
-        if (splitted.size () != num_rows)
-        {
-            LOG_F(ERROR,
-                "invalid string in file, check provided board id. String size {}, expected size {}",
-                splitted.size (), num_rows);
-            continue;
-        }
-        for (int i = 0; i < num_rows; i++)
-        {
-            try
+            if (block_size == 0)
             {
-                package[i] = std::stod (splitted[i]);
+                // only get_board_data frees space, get_current_board_data doesnt
+                if (!is_buffer_full)
+                {
+                    LOG_F(WARNING,
+                        "buffer for preset {} is full, playback is stopped until get_board_data "
+                        "is called",
+                        preset);
+                    is_buffer_full = true;
+                }
+#ifdef _WIN32
+                Sleep (1);
+#else
+                usleep (1000);
+#endif
+                continue;
             }
-            catch (...)
+            is_buffer_full = false;
+            int count = 0;
+            for (size_t i = 0; i < block_size; i++)
             {
-                LOG_F(ERROR, "failed to parse value: {}", splitted[i].c_str ());
+                double *cur = packages + count * num_rows;
+                bool is_valid = read_package (preset, cur_package, cur, num_rows);
+                cur_package++;
+                if (!is_valid)
+                {
+                    LOG_F(ERROR,
+                        "invalid string in file, check provided board id. Line {}, expected "
+                        "size {}",
+                        cur_package, num_rows);
+                    continue;
+                }
+                if (new_timestamps)
+                {
+                    cur[timestamp_channel] = get_timestamp ();
+                }
+                count++;
             }
+            push_packages (packages, count, preset);
+            continue;
+        }
+
+        bool is_valid = read_package (preset, cur_package, package, num_rows);
+        cur_package++;
+        if (!is_valid)
+        {
+            LOG_F(ERROR,
+                "invalid string in file, check provided board id. Line {}, expected size {}",
+                cur_package, num_rows);
+            continue;
         }
         if (last_timestamp > 0)
         {
-            double time_wait = (package[timestamp_channel] - last_timestamp) * 1000; // in ms
+            // in ms, scaled by playback speed
+            double time_wait = (package[timestamp_channel] - last_timestamp) * 1000 / speed;
             if (time_wait - accumulated_time_delta > 1)
             {
 #ifdef _WIN32
@@ -312,8 +322,7 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
         }
         push_package (package, preset);
     }
-    fclose (fp);
-    delete[] package;
+    delete[] packages;
 }
 
 int PlaybackFileBoard::config_board (std::string config, std::string &response)
@@ -342,7 +351,11 @@ int PlaybackFileBoard::config_board (std::string config, std::string &response)
             if (((int)new_index >= 0) && ((int)new_index < 100))
             {
                 lock.lock ();
-                std::fill (pos_percentage.begin (), pos_percentage.end (), new_index);
+                for (int preset = 0; preset < 3; preset++)
+                {
+                    seek_positions[preset] =
+                        (long long)(new_index * (get_num_packages (preset) / 100.0));
+                }
                 lock.unlock ();
             }
             else
@@ -358,6 +371,77 @@ int PlaybackFileBoard::config_board (std::string config, std::string &response)
             return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
     }
+    else if (strncmp (config.c_str (), SET_INDEX_SAMPLE_PREFIX, strlen (SET_INDEX_SAMPLE_PREFIX)) ==
+        0)
+    {
+        try
+        {
+            long long new_index = std::stoll (config.substr (strlen (SET_INDEX_SAMPLE_PREFIX)));
+            if (new_index < 0)
+            {
+                LOG_F(ERROR, "invalid sample index, should be positive");
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+            lock.lock ();
+            for (int preset = 0; preset < 3; preset++)
+            {
+                seek_positions[preset] =
+                    std::min (new_index, (long long)get_num_packages (preset));
+            }
+            lock.unlock ();
+        }
+        catch (const std::exception &e)
+        {
+            LOG_F(ERROR, "need to write a number after {}, exception is: {}",
+                SET_INDEX_SAMPLE_PREFIX, e.what ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
+    else if (strncmp (config.c_str (), SET_INDEX_TIMESTAMP_PREFIX,
+                 strlen (SET_INDEX_TIMESTAMP_PREFIX)) == 0)
+    {
+        try
+        {
+            double timestamp = std::stod (config.substr (strlen (SET_INDEX_TIMESTAMP_PREFIX)));
+            lock.lock ();
+            for (int preset = 0; preset < 3; preset++)
+            {
+                seek_positions[preset] = (long long)find_package (preset, timestamp);
+            }
+            lock.unlock ();
+        }
+        catch (const std::exception &e)
+        {
+            LOG_F(ERROR, "need to write a timestamp after {}, exception is: {}",
+                SET_INDEX_TIMESTAMP_PREFIX, e.what ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
+    else if (strncmp (config.c_str (), SET_SPEED_PREFIX, strlen (SET_SPEED_PREFIX)) == 0)
+    {
+        std::string speed = config.substr (strlen (SET_SPEED_PREFIX));
+        if (speed == MAX_SPEED)
+        {
+            playback_speed = 0.0;
+            return (int)BrainFlowExitCodes::STATUS_OK;
+        }
+        try
+        {
+            double new_speed = std::stod (speed);
+            if (!(new_speed > 0.0))
+            {
+                LOG_F(ERROR, "invalid playback speed, should be positive or {}", MAX_SPEED);
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+            playback_speed = new_speed;
+        }
+        catch (const std::exception &e)
+        {
+            LOG_F(ERROR, "need to write a number or {} after {}, exception is: {}", MAX_SPEED,
+                SET_SPEED_PREFIX, e.what ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
     else
     {
         LOG_F(WARNING, "invalid config string {}", config);
@@ -366,36 +450,114 @@ int PlaybackFileBoard::config_board (std::string config, std::string &response)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int PlaybackFileBoard::get_file_offsets (std::string filename, std::vector<long int> &offsets)
+int PlaybackFileBoard::open_file (std::string filename, int preset)
 {
-    offsets.clear ();
-
-    FILE *fp = fopen (filename.c_str (), "rb");
-    if (fp == NULL)
+    std::string preset_str = preset_to_string (preset);
+    if (board_descr.find (preset_str) == board_descr.end ())
     {
-        LOG_F(ERROR, "failed to open file: {}", filename.c_str ());
+        LOG_F(ERROR, "no preset {} for board {}", preset, board_id);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-
-    char buf[MAX_LINE_LENGTH];
-    long int bytes_read = 0;
-    while (true)
-    {
-        offsets.push_back (bytes_read);
-        char *res = fgets (buf, sizeof (buf), fp);
-        bytes_read += (long int)strlen (buf);
-        if (res == NULL)
+    is_binary[preset] = BinaryFileReader::is_binary_file (filename.c_str ());
+    if (is_binary[preset])
+    {
+        int res = binary_files[preset].open (filename.c_str ());
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            LOG_F(ERROR, "invalid binary file: {}", filename.c_str ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        const BinaryFileHeader &header = binary_files[preset].get_header ();
+        if (header.num_rows != (int)board_descr[preset_str]["num_rows"])
+        {
+            LOG_F(ERROR, "file {} has {} rows, expected {}, check provided board id",
+                filename.c_str (), header.num_rows, (int)board_descr[preset_str]["num_rows"]);
+            binary_files[preset].close ();
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        if ((header.board_id != board_id) && (header.board_id != (int)BoardIds::NO_BOARD))
         {
-            break;
+            LOG_F(WARNING, "file {} was recorded by board {}", filename.c_str (), header.board_id);
         }
     }
-
-    fclose (fp);
-    if (offsets.size () < 2)
+    else
+    {
+        int res = tsv_files[preset].open (filename.c_str ());
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            LOG_F(ERROR, "failed to open file: {}", filename.c_str ());
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
+    if (get_num_packages (preset) < 1)
     {
         LOG_F(ERROR, "empty file: {}", filename);
+        tsv_files[preset].close ();
+        binary_files[preset].close ();
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-
     return (int)BrainFlowExitCodes::STATUS_OK;
-}
\ No newline at end of file
+}
+
+void PlaybackFileBoard::close_files ()
+{
+    for (int i = 0; i < 3; i++)
+    {
+        tsv_files[i].close ();
+        binary_files[i].close ();
+        is_binary[i] = false;
+    }
+}
+
+size_t PlaybackFileBoard::get_num_packages (int preset)
+{
+    if (is_binary[preset])
+    {
+        return binary_files[preset].get_num_packages ();
+    }
+    return tsv_files[preset].get_num_lines ();
+}
+
+bool PlaybackFileBoard::read_package (int preset, size_t package_num, double *package, int num_rows)
+{
+    if (is_binary[preset])
+    {
+        binary_files[preset].read_package (package_num, package);
+        return true;
+    }
+    return tsv_files[preset].parse_line (package_num, package, num_rows) == num_rows;
+}
+
+size_t PlaybackFileBoard::find_package (int preset, double timestamp)
+{
+    std::string preset_str = preset_to_string (preset);
+    size_t num_packages = get_num_packages (preset);
+    if ((num_packages == 0) || (board_descr.find (preset_str) == board_descr.end ()))
+    {
+        return 0;
+    }
+    int timestamp_channel = board_descr[preset_str]["timestamp_channel"];
+    if (is_binary[preset])
+    {
+        return binary_files[preset].find_package (timestamp, timestamp_channel);
+    }
+    // same binary search over lines, only log n lines are parsed
+    int num_rows = board_descr[preset_str]["num_rows"];
+    std::vector<double> package (num_rows);
+    size_t first = 0;
+    size_t last = num_packages;
+    while (first < last)
+    {
+        size_t mid = first + (last - first) / 2;
+        if ((read_package (preset, mid, package.data (), num_rows)) &&
+            (package[timestamp_channel] < timestamp))
+        {
+            first = mid + 1;
+        }
+        else
+        {
+            last = mid;
+        }
+    }
+    return first;
+}
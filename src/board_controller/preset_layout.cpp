@@ -0,0 +1,61 @@
+#include <string>
+
+#include "preset_layout.h"
+
+
+static int get_int (const json &board_preset, const std::string &field, int default_value)
+{
+    auto it = board_preset.find (field);
+    if ((it == board_preset.end ()) || (!it->is_number_integer ()))
+    {
+        return default_value;
+    }
+    return it->get<int> ();
+}
+
+static std::vector<int> get_channels (const json &board_preset, const std::string &field)
+{
+    auto it = board_preset.find (field);
+    if ((it == board_preset.end ()) || (!it->is_array ()))
+    {
+        return std::vector<int> ();
+    }
+    return it->get<std::vector<int>> ();
+}
+
+PresetLayout::PresetLayout ()
+{
+    num_rows = 0;
+    sampling_rate = 0;
+    timestamp_channel = -1;
+    marker_channel = -1;
+    package_num_channel = -1;
+    battery_channel = -1;
+    trigger1_channel = -1;
+    trigger2_channel = -1;
+}
+
+PresetLayout::PresetLayout (const json &board_preset)
+{
+    num_rows = get_int (board_preset, "num_rows", 0);
+    sampling_rate = get_int (board_preset, "sampling_rate", 0);
+    timestamp_channel = get_int (board_preset, "timestamp_channel", -1);
+    marker_channel = get_int (board_preset, "marker_channel", -1);
+    package_num_channel = get_int (board_preset, "package_num_channel", -1);
+    battery_channel = get_int (board_preset, "battery_channel", -1);
+    trigger1_channel = get_int (board_preset, "trigger1_channel", -1);
+    trigger2_channel = get_int (board_preset, "trigger2_channel", -1);
+    eeg_channels = get_channels (board_preset, "eeg_channels");
+    emg_channels = get_channels (board_preset, "emg_channels");
+    ecg_channels = get_channels (board_preset, "ecg_channels");
+    eog_channels = get_channels (board_preset, "eog_channels");
+    eda_channels = get_channels (board_preset, "eda_channels");
+    ppg_channels = get_channels (board_preset, "ppg_channels");
+    accel_channels = get_channels (board_preset, "accel_channels");
+    gyro_channels = get_channels (board_preset, "gyro_channels");
+    magnetometer_channels = get_channels (board_preset, "magnetometer_channels");
+    temperature_channels = get_channels (board_preset, "temperature_channels");
+    resistance_channels = get_channels (board_preset, "resistance_channels");
+    analog_channels = get_channels (board_preset, "analog_channels");
+    other_channels = get_channels (board_preset, "other_channels");
+}
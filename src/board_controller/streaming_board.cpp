@@ -220,10 +220,7 @@ void StreamingBoard::read_thread (int num)
             log_socket_error (-1);
             continue;
         }
-        for (int i = 0; i < num_packages; i++)
-        {
-            push_package (transaction + i * num_rows, presets[num]);
-        }
+        push_packages (transaction, num_packages, presets[num]);
     }
     delete[] transaction;
 }
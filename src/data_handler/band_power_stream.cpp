@@ -0,0 +1,179 @@
+#include <algorithm>
+
+#include "band_power_stream.h"
+#include "brainflow_constants.h"
+#include "fft_plan.h"
+
+
+BandPowerStream::BandPowerStream (int num_channels, int sampling_rate, int window_len, int nfft,
+    std::shared_ptr<IIRFilter> filter, bool remove_mean)
+{
+    this->num_channels = num_channels;
+    this->sampling_rate = sampling_rate;
+    this->window_len = window_len;
+    this->nfft = nfft;
+    this->filter = filter;
+    this->remove_mean = remove_mean;
+    // the same overlap as in get_custom_band_powers
+    hop = nfft - 4 * nfft / 5;
+    num_samples_added = 0;
+    next_segment_start = 0;
+    window.resize (num_channels * window_len, 0.0);
+    segment_data.resize (nfft);
+    // spectrum of a constant is used to subtract mean without recomputing segments
+    window_spectrum.resize (get_psd_len () * 2);
+    std::vector<double> ones (nfft, 1.0);
+    get_fft_plan (nfft, (int)WindowOperations::HANNING)
+        ->perform_fft (ones.data (), window_spectrum.data (),
+            window_spectrum.data () + get_psd_len ());
+}
+
+void BandPowerStream::add_data (const double *data, int num_samples)
+{
+    std::lock_guard<std::mutex> lock_guard (lock);
+    filtered.assign (data, data + num_channels * num_samples);
+    if (filter != NULL)
+    {
+        filter->process_block (filtered.data (), num_samples);
+    }
+    long long first_needed = num_samples_added + num_samples - window_len;
+    for (int i = 0; i < num_samples; i++)
+    {
+        int pos = (int)(num_samples_added % window_len);
+        for (int channel = 0; channel < num_channels; channel++)
+        {
+            window[channel * window_len + pos] = filtered[channel * num_samples + i];
+        }
+        num_samples_added++;
+        if (num_samples_added == next_segment_start + nfft)
+        {
+            // segments which leave the window before this call returns are not needed
+            if (next_segment_start >= first_needed)
+            {
+                add_segment ();
+            }
+            next_segment_start += hop;
+        }
+    }
+    while ((!segments.empty ()) && (segments.front ().start < first_needed))
+    {
+        segments.pop_front ();
+    }
+}
+
+bool BandPowerStream::is_ready ()
+{
+    std::lock_guard<std::mutex> lock_guard (lock);
+    return num_samples_added >= window_len;
+}
+
+void BandPowerStream::compute_spectrum (long long start, int channel, double *re, double *im)
+{
+    const double *channel_window = window.data () + channel * window_len;
+    for (int i = 0; i < nfft; i++)
+    {
+        segment_data[i] = channel_window[(start + i) % window_len];
+    }
+    get_fft_plan (nfft, (int)WindowOperations::HANNING)->perform_fft (segment_data.data (), re, im);
+}
+
+void BandPowerStream::add_segment ()
+{
+    Segment segment;
+    segment.start = next_segment_start;
+    segment.spectrum.resize (num_channels * get_psd_len () * 2);
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        double *re = segment.spectrum.data () + channel * get_psd_len () * 2;
+        compute_spectrum (segment.start, channel, re, re + get_psd_len ());
+    }
+    segments.push_back (std::move (segment));
+}
+
+void BandPowerStream::add_segment_psd (
+    const double *re, const double *im, double mean, double *output_ampl)
+{
+    // the same math as in FFTPlan::get_psd
+    double norm = (double)(sampling_rate * nfft);
+    const double *window_re = window_spectrum.data ();
+    const double *window_im = window_spectrum.data () + get_psd_len ();
+    for (int i = 0; i < get_psd_len (); i++)
+    {
+        double value_re = re[i] - mean * window_re[i];
+        double value_im = im[i] - mean * window_im[i];
+        double ampl = (value_re * value_re + value_im * value_im) / norm;
+        if ((i != 0) && (i != nfft / 2))
+        {
+            ampl *= 2;
+        }
+        output_ampl[i] += ampl;
+    }
+}
+
+void BandPowerStream::get_psd (int channel, double *output_ampl, double *output_freq)
+{
+    std::lock_guard<std::mutex> lock_guard (lock);
+    compute_psd (channel, output_ampl, output_freq);
+}
+
+bool BandPowerStream::get_psds (double *output_ampls, double *output_freq)
+{
+    std::lock_guard<std::mutex> lock_guard (lock);
+    if (num_samples_added < window_len)
+    {
+        return false;
+    }
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        compute_psd (channel, output_ampls + channel * get_psd_len (), output_freq);
+    }
+    return true;
+}
+
+void BandPowerStream::compute_psd (int channel, double *output_ampl, double *output_freq)
+{
+    long long window_start = std::max (num_samples_added - window_len, 0LL);
+    double mean = 0.0;
+    if (remove_mean)
+    {
+        const double *channel_window = window.data () + channel * window_len;
+        for (long long i = window_start; i < num_samples_added; i++)
+        {
+            mean += channel_window[i % window_len];
+        }
+        mean /= (double)(num_samples_added - window_start);
+    }
+    for (int i = 0; i < get_psd_len (); i++)
+    {
+        output_ampl[i] = 0.0;
+        output_freq[i] = i * ((double)sampling_rate / (double)nfft);
+    }
+    int counter = 0;
+    for (const Segment &segment : segments)
+    {
+        const double *re = segment.spectrum.data () + channel * get_psd_len () * 2;
+        add_segment_psd (re, re + get_psd_len (), mean, output_ampl);
+        counter++;
+    }
+    // window is shorter than nfft + hop and no cached segment fits, use segments of
+    // get_psd_welch
+    if (counter == 0)
+    {
+        std::vector<double> spectrum (get_psd_len () * 2);
+        for (long long start = window_start; start + nfft <= num_samples_added; start += hop)
+        {
+            compute_spectrum (start, channel, spectrum.data (), spectrum.data () + get_psd_len ());
+            add_segment_psd (spectrum.data (), spectrum.data () + get_psd_len (), mean, output_ampl);
+            counter++;
+        }
+    }
+    if (counter == 0)
+    {
+        return;
+    }
+    // average data, last value is not averaged like in get_psd_welch
+    for (int i = 0; i < nfft / 2; i++)
+    {
+        output_ampl[i] /= counter;
+    }
+}
@@ -27,8 +27,19 @@ else (CMAKE_SIZEOF_VOID_P EQUAL 8)
 endif (CMAKE_SIZEOF_VOID_P EQUAL 8)
 
 SET (DATA_HANDLER_SRC
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/band_power_stream.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/csp.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/data_handler.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/fastica.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/fft_plan.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/iir_filter.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/wavelet_plan.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/window_functions.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/z_score_peak_detector.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/generated/mindfulness_model.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/binary_file.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/mapped_file.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/tsv_file.cpp
 )
 
 add_library (
@@ -42,6 +53,7 @@ target_include_directories (
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/third_party/DSPFilters/include
     ${CMAKE_CURRENT_SOURCE_DIR}/third_party/wavelib/header
     ${CMAKE_CURRENT_SOURCE_DIR}/third_party/kissfft
@@ -0,0 +1,102 @@
+#include "csp.h"
+
+
+int CSP::compute (const double *data, const double *labels, int n_epochs, int n_times)
+{
+    if ((n_channels <= 0) || (n_epochs <= 0) || (n_times <= 0) || (shrinkage < 0.0) ||
+        (shrinkage > 1.0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int n_class[2] = {0, 0};
+    for (int e = 0; e < n_epochs; e++)
+    {
+        int label = int (labels[e]);
+        if ((label != 0) && (label != 1))
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        n_class[label]++;
+    }
+    if ((n_class[0] == 0) || (n_class[1] == 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    RowMajorMatrix sums[2];
+    sums[0].setZero (n_channels, n_channels);
+    sums[1].setZero (n_channels, n_channels);
+
+    // Compute an averaged covariance matrix for each class
+#pragma omp parallel
+    {
+        RowMajorMatrix partial_sums[2];
+        partial_sums[0].setZero (n_channels, n_channels);
+        partial_sums[1].setZero (n_channels, n_channels);
+        RowMajorMatrix centered (n_channels, n_times);
+#pragma omp for
+        for (int e = 0; e < n_epochs; e++)
+        {
+            Eigen::Map<const RowMajorMatrix> epoch (
+                data + (size_t)e * n_channels * n_times, n_channels, n_times);
+            centered.noalias () = epoch.colwise () - epoch.rowwise ().mean ();
+            // For centered data cov(X) = (X * X_T) / n, only lower triangle is updated
+            partial_sums[int (labels[e])].selfadjointView<Eigen::Lower> ().rankUpdate (
+                centered, 1.0 / n_times);
+        }
+#pragma omp critical
+        {
+            sums[0] += partial_sums[0];
+            sums[1] += partial_sums[1];
+        }
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        RowMajorMatrix full = sums[i].selfadjointView<Eigen::Lower> ();
+        sums[i] = full / double (n_class[i]);
+        shrink (sums[i]);
+    }
+
+    // Compute the CSP filters
+    Eigen::GeneralizedSelfAdjointEigenSolver<RowMajorMatrix> ges (sums[0], sums[0] + sums[1]);
+    if (ges.info () != Eigen::Success)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    eigenvalues = ges.eigenvalues ();
+    eigenvectors = ges.eigenvectors ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void CSP::get_filters (double *output_w, double *output_d)
+{
+    for (int i = 0; i < n_channels; i++)
+    {
+        output_d[i] = eigenvalues (i);
+        for (int j = 0; j < n_channels; j++)
+        {
+            output_w[i * n_channels + j] = eigenvectors (j, i);
+        }
+    }
+}
+
+void CSP::apply_filters (const double *filters, int n_filters, int n_channels,
+    const double *data, int n_times, double *output)
+{
+    Eigen::Map<const RowMajorMatrix> w (filters, n_filters, n_channels);
+    Eigen::Map<const RowMajorMatrix> x (data, n_channels, n_times);
+    Eigen::Map<RowMajorMatrix> y (output, n_filters, n_times);
+    y.noalias () = w * x;
+}
+
+void CSP::shrink (RowMajorMatrix &cov)
+{
+    if (shrinkage == 0.0)
+    {
+        return;
+    }
+    double mu = cov.trace () / n_channels;
+    cov *= (1.0 - shrinkage);
+    cov.diagonal ().array () += shrinkage * mu;
+}
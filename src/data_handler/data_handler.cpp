@@ -1,7 +1,8 @@
 #include <algorithm>
+#include <map>
 #include <math.h>
+#include <memory>
 #include <mutex>
-#include <sstream>
 #include <stdexcept>
 #include <stdint.h>
 #include <stdio.h>
@@ -10,23 +11,28 @@
 #include <thread>
 #include <vector>
 
+#include "band_power_stream.h"
+#include "binary_file.h"
 #include "brainflow_constants.h"
 #include "brainflow_version.h"
 #include "common_data_handler_helpers.h"
+#include "csp.h"
 #include "data_handler.h"
 #include "downsample_operators.h"
+#include "fft_plan.h"
+#include "iir_filter.h"
+#include "mindfulness_model.h"
 #include "rolling_filter.h"
+#include "tsv_file.h"
 #include "wavelet_helpers.h"
+#include "wavelet_plan.h"
 #include "window_functions.h"
+#include "z_score_peak_detector.h"
 
 #include "DspFilters/Dsp.h"
 
 #include "Eigen/Dense"
 
-#include "wauxlib.h"
-#include "wavelib.h"
-
-#include "kiss_fftr.h"
 
 #include "spdlog/sinks/null_sink.h"
 #include "spdlog/spdlog.h"
@@ -38,7 +44,6 @@
 #endif
 
 #define LOGGER_NAME "data_logger"
-#define MAX_FILTER_ORDER 8
 
 #ifdef __ANDROID__
 #include "spdlog/sinks/android_sink.h"
@@ -51,6 +56,17 @@ std::shared_ptr<spdlog::logger> data_logger = spdlog::stderr_logger_mt (LOGGER_N
 // its only for logging methods, other methods can be executed simultaneously
 std::mutex data_mutex;
 
+// stateful filters created by create_*_filter methods
+std::map<int, std::shared_ptr<IIRFilter>> iir_filters;
+int last_filter_id = 0;
+std::mutex filters_mutex;
+std::map<int, std::shared_ptr<BandPowerStream>> band_power_streams;
+int last_band_power_stream_id = 0;
+std::mutex band_power_streams_mutex;
+std::map<int, std::shared_ptr<ZScorePeakDetector>> peak_detectors;
+int last_peak_detector_id = 0;
+std::mutex peak_detectors_mutex;
+
 
 int log_message_data_handler (int log_level, char *log_message)
 {
@@ -123,50 +139,102 @@ int set_log_level_data_handler (int level)
 }
 
 
-int perform_lowpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
-    int filter_type, double ripple)
+// filters data from zero history using cached design
+static int apply_iir_filter (double *data, int data_len, const IIRFilterDesignKey &key)
 {
-    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data) || (cutoff < 0) || (sampling_rate < 1))
+    std::shared_ptr<const IIRFilterDesign> design = get_iir_filter_design (key);
+    if (design == NULL)
     {
-        data_logger->error (
-            "Order must be from 1-8 and data cannot be empty. Order:{} , Data:{} , Cutoff:{}",
-            order, (data != NULL), cutoff);
+        data_logger->error ("Filter type {} is Invalid", key.filter_type);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    IIRFilter filter (1);
+    filter.add_stage (design);
+    filter.process (0, data, data_len);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    double *filter_data[1];
-    filter_data[0] = data;
-    Dsp::Filter *f = NULL;
+static bool check_filter_cutoff (double cutoff, int order, int sampling_rate)
+{
+    if ((order < 1) || (order > MAX_FILTER_ORDER) || (cutoff < 0) || (sampling_rate < 1))
+    {
+        data_logger->error ("Order must be from 1-8. Order:{} , Cutoff:{} , Sampling Rate:{}",
+            order, cutoff, sampling_rate);
+        return false;
+    }
+    return true;
+}
 
-    switch (static_cast<FilterTypes> (filter_type))
+static bool check_filter_band (double start_freq, double stop_freq, int order, int sampling_rate)
+{
+    if ((order < 1) || (order > MAX_FILTER_ORDER) || (stop_freq <= start_freq) ||
+        (start_freq < 0) || (sampling_rate < 1))
     {
-        case FilterTypes::BUTTERWORTH:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::LowPass<MAX_FILTER_ORDER>, 1> ();
+        data_logger->error ("Order must be from 1-8. Order:{} , Start Freq:{} , Stop Freq:{} , "
+                            "Sampling Rate:{}",
+            order, start_freq, stop_freq, sampling_rate);
+        return false;
+    }
+    return true;
+}
+
+static IIRFilterDesignKey get_filter_key (int filter_operation, int sampling_rate,
+    double start_freq, double stop_freq, int order, int filter_type, double ripple)
+{
+    IIRFilterDesignKey key;
+    key.filter_operation = filter_operation;
+    key.filter_type = filter_type;
+    key.order = order;
+    key.sampling_rate = sampling_rate;
+    key.start_freq = start_freq;
+    key.stop_freq = stop_freq;
+    key.ripple = ripple;
+    return key;
+}
+
+// bandstops used by remove_environmental_noise
+static int get_noise_filter_keys (
+    int sampling_rate, int noise_type, std::vector<IIRFilterDesignKey> &keys)
+{
+    int bandstop = (int)IIRFilterOperations::BANDSTOP;
+    int butterworth = (int)FilterTypes::BUTTERWORTH;
+    switch (static_cast<NoiseTypes> (noise_type))
+    {
+        case NoiseTypes::FIFTY:
+            keys.push_back (
+                get_filter_key (bandstop, sampling_rate, 48.0, 52.0, 4, butterworth, 0.0));
             break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::LowPass<MAX_FILTER_ORDER>, 1> ();
+        case NoiseTypes::SIXTY:
+            keys.push_back (
+                get_filter_key (bandstop, sampling_rate, 58.0, 62.0, 4, butterworth, 0.0));
             break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::LowPass<MAX_FILTER_ORDER>, 1> ();
+        case NoiseTypes::FIFTY_AND_SIXTY:
+            keys.push_back (
+                get_filter_key (bandstop, sampling_rate, 48.0, 52.0, 4, butterworth, 0.0));
+            keys.push_back (
+                get_filter_key (bandstop, sampling_rate, 58.0, 62.0, 4, butterworth, 0.0));
             break;
         default:
-            data_logger->error ("Filter type {} is Invalid", filter_type);
+            data_logger->error ("Invalid noise type");
             return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    Dsp::Params params;
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = cutoff;        // cutoff
-    if (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1)
+int perform_lowpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
+    int filter_type, double ripple)
+{
+    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data) || (cutoff < 0) || (sampling_rate < 1))
     {
-        params[3] = ripple; // ripple
+        data_logger->error (
+            "Order must be from 1-8 and data cannot be empty. Order:{} , Data:{} , Cutoff:{}",
+            order, (data != NULL), cutoff);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    f->setParams (params);
-    f->process (data_len, filter_data);
-    delete f;
 
-    return (int)BrainFlowExitCodes::STATUS_OK;
+    return apply_iir_filter (data, data_len,
+        get_filter_key ((int)IIRFilterOperations::LOWPASS, sampling_rate, cutoff, 0.0, order,
+            filter_type, ripple));
 }
 
 int perform_highpass (double *data, int data_len, int sampling_rate, double cutoff, int order,
@@ -180,41 +248,29 @@ int perform_highpass (double *data, int data_len, int sampling_rate, double cuto
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    Dsp::Filter *f = NULL;
-    double *filter_data[1];
-    filter_data[0] = data;
+    return apply_iir_filter (data, data_len,
+        get_filter_key ((int)IIRFilterOperations::HIGHPASS, sampling_rate, cutoff, 0.0, order,
+            filter_type, ripple));
+}
 
-    switch (static_cast<FilterTypes> (filter_type))
-    {
-        case FilterTypes::BUTTERWORTH:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::HighPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::HighPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::HighPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        default:
-            data_logger->error ("Filter type {} is Invalid", filter_type);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-    }
-    Dsp::Params params;
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = cutoff;        // cutoff
-    if (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1)
+int perform_bandpass (double *data, int data_len, int sampling_rate, double start_freq,
+    double stop_freq, int order, int filter_type, double ripple)
+{
+    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data) || (stop_freq <= start_freq) ||
+        (start_freq < 0) || (sampling_rate < 1))
     {
-        params[3] = ripple; // ripple
+        data_logger->error ("Order must be from 1-8 and data cannot be empty. Order:{} , Data:{} , "
+                            "Start Freq:{} , Stop Freq:{}",
+            order, (data != NULL), start_freq, stop_freq);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    f->setParams (params);
-    f->process (data_len, filter_data);
-    delete f;
 
-    return (int)BrainFlowExitCodes::STATUS_OK;
+    return apply_iir_filter (data, data_len,
+        get_filter_key ((int)IIRFilterOperations::BANDPASS, sampling_rate, start_freq, stop_freq,
+            order, filter_type, ripple));
 }
 
-int perform_bandpass (double *data, int data_len, int sampling_rate, double start_freq,
+int perform_bandstop (double *data, int data_len, int sampling_rate, double start_freq,
     double stop_freq, int order, int filter_type, double ripple)
 {
     if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data) || (stop_freq <= start_freq) ||
@@ -226,128 +282,197 @@ int perform_bandpass (double *data, int data_len, int sampling_rate, double star
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    double center_freq = (start_freq + stop_freq) / 2.0;
-    double band_width = stop_freq - start_freq;
-    Dsp::Filter *f = NULL;
-    double *filter_data[1];
-    filter_data[0] = data;
+    return apply_iir_filter (data, data_len,
+        get_filter_key ((int)IIRFilterOperations::BANDSTOP, sampling_rate, start_freq, stop_freq,
+            order, filter_type, ripple));
+}
 
-    switch (static_cast<FilterTypes> (filter_type))
+int remove_environmental_noise (double *data, int data_len, int sampling_rate, int noise_type)
+{
+    if ((data_len < 1) || (sampling_rate < 1) || (!data))
     {
-        case FilterTypes::BUTTERWORTH:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::BandPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::BandPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::BandPass<MAX_FILTER_ORDER>, 1> ();
-            break;
-        default:
-            data_logger->error ("Filter type {} is Invalid. ", filter_type);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    Dsp::Params params;
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = center_freq;   // center freq
-    params[3] = band_width;
-    if (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1)
+    std::vector<IIRFilterDesignKey> keys;
+    int res = get_noise_filter_keys (sampling_rate, noise_type, keys);
+    for (size_t i = 0; (i < keys.size ()) && (res == (int)BrainFlowExitCodes::STATUS_OK); i++)
     {
-        params[4] = ripple; // ripple
+        res = apply_iir_filter (data, data_len, keys[i]);
     }
-    f->setParams (params);
-    f->process (data_len, filter_data);
-    delete f;
 
+    return res;
+}
+
+static int register_filter (
+    const std::vector<IIRFilterDesignKey> &keys, int num_channels, int *filter_id)
+{
+    std::shared_ptr<IIRFilter> filter (new IIRFilter (num_channels));
+    for (const IIRFilterDesignKey &key : keys)
+    {
+        std::shared_ptr<const IIRFilterDesign> design = get_iir_filter_design (key);
+        if (design == NULL)
+        {
+            data_logger->error ("Filter type {} is Invalid", key.filter_type);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        filter->add_stage (design);
+    }
+    std::lock_guard<std::mutex> lock (filters_mutex);
+    *filter_id = ++last_filter_id;
+    iir_filters[*filter_id] = filter;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int perform_bandstop (double *data, int data_len, int sampling_rate, double start_freq,
-    double stop_freq, int order, int filter_type, double ripple)
+static std::shared_ptr<IIRFilter> get_filter (int filter_id)
 {
-    if ((order < 1) || (order > MAX_FILTER_ORDER) || (!data) || (stop_freq <= start_freq) ||
-        (start_freq < 0) || (sampling_rate < 1))
+    std::lock_guard<std::mutex> lock (filters_mutex);
+    auto it = iir_filters.find (filter_id);
+    if (it == iir_filters.end ())
+    {
+        data_logger->error ("No filter with id {}", filter_id);
+        return NULL;
+    }
+    return it->second;
+}
+
+int create_lowpass_filter (int sampling_rate, double cutoff, int order, int filter_type,
+    double ripple, int num_channels, int *filter_id)
+{
+    if ((!check_filter_cutoff (cutoff, order, sampling_rate)) || (num_channels < 1) ||
+        (!filter_id))
     {
-        data_logger->error ("Order must be from 1-8 and data cannot be empty. Order:{} , Data:{} , "
-                            "Start Freq:{} , Stop Freq:{}",
-            order, (data != NULL), start_freq, stop_freq);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    std::vector<IIRFilterDesignKey> keys;
+    keys.push_back (get_filter_key ((int)IIRFilterOperations::LOWPASS, sampling_rate, cutoff, 0.0,
+        order, filter_type, ripple));
+    return register_filter (keys, num_channels, filter_id);
+}
 
-    double center_freq = (start_freq + stop_freq) / 2.0;
-    double band_width = stop_freq - start_freq;
-    Dsp::Filter *f = NULL;
-    double *filter_data[1];
-    filter_data[0] = data;
+int create_highpass_filter (int sampling_rate, double cutoff, int order, int filter_type,
+    double ripple, int num_channels, int *filter_id)
+{
+    if ((!check_filter_cutoff (cutoff, order, sampling_rate)) || (num_channels < 1) ||
+        (!filter_id))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::vector<IIRFilterDesignKey> keys;
+    keys.push_back (get_filter_key ((int)IIRFilterOperations::HIGHPASS, sampling_rate, cutoff,
+        0.0, order, filter_type, ripple));
+    return register_filter (keys, num_channels, filter_id);
+}
 
-    switch (static_cast<FilterTypes> (filter_type))
+int create_bandpass_filter (int sampling_rate, double start_freq, double stop_freq, int order,
+    int filter_type, double ripple, int num_channels, int *filter_id)
+{
+    if ((!check_filter_band (start_freq, stop_freq, order, sampling_rate)) ||
+        (num_channels < 1) || (!filter_id))
     {
-        case FilterTypes::BUTTERWORTH:
-            f = new Dsp::FilterDesign<Dsp::Butterworth::Design::BandStop<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::CHEBYSHEV_TYPE_1:
-            f = new Dsp::FilterDesign<Dsp::ChebyshevI::Design::BandStop<MAX_FILTER_ORDER>, 1> ();
-            break;
-        case FilterTypes::BESSEL:
-            f = new Dsp::FilterDesign<Dsp::Bessel::Design::BandStop<MAX_FILTER_ORDER>, 1> ();
-            break;
-        default:
-            data_logger->error ("Filter type {} is Invalid", filter_type);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    std::vector<IIRFilterDesignKey> keys;
+    keys.push_back (get_filter_key ((int)IIRFilterOperations::BANDPASS, sampling_rate,
+        start_freq, stop_freq, order, filter_type, ripple));
+    return register_filter (keys, num_channels, filter_id);
+}
 
-    Dsp::Params params;
-    params[0] = sampling_rate; // sample rate
-    params[1] = order;         // order
-    params[2] = center_freq;   // center freq
-    params[3] = band_width;
-    if (filter_type == (int)FilterTypes::CHEBYSHEV_TYPE_1)
+int create_bandstop_filter (int sampling_rate, double start_freq, double stop_freq, int order,
+    int filter_type, double ripple, int num_channels, int *filter_id)
+{
+    if ((!check_filter_band (start_freq, stop_freq, order, sampling_rate)) ||
+        (num_channels < 1) || (!filter_id))
     {
-        params[4] = ripple; // ripple
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    f->setParams (params);
-    f->process (data_len, filter_data);
-    delete f;
+    std::vector<IIRFilterDesignKey> keys;
+    keys.push_back (get_filter_key ((int)IIRFilterOperations::BANDSTOP, sampling_rate,
+        start_freq, stop_freq, order, filter_type, ripple));
+    return register_filter (keys, num_channels, filter_id);
+}
 
-    return (int)BrainFlowExitCodes::STATUS_OK;
+int create_environmental_noise_filter (
+    int sampling_rate, int noise_type, int num_channels, int *filter_id)
+{
+    if ((sampling_rate < 1) || (num_channels < 1) || (!filter_id))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::vector<IIRFilterDesignKey> keys;
+    int res = get_noise_filter_keys (sampling_rate, noise_type, keys);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return register_filter (keys, num_channels, filter_id);
 }
 
-int remove_environmental_noise (double *data, int data_len, int sampling_rate, int noise_type)
+int process_filter (int filter_id, int channel, double *data, int data_len)
 {
-    if ((data_len < 1) || (sampling_rate < 1) || (!data))
+    if ((!data) || (data_len < 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<IIRFilter> filter = get_filter (filter_id);
+    if (filter == NULL)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    if ((channel < 0) || (channel >= filter->get_num_channels ()))
+    {
+        data_logger->error ("Channel must be from 0 to {}, Channel:{}",
+            filter->get_num_channels () - 1, channel);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    filter->process (channel, data, data_len);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    int res = (int)BrainFlowExitCodes::STATUS_OK;
+int process_filter_block (int filter_id, double *data, int rows, int cols)
+{
+    if ((!data) || (cols < 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<IIRFilter> filter = get_filter (filter_id);
+    if (filter == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (rows != filter->get_num_channels ())
+    {
+        data_logger->error ("Number of rows must be equal to number of channels in filter, Rows:{} "
+                            ", Channels:{}",
+            rows, filter->get_num_channels ());
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    filter->process_block (data, cols);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    switch (static_cast<NoiseTypes> (noise_type))
+int reset_filter (int filter_id)
+{
+    std::shared_ptr<IIRFilter> filter = get_filter (filter_id);
+    if (filter == NULL)
     {
-        case NoiseTypes::FIFTY:
-            res = perform_bandstop (
-                data, data_len, sampling_rate, 48.0, 52.0, 4, (int)FilterTypes::BUTTERWORTH, 0.0);
-            break;
-        case NoiseTypes::SIXTY:
-            res = perform_bandstop (
-                data, data_len, sampling_rate, 58.0, 62.0, 4, (int)FilterTypes::BUTTERWORTH, 0.0);
-            break;
-        case NoiseTypes::FIFTY_AND_SIXTY:
-            res = perform_bandstop (
-                data, data_len, sampling_rate, 48.0, 52.0, 4, (int)FilterTypes::BUTTERWORTH, 0.0);
-            if (res == (int)BrainFlowExitCodes::STATUS_OK)
-            {
-                res = perform_bandstop (data, data_len, sampling_rate, 58.0, 62.0, 4,
-                    (int)FilterTypes::BUTTERWORTH, 0.0);
-            }
-            break;
-        default:
-            data_logger->error ("Invalid noise type");
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    filter->reset ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    return res;
+int release_filter (int filter_id)
+{
+    std::lock_guard<std::mutex> lock (filters_mutex);
+    auto it = iir_filters.find (filter_id);
+    if (it == iir_filters.end ())
+    {
+        data_logger->error ("No filter with id {}", filter_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    iir_filters.erase (it);
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 int perform_rolling_filter (double *data, int data_len, int period, int agg_operation)
@@ -368,6 +493,18 @@ int perform_rolling_filter (double *data, int data_len, int period, int agg_oper
         case AggOperations::MEDIAN:
             filter = new RollingMedian<double> (period);
             break;
+        case AggOperations::STDDEV:
+            filter = new RollingStddev<double> (period);
+            break;
+        case AggOperations::MIN:
+            filter = new RollingMin<double> (period);
+            break;
+        case AggOperations::MAX:
+            filter = new RollingMax<double> (period);
+            break;
+        case AggOperations::RMS:
+            filter = new RollingRms<double> (period);
+            break;
         case AggOperations::EACH:
             return (int)BrainFlowExitCodes::STATUS_OK;
         default:
@@ -429,51 +566,72 @@ int perform_wavelet_transform (double *data, int data_len, int wavelet, int deco
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    wave_object obj = NULL;
-    wt_object wt = NULL;
+    try
+    {
+        WaveletPlan *plan = get_wavelet_plan (wavelet, data_len, decomposition_level, extension);
+        plan->perform_wavelet_transform (data, output_data, decomposition_lengths);
+    }
+    catch (const std::exception &e)
+    {
+        // more likely exception here occured because input buffer is to small to perform wavelet
+        // transform
+        data_logger->error ("Exception in wavelib: {}", e.what ());
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
+int perform_wavelet_transform_block (double *data, int rows, int cols, int wavelet,
+    int decomposition_level, int extension, double *output_data, int *decomposition_lengths)
+{
+    std::string wavelet_str = get_wavelet_name (wavelet);
+    std::string extension_str = get_extension_type (extension);
+    if ((data == NULL) || (rows <= 0) || (cols <= 0) || (wavelet_str.empty ()) ||
+        (output_data == NULL) || (extension_str.empty ()) || (decomposition_lengths == NULL) ||
+        (decomposition_level <= 0))
+    {
+        data_logger->error ("Please review arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    // first row gives number of coeffs which is the same for all rows
+    int output_len = 0;
     try
     {
-        obj = wave_init (wavelet_str.c_str ());
-        wt = wt_init (obj, "dwt", data_len, decomposition_level);
-        setDWTExtension (wt, extension_str.c_str ());
-        setWTConv (wt, "direct");
-        dwt (wt, data);
-        for (int i = 0; i < wt->outlength; i++)
-        {
-            output_data[i] = wt->output[i];
-        }
-        for (int i = 0; i < decomposition_level + 1; i++)
-        {
-            decomposition_lengths[i] = wt->length[i];
-        }
-        wave_free (obj);
-        obj = NULL;
-        wt_free (wt);
-        wt = NULL;
+        WaveletPlan *plan = get_wavelet_plan (wavelet, cols, decomposition_level, extension);
+        output_len = plan->perform_wavelet_transform (data, output_data, decomposition_lengths);
     }
     catch (const std::exception &e)
     {
-        if (obj)
+        data_logger->error ("Exception in wavelib: {}", e.what ());
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    // exceptions cant leave omp loop, first row passed so they are not expected here
+    std::vector<char> failed (rows, 0);
+#pragma omp parallel for
+    for (int i = 1; i < rows; i++)
+    {
+        std::vector<int> lengths (decomposition_level + 1);
+        try
         {
-            wave_free (obj);
-            obj = NULL;
+            WaveletPlan *plan = get_wavelet_plan (wavelet, cols, decomposition_level, extension);
+            plan->perform_wavelet_transform (
+                data + i * cols, output_data + i * output_len, lengths.data ());
         }
-        if (wt)
+        catch (const std::exception &)
         {
-            wt_free (wt);
-            wt = NULL;
+            failed[i] = 1;
         }
-        // more likely exception here occured because input buffer is to small to perform wavelet
-        // transform
-        data_logger->error ("Exception in wavelib: {}", e.what ());
+    }
+    // the same exit code as for the first row and single row versions
+    if (std::find (failed.begin (), failed.end (), 1) != failed.end ())
+    {
+        data_logger->error ("Exception in wavelib.");
         return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-// inside wavelib inverse transform uses internal state from direct transform, dirty hack to restore
-// it here
 int perform_inverse_wavelet_transform (double *wavelet_coeffs, int original_data_len, int wavelet,
     int decomposition_level, int extension, int *decomposition_lengths, double *output_data)
 {
@@ -487,43 +645,15 @@ int perform_inverse_wavelet_transform (double *wavelet_coeffs, int original_data
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    wave_object obj = NULL;
-    wt_object wt = NULL;
-
     try
     {
-        obj = wave_init (wavelet_str.c_str ());
-        wt = wt_init (obj, "dwt", original_data_len, decomposition_level);
-        setDWTExtension (wt, extension_str.c_str ());
-        setWTConv (wt, "direct");
-        int total_len = 0;
-        for (int i = 0; i < decomposition_level + 1; i++)
-        {
-            wt->length[i] = decomposition_lengths[i];
-            total_len += decomposition_lengths[i];
-        }
-        for (int i = 0; i < total_len; i++)
-        {
-            wt->output[i] = wavelet_coeffs[i];
-        }
-        idwt (wt, output_data);
-        wave_free (obj);
-        obj = NULL;
-        wt_free (wt);
-        wt = NULL;
+        WaveletPlan *plan =
+            get_wavelet_plan (wavelet, original_data_len, decomposition_level, extension);
+        plan->perform_inverse_wavelet_transform (
+            wavelet_coeffs, decomposition_lengths, output_data);
     }
     catch (const std::exception &e)
     {
-        if (obj)
-        {
-            wave_free (obj);
-            obj = NULL;
-        }
-        if (wt)
-        {
-            wt_free (wt);
-            wt = NULL;
-        }
         data_logger->error ("Exception in wavelib: {}", e.what ());
         // more likely exception here occured because input buffer is to small to perform wavelet
         // transform
@@ -534,54 +664,61 @@ int perform_inverse_wavelet_transform (double *wavelet_coeffs, int original_data
 
 int perform_wavelet_denoising (double *data, int data_len, int wavelet, int decomposition_level,
     int wavelet_denoising, int threshold, int extenstion_type, int noise_level)
+{
+    return perform_wavelet_denoising_block (data, 1, data_len, wavelet, decomposition_level,
+        wavelet_denoising, threshold, extenstion_type, noise_level);
+}
+
+int perform_wavelet_denoising_block (double *data, int rows, int cols, int wavelet,
+    int decomposition_level, int wavelet_denoising, int threshold, int extenstion_type,
+    int noise_level)
 {
     std::string wavelet_str = get_wavelet_name (wavelet);
     std::string denoising_str = get_wavelet_denoising_type (wavelet_denoising);
     std::string threshold_str = get_threshold_type (threshold);
     std::string extension_str = get_extension_type (extenstion_type);
     std::string noise_str = get_noise_estimation_type (noise_level);
-    if ((data == NULL) || (data_len <= 0) || (decomposition_level <= 0) || (wavelet_str.empty ()) ||
-        (denoising_str.empty ()) || (threshold_str.empty ()) || (extension_str.empty ()) ||
-        (noise_str.empty ()))
+    if ((data == NULL) || (rows <= 0) || (cols <= 0) || (decomposition_level <= 0) ||
+        (wavelet_str.empty ()) || (denoising_str.empty ()) || (threshold_str.empty ()) ||
+        (extension_str.empty ()) || (noise_str.empty ()))
     {
         data_logger->error ("Please review arguments.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    denoise_object obj = NULL;
-    double *temp = new double[data_len];
+    // plan for the first row validates that cols is big enough for this level
     try
     {
-        obj = denoise_init (data_len, decomposition_level, wavelet_str.c_str ());
-        setDenoiseMethod (obj, denoising_str.c_str ());
-        setDenoiseWTMethod (obj, "dwt");
-        setDenoiseWTExtension (obj, extension_str.c_str ());
-        setDenoiseParameters (obj, threshold_str.c_str (), noise_str.c_str ());
-        denoise (obj, data, temp);
-        for (int i = 0; i < data_len; i++)
-        {
-            data[i] = temp[i];
-        }
-        delete[] temp;
-        temp = NULL;
-        denoise_free (obj);
-        obj = NULL;
+        get_wavelet_plan (wavelet, cols, decomposition_level, extenstion_type);
     }
     catch (const std::exception &e)
     {
-        if (temp)
+        // more likely exception here occured because input buffer is to small to perform wavelet
+        // transform
+        data_logger->error ("Exception in wavelib: {}", e.what ());
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    // exceptions cant leave omp loop, first plan is created so they are not expected here
+    std::vector<char> failed (rows, 0);
+#pragma omp parallel for
+    for (int i = 0; i < rows; i++)
+    {
+        try
         {
-            delete[] temp;
-            temp = NULL;
+            WaveletPlan *plan =
+                get_wavelet_plan (wavelet, cols, decomposition_level, extenstion_type);
+            plan->perform_wavelet_denoising (
+                data + i * cols, wavelet_denoising, threshold, noise_level);
         }
-        if (obj)
+        catch (const std::exception &)
         {
-            denoise_free (obj);
-            obj = NULL;
+            failed[i] = 1;
         }
-        // more likely exception here occured because input buffer is to small to perform wavelet
-        // transform
-        data_logger->error ("Exception in wavelib: {}", e.what ());
+    }
+    // the same exit code as for the first row and single row versions
+    if (std::find (failed.begin (), failed.end (), 1) != failed.end ())
+    {
+        data_logger->error ("Exception in wavelib.");
         return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
     return (int)BrainFlowExitCodes::STATUS_OK;
@@ -590,82 +727,32 @@ int perform_wavelet_denoising (double *data, int data_len, int wavelet, int deco
 int get_csp (const double *data, const double *labels, int n_epochs, int n_channels, int n_times,
     double *output_w, double *output_d)
 {
-    if ((!data) || (!labels) || n_epochs <= 0 || n_channels <= 0 || n_times <= 0)
+    return get_regularized_csp (
+        data, labels, n_epochs, n_channels, n_times, 0.0, output_w, output_d);
+}
+
+int get_regularized_csp (const double *data, const double *labels, int n_epochs, int n_channels,
+    int n_times, double shrinkage, double *output_w, double *output_d)
+{
+    if ((!data) || (!labels) || (!output_w) || (!output_d) || n_epochs <= 0 || n_channels <= 0 ||
+        n_times <= 0 || shrinkage < 0.0 || shrinkage > 1.0)
     {
         data_logger->error ("Invalid function arguments provided. Please verify that all integer "
-                            "arguments are positive and data and labels arrays aren't empty.");
+                            "arguments are positive, shrinkage is in [0, 1] and data and labels "
+                            "arrays aren't empty.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
     try
     {
-        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> sum1 (
-            n_channels, n_channels);
-        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> sum2 (
-            n_channels, n_channels);
-
-        sum1.setZero ();
-        sum2.setZero ();
-
-        int n_class1 = 0;
-        int n_class2 = 0;
-
-        // Compute an averaged covariance matrix for each class
-        for (int e = 0; e < n_epochs; e++)
-        {
-            Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> X (
-                n_channels, n_times);
-            for (int c = 0; c < n_channels; c++)
-            {
-                for (int t = 0; t < n_times; t++)
-                {
-                    X (c, t) = data[e * n_channels * n_times + c * n_times + t];
-                }
-            }
-
-            // center data
-            for (int i = 0; i < n_channels; i++)
-            {
-                double ctr = X.row (i).mean ();
-                for (int j = 0; j < n_times; j++)
-                {
-                    X (i, j) -= ctr;
-                }
-            }
-
-            // For centered data cov(X) = (X * X_T) / n
-            switch (int (labels[e]))
-            {
-                case 0:
-                    sum1 += ((X * X.transpose ()).eval ()) / double (n_times);
-                    n_class1++;
-                    break;
-                case 1:
-                    sum2 += ((X * X.transpose ()).eval ()) / double (n_times);
-                    n_class2++;
-                    break;
-                default:
-                    data_logger->error ("Invalid class label. Current class label: {}", labels[e]);
-                    return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-                    break;
-            }
-        }
-
-        sum1 /= double (n_class1);
-        sum2 /= double (n_class2);
-
-        // Compute the CSP filters
-        Eigen::GeneralizedSelfAdjointEigenSolver<
-            Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
-            ges (sum1, sum1 + sum2);
-
-        for (int i = 0; i < n_channels; i++)
+        CSP csp (n_channels, shrinkage);
+        int res = csp.compute (data, labels, n_epochs, n_times);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
-            output_d[i] = ges.eigenvalues () (i);
-            for (int j = 0; j < n_channels; j++)
-            {
-                output_w[i * n_channels + j] = ges.eigenvectors () (j, i);
-            }
+            data_logger->error (
+                "Failed to compute CSP, labels must be 0 or 1 and both classes must be present.");
+            return res;
         }
+        csp.get_filters (output_w, output_d);
     }
     catch (...)
     {
@@ -675,7 +762,26 @@ int get_csp (const double *data, const double *labels, int n_epochs, int n_chann
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int apply_csp_filters (const double *filters, int n_filters, int n_channels, const double *data,
+    int n_times, double *output)
+{
+    if ((!filters) || (!data) || (!output) || (n_filters <= 0) || (n_channels <= 0) ||
+        (n_times <= 0))
+    {
+        data_logger->error ("Invalid function arguments provided. Please verify that all integer "
+                            "arguments are positive and arrays aren't empty.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    CSP::apply_filters (filters, n_filters, n_channels, data, n_times, output);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int get_window (int window_function, int window_len, double *output_window)
+{
+    return get_custom_window (window_function, window_len, -1.0, output_window);
+}
+
+int get_custom_window (int window_function, int window_len, double param, double *output_window)
 {
     if ((window_len <= 0) || (window_function < 0) || (output_window == NULL))
     {
@@ -683,25 +789,32 @@ int get_window (int window_function, int window_len, double *output_window)
                             "0 and output_window cannot be empty.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    // from https://www.edn.com/windowing-functions-improve-fft-results-part-i/
-    switch (static_cast<WindowOperations> (window_function))
+    const std::vector<double> *table = get_window_table (window_function, window_len, param);
+    if (table == NULL)
     {
-        case WindowOperations::NO_WINDOW:
-            no_window_function (window_len, output_window);
-            break;
-        case WindowOperations::HAMMING:
-            hamming_function (window_len, output_window);
-            break;
-        case WindowOperations::HANNING:
-            hanning_function (window_len, output_window);
-            break;
-        case WindowOperations::BLACKMAN_HARRIS:
-            blackman_harris_function (window_len, output_window);
-            break;
-        default:
-            data_logger->error ("Invalid Window function. Window function:{}", window_function);
-            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        data_logger->error (
+            "Invalid Window function. Window function:{}, param:{}", window_function, param);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    std::copy (table->begin (), table->end (), output_window);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int get_dpss_tapers (int window_len, double nw, int num_tapers, double *output_tapers)
+{
+    if (output_tapers == NULL)
+    {
+        data_logger->error ("output_tapers cannot be empty.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    const std::vector<double> *table = get_dpss_table (window_len, nw, num_tapers);
+    if (table == NULL)
+    {
+        data_logger->error ("Please check the arguments: window_len must be >= 2, nw must be in "
+                            "(0, window_len / 2) and num_tapers in [1, window_len].");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::copy (table->begin (), table->end (), output_tapers);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -714,47 +827,13 @@ int perform_fft (
             "Please check to make sure all arguments aren't empty and data_len is even.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-
-    double *windowed_data = new double[data_len];
-    get_window (window_function, data_len, windowed_data);
-    for (int i = 0; i < data_len; i++)
-    {
-        windowed_data[i] *= data[i];
-    }
-    kiss_fft_cpx *sout = new kiss_fft_cpx[data_len];
-    kiss_fftr_cfg cfg = NULL;
-    try
-    {
-        cfg = kiss_fftr_alloc (data_len, 0, 0, 0);
-        kiss_fftr (cfg, windowed_data, sout);
-        for (int i = 0; i < data_len / 2 + 1; i++)
-        {
-            output_re[i] = sout[i].r;
-            output_im[i] = sout[i].i;
-        }
-        delete[] sout;
-        delete[] windowed_data;
-        windowed_data = NULL;
-        sout = NULL;
-        kiss_fftr_free (cfg);
-    }
-    catch (...)
+    FFTPlan *plan = get_fft_plan (data_len, window_function);
+    if (plan == NULL)
     {
-        if (sout)
-        {
-            delete[] sout;
-        }
-        if (windowed_data)
-        {
-            delete[] windowed_data;
-        }
-        if (cfg)
-        {
-            kiss_fftr_free (cfg);
-        }
-        data_logger->error ("Error with doing FFT processing.");
-        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        data_logger->error ("Failed to create FFT plan. Window function:{}", window_function);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    plan->perform_fft (data, output_re, output_im);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -767,45 +846,13 @@ int perform_ifft (double *input_re, double *input_im, int data_len, double *rest
             "Please check to make sure all arguments aren't empty and data_len is even.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *temp = new double[data_len];
-    kiss_fft_cpx *cin = new kiss_fft_cpx[data_len];
-    for (int i = 0; i < data_len / 2 + 1; i++)
-    {
-        cin[i].r = input_re[i];
-        cin[i].i = input_im[i];
-    }
-    kiss_fftr_cfg cfg = NULL;
-    try
-    {
-        cfg = kiss_fftr_alloc (data_len, 1, 0, 0);
-        kiss_fftri (cfg, cin, temp);
-        for (int i = 0; i < data_len; i++)
-        {
-            restored_data[i] = temp[i] / data_len;
-        }
-        delete[] cin;
-        cin = NULL;
-        delete[] temp;
-        temp = NULL;
-        kiss_fftr_free (cfg);
-    }
-    catch (...)
+    FFTPlan *plan = get_fft_plan (data_len, (int)WindowOperations::NO_WINDOW);
+    if (plan == NULL)
     {
-        if (temp)
-        {
-            delete[] temp;
-        }
-        if (cin)
-        {
-            delete[] cin;
-        }
-        if (cfg)
-        {
-            kiss_fftr_free (cfg);
-        }
         data_logger->error ("Error with doing inverse FFT.");
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
+    plan->perform_ifft (input_re, input_im, restored_data);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -819,28 +866,69 @@ int get_psd (double *data, int data_len, int sampling_rate, int window_function,
                             "is >=1 and data_len is even.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *re = new double[data_len / 2 + 1];
-    double *im = new double[data_len / 2 + 1];
-    int res = perform_fft (data, data_len, window_function, re, im);
-    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    FFTPlan *plan = get_fft_plan (data_len, window_function);
+    if (plan == NULL)
     {
-        delete[] re;
-        delete[] im;
-        return res;
+        data_logger->error ("Failed to create FFT plan. Window function:{}", window_function);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    plan->get_psd (data, sampling_rate, output_ampl);
     double freq_res = (double)sampling_rate / (double)data_len;
     for (int i = 0; i < data_len / 2 + 1; i++)
     {
-        // https://www.mathworks.com/help/signal/ug/power-spectral-density-estimates-using-fft.html
-        output_ampl[i] = (re[i] * re[i] + im[i] * im[i]) / ((double)(sampling_rate * data_len));
-        if ((i != 0) && (i != data_len / 2))
+        output_freq[i] = i * freq_res;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int get_psd_multitaper (double *data, int data_len, int sampling_rate, double nw, int num_tapers,
+    double *output_ampl, double *output_freq)
+{
+    if ((data == NULL) || (sampling_rate < 1) || (data_len < 2) || (data_len % 2 == 1) ||
+        (output_ampl == NULL) || (output_freq == NULL))
+    {
+        data_logger->error ("Please check to make sure all arguments aren't empty, sampling rate "
+                            "is >=1 and data_len is even.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    const std::vector<double> *tapers = get_dpss_table (data_len, nw, num_tapers);
+    if (tapers == NULL)
+    {
+        data_logger->error ("Please check the arguments: nw must be in (0, data_len / 2) and "
+                            "num_tapers in [1, data_len].");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    FFTPlan *plan = get_fft_plan (data_len, (int)WindowOperations::NO_WINDOW);
+    if (plan == NULL)
+    {
+        data_logger->error ("Failed to create FFT plan.");
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+
+    int psd_len = data_len / 2 + 1;
+    std::vector<double> tapered (data_len);
+    std::vector<double> taper_psd (psd_len);
+    std::fill (output_ampl, output_ampl + psd_len, 0.0);
+    // tapers have unit energy, scale them to the energy of rectangular window to reuse its norm
+    double scale = sqrt ((double)data_len);
+    for (int k = 0; k < num_tapers; k++)
+    {
+        const double *taper = tapers->data () + (size_t)k * data_len;
+        for (int i = 0; i < data_len; i++)
+        {
+            tapered[i] = data[i] * taper[i] * scale;
+        }
+        plan->get_psd (tapered.data (), sampling_rate, taper_psd.data ());
+        for (int i = 0; i < psd_len; i++)
         {
-            output_ampl[i] *= 2;
+            output_ampl[i] += taper_psd[i] / num_tapers;
         }
+    }
+    double freq_res = (double)sampling_rate / (double)data_len;
+    for (int i = 0; i < psd_len; i++)
+    {
         output_freq[i] = i * freq_res;
     }
-    delete[] re;
-    delete[] im;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -904,9 +992,69 @@ int get_nearest_power_of_two (int value, int *output)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+// binary recording format, the same as written by binary_file streamer. Timestamp index is
+// written if timestamp_channel >= 0, appending keeps timestamp channel of the existing file
+static int write_binary_file (const double *data, int num_rows, int num_cols,
+    const char *file_name, bool append, int timestamp_channel)
+{
+    BinaryFileHeader header;
+    header.num_rows = num_rows;
+    header.timestamp_channel = timestamp_channel;
+    BinaryFileWriter writer;
+    int res = writer.open (file_name, header, append);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("Couldn't open binary file {}, appending is allowed only to a binary "
+                            "file with the same number of rows",
+            file_name);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    // in read/write file data is transposed!
+    const int block_size = 1024;
+    std::vector<double> packages ((size_t)block_size * num_rows);
+    for (int first = 0; (first < num_cols) && (res == (int)BrainFlowExitCodes::STATUS_OK);
+         first += block_size)
+    {
+        int count = std::min (block_size, num_cols - first);
+        for (int i = 0; i < count; i++)
+        {
+            for (int j = 0; j < num_rows; j++)
+            {
+                packages[i * num_rows + j] = data[j * num_cols + first + i];
+            }
+        }
+        res = writer.write_packages (packages.data (), count);
+    }
+    int close_res = writer.close ();
+    if ((res != (int)BrainFlowExitCodes::STATUS_OK) ||
+        (close_res != (int)BrainFlowExitCodes::STATUS_OK))
+    {
+        data_logger->error ("Couldn't write to file {}", file_name);
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int write_file (
     const double *data, int num_rows, int num_cols, const char *file_name, const char *file_mode)
 {
+    return write_file_with_index (data, num_rows, num_cols, file_name, file_mode, -1);
+}
+
+int write_file_with_index (const double *data, int num_rows, int num_cols, const char *file_name,
+    const char *file_mode, int timestamp_channel)
+{
+    if ((timestamp_channel < -1) || (timestamp_channel >= num_rows))
+    {
+        data_logger->error (
+            "Invalid timestamp channel {} for {} rows", timestamp_channel, num_rows);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if ((strcmp (file_mode, "wb") == 0) || (strcmp (file_mode, "ab") == 0))
+    {
+        return write_binary_file (
+            data, num_rows, num_cols, file_name, file_mode[0] == 'a', timestamp_channel);
+    }
     if ((strcmp (file_mode, "w") != 0) && (strcmp (file_mode, "w+") != 0) &&
         (strcmp (file_mode, "a") != 0) && (strcmp (file_mode, "a+") != 0))
     {
@@ -936,6 +1084,36 @@ int write_file (
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+static int read_binary_file (
+    double *data, int *num_rows, int *num_cols, const char *file_name, int num_elements)
+{
+    BinaryFileReader file;
+    if (file.open (file_name) != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("Couldn't read binary file {}", file_name);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int total_rows = (int)file.get_num_packages ();
+    int total_cols = file.get_header ().num_rows;
+    // read only full packages which fit into num_elements, last one may be read partially
+    int full_rows = std::min (num_elements / total_cols, total_rows);
+    file.read_packages_transposed (0, full_rows, data, total_rows);
+    int rest = num_elements - full_rows * total_cols;
+    if ((full_rows < total_rows) && (rest > 0))
+    {
+        std::vector<double> package (total_cols);
+        file.read_package (full_rows, package.data ());
+        for (int i = 0; i < rest; i++)
+        {
+            data[i * total_rows + full_rows] = package[i];
+        }
+        full_rows++;
+    }
+    *num_cols = full_rows;
+    *num_rows = total_cols;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int read_file (double *data, int *num_rows, int *num_cols, const char *file_name, int num_elements)
 {
     if (num_elements <= 0)
@@ -943,84 +1121,57 @@ int read_file (double *data, int *num_rows, int *num_cols, const char *file_name
         data_logger->error ("Nummber or elements must be greater than 0.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    FILE *fp;
-    fp = fopen (file_name, "r");
-    if (fp == NULL)
+    if (BinaryFileReader::is_binary_file (file_name))
+    {
+        return read_binary_file (data, num_rows, num_cols, file_name, num_elements);
+    }
+    TsvFile file;
+    if (file.open (file_name) != (int)BrainFlowExitCodes::STATUS_OK)
     {
         data_logger->error ("Couldn't read file {}", file_name);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    char buf[4096];
     // rows and cols in tsv file, in data array its transposed!
-    int total_rows = 0;
-    int total_cols = 0;
-
-    // count rows
-    char c;
-    for (c = getc (fp); !feof (fp); c = getc (fp))
+    int total_rows = (int)file.get_num_lines ();
+    if (total_rows == 0)
     {
-        if (c == '\n')
-        {
-            total_rows++;
-        }
+        *num_cols = 0;
+        *num_rows = 0;
+        return (int)BrainFlowExitCodes::STATUS_OK;
     }
-
-    fseek (fp, 0, SEEK_SET);
-    int current_row = 0;
-    int cur_pos = 0;
-    while (fgets (buf, sizeof (buf), fp) != NULL)
+    int total_cols = file.get_num_cols (0);
+    if (total_cols <= 0)
     {
-        std::string tsv_string (buf);
-        std::stringstream ss (tsv_string);
-        std::vector<std::string> splitted;
-        std::string tmp;
-        char sep = '\t';
-        if (tsv_string.find ('\t') == std::string::npos)
-        {
-            sep = ',';
-        }
-        while (std::getline (ss, tmp, sep))
-        {
-            if (tmp != "\n")
-            {
-                splitted.push_back (tmp);
-            }
-        }
-        if ((total_cols != 0) && (total_cols != (int)splitted.size ()))
+        data_logger->error ("found not a number in data file");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    // read only full lines which fit into num_elements, last one may be read partially
+    int full_rows = std::min (num_elements / total_cols, total_rows);
+    int res = file.parse_lines_transposed (0, full_rows, total_cols, data, total_rows);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("invalid input file, found not a number or rows with different size");
+        return res;
+    }
+    int rest = num_elements - full_rows * total_cols;
+    if ((full_rows < total_rows) && (rest > 0))
+    {
+        std::vector<double> line (total_cols);
+        if (file.parse_line (full_rows, line.data (), total_cols) != total_cols)
         {
-            data_logger->error ("some rows have more cols than others, invalid input file");
-            fclose (fp);
+            data_logger->error (
+                "invalid input file, found not a number or rows with different size");
             return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
-        total_cols = (int)splitted.size ();
-        for (int i = 0; i < total_cols; i++)
+        for (int i = 0; i < rest; i++)
         {
-            try
-            {
-                data[i * total_rows + current_row] = std::stod (splitted[i]);
-            }
-            catch (const std::invalid_argument &)
-            {
-                fclose (fp);
-                data_logger->error ("found not a number in data file");
-                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-            }
-            if (cur_pos == (num_elements - 1))
-            {
-                *num_cols = current_row + 1;
-                *num_rows = total_cols;
-                fclose (fp);
-                return (int)BrainFlowExitCodes::STATUS_OK;
-            }
-            cur_pos++;
+            data[i * total_rows + full_rows] = line[i];
         }
-        current_row++;
+        full_rows++;
     }
-    // more likely code below is unreachable
-    *num_cols = total_rows;
+    *num_cols = full_rows;
     *num_rows = total_cols;
-    fclose (fp);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -1046,63 +1197,47 @@ int calc_stddev (double *data, int start_pos, int end_pos, double *output)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int get_num_elements_in_file (const char *file_name, int *num_elements)
-{
-    FILE *fp;
-    fp = fopen (file_name, "r");
-    if (fp == NULL)
-    {
-        data_logger->error ("Couldn't read file {}", file_name);
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-    }
-
-    char buf[4096];
-    int total_rows = 0;
-
-    // count rows
-    char c;
-    for (c = getc (fp); !feof (fp); c = getc (fp))
+int get_num_elements_in_file (const char *file_name, int *num_elements)
+{
+    if (BinaryFileReader::is_binary_file (file_name))
     {
-        if (c == '\n')
+        BinaryFileReader binary_file;
+        if (binary_file.open (file_name) != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            data_logger->error ("Couldn't read binary file {}", file_name);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        *num_elements = (int)binary_file.get_num_packages () * binary_file.get_header ().num_rows;
+        if (*num_elements == 0)
         {
-            total_rows++;
+            data_logger->error ("Empty file {}", file_name);
+            return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
         }
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    TsvFile file;
+    if (file.open (file_name) != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("Couldn't read file {}", file_name);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+
+    int total_rows = (int)file.get_num_lines ();
     if (total_rows == 0)
     {
         *num_elements = 0;
-        fclose (fp);
         data_logger->error ("Empty file {}", file_name);
         return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
     }
-
-    fseek (fp, 0, SEEK_SET);
-    while (fgets (buf, sizeof (buf), fp) != NULL)
+    int total_cols = file.get_num_cols (0);
+    if (total_cols < 0)
     {
-        std::string tsv_string (buf);
-        std::stringstream ss (tsv_string);
-        std::vector<std::string> splitted;
-        std::string tmp;
-        char sep = '\t';
-        if (tsv_string.find ('\t') == std::string::npos)
-        {
-            sep = ',';
-        }
-        while (std::getline (ss, tmp, sep))
-        {
-            if (tmp != "\n")
-            {
-                splitted.push_back (tmp);
-            }
-        }
-        *num_elements = (int)splitted.size () * total_rows;
-        fclose (fp);
-        return (int)BrainFlowExitCodes::STATUS_OK;
+        *num_elements = 0;
+        data_logger->error ("found not a number in data file {}", file_name);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    *num_elements = 0;
-    fclose (fp);
-    data_logger->error ("File contents", file_name);
-    return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    *num_elements = total_cols * total_rows;
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 int detrend (double *data, int data_len, int detrend_operation)
@@ -1172,26 +1307,29 @@ int get_psd_welch (double *data, int data_len, int nfft, int overlap, int sampli
         data_logger->error ("Please review your arguments.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double *ampls = new double[nfft / 2 + 1];
+    // segments share plan and buffers, psd of a segment differs from get_psd only by freqs
+    FFTPlan *plan = get_fft_plan (nfft, window_function);
+    if (plan == NULL)
+    {
+        data_logger->error ("Failed to create FFT plan. Nfft:{}, Window function:{}", nfft,
+            window_function);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::vector<double> ampls (nfft / 2 + 1);
     int counter = 0;
     for (int i = 0; i < nfft / 2 + 1; i++)
     {
         output_ampl[i] = 0.0;
+        output_freq[i] = i * ((double)sampling_rate / (double)nfft);
     }
     for (int pos = 0; (pos + nfft) <= data_len; pos += (nfft - overlap), counter++)
     {
-        int res = get_psd (data + pos, nfft, sampling_rate, window_function, ampls, output_freq);
-        if (res != (int)BrainFlowExitCodes::STATUS_OK)
-        {
-            delete[] ampls;
-            return res;
-        }
+        plan->get_psd (data + pos, sampling_rate, ampls.data ());
         for (int i = 0; i < nfft / 2 + 1; i++)
         {
             output_ampl[i] += ampls[i];
         }
     }
-    delete[] ampls;
     if (counter == 0)
     {
         data_logger->error ("Nfft must be less than data_len.");
@@ -1206,6 +1344,62 @@ int get_psd_welch (double *data, int data_len, int nfft, int overlap, int sampli
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+static int get_band_powers_nfft (int sampling_rate, int cols)
+{
+    int nfft = 0;
+    get_nearest_power_of_two (sampling_rate, &nfft);
+    nfft *= 2; // for resolution ~ 0.5
+    // handle the case if nfft > number of data points
+    // its valid case but results will not be accurate
+    while (nfft > cols)
+    {
+        nfft /= 2;
+    }
+    return nfft;
+}
+
+// bands[band][channel] to relative band powers averaged over channels
+static void get_relative_band_powers (double **bands, int rows, int num_bands,
+    double *avg_band_powers, double *stddev_band_powers)
+{
+    // find average and stddev
+    double *avg_bands = new double[num_bands];
+    double *std_bands = new double[num_bands];
+    memset (avg_bands, 0, sizeof (double) * num_bands);
+    memset (std_bands, 0, sizeof (double) * num_bands);
+    for (int i = 0; i < num_bands; i++)
+    {
+        for (int j = 0; j < rows; j++)
+        {
+            avg_bands[i] += bands[i][j];
+        }
+        avg_bands[i] /= rows;
+        for (int j = 0; j < rows; j++)
+        {
+            std_bands[i] += (bands[i][j] - avg_bands[i]) * (bands[i][j] - avg_bands[i]);
+        }
+        std_bands[i] /= rows;
+        std_bands[i] = sqrt (std_bands[i]);
+    }
+    // use relative band powers
+    double sum = 0.0;
+    for (int i = 0; i < num_bands; i++)
+    {
+        sum += avg_bands[i];
+    }
+    for (int i = 0; i < num_bands; i++)
+    {
+        avg_band_powers[i] = avg_bands[i] / sum;
+        // use relative stddev to 'normalize'(doesnt ensure range between 0 and 1) it and keep
+        // information about variance, division by max doesnt make any sense for stddev, it will
+        // lose information about ratio between mean and deviation
+        stddev_band_powers[i] = std_bands[i] / avg_bands[i];
+    }
+
+    delete[] avg_bands;
+    delete[] std_bands;
+}
+
 int get_custom_band_powers (double *raw_data, int rows, int cols, double *start_freqs,
     double *stop_freqs, int num_bands, int sampling_rate, int apply_filters,
     double *avg_band_powers, double *stddev_band_powers)
@@ -1224,15 +1418,7 @@ int get_custom_band_powers (double *raw_data, int rows, int cols, double *start_
     {
         exit_codes[i] = (int)BrainFlowExitCodes::STATUS_OK;
     }
-    int nfft = 0;
-    get_nearest_power_of_two (sampling_rate, &nfft);
-    nfft *= 2; // for resolution ~ 0.5
-    // handle the case if nfft > number of data points
-    // its valid case but results will not be accurate
-    while (nfft > cols)
-    {
-        nfft /= 2;
-    }
+    int nfft = get_band_powers_nfft (sampling_rate, cols);
     if (nfft < 8)
     {
         data_logger->error ("Not enough data for calculation.");
@@ -1310,52 +1496,219 @@ int get_custom_band_powers (double *raw_data, int rows, int cols, double *start_
         }
     }
 
-    // find average and stddev
-    double *avg_bands = new double[num_bands];
-    double *std_bands = new double[num_bands];
-    memset (avg_bands, 0, sizeof (double) * num_bands);
-    memset (std_bands, 0, sizeof (double) * num_bands);
-    for (int i = 0; i < num_bands; i++)
+    get_relative_band_powers (bands, rows, num_bands, avg_band_powers, stddev_band_powers);
+
+    delete[] exit_codes;
+    for (int j = 0; j < num_bands; j++)
     {
-        for (int j = 0; j < rows; j++)
-        {
-            avg_bands[i] += bands[i][j];
-        }
-        avg_bands[i] /= rows;
-        for (int j = 0; j < rows; j++)
+        delete[] bands[j];
+    }
+    delete[] bands;
+
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+static std::shared_ptr<BandPowerStream> get_band_power_stream (int stream_id)
+{
+    std::lock_guard<std::mutex> lock (band_power_streams_mutex);
+    auto it = band_power_streams.find (stream_id);
+    if (it == band_power_streams.end ())
+    {
+        data_logger->error ("No band power stream with id {}", stream_id);
+        return NULL;
+    }
+    return it->second;
+}
+
+int create_band_power_stream (
+    int sampling_rate, int window_len, int num_channels, int apply_filters, int *stream_id)
+{
+    if ((sampling_rate < 1) || (window_len < 1) || (num_channels < 1) || (stream_id == NULL))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int nfft = get_band_powers_nfft (sampling_rate, window_len);
+    if (nfft < 8)
+    {
+        data_logger->error ("Not enough data for calculation.");
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    std::shared_ptr<IIRFilter> filter = NULL;
+    if (apply_filters)
+    {
+        // the same filters as in get_custom_band_powers, history is kept between calls
+        std::vector<IIRFilterDesignKey> keys;
+        keys.push_back (get_filter_key ((int)IIRFilterOperations::BANDSTOP, sampling_rate, 48.0,
+            52.0, 4, (int)FilterTypes::BUTTERWORTH, 0.0));
+        keys.push_back (get_filter_key ((int)IIRFilterOperations::BANDSTOP, sampling_rate, 58.0,
+            62.0, 4, (int)FilterTypes::BUTTERWORTH, 0.0));
+        keys.push_back (get_filter_key ((int)IIRFilterOperations::BANDPASS, sampling_rate, 2.0,
+            45.0, 4, (int)FilterTypes::BUTTERWORTH, 0.0));
+        filter = std::shared_ptr<IIRFilter> (new IIRFilter (num_channels));
+        for (const IIRFilterDesignKey &key : keys)
         {
-            std_bands[i] += (bands[i][j] - avg_bands[i]) * (bands[i][j] - avg_bands[i]);
+            std::shared_ptr<const IIRFilterDesign> design = get_iir_filter_design (key);
+            if (design == NULL)
+            {
+                data_logger->error ("Failed to design filters for band powers.");
+                return (int)BrainFlowExitCodes::GENERAL_ERROR;
+            }
+            filter->add_stage (design);
         }
-        std_bands[i] /= rows;
-        std_bands[i] = sqrt (std_bands[i]);
     }
-    // use relative band powers
-    double sum = 0.0;
-    for (int i = 0; i < num_bands; i++)
+    std::shared_ptr<BandPowerStream> stream (new BandPowerStream (
+        num_channels, sampling_rate, window_len, nfft, filter, apply_filters != 0));
+    std::lock_guard<std::mutex> lock (band_power_streams_mutex);
+    *stream_id = ++last_band_power_stream_id;
+    band_power_streams[*stream_id] = stream;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int add_band_power_stream_data (int stream_id, double *data, int rows, int cols)
+{
+    if ((data == NULL) || (cols < 0))
     {
-        sum += avg_bands[i];
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<BandPowerStream> stream = get_band_power_stream (stream_id);
+    if (stream == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (rows != stream->get_num_channels ())
+    {
+        data_logger->error ("Number of rows must be equal to number of channels in stream, Rows:{} "
+                            ", Channels:{}",
+            rows, stream->get_num_channels ());
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    stream->add_data (data, cols);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int get_band_power_stream_powers (int stream_id, double *start_freqs, double *stop_freqs,
+    int num_bands, double *avg_band_powers, double *stddev_band_powers)
+{
+    if ((avg_band_powers == NULL) || (stddev_band_powers == NULL) || (start_freqs == NULL) ||
+        (stop_freqs == NULL) || (num_bands < 1))
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<BandPowerStream> stream = get_band_power_stream (stream_id);
+    if (stream == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    int rows = stream->get_num_channels ();
+    int psd_len = stream->get_psd_len ();
+    std::vector<double> ampls (rows * psd_len);
+    std::vector<double> freqs (psd_len);
+    // all channels under one lock, add_data from another thread doesnt mix windows
+    if (!stream->get_psds (ampls.data (), freqs.data ()))
+    {
+        data_logger->error ("Not enough data in band power stream.");
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    std::vector<double> bands_data (num_bands * rows);
+    std::vector<double *> bands (num_bands);
     for (int i = 0; i < num_bands; i++)
     {
-        avg_band_powers[i] = avg_bands[i] / sum;
-        // use relative stddev to 'normalize'(doesnt ensure range between 0 and 1) it and keep
-        // information about variance, division by max doesnt make any sense for stddev, it will
-        // lose information about ratio between mean and deviation
-        stddev_band_powers[i] = std_bands[i] / avg_bands[i];
+        bands[i] = bands_data.data () + i * rows;
+    }
+    for (int i = 0; i < rows; i++)
+    {
+        for (int band_num = 0; band_num < num_bands; band_num++)
+        {
+            int res = get_band_power (ampls.data () + i * psd_len, freqs.data (), psd_len,
+                start_freqs[band_num], stop_freqs[band_num], &bands[band_num][i]);
+            if (res != (int)BrainFlowExitCodes::STATUS_OK)
+            {
+                return res;
+            }
+        }
     }
+    get_relative_band_powers (
+        bands.data (), rows, num_bands, avg_band_powers, stddev_band_powers);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    delete[] exit_codes;
-    for (int j = 0; j < num_bands; j++)
+int release_band_power_stream (int stream_id)
+{
+    std::lock_guard<std::mutex> lock (band_power_streams_mutex);
+    auto it = band_power_streams.find (stream_id);
+    if (it == band_power_streams.end ())
     {
-        delete[] bands[j];
+        data_logger->error ("No band power stream with id {}", stream_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    delete[] bands;
-    delete[] avg_bands;
-    delete[] std_bands;
+    band_power_streams.erase (it);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
+// features of built-in mindfulness and restfulness models are avg band powers of these bands, the
+// same bands as in get_avg_band_powers of bindings
+static const double eeg_metric_start_freqs[5] = {2.0, 4.0, 8.0, 13.0, 30.0};
+static const double eeg_metric_stop_freqs[5] = {4.0, 8.0, 13.0, 30.0, 45.0};
+
+static int calc_eeg_metric (int metric, const double *avg_band_powers, double *output)
+{
+    double mindfulness = calc_mindfulness (avg_band_powers);
+    if (metric == (int)BrainFlowMetrics::MINDFULNESS)
+    {
+        *output = mindfulness;
+    }
+    else if (metric == (int)BrainFlowMetrics::RESTFULNESS)
+    {
+        *output = 1.0 - mindfulness;
+    }
+    else
+    {
+        data_logger->error ("Only mindfulness and restfulness metrics are supported.");
+        return (int)BrainFlowExitCodes::UNSUPPORTED_CLASSIFIER_AND_METRIC_COMBINATION_ERROR;
+    }
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int get_eeg_metric (double *raw_data, int rows, int cols, int sampling_rate, int metric,
+    int apply_filters, double *output)
+{
+    if (output == NULL)
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    double avg_band_powers[5];
+    double stddev_band_powers[5];
+    int res = get_custom_band_powers (raw_data, rows, cols, (double *)eeg_metric_start_freqs,
+        (double *)eeg_metric_stop_freqs, 5, sampling_rate, apply_filters, avg_band_powers,
+        stddev_band_powers);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return calc_eeg_metric (metric, avg_band_powers, output);
+}
+
+int get_band_power_stream_metric (int stream_id, int metric, double *output)
+{
+    if (output == NULL)
+    {
+        data_logger->error ("Please review your arguments.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    double avg_band_powers[5];
+    double stddev_band_powers[5];
+    int res = get_band_power_stream_powers (stream_id, (double *)eeg_metric_start_freqs,
+        (double *)eeg_metric_stop_freqs, 5, avg_band_powers, stddev_band_powers);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return calc_eeg_metric (metric, avg_band_powers, output);
+}
+
 int get_railed_percentage (double *raw_data, int data_len, int gain, double *output)
 {
     if ((raw_data == NULL) || (data_len < 1) || (gain < 1) || (output == NULL))
@@ -1523,41 +1876,63 @@ int detect_peaks_z_score (
         data_logger->error ("invalid inputs for detect_peaks_z_score");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    memset (output, 0, sizeof (double) * data_len);
-    double *filtered_data = new double[data_len];
-    double *avg_filter = new double[data_len];
-    double *std_filter = new double[data_len];
-    memcpy (filtered_data, data, sizeof (double) * data_len);
+    ZScorePeakDetector detector (lag, threshold, influence);
+    detector.process (data, data_len, output);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    avg_filter[lag - 1] = mean (data, lag);
-    std_filter[lag - 1] = stddev (data, lag);
+static std::shared_ptr<ZScorePeakDetector> get_peak_detector (int detector_id)
+{
+    std::lock_guard<std::mutex> lock (peak_detectors_mutex);
+    auto it = peak_detectors.find (detector_id);
+    if (it == peak_detectors.end ())
+    {
+        data_logger->error ("No peak detector with id {}", detector_id);
+        return NULL;
+    }
+    return it->second;
+}
 
-    for (int i = lag; i < data_len; i++)
+int create_z_score_peak_detector (int lag, double threshold, double influence, int *detector_id)
+{
+    if ((lag < 2) || (threshold < 0) || (influence < 0) || (detector_id == NULL))
     {
-        if (abs (data[i] - avg_filter[i - 1]) > threshold * std_filter[i - 1])
-        {
-            if (data[i] > avg_filter[i - 1])
-            {
-                output[i] = 1;
-            }
-            else
-            {
-                output[i] = -1;
-            }
-            filtered_data[i] = influence * data[i] + (1 - influence) * filtered_data[i - 1];
-        }
-        else
-        {
-            output[i] = 0;
-        }
-        avg_filter[i] = mean (filtered_data + i - lag, lag);
-        std_filter[i] = stddev (filtered_data + i - lag, lag);
+        data_logger->error ("invalid inputs for create_z_score_peak_detector");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    std::shared_ptr<ZScorePeakDetector> detector (
+        new ZScorePeakDetector (lag, threshold, influence));
+    std::lock_guard<std::mutex> lock (peak_detectors_mutex);
+    *detector_id = ++last_peak_detector_id;
+    peak_detectors[*detector_id] = detector;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    delete[] filtered_data;
-    delete[] avg_filter;
-    delete[] std_filter;
+int process_z_score_peak_detector (int detector_id, double *data, int data_len, double *output)
+{
+    if ((data == NULL) || (data_len < 0) || (output == NULL))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<ZScorePeakDetector> detector = get_peak_detector (detector_id);
+    if (detector == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    detector->process (data, data_len, output);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
+int release_z_score_peak_detector (int detector_id)
+{
+    std::lock_guard<std::mutex> lock (peak_detectors_mutex);
+    auto it = peak_detectors.find (detector_id);
+    if (it == peak_detectors.end ())
+    {
+        data_logger->error ("No peak detector with id {}", detector_id);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    peak_detectors.erase (it);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -1623,21 +1998,33 @@ int get_heart_rate (
 int perform_ica (double *data, int rows, int cols, int num_components, double *w_mat, double *k_mat,
     double *a_mat, double *s_mat)
 {
-    if ((data == NULL) || (rows < 2) || (cols < 2) || (num_components < 2) || (w_mat == NULL) ||
-        (k_mat == NULL) || (a_mat == NULL) || (s_mat == NULL))
+    return perform_custom_ica (
+        data, rows, cols, num_components, 300, 0.0001, NULL, 0, w_mat, k_mat, a_mat, s_mat);
+}
+
+int perform_custom_ica (double *data, int rows, int cols, int num_components, int max_iterations,
+    double tolerance, const double *w_init, int use_float32, double *w_mat, double *k_mat,
+    double *a_mat, double *s_mat)
+{
+    if ((data == NULL) || (rows < 2) || (cols < 2) || (num_components < 2) ||
+        (max_iterations < 1) || (tolerance <= 0) || (w_mat == NULL) || (k_mat == NULL) ||
+        (a_mat == NULL) || (s_mat == NULL))
     {
         data_logger->error ("invalid inputs for perform_ica.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    Eigen::MatrixXd input_matrix =
-        Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> (
-            data, rows, cols);
+    Eigen::MatrixXd input_matrix = Eigen::Map<RowMajorMatrix> (data, rows, cols);
 
-    FastICA ica (num_components);
+    FastICA ica (num_components, max_iterations, tolerance, use_float32 != 0);
+    if (w_init != NULL)
+    {
+        ica.set_init_w (Eigen::Map<const RowMajorMatrix> (w_init, num_components, num_components));
+    }
     int res = ica.compute (input_matrix);
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
+        data_logger->trace ("ica finished after {} iterations", ica.get_num_iterations ());
         res = ica.get_matrixes (w_mat, k_mat, a_mat, s_mat);
     }
     return res;
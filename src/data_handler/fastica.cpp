@@ -25,7 +25,7 @@ int FastICA::compute (Eigen::MatrixXd &X)
 
     // Whitening
     // X %*% t(X)/rows
-    Eigen::MatrixXd V = X * (X.array () / cols).matrix ().transpose ();
+    Eigen::MatrixXd V = (X * X.transpose ()) / cols;
     // s <- La.svd(V)
     Eigen::BDCSVD<Eigen::MatrixXd> s (V, Eigen::ComputeThinU | Eigen::ComputeThinV);
     // D <- diag(c(1/sqrt(s$d)))
@@ -36,7 +36,8 @@ int FastICA::compute (Eigen::MatrixXd &X)
     Eigen::MatrixXd K_temp2 = K_temp.block (0, 0, num_components, rows);
     // X1 <- K %*% X
     Eigen::MatrixXd X1 = K_temp2 * X;
-    Eigen::MatrixXd a = fast_ica_parallel_compute (X1);
+    Eigen::MatrixXd a = use_float ? fast_ica_parallel_compute<float> (X1) :
+                                    fast_ica_parallel_compute<double> (X1);
     // w <- a %*% K
     Eigen::MatrixXd w = a * K_temp2;
     // S <- w %*% X
@@ -50,51 +51,76 @@ int FastICA::compute (Eigen::MatrixXd &X)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-Eigen::MatrixXd FastICA::fast_ica_parallel_compute (const Eigen::MatrixXd &X)
+// W <- sW$u %*% Diag(1/sW$d) %*% t(sW$u) %*% W where sW <- La.svd(W), it's the same as
+// (W %*% t(W))^(-1/2) %*% W, eigen decomposition of small symmetric matrix is cheaper than svd and
+// it's done in double for any T
+template <typename Matrix>
+static void symmetric_decorrelation (Matrix &W)
 {
-    int cols = (int)X.cols ();
-    Eigen::MatrixXd W (num_components, num_components);
-    random_normal (W);
-
-    //  sW <- La.svd(W)
-    Eigen::BDCSVD<Eigen::MatrixXd> sW (W, Eigen::ComputeThinU | Eigen::ComputeThinV);
-    // W <- sW$u %*% Diag(1/sW$d) %*% t(sW$u) %*% W
-    W = sW.matrixU () * (sW.singularValues ().array ().inverse ()).matrix ().asDiagonal () *
-        sW.matrixU ().transpose () * W;
-    Eigen::MatrixXd W1 = W;
+    Eigen::MatrixXd w = W.template cast<double> ();
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es (w * w.transpose ());
+    w = es.eigenvectors () * es.eigenvalues ().array ().rsqrt ().matrix ().asDiagonal () *
+        es.eigenvectors ().transpose () * w;
+    W = w.cast<typename Matrix::Scalar> ();
+}
+
+template <typename T>
+Eigen::MatrixXd FastICA::fast_ica_parallel_compute (const Eigen::MatrixXd &X_double)
+{
+    typedef Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> Matrix;
+    typedef Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrix;
+
+    int cols = (int)X_double.cols ();
+    // rows of X and W * X are contiguous for tanh
+    RowMajorMatrix X = X_double.cast<T> ();
+    Eigen::MatrixXd W_init (num_components, num_components);
+    if ((w_init.rows () == num_components) && (w_init.cols () == num_components))
+    {
+        W_init = w_init;
+    }
+    else
+    {
+        random_normal (W_init);
+    }
+    Matrix W = W_init.cast<T> ();
+    symmetric_decorrelation (W);
+    Matrix W1 = W;
+    RowMajorMatrix gwx (num_components, cols);
+    Eigen::Matrix<T, Eigen::Dynamic, 1> g_wx_mean (num_components);
     // lim <- rep(1000, maxit)
-    std::vector<double> lim (max_it, 1000);
+    double lim = 1000;
     // iteration counter
     int it = 0;
 
-    while (lim[it] > tol && it < (max_it - 1))
+    while (lim > tol && it < (max_it - 1))
     {
         //  wx <- W %*% X
+        gwx.noalias () = W * X;
         // gwx <- tanh(alpha * wx)
+        // g.wx <- alpha * (1 - (gwx)^2)
         // alpha = 1 , so ignore
-        Eigen::MatrixXd gwx = (W * X).array ().tanh ().matrix ();
+#pragma omp parallel for
+        for (int i = 0; i < num_components; i++)
+        {
+            gwx.row (i).array () = gwx.row (i).array ().tanh ();
+            g_wx_mean (i) = 1 - gwx.row (i).array ().square ().mean ();
+        }
         // v1 <- gwx %*% t(X)/cols
-        Eigen::MatrixXd v1 = gwx * (X.array () / cols).matrix ().transpose ();
-        // g.wx <- alpha * (1 - (gwx)^2)
-        // nb alpha == 1
-        gwx = 1 - gwx.array ().square ();
         // v2 <- Diag(apply(g.wx, 1, FUN = mean)) %*% W
-        Eigen::MatrixXd v2 = gwx.array ().rowwise ().mean ().matrix ().asDiagonal () * W;
         // W1 <- v1 - v2
-        W1 = v1 - v2;
-        // sW1 <- La.svd(W1)
-        Eigen::BDCSVD<Eigen::MatrixXd> sW1 (W1, Eigen::ComputeThinU | Eigen::ComputeThinV);
-        // W1 <- sW1$u %*% Diag(1/sW1$d) %*% t(sW1$u) %*% W1
-        W1 = sW1.matrixU () * (sW1.singularValues ().array ().inverse ()).matrix ().asDiagonal () *
-            sW1.matrixU ().transpose () * W1;
+        W1.noalias () = gwx * X.transpose ();
+        W1 /= (T)cols;
+        W1 -= g_wx_mean.asDiagonal () * W;
+        symmetric_decorrelation (W1);
         // lim[it + 1] <- max( Mod(   Mod(  diag(W1 %*% t(W) )  )  - 1 ) )
-        lim[it + 1] = ((W1 * W.transpose ()).diagonal ().array ().abs () - 1).abs ().maxCoeff ();
+        lim = (double)((W1 * W.transpose ()).diagonal ().array ().abs () - 1).abs ().maxCoeff ();
         // W <- W1
         W = W1;
         ++it;
     }
+    num_iterations = it;
 
-    return W;
+    return W.template cast<double> ();
 }
 
 void FastICA::scale (Eigen::Ref<Eigen::MatrixXd> M, bool center, bool normalize,
@@ -0,0 +1,106 @@
+#include <memory>
+#include <utility>
+
+#include "bounded_cache.h"
+#include "fft_plan.h"
+#include "window_functions.h"
+
+// plans of a thread, typical app uses one or two sizes
+#define MAX_CACHED_PLANS 16
+
+
+FFTPlan::FFTPlan (int nfft, int window_function)
+{
+    this->nfft = (size_t)nfft;
+    forward_cfg = kiss_fftr_alloc (nfft, 0, NULL, NULL);
+    inverse_cfg = kiss_fftr_alloc (nfft, 1, NULL, NULL);
+    const std::vector<double> *table = get_window_table (window_function, nfft);
+    if (table != NULL)
+    {
+        window = *table;
+    }
+    buffer.resize (nfft);
+    spectrum.resize (nfft / 2 + 1);
+}
+
+FFTPlan::~FFTPlan ()
+{
+    if (forward_cfg != NULL)
+    {
+        kiss_fftr_free (forward_cfg);
+    }
+    if (inverse_cfg != NULL)
+    {
+        kiss_fftr_free (inverse_cfg);
+    }
+}
+
+void FFTPlan::transform (const double *data)
+{
+    for (size_t i = 0; i < nfft; i++)
+    {
+        buffer[i] = window[i] * data[i];
+    }
+    kiss_fftr (forward_cfg, buffer.data (), spectrum.data ());
+}
+
+void FFTPlan::perform_fft (const double *data, double *output_re, double *output_im)
+{
+    transform (data);
+    for (size_t i = 0; i < spectrum.size (); i++)
+    {
+        output_re[i] = spectrum[i].r;
+        output_im[i] = spectrum[i].i;
+    }
+}
+
+void FFTPlan::perform_ifft (const double *input_re, const double *input_im, double *output)
+{
+    for (size_t i = 0; i < spectrum.size (); i++)
+    {
+        spectrum[i].r = input_re[i];
+        spectrum[i].i = input_im[i];
+    }
+    kiss_fftri (inverse_cfg, spectrum.data (), buffer.data ());
+    for (size_t i = 0; i < nfft; i++)
+    {
+        output[i] = buffer[i] / nfft;
+    }
+}
+
+void FFTPlan::get_psd (const double *data, int sampling_rate, double *output_ampl)
+{
+    transform (data);
+    // https://www.mathworks.com/help/signal/ug/power-spectral-density-estimates-using-fft.html
+    double norm = (double)(sampling_rate * (int)nfft);
+    for (size_t i = 0; i < spectrum.size (); i++)
+    {
+        output_ampl[i] = (spectrum[i].r * spectrum[i].r + spectrum[i].i * spectrum[i].i) / norm;
+        if ((i != 0) && (i != nfft / 2))
+        {
+            output_ampl[i] *= 2;
+        }
+    }
+}
+
+FFTPlan *get_fft_plan (int nfft, int window_function)
+{
+    if ((nfft <= 0) || (nfft % 2 == 1))
+    {
+        return NULL;
+    }
+    thread_local BoundedCache<std::pair<int, int>, std::unique_ptr<FFTPlan>> plans (
+        MAX_CACHED_PLANS);
+    std::pair<int, int> key (nfft, window_function);
+    const std::unique_ptr<FFTPlan> *cached = plans.get (key);
+    if (cached != NULL)
+    {
+        return cached->get ();
+    }
+    std::unique_ptr<FFTPlan> plan (new FFTPlan (nfft, window_function));
+    if (!plan->is_valid ())
+    {
+        return NULL;
+    }
+    return plans.insert (key, std::move (plan)).get ();
+}
@@ -0,0 +1,450 @@
+#include <algorithm>
+#include <mutex>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define BRAINFLOW_IIR_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BRAINFLOW_IIR_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define BRAINFLOW_IIR_NEON
+#endif
+
+#include "bounded_cache.h"
+#include "brainflow_constants.h"
+#include "iir_filter.h"
+
+#include "DspFilters/Dsp.h"
+
+// filters with different params are rarely used at the same time
+#define MAX_CACHED_DESIGNS 256
+// samples processed stage by stage at once, interleaved tile of 4 channels fits into L1
+#define IIR_TILE 256
+
+
+// Arithmetic for process_biquad, operations are the same as in Dsp::DirectFormII and are not
+// fused, so all implementations return bit exact results.
+struct ScalarOps
+{
+    typedef double type;
+    enum
+    {
+        lanes = 1
+    };
+    static inline type load (const double *p)
+    {
+        return *p;
+    }
+    static inline void store (double *p, type v)
+    {
+        *p = v;
+    }
+    static inline type set (double v)
+    {
+        return v;
+    }
+    static inline type add (type a, type b)
+    {
+        return a + b;
+    }
+    static inline type sub (type a, type b)
+    {
+        return a - b;
+    }
+    static inline type mul (type a, type b)
+    {
+        return a * b;
+    }
+};
+
+#if defined(BRAINFLOW_IIR_AVX)
+struct SimdOps
+{
+    typedef __m256d type;
+    enum
+    {
+        lanes = 4
+    };
+    static inline type load (const double *p)
+    {
+        return _mm256_loadu_pd (p);
+    }
+    static inline void store (double *p, type v)
+    {
+        _mm256_storeu_pd (p, v);
+    }
+    static inline type set (double v)
+    {
+        return _mm256_set1_pd (v);
+    }
+    static inline type add (type a, type b)
+    {
+        return _mm256_add_pd (a, b);
+    }
+    static inline type sub (type a, type b)
+    {
+        return _mm256_sub_pd (a, b);
+    }
+    static inline type mul (type a, type b)
+    {
+        return _mm256_mul_pd (a, b);
+    }
+};
+#elif defined(BRAINFLOW_IIR_SSE2)
+struct SimdOps
+{
+    typedef __m128d type;
+    enum
+    {
+        lanes = 2
+    };
+    static inline type load (const double *p)
+    {
+        return _mm_loadu_pd (p);
+    }
+    static inline void store (double *p, type v)
+    {
+        _mm_storeu_pd (p, v);
+    }
+    static inline type set (double v)
+    {
+        return _mm_set1_pd (v);
+    }
+    static inline type add (type a, type b)
+    {
+        return _mm_add_pd (a, b);
+    }
+    static inline type sub (type a, type b)
+    {
+        return _mm_sub_pd (a, b);
+    }
+    static inline type mul (type a, type b)
+    {
+        return _mm_mul_pd (a, b);
+    }
+};
+#elif defined(BRAINFLOW_IIR_NEON)
+struct SimdOps
+{
+    typedef float64x2_t type;
+    enum
+    {
+        lanes = 2
+    };
+    static inline type load (const double *p)
+    {
+        return vld1q_f64 (p);
+    }
+    static inline void store (double *p, type v)
+    {
+        vst1q_f64 (p, v);
+    }
+    static inline type set (double v)
+    {
+        return vdupq_n_f64 (v);
+    }
+    static inline type add (type a, type b)
+    {
+        return vaddq_f64 (a, b);
+    }
+    static inline type sub (type a, type b)
+    {
+        return vsubq_f64 (a, b);
+    }
+    static inline type mul (type a, type b)
+    {
+        return vmulq_f64 (a, b);
+    }
+};
+#else
+typedef ScalarOps SimdOps;
+#endif
+
+
+static BoundedCache<IIRFilterDesignKey, std::shared_ptr<const IIRFilterDesign>> designs_cache (
+    MAX_CACHED_DESIGNS);
+static std::mutex designs_mutex;
+
+
+bool IIRFilterDesignKey::operator< (const IIRFilterDesignKey &other) const
+{
+    if (filter_operation != other.filter_operation)
+    {
+        return filter_operation < other.filter_operation;
+    }
+    if (filter_type != other.filter_type)
+    {
+        return filter_type < other.filter_type;
+    }
+    if (order != other.order)
+    {
+        return order < other.order;
+    }
+    if (sampling_rate != other.sampling_rate)
+    {
+        return sampling_rate < other.sampling_rate;
+    }
+    if (start_freq != other.start_freq)
+    {
+        return start_freq < other.start_freq;
+    }
+    if (stop_freq != other.stop_freq)
+    {
+        return stop_freq < other.stop_freq;
+    }
+    return ripple < other.ripple;
+}
+
+template <class DesignClass>
+static std::shared_ptr<const IIRFilterDesign> create_design (const Dsp::Params &params)
+{
+    DesignClass design;
+    design.setParams (params);
+    std::shared_ptr<IIRFilterDesign> result (new IIRFilterDesign ());
+    result->stages.resize (design.getNumStages ());
+    for (int i = 0; i < design.getNumStages (); i++)
+    {
+        const Dsp::Cascade::Stage &stage = design[i];
+        result->stages[i].b0 = stage.m_b0;
+        result->stages[i].b1 = stage.m_b1;
+        result->stages[i].b2 = stage.m_b2;
+        result->stages[i].a1 = stage.m_a1;
+        result->stages[i].a2 = stage.m_a2;
+    }
+    return result;
+}
+
+template <template <int> class Butterworth, template <int> class ChebyshevI,
+    template <int> class Bessel>
+static std::shared_ptr<const IIRFilterDesign> create_design (
+    int filter_type, const Dsp::Params &params)
+{
+    switch (static_cast<FilterTypes> (filter_type))
+    {
+        case FilterTypes::BUTTERWORTH:
+            return create_design<Butterworth<MAX_FILTER_ORDER>> (params);
+        case FilterTypes::CHEBYSHEV_TYPE_1:
+            return create_design<ChebyshevI<MAX_FILTER_ORDER>> (params);
+        case FilterTypes::BESSEL:
+            return create_design<Bessel<MAX_FILTER_ORDER>> (params);
+        default:
+            return NULL;
+    }
+}
+
+std::shared_ptr<const IIRFilterDesign> get_iir_filter_design (const IIRFilterDesignKey &key)
+{
+    IIRFilterDesignKey cache_key = key;
+    // ripple is used only for chebyshev filter
+    if (key.filter_type != (int)FilterTypes::CHEBYSHEV_TYPE_1)
+    {
+        cache_key.ripple = 0.0;
+    }
+    if ((key.filter_operation == (int)IIRFilterOperations::LOWPASS) ||
+        (key.filter_operation == (int)IIRFilterOperations::HIGHPASS))
+    {
+        cache_key.stop_freq = 0.0;
+    }
+
+    std::lock_guard<std::mutex> lock (designs_mutex);
+    const std::shared_ptr<const IIRFilterDesign> *cached = designs_cache.get (cache_key);
+    if (cached != NULL)
+    {
+        return *cached;
+    }
+
+    Dsp::Params params;
+    params[0] = cache_key.sampling_rate; // sample rate
+    params[1] = cache_key.order;         // order
+    std::shared_ptr<const IIRFilterDesign> design = NULL;
+    switch (static_cast<IIRFilterOperations> (cache_key.filter_operation))
+    {
+        case IIRFilterOperations::LOWPASS:
+            params[2] = cache_key.start_freq; // cutoff
+            params[3] = cache_key.ripple;
+            design = create_design<Dsp::Butterworth::Design::LowPass,
+                Dsp::ChebyshevI::Design::LowPass, Dsp::Bessel::Design::LowPass> (
+                cache_key.filter_type, params);
+            break;
+        case IIRFilterOperations::HIGHPASS:
+            params[2] = cache_key.start_freq; // cutoff
+            params[3] = cache_key.ripple;
+            design = create_design<Dsp::Butterworth::Design::HighPass,
+                Dsp::ChebyshevI::Design::HighPass, Dsp::Bessel::Design::HighPass> (
+                cache_key.filter_type, params);
+            break;
+        case IIRFilterOperations::BANDPASS:
+            params[2] = (cache_key.start_freq + cache_key.stop_freq) / 2.0; // center freq
+            params[3] = cache_key.stop_freq - cache_key.start_freq;         // band width
+            params[4] = cache_key.ripple;
+            design = create_design<Dsp::Butterworth::Design::BandPass,
+                Dsp::ChebyshevI::Design::BandPass, Dsp::Bessel::Design::BandPass> (
+                cache_key.filter_type, params);
+            break;
+        case IIRFilterOperations::BANDSTOP:
+            params[2] = (cache_key.start_freq + cache_key.stop_freq) / 2.0; // center freq
+            params[3] = cache_key.stop_freq - cache_key.start_freq;         // band width
+            params[4] = cache_key.ripple;
+            design = create_design<Dsp::Butterworth::Design::BandStop,
+                Dsp::ChebyshevI::Design::BandStop, Dsp::Bessel::Design::BandStop> (
+                cache_key.filter_type, params);
+            break;
+        default:
+            break;
+    }
+    if (design != NULL)
+    {
+        designs_cache.insert (cache_key, design);
+    }
+    return design;
+}
+
+// runs one biquad over num_samples interleaved samples of Ops::lanes channels, v1, v2 and vsa hold
+// a value per lane and are updated, vsa is NULL for all stages except the first one
+template <class Ops>
+static void process_biquad (
+    const IIRBiquad &stage, double *data, int num_samples, double *v1, double *v2, double *vsa)
+{
+    const typename Ops::type b0 = Ops::set (stage.b0);
+    const typename Ops::type b1 = Ops::set (stage.b1);
+    const typename Ops::type b2 = Ops::set (stage.b2);
+    const typename Ops::type a1 = Ops::set (stage.a1);
+    const typename Ops::type a2 = Ops::set (stage.a2);
+    const typename Ops::type zero = Ops::set (0.0);
+    typename Ops::type s1 = Ops::load (v1);
+    typename Ops::type s2 = Ops::load (v2);
+    typename Ops::type ac = (vsa != NULL) ? Ops::load (vsa) : zero;
+    for (int i = 0; i < num_samples; i++)
+    {
+        typename Ops::type in = Ops::load (data + i * Ops::lanes);
+        if (vsa != NULL)
+        {
+            ac = Ops::sub (zero, ac);
+        }
+        typename Ops::type w =
+            Ops::add (Ops::sub (Ops::sub (in, Ops::mul (a1, s1)), Ops::mul (a2, s2)), ac);
+        typename Ops::type out =
+            Ops::add (Ops::add (Ops::mul (b0, w), Ops::mul (b1, s1)), Ops::mul (b2, s2));
+        s2 = s1;
+        s1 = w;
+        Ops::store (data + i * Ops::lanes, out);
+    }
+    Ops::store (v1, s1);
+    Ops::store (v2, s2);
+    if (vsa != NULL)
+    {
+        Ops::store (vsa, ac);
+    }
+}
+
+IIRFilter::IIRFilter (int num_channels)
+{
+    this->num_channels = num_channels;
+}
+
+void IIRFilter::add_stage (std::shared_ptr<const IIRFilterDesign> design)
+{
+    designs.push_back (design);
+    history.push_back (std::vector<double> (num_channels * design->stages.size () * 2, 0.0));
+    vsa.push_back (std::vector<double> (num_channels, Dsp::anti_denormal_vsa));
+}
+
+void IIRFilter::process (int channel, double *data, int data_len)
+{
+    for (int tile = 0; tile < data_len; tile += IIR_TILE)
+    {
+        int tile_len = std::min (IIR_TILE, data_len - tile);
+        for (size_t i = 0; i < designs.size (); i++)
+        {
+            const std::vector<IIRBiquad> &stages = designs[i]->stages;
+            double *state = history[i].data () + channel * stages.size () * 2;
+            for (size_t j = 0; j < stages.size (); j++)
+            {
+                process_biquad<ScalarOps> (stages[j], data + tile, tile_len, state + j * 2,
+                    state + j * 2 + 1, (j == 0) ? &vsa[i][channel] : NULL);
+            }
+        }
+    }
+}
+
+void IIRFilter::process_lanes (int first_channel, double *data, int data_len, double *buffer)
+{
+    const int lanes = SimdOps::lanes;
+    double v1[lanes];
+    double v2[lanes];
+    double ac[lanes];
+    for (int tile = 0; tile < data_len; tile += IIR_TILE)
+    {
+        int tile_len = std::min (IIR_TILE, data_len - tile);
+        for (int i = 0; i < tile_len; i++)
+        {
+            for (int lane = 0; lane < lanes; lane++)
+            {
+                buffer[i * lanes + lane] = data[(first_channel + lane) * data_len + tile + i];
+            }
+        }
+        for (size_t i = 0; i < designs.size (); i++)
+        {
+            const std::vector<IIRBiquad> &stages = designs[i]->stages;
+            size_t channel_size = stages.size () * 2;
+            double *state = history[i].data () + first_channel * channel_size;
+            for (int lane = 0; lane < lanes; lane++)
+            {
+                ac[lane] = vsa[i][first_channel + lane];
+            }
+            for (size_t j = 0; j < stages.size (); j++)
+            {
+                for (int lane = 0; lane < lanes; lane++)
+                {
+                    v1[lane] = state[lane * channel_size + j * 2];
+                    v2[lane] = state[lane * channel_size + j * 2 + 1];
+                }
+                process_biquad<SimdOps> (
+                    stages[j], buffer, tile_len, v1, v2, (j == 0) ? ac : NULL);
+                for (int lane = 0; lane < lanes; lane++)
+                {
+                    state[lane * channel_size + j * 2] = v1[lane];
+                    state[lane * channel_size + j * 2 + 1] = v2[lane];
+                }
+            }
+            for (int lane = 0; lane < lanes; lane++)
+            {
+                vsa[i][first_channel + lane] = ac[lane];
+            }
+        }
+        for (int i = 0; i < tile_len; i++)
+        {
+            for (int lane = 0; lane < lanes; lane++)
+            {
+                data[(first_channel + lane) * data_len + tile + i] = buffer[i * lanes + lane];
+            }
+        }
+    }
+}
+
+void IIRFilter::process_block (double *data, int data_len)
+{
+    const int lanes = SimdOps::lanes;
+    int num_groups = num_channels / lanes;
+#pragma omp parallel for
+    for (int group = 0; group < num_groups; group++)
+    {
+        std::vector<double> buffer (IIR_TILE * lanes);
+        process_lanes (group * lanes, data, data_len, buffer.data ());
+    }
+    for (int channel = num_groups * lanes; channel < num_channels; channel++)
+    {
+        process (channel, data + channel * data_len, data_len);
+    }
+}
+
+void IIRFilter::reset ()
+{
+    for (size_t i = 0; i < designs.size (); i++)
+    {
+        std::fill (history[i].begin (), history[i].end (), 0.0);
+        std::fill (vsa[i].begin (), vsa[i].end (), Dsp::anti_denormal_vsa);
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "iir_filter.h"
+
+
+// Welch PSD (hanning window, 80% overlap) of the last window_len samples of each channel, updated
+// as data arrives. Spectrum of a segment is computed once, when its last sample is added, so an
+// update costs one FFT per Welch hop instead of a full Welch over the window.
+// Segments start at multiples of hop counting from the first added sample. If number of added
+// samples minus window_len is a multiple of hop, segments are the same as get_psd_welch uses for
+// the last window_len samples, otherwise they are shifted by less than a hop.
+// With filters result differs from batch get_custom_band_powers: stream filters data continuously
+// and removes the mean in frequency domain, batch call detrends each window first and filters it
+// from zero state, so batch windows have a filter startup transient which stream doesnt have.
+class BandPowerStream
+{
+public:
+    // filter is applied to new data before it's stored and can be NULL, if remove_mean is set
+    // mean of a window is subtracted from data, it's done in frequency domain
+    BandPowerStream (int num_channels, int sampling_rate, int window_len, int nfft,
+        std::shared_ptr<IIRFilter> filter, bool remove_mean);
+
+    BandPowerStream (const BandPowerStream &) = delete;
+    BandPowerStream &operator= (const BandPowerStream &) = delete;
+
+    // data is num_channels rows of num_samples
+    void add_data (const double *data, int num_samples);
+    // false until window_len samples are added
+    bool is_ready ();
+    // output_ampl and output_freq have nfft / 2 + 1 values, result is the same as get_psd_welch
+    // output for the window
+    void get_psd (int channel, double *output_ampl, double *output_freq);
+    // psd of all channels from the same snapshot, output_ampls is num_channels rows of
+    // get_psd_len () values, returns false if stream is not ready
+    bool get_psds (double *output_ampls, double *output_freq);
+
+    int get_num_channels () const
+    {
+        return num_channels;
+    }
+
+    int get_psd_len () const
+    {
+        return nfft / 2 + 1;
+    }
+
+private:
+    struct Segment
+    {
+        long long start;
+        // re and im of each channel, channel by channel
+        std::vector<double> spectrum;
+    };
+
+    int num_channels;
+    int sampling_rate;
+    int window_len;
+    int nfft;
+    int hop;
+    bool remove_mean;
+    std::shared_ptr<IIRFilter> filter;
+    std::mutex lock;
+
+    long long num_samples_added;
+    long long next_segment_start;
+    // last window_len samples of each channel, position of sample i is i % window_len
+    std::vector<double> window;
+    std::vector<double> window_spectrum;
+    std::vector<double> filtered;
+    std::vector<double> segment_data;
+    std::deque<Segment> segments;
+
+    void add_segment ();
+    void compute_spectrum (long long start, int channel, double *re, double *im);
+    void add_segment_psd (const double *re, const double *im, double mean, double *output_ampl);
+    // call it under lock
+    void compute_psd (int channel, double *output_ampl, double *output_freq);
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Eigen/Dense"
+#include "brainflow_constants.h"
+
+
+typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrix;
+
+// Common spatial patterns for two classes. Epochs are read in place, covariances of centered epochs
+// are accumulated in parallel with partial sums per thread and can be regularized with shrinkage
+// towards a scaled identity: (1 - shrinkage) * C + shrinkage * trace (C) / n_channels * I.
+class CSP
+{
+
+public:
+    CSP (int n_channels, double shrinkage = 0.0)
+    {
+        this->n_channels = n_channels;
+        this->shrinkage = shrinkage;
+    }
+
+    // data is n_epochs epochs of n_channels x n_times, labels are 0 or 1 and both are present
+    int compute (const double *data, const double *labels, int n_epochs, int n_times);
+    // output_w has filters in rows sorted by eigenvalue in ascending order, output_d eigenvalues
+    void get_filters (double *output_w, double *output_d);
+
+    // output = filters * data, filters are n_filters rows of n_channels, it has no state so data
+    // can be chunks of a stream
+    static void apply_filters (const double *filters, int n_filters, int n_channels,
+        const double *data, int n_times, double *output);
+
+private:
+    int n_channels;
+    double shrinkage;
+    Eigen::VectorXd eigenvalues;
+    RowMajorMatrix eigenvectors;
+
+    void shrink (RowMajorMatrix &cov);
+};
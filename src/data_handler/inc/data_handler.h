@@ -20,6 +20,28 @@ extern "C"
         double ripple);
     SHARED_EXPORT int CALLING_CONVENTION remove_environmental_noise (
         double *data, int data_len, int sampling_rate, int noise_type);
+    // stateful filters keep history between calls, filter_id is an output param, each channel of
+    // a filter has its own history
+    SHARED_EXPORT int CALLING_CONVENTION create_lowpass_filter (int sampling_rate, double cutoff,
+        int order, int filter_type, double ripple, int num_channels, int *filter_id);
+    SHARED_EXPORT int CALLING_CONVENTION create_highpass_filter (int sampling_rate, double cutoff,
+        int order, int filter_type, double ripple, int num_channels, int *filter_id);
+    SHARED_EXPORT int CALLING_CONVENTION create_bandpass_filter (int sampling_rate,
+        double start_freq, double stop_freq, int order, int filter_type, double ripple,
+        int num_channels, int *filter_id);
+    SHARED_EXPORT int CALLING_CONVENTION create_bandstop_filter (int sampling_rate,
+        double start_freq, double stop_freq, int order, int filter_type, double ripple,
+        int num_channels, int *filter_id);
+    SHARED_EXPORT int CALLING_CONVENTION create_environmental_noise_filter (
+        int sampling_rate, int noise_type, int num_channels, int *filter_id);
+    SHARED_EXPORT int CALLING_CONVENTION process_filter (
+        int filter_id, int channel, double *data, int data_len);
+    // filters all channels of a filter at once, data is rows x cols and rows must be equal to
+    // num_channels of a filter
+    SHARED_EXPORT int CALLING_CONVENTION process_filter_block (
+        int filter_id, double *data, int rows, int cols);
+    SHARED_EXPORT int CALLING_CONVENTION reset_filter (int filter_id);
+    SHARED_EXPORT int CALLING_CONVENTION release_filter (int filter_id);
     SHARED_EXPORT int CALLING_CONVENTION perform_rolling_filter (
         double *data, int data_len, int period, int agg_operation);
     SHARED_EXPORT int CALLING_CONVENTION perform_downsampling (
@@ -27,16 +49,38 @@ extern "C"
     SHARED_EXPORT int CALLING_CONVENTION perform_wavelet_transform (double *data, int data_len,
         int wavelet, int decomposition_level, int extension, double *output_data,
         int *decomposition_lengths);
+    // data is rows of cols points, output_data has rows of coeffs one by one, each row has
+    // sum of decomposition_lengths coeffs, decomposition_lengths are the same for all rows
+    SHARED_EXPORT int CALLING_CONVENTION perform_wavelet_transform_block (double *data, int rows,
+        int cols, int wavelet, int decomposition_level, int extension, double *output_data,
+        int *decomposition_lengths);
     SHARED_EXPORT int CALLING_CONVENTION perform_inverse_wavelet_transform (double *wavelet_coeffs,
         int original_data_len, int wavelet, int decomposition_level, int extension,
         int *decomposition_lengths, double *output_data);
     SHARED_EXPORT int CALLING_CONVENTION perform_wavelet_denoising (double *data, int data_len,
         int wavelet, int decomposition_level, int wavelet_denoising, int threshold,
         int extenstion_type, int noise_level);
+    // denoises each of rows of cols points inplace
+    SHARED_EXPORT int CALLING_CONVENTION perform_wavelet_denoising_block (double *data, int rows,
+        int cols, int wavelet, int decomposition_level, int wavelet_denoising, int threshold,
+        int extenstion_type, int noise_level);
     SHARED_EXPORT int CALLING_CONVENTION get_csp (const double *data, const double *labels,
         int n_epochs, int n_channels, int n_times, double *output_w, double *output_d);
+    // covariance of each class is (1 - shrinkage) * C + shrinkage * trace (C) / n_channels * I
+    SHARED_EXPORT int CALLING_CONVENTION get_regularized_csp (const double *data,
+        const double *labels, int n_epochs, int n_channels, int n_times, double shrinkage,
+        double *output_w, double *output_d);
+    // output is n_filters x n_times, filters are rows of output_w of get_csp
+    SHARED_EXPORT int CALLING_CONVENTION apply_csp_filters (const double *filters, int n_filters,
+        int n_channels, const double *data, int n_times, double *output);
     SHARED_EXPORT int CALLING_CONVENTION get_window (
         int window_function, int window_len, double *output_window);
+    // param is alpha for TUKEY and beta for KAISER, ignored by other windows
+    SHARED_EXPORT int CALLING_CONVENTION get_custom_window (
+        int window_function, int window_len, double param, double *output_window);
+    // num_tapers rows of window_len in output_tapers, nw is time half bandwidth product
+    SHARED_EXPORT int CALLING_CONVENTION get_dpss_tapers (
+        int window_len, double nw, int num_tapers, double *output_tapers);
     SHARED_EXPORT int CALLING_CONVENTION perform_fft (
         double *data, int data_len, int window_function, double *output_re, double *output_im);
     SHARED_EXPORT int CALLING_CONVENTION perform_ifft (
@@ -44,6 +88,9 @@ extern "C"
     SHARED_EXPORT int CALLING_CONVENTION get_nearest_power_of_two (int value, int *output);
     SHARED_EXPORT int CALLING_CONVENTION get_psd (double *data, int data_len, int sampling_rate,
         int window_function, double *output_ampl, double *output_freq);
+    // average of psds with dpss tapers, num_tapers is usually 2 * nw - 1
+    SHARED_EXPORT int CALLING_CONVENTION get_psd_multitaper (double *data, int data_len,
+        int sampling_rate, double nw, int num_tapers, double *output_ampl, double *output_freq);
     SHARED_EXPORT int CALLING_CONVENTION detrend (
         double *data, int data_len, int detrend_operation);
     SHARED_EXPORT int CALLING_CONVENTION calc_stddev (
@@ -56,6 +103,24 @@ extern "C"
     SHARED_EXPORT int CALLING_CONVENTION get_custom_band_powers (double *raw_data, int rows,
         int cols, double *start_freqs, double *stop_freqs, int num_bands, int sampling_rate,
         int apply_filters, double *avg_band_powers, double *stddev_band_powers);
+    // band powers of the last window_len samples updated as data arrives, only spectra of new
+    // welch segments are computed on each call. With apply_filters filters keep history between
+    // calls instead of starting from zero for each window
+    SHARED_EXPORT int CALLING_CONVENTION create_band_power_stream (
+        int sampling_rate, int window_len, int num_channels, int apply_filters, int *stream_id);
+    SHARED_EXPORT int CALLING_CONVENTION add_band_power_stream_data (
+        int stream_id, double *data, int rows, int cols);
+    SHARED_EXPORT int CALLING_CONVENTION get_band_power_stream_powers (int stream_id,
+        double *start_freqs, double *stop_freqs, int num_bands, double *avg_band_powers,
+        double *stddev_band_powers);
+    SHARED_EXPORT int CALLING_CONVENTION release_band_power_stream (int stream_id);
+    // mindfulness or restfulness score of eeg rows in one call, features are avg band powers of
+    // default bands and model is the same as in ml module
+    SHARED_EXPORT int CALLING_CONVENTION get_eeg_metric (double *raw_data, int rows, int cols,
+        int sampling_rate, int metric, int apply_filters, double *output);
+    // the same for the last window of band power stream
+    SHARED_EXPORT int CALLING_CONVENTION get_band_power_stream_metric (
+        int stream_id, int metric, double *output);
     SHARED_EXPORT int CALLING_CONVENTION get_railed_percentage (
         double *raw_data, int data_len, int gain, double *output);
     SHARED_EXPORT int CALLING_CONVENTION get_oxygen_level (double *ppg_ir, double *ppg_red,
@@ -67,8 +132,18 @@ extern "C"
         int data_len, int wavelet, int decomposition_level, int level_to_restore, double *output);
     SHARED_EXPORT int CALLING_CONVENTION detect_peaks_z_score (
         double *data, int data_len, int lag, double threshold, double influence, double *output);
+    // detect_peaks_z_score which keeps its state between calls to process new data as it arrives
+    SHARED_EXPORT int CALLING_CONVENTION create_z_score_peak_detector (
+        int lag, double threshold, double influence, int *detector_id);
+    SHARED_EXPORT int CALLING_CONVENTION process_z_score_peak_detector (
+        int detector_id, double *data, int data_len, double *output);
+    SHARED_EXPORT int CALLING_CONVENTION release_z_score_peak_detector (int detector_id);
     SHARED_EXPORT int CALLING_CONVENTION perform_ica (double *data, int rows, int cols,
         int num_components, double *w_mat, double *k_mat, double *a_mat, double *s_mat);
+    // w_init is num_components x num_components unmixing matrix to start from or NULL for random
+    SHARED_EXPORT int CALLING_CONVENTION perform_custom_ica (double *data, int rows, int cols,
+        int num_components, int max_iterations, double tolerance, const double *w_init,
+        int use_float32, double *w_mat, double *k_mat, double *a_mat, double *s_mat);
 
     // logging methods
     SHARED_EXPORT int CALLING_CONVENTION set_log_level_data_handler (int log_level);
@@ -78,6 +153,10 @@ extern "C"
     // file operations
     SHARED_EXPORT int CALLING_CONVENTION write_file (const double *data, int num_rows, int num_cols,
         const char *file_name, const char *file_mode);
+    // the same as write_file, for "wb" and "ab" modes timestamp_channel row is used to build
+    // timestamp index for search by time, -1 to skip it. Text modes ignore it
+    SHARED_EXPORT int CALLING_CONVENTION write_file_with_index (const double *data, int num_rows,
+        int num_cols, const char *file_name, const char *file_mode, int timestamp_channel);
     SHARED_EXPORT int CALLING_CONVENTION read_file (
         double *data, int *num_rows, int *num_cols, const char *file_name, int num_elements);
     SHARED_EXPORT int CALLING_CONVENTION get_num_elements_in_file (
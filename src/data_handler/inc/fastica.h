@@ -11,24 +11,41 @@ class FastICA
 {
 
 public:
-    FastICA (int num_components, int max_it = 300, double tol = 0.0001)
+    FastICA (int num_components, int max_it = 300, double tol = 0.0001, bool use_float = false)
     {
         this->max_it = max_it;
         this->num_components = num_components;
         this->tol = tol;
+        this->use_float = use_float;
         alpha = 1;
         row_norm = false;
+        num_iterations = 0;
+    }
+
+    // warm start, w_init is num_components x num_components W from a previous run, for example
+    // for previous window of the same recording
+    void set_init_w (const Eigen::MatrixXd &w_init)
+    {
+        this->w_init = w_init;
     }
 
     int compute (Eigen::MatrixXd &X);
     int get_matrixes (double *w_mat, double *k_mat, double *a_mat, double *s_mat);
 
+    int get_num_iterations () const
+    {
+        return num_iterations;
+    }
+
 private:
     Eigen::MatrixXd K;
     Eigen::MatrixXd W;
     Eigen::MatrixXd A;
     Eigen::MatrixXd S;
+    Eigen::MatrixXd w_init;
 
+    // iterations run in T, products and tanh are parallel if OpenMP is enabled
+    template <typename T>
     Eigen::MatrixXd fast_ica_parallel_compute (const Eigen::MatrixXd &X);
     void scale (Eigen::Ref<Eigen::MatrixXd> m, bool, bool, bool ignore_invariants = false,
         std::vector<int> *zeros = NULL);
@@ -37,6 +54,8 @@ private:
     int max_it;
     int num_components;
     double tol;
+    bool use_float;
     int alpha;
     bool row_norm;
+    int num_iterations;
 };
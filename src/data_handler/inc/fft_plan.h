@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+
+#include "kiss_fftr.h"
+
+
+// Real FFT of a fixed size with precomputed window and scratch buffers, so repeated transforms
+// (Welch segments, channels, chunks of a stream) dont allocate or recompute twiddles.
+// Not thread safe, use get_fft_plan to get a plan owned by the calling thread.
+class FFTPlan
+{
+public:
+    FFTPlan (int nfft, int window_function);
+    ~FFTPlan ();
+
+    FFTPlan (const FFTPlan &) = delete;
+    FFTPlan &operator= (const FFTPlan &) = delete;
+
+    // returns false if window function is unknown or kissfft failed to allocate memory
+    bool is_valid () const
+    {
+        return (forward_cfg != NULL) && (inverse_cfg != NULL) && (window.size () == nfft);
+    }
+
+    int get_nfft () const
+    {
+        return (int)nfft;
+    }
+
+    // nfft points of data to nfft / 2 + 1 complex values
+    void perform_fft (const double *data, double *output_re, double *output_im);
+    // nfft / 2 + 1 complex values to nfft points, window is not applied
+    void perform_ifft (const double *input_re, const double *input_im, double *output);
+    // one sided psd of nfft points of data, output_ampl has nfft / 2 + 1 values
+    void get_psd (const double *data, int sampling_rate, double *output_ampl);
+
+private:
+    size_t nfft;
+    kiss_fftr_cfg forward_cfg;
+    kiss_fftr_cfg inverse_cfg;
+    std::vector<double> window;
+    std::vector<double> buffer;
+    std::vector<kiss_fft_cpx> spectrum;
+
+    void transform (const double *data);
+};
+
+// Returns plan for (nfft, window_function) from a cache of the calling thread, NULL if params are
+// invalid. Pointer is valid until the next call of get_fft_plan in the same thread.
+FFTPlan *get_fft_plan (int nfft, int window_function);
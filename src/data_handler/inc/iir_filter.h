@@ -0,0 +1,85 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#define MAX_FILTER_ORDER 8
+
+
+enum class IIRFilterOperations : int
+{
+    LOWPASS = 0,
+    HIGHPASS = 1,
+    BANDPASS = 2,
+    BANDSTOP = 3
+};
+
+// everything which affects coefficients, stop_freq is unused for lowpass and highpass
+struct IIRFilterDesignKey
+{
+    int filter_operation;
+    int filter_type;
+    int order;
+    int sampling_rate;
+    double start_freq;
+    double stop_freq;
+    double ripple;
+
+    bool operator< (const IIRFilterDesignKey &other) const;
+};
+
+// normalized second order section, the same coefficients DspFilters uses for DirectFormII
+struct IIRBiquad
+{
+    double b0;
+    double b1;
+    double b2;
+    double a1;
+    double a2;
+};
+
+// cascade of biquads designed by DspFilters
+struct IIRFilterDesign
+{
+    std::vector<IIRBiquad> stages;
+};
+
+// Returns coefficients for a filter, NULL if filter type is invalid. Designs are cached and shared
+// between filters because computing poles and zeros costs much more than filtering a chunk.
+std::shared_ptr<const IIRFilterDesign> get_iir_filter_design (const IIRFilterDesignKey &key);
+
+// Keeps history of each channel between process calls, so data filtered chunk by chunk is equal to
+// data filtered at once. Designs (e.g. 50Hz and 60Hz bandstops) are applied one after another.
+// Output is the same as output of Dsp::FilterDesign with DirectFormII state.
+class IIRFilter
+{
+public:
+    explicit IIRFilter (int num_channels);
+
+    IIRFilter (const IIRFilter &) = delete;
+    IIRFilter &operator= (const IIRFilter &) = delete;
+
+    void add_stage (std::shared_ptr<const IIRFilterDesign> design);
+    // filters data of a single channel in place
+    void process (int channel, double *data, int data_len);
+    // filters num_channels rows of data_len samples in place, channels are interleaved to run
+    // biquads for several channels in SIMD lanes and groups of channels run in parallel with OpenMP
+    void process_block (double *data, int data_len);
+    // clears history, next sample is filtered as the first one
+    void reset ();
+
+    int get_num_channels () const
+    {
+        return num_channels;
+    }
+
+private:
+    int num_channels;
+    std::vector<std::shared_ptr<const IIRFilterDesign>> designs;
+    // for each design: v1 and v2 of each biquad, channel by channel
+    std::vector<std::vector<double>> history;
+    // for each design: alternating anti denormal value of each channel
+    std::vector<std::vector<double>> vsa;
+
+    void process_lanes (int first_channel, double *data, int data_len, double *buffer);
+};
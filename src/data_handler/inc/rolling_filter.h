@@ -1,7 +1,8 @@
 #pragma once
 
-#include <deque>
-#include <set>
+#include <functional>
+#include <math.h>
+#include <vector>
 
 template <typename T>
 class RollingFilter
@@ -24,80 +25,404 @@ public:
     virtual T get_value () = 0;
 };
 
+// last period values in a circular buffer allocated once, values are never moved
 template <typename T>
-class RollingMedian : public RollingFilter<T>
+class RollingWindow : public RollingFilter<T>
+{
+
+protected:
+    std::vector<T> values;
+    int count;
+    // slot for the next value, it holds the oldest value if window is full
+    int next;
+
+    // returns true and the replaced value if window was full
+    bool push (T num, T &oldest)
+    {
+        bool is_full = (count == this->period);
+        if (is_full)
+        {
+            oldest = values[next];
+        }
+        else
+        {
+            count++;
+        }
+        values[next] = num;
+        if (++next == this->period)
+        {
+            next = 0;
+        }
+        return is_full;
+    }
+
+public:
+    RollingWindow (int period) : RollingFilter<T> (period), values (period)
+    {
+        count = 0;
+        next = 0;
+    }
+
+    // copies values from the oldest to the newest
+    void copy_values (T *output)
+    {
+        int first = (count == this->period) ? next : 0;
+        for (int i = 0; i < count; i++)
+        {
+            int slot = first + i;
+            output[i] = this->values[(slot >= this->period) ? slot - this->period : slot];
+        }
+    }
+};
+
+// Two heaps over slots of the circular buffer: lower is a max heap, upper is a min heap and lower
+// has the same number of values or one more. New value replaces the oldest one in its heap and
+// only one swap of the roots is needed to restore order between heaps, so update is O(log n).
+template <typename T>
+class RollingMedian : public RollingWindow<T>
 {
 
 private:
-    std::multiset<T> dataset;
-    std::deque<T> deque;
+    enum
+    {
+        LOWER = 0,
+        UPPER = 1
+    };
+
+    std::vector<int> heaps[2];
+    int heap_sizes[2];
+    // heap and position in heap of each slot of the circular buffer
+    std::vector<int> slot_heaps;
+    std::vector<int> slot_positions;
+
+    bool is_before (int heap, int first_slot, int second_slot)
+    {
+        if (heap == LOWER)
+        {
+            return this->values[first_slot] > this->values[second_slot];
+        }
+        return this->values[first_slot] < this->values[second_slot];
+    }
+
+    void set_slot (int heap, int pos, int slot)
+    {
+        heaps[heap][pos] = slot;
+        slot_heaps[slot] = heap;
+        slot_positions[slot] = pos;
+    }
+
+    void sift_up (int heap, int pos)
+    {
+        int slot = heaps[heap][pos];
+        while (pos > 0)
+        {
+            int parent = (pos - 1) / 2;
+            if (!is_before (heap, slot, heaps[heap][parent]))
+            {
+                break;
+            }
+            set_slot (heap, pos, heaps[heap][parent]);
+            pos = parent;
+        }
+        set_slot (heap, pos, slot);
+    }
+
+    void sift_down (int heap, int pos)
+    {
+        int slot = heaps[heap][pos];
+        while (true)
+        {
+            int child = 2 * pos + 1;
+            if (child >= heap_sizes[heap])
+            {
+                break;
+            }
+            if ((child + 1 < heap_sizes[heap]) &&
+                (is_before (heap, heaps[heap][child + 1], heaps[heap][child])))
+            {
+                child++;
+            }
+            if (!is_before (heap, heaps[heap][child], slot))
+            {
+                break;
+            }
+            set_slot (heap, pos, heaps[heap][child]);
+            pos = child;
+        }
+        set_slot (heap, pos, slot);
+    }
+
+    void push_slot (int heap, int slot)
+    {
+        heaps[heap][heap_sizes[heap]] = slot;
+        sift_up (heap, heap_sizes[heap]++);
+    }
+
+    int pop_root (int heap)
+    {
+        int root = heaps[heap][0];
+        heap_sizes[heap]--;
+        if (heap_sizes[heap] > 0)
+        {
+            heaps[heap][0] = heaps[heap][heap_sizes[heap]];
+            sift_down (heap, 0);
+        }
+        return root;
+    }
+
+    void insert_slot (int slot)
+    {
+        if ((heap_sizes[LOWER] == 0) || (this->values[slot] <= this->values[heaps[LOWER][0]]))
+        {
+            push_slot (LOWER, slot);
+        }
+        else
+        {
+            push_slot (UPPER, slot);
+        }
+        if (heap_sizes[LOWER] > heap_sizes[UPPER] + 1)
+        {
+            push_slot (UPPER, pop_root (LOWER));
+        }
+        else if (heap_sizes[UPPER] > heap_sizes[LOWER])
+        {
+            push_slot (LOWER, pop_root (UPPER));
+        }
+    }
+
+    void update_slot (int slot)
+    {
+        int heap = slot_heaps[slot];
+        sift_up (heap, slot_positions[slot]);
+        sift_down (heap, slot_positions[slot]);
+        if ((heap_sizes[UPPER] > 0) &&
+            (this->values[heaps[LOWER][0]] > this->values[heaps[UPPER][0]]))
+        {
+            int lower_root = heaps[LOWER][0];
+            set_slot (LOWER, 0, heaps[UPPER][0]);
+            set_slot (UPPER, 0, lower_root);
+            sift_down (LOWER, 0);
+            sift_down (UPPER, 0);
+        }
+    }
 
 public:
-    RollingMedian (int period) : RollingFilter<T> (period)
+    RollingMedian (int period)
+        : RollingWindow<T> (period), slot_heaps (period), slot_positions (period)
     {
+        heaps[LOWER].resize (period);
+        heaps[UPPER].resize (period);
+        heap_sizes[LOWER] = 0;
+        heap_sizes[UPPER] = 0;
     }
 
     void add_data (T num)
     {
-        this->deque.push_back (num);
-        this->dataset.insert (num);
+        int slot = this->next;
+        T oldest;
+        if (this->push (num, oldest))
+        {
+            update_slot (slot);
+        }
+        else
+        {
+            insert_slot (slot);
+        }
     }
 
-    // https://leetcode.com/problems/sliding-window-median/
     T get_value ()
     {
-        if ((int)this->dataset.size () < this->period)
+        if (this->count < this->period)
         {
             // to simplify algorithm if there are less data just return the last value
-            return this->deque.back ();
-        }
-        auto it1 = this->dataset.begin ();
-        auto it2 = it1;
-        std::advance (it1, (this->period - 1) / 2);
-        it2 = it1;
-        std::advance (it2, (int)((this->period & 1) == 0));
-        T res = (*it1 + *it2) / 2.0;
-        T val = deque.front ();
-        deque.pop_front ();
-        this->dataset.erase (this->dataset.find (val));
-        return res;
+            int last = (this->next == 0) ? this->period - 1 : this->next - 1;
+            return this->values[last];
+        }
+        T lower = this->values[heaps[LOWER][0]];
+        T upper = (heap_sizes[UPPER] == heap_sizes[LOWER]) ? this->values[heaps[UPPER][0]] : lower;
+        return (lower + upper) / 2.0;
     }
 };
 
 template <typename T>
-class RollingAverage : public RollingFilter<T>
+class RollingAverage : public RollingWindow<T>
 {
 
 private:
-    std::deque<T> dataset;
     T sum;
 
 public:
-    RollingAverage (int period) : RollingFilter<T> (period)
+    RollingAverage (int period) : RollingWindow<T> (period)
     {
         this->sum = 0;
     }
 
     void add_data (T num)
     {
+        T oldest;
         this->sum += num;
-        this->dataset.push_back (num);
-        if ((int)this->dataset.size () > this->period)
+        if (this->push (num, oldest))
         {
-            this->sum -= this->dataset.front ();
-            this->dataset.pop_front ();
+            this->sum -= oldest;
         }
     }
 
     T get_value ()
     {
-        if ((int)this->dataset.size () < this->period)
+        return this->sum / this->count;
+    }
+};
+
+// population stddev, sliding Welford update, sums are recomputed once per period to drop
+// accumulated rounding errors
+template <typename T>
+class RollingStddev : public RollingWindow<T>
+{
+
+private:
+    T mean;
+    T m2;
+
+public:
+    RollingStddev (int period) : RollingWindow<T> (period)
+    {
+        mean = 0;
+        m2 = 0;
+    }
+
+    void add_data (T num)
+    {
+        T oldest;
+        if (this->push (num, oldest))
         {
-            return this->sum / this->dataset.size ();
+            T old_mean = mean;
+            mean += (num - oldest) / this->period;
+            m2 += (num - oldest) * (num - mean + oldest - old_mean);
         }
         else
         {
-            return this->sum / this->period;
+            T delta = num - mean;
+            mean += delta / this->count;
+            m2 += delta * (num - mean);
+        }
+        if (this->next == 0)
+        {
+            mean = 0;
+            for (int i = 0; i < this->count; i++)
+            {
+                mean += this->values[i];
+            }
+            mean /= this->count;
+            m2 = 0;
+            for (int i = 0; i < this->count; i++)
+            {
+                m2 += (this->values[i] - mean) * (this->values[i] - mean);
+            }
+        }
+    }
+
+    T get_value ()
+    {
+        return (m2 > 0) ? sqrt (m2 / this->count) : 0;
+    }
+
+    T get_mean ()
+    {
+        return mean;
+    }
+};
+
+template <typename T>
+class RollingRms : public RollingWindow<T>
+{
+
+private:
+    T sum_squares;
+
+public:
+    RollingRms (int period) : RollingWindow<T> (period)
+    {
+        sum_squares = 0;
+    }
+
+    void add_data (T num)
+    {
+        T oldest;
+        sum_squares += num * num;
+        if (this->push (num, oldest))
+        {
+            sum_squares -= oldest * oldest;
+        }
+        if (this->next == 0)
+        {
+            sum_squares = 0;
+            for (int i = 0; i < this->count; i++)
+            {
+                sum_squares += this->values[i] * this->values[i];
+            }
         }
     }
+
+    T get_value ()
+    {
+        return (sum_squares > 0) ? sqrt (sum_squares / this->count) : 0;
+    }
 };
+
+// Monotonic queue of candidates in a circular buffer, Compare is std::less for min and
+// std::greater for max. Each value is added and removed once, so update is amortized O(1).
+template <typename T, typename Compare>
+class RollingExtremum : public RollingFilter<T>
+{
+
+private:
+    std::vector<T> candidates;
+    std::vector<long long> candidate_ids;
+    int head;
+    int size;
+    long long num_added;
+    Compare compare;
+
+    int index (int pos)
+    {
+        pos += head;
+        return (pos >= this->period) ? pos - this->period : pos;
+    }
+
+public:
+    RollingExtremum (int period)
+        : RollingFilter<T> (period), candidates (period), candidate_ids (period)
+    {
+        head = 0;
+        size = 0;
+        num_added = 0;
+    }
+
+    void add_data (T num)
+    {
+        while ((size > 0) && (!compare (candidates[index (size - 1)], num)))
+        {
+            size--;
+        }
+        if ((size > 0) && (candidate_ids[head] <= num_added - this->period))
+        {
+            head = index (1);
+            size--;
+        }
+        candidates[index (size)] = num;
+        candidate_ids[index (size)] = num_added;
+        size++;
+        num_added++;
+    }
+
+    T get_value ()
+    {
+        return candidates[head];
+    }
+};
+
+template <typename T>
+using RollingMin = RollingExtremum<T, std::less<T>>;
+
+template <typename T>
+using RollingMax = RollingExtremum<T, std::greater<T>>;
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+
+#include "wavelib.h"
+
+
+// Wavelib wave and transform objects for fixed (wavelet, data_len, decomposition_level,
+// extension), so repeated transforms of epochs and channels dont parse filters and allocate
+// output buffers each time. Convolution is direct, for filters of supported wavelets (up to 30
+// taps) fft convolution of wavelib is slower. Not thread safe, use get_wavelet_plan to get a plan
+// owned by the calling thread.
+class WaveletPlan
+{
+public:
+    // throws std::runtime_error from wavelib if data_len is too small for this level
+    WaveletPlan (int wavelet, int data_len, int decomposition_level, int extension);
+    ~WaveletPlan ();
+
+    WaveletPlan (const WaveletPlan &) = delete;
+    WaveletPlan &operator= (const WaveletPlan &) = delete;
+
+    // the same output as perform_wavelet_transform, returns total number of coeffs
+    int perform_wavelet_transform (
+        const double *data, double *output_data, int *decomposition_lengths);
+    void perform_inverse_wavelet_transform (
+        const double *wavelet_coeffs, const int *decomposition_lengths, double *output_data);
+    // denoises data_len points of data inplace, params are values of brainflow enums
+    void perform_wavelet_denoising (
+        double *data, int wavelet_denoising, int threshold, int noise_level);
+
+private:
+    int decomposition_level;
+    wave_object obj;
+    wt_object wt;
+    std::vector<double> denoised;
+};
+
+// Returns plan from a cache of the calling thread, NULL if wavelet or extension are unknown, throws
+// like WaveletPlan constructor. Pointer is valid until the next call of get_wavelet_plan in the
+// same thread.
+WaveletPlan *get_wavelet_plan (int wavelet, int data_len, int decomposition_level, int extension);
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <vector>
 
+#include "brainflow_constants.h"
+
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
@@ -40,3 +42,119 @@ inline void blackman_harris_function (int window_len, double *wind)
             0.012604 * cos (6.0 * M_PI * i / window_len);
     }
 }
+
+// alpha is a fraction of the window inside cosine tapered parts, 0 is rectangular, 1 is hanning
+inline void tukey_function (int window_len, double alpha, double *wind)
+{
+    for (int i = 0; i < window_len; i++)
+    {
+        double x = (double)i / window_len;
+        if (x < alpha / 2)
+        {
+            wind[i] = 0.5 - 0.5 * cos (2.0 * M_PI * x / alpha);
+        }
+        else if (x > 1.0 - alpha / 2)
+        {
+            wind[i] = 0.5 - 0.5 * cos (2.0 * M_PI * (1.0 - x) / alpha);
+        }
+        else
+        {
+            wind[i] = 1.0;
+        }
+    }
+}
+
+// zeroth order modified bessel function of the first kind
+inline double bessel_i0 (double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    double quarter_x2 = x * x / 4.0;
+    for (int k = 1; k < 500; k++)
+    {
+        term *= quarter_x2 / ((double)k * k);
+        sum += term;
+        if (term < sum * 1e-17)
+        {
+            break;
+        }
+    }
+    return sum;
+}
+
+// bigger beta gives lower sidelobes and wider main lobe
+inline void kaiser_function (int window_len, double beta, double *wind)
+{
+    double norm = bessel_i0 (beta);
+    for (int i = 0; i < window_len; i++)
+    {
+        double x = 2.0 * i / window_len - 1.0;
+        wind[i] = bessel_i0 (beta * sqrt (std::max (0.0, 1.0 - x * x))) / norm;
+    }
+}
+
+// ISO 18431-2 coefficients, for amplitude measurements
+inline void flat_top_function (int window_len, double *wind)
+{
+    for (int i = 0; i < window_len; i++)
+    {
+        wind[i] = 0.21557895 - 0.41663158 * cos (2.0 * M_PI * i / window_len) +
+            0.277263158 * cos (4.0 * M_PI * i / window_len) -
+            0.083578947 * cos (6.0 * M_PI * i / window_len) +
+            0.006947368 * cos (8.0 * M_PI * i / window_len);
+    }
+}
+
+#define DEFAULT_TUKEY_ALPHA 0.5
+#define DEFAULT_KAISER_BETA 8.6
+
+// from https://www.edn.com/windowing-functions-improve-fft-results-part-i/
+// param is alpha for tukey and beta for kaiser, negative value means default, ignored by others
+// returns false if window function is unknown
+inline bool fill_window (int window_function, int window_len, double *wind, double param = -1.0)
+{
+    switch (static_cast<WindowOperations> (window_function))
+    {
+        case WindowOperations::NO_WINDOW:
+            no_window_function (window_len, wind);
+            return true;
+        case WindowOperations::HAMMING:
+            hamming_function (window_len, wind);
+            return true;
+        case WindowOperations::HANNING:
+            hanning_function (window_len, wind);
+            return true;
+        case WindowOperations::BLACKMAN_HARRIS:
+            blackman_harris_function (window_len, wind);
+            return true;
+        case WindowOperations::TUKEY:
+            if (param > 1.0)
+            {
+                return false;
+            }
+            tukey_function (window_len, (param < 0) ? DEFAULT_TUKEY_ALPHA : param, wind);
+            return true;
+        case WindowOperations::KAISER:
+            kaiser_function (window_len, (param < 0) ? DEFAULT_KAISER_BETA : param, wind);
+            return true;
+        case WindowOperations::FLAT_TOP:
+            flat_top_function (window_len, wind);
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Returns window from a cache of the calling thread, NULL if params are invalid. Pointer is valid
+// until the next call of get_window_table in the same thread.
+const std::vector<double> *get_window_table (
+    int window_function, int window_len, double param = -1.0);
+
+// Discrete prolate spheroidal sequences with time half bandwidth product nw, tapers are in rows of
+// tapers with unit energy, first taper has the best concentration. Returns false if params are
+// invalid.
+bool fill_dpss_tapers (int window_len, double nw, int num_tapers, double *tapers);
+
+// Same as fill_dpss_tapers with a cache of the calling thread, tapers are stored row by row.
+// Pointer is valid until the next call of get_dpss_table in the same thread.
+const std::vector<double> *get_dpss_table (int window_len, double nw, int num_tapers);
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector>
+
+#include "rolling_filter.h"
+
+
+// Smoothed z-score peak detection (https://stackoverflow.com/a/22640362) which keeps its state
+// between calls, so new data can be processed as it arrives. Mean and stddev of the lag window are
+// updated in O(1) per sample, output is the same as detect_peaks_z_score over all data at once.
+class ZScorePeakDetector
+{
+public:
+    ZScorePeakDetector (int lag, double threshold, double influence);
+
+    // output is 1 for positive peaks, -1 for negative peaks and 0 otherwise, first lag samples are
+    // always 0
+    void process (const double *data, int data_len, double *output);
+
+private:
+    int lag;
+    double threshold;
+    double influence;
+    long long num_processed;
+    // filtered values of two previous samples, pending enters the window on the next sample
+    double last_filtered;
+    double pending;
+    RollingStddev<double> window;
+    std::vector<double> window_copy;
+
+    double process_sample (double value);
+};
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "bounded_cache.h"
+#include "wauxlib.h"
+#include "wavelet_helpers.h"
+#include "wavelet_plan.h"
+
+// plans of a thread, the same limit as for fft plans
+#define MAX_CACHED_PLANS 16
+
+
+WaveletPlan::WaveletPlan (int wavelet, int data_len, int decomposition_level, int extension)
+{
+    this->decomposition_level = decomposition_level;
+    obj = wave_init (get_wavelet_name (wavelet).c_str ());
+    try
+    {
+        wt = wt_init (obj, "dwt", data_len, decomposition_level);
+    }
+    catch (...)
+    {
+        wave_free (obj);
+        throw;
+    }
+    setDWTExtension (wt, get_extension_type (extension).c_str ());
+    setWTConv (wt, "direct");
+    denoised.resize (data_len);
+}
+
+WaveletPlan::~WaveletPlan ()
+{
+    wt_free (wt);
+    wave_free (obj);
+}
+
+int WaveletPlan::perform_wavelet_transform (
+    const double *data, double *output_data, int *decomposition_lengths)
+{
+    dwt (wt, data);
+    std::copy (wt->output, wt->output + wt->outlength, output_data);
+    std::copy (wt->length, wt->length + decomposition_level + 1, decomposition_lengths);
+    return wt->outlength;
+}
+
+// inside wavelib inverse transform uses internal state from direct transform, restore it here
+void WaveletPlan::perform_inverse_wavelet_transform (
+    const double *wavelet_coeffs, const int *decomposition_lengths, double *output_data)
+{
+    int total_len = 0;
+    for (int i = 0; i < decomposition_level + 1; i++)
+    {
+        wt->length[i] = decomposition_lengths[i];
+        total_len += decomposition_lengths[i];
+    }
+    std::copy (wavelet_coeffs, wavelet_coeffs + total_len, wt->output);
+    idwt (wt, output_data);
+}
+
+void WaveletPlan::perform_wavelet_denoising (
+    double *data, int wavelet_denoising, int threshold, int noise_level)
+{
+    std::string threshold_str = get_threshold_type (threshold);
+    std::string noise_str = get_noise_estimation_type (noise_level);
+    if (wavelet_denoising == (int)WaveletDenoisingTypes::VISUSHRINK)
+    {
+        visushrink_wt (wt, data, threshold_str.c_str (), noise_str.c_str (), denoised.data ());
+    }
+    else if (wavelet_denoising == (int)WaveletDenoisingTypes::SURESHRINK)
+    {
+        sureshrink_wt (wt, data, threshold_str.c_str (), noise_str.c_str (), denoised.data ());
+    }
+    else
+    {
+        throw std::runtime_error ("unsupported denoising method");
+    }
+    std::copy (denoised.begin (), denoised.end (), data);
+}
+
+WaveletPlan *get_wavelet_plan (int wavelet, int data_len, int decomposition_level, int extension)
+{
+    if ((get_wavelet_name (wavelet).empty ()) || (get_extension_type (extension).empty ()) ||
+        (data_len <= 0) || (decomposition_level <= 0))
+    {
+        return NULL;
+    }
+    thread_local BoundedCache<std::tuple<int, int, int, int>, std::unique_ptr<WaveletPlan>> plans (
+        MAX_CACHED_PLANS);
+    std::tuple<int, int, int, int> key (wavelet, data_len, decomposition_level, extension);
+    const std::unique_ptr<WaveletPlan> *cached = plans.get (key);
+    if (cached != NULL)
+    {
+        return cached->get ();
+    }
+    std::unique_ptr<WaveletPlan> plan (
+        new WaveletPlan (wavelet, data_len, decomposition_level, extension));
+    return plans.insert (key, std::move (plan)).get ();
+}
@@ -0,0 +1,256 @@
+#include <math.h>
+#include <memory>
+#include <tuple>
+
+#include "bounded_cache.h"
+#include "window_functions.h"
+
+// tables of a thread, typical app uses one or two sizes
+#define MAX_CACHED_TABLES 16
+
+
+const std::vector<double> *get_window_table (int window_function, int window_len, double param)
+{
+    if (window_len <= 0)
+    {
+        return NULL;
+    }
+    thread_local BoundedCache<std::tuple<int, int, double>, std::unique_ptr<std::vector<double>>>
+        tables (MAX_CACHED_TABLES);
+    std::tuple<int, int, double> key (window_function, window_len, param);
+    const std::unique_ptr<std::vector<double>> *cached = tables.get (key);
+    if (cached != NULL)
+    {
+        return cached->get ();
+    }
+    std::unique_ptr<std::vector<double>> table (new std::vector<double> (window_len));
+    if (!fill_window (window_function, window_len, table->data (), param))
+    {
+        return NULL;
+    }
+    return tables.insert (key, std::move (table)).get ();
+}
+
+// Tapers are eigenvectors of a symmetric tridiagonal matrix with the largest eigenvalues, see
+// Percival and Walden, Spectral Analysis for Physical Applications, 8.3. Eigenvalues are found by
+// bisection and eigenvectors by inverse iteration, it's O(window_len) per taper.
+
+// number of eigenvalues of tridiagonal matrix less than x, from signs of LDL^T pivots
+static int count_eigenvalues_less (
+    const std::vector<double> &diag, const std::vector<double> &off_diag, double x)
+{
+    int count = 0;
+    double q = diag[0] - x;
+    for (size_t i = 0;; i++)
+    {
+        if (q == 0.0)
+        {
+            q = -1e-300;
+        }
+        if (q < 0)
+        {
+            count++;
+        }
+        if (i + 1 == diag.size ())
+        {
+            break;
+        }
+        q = diag[i + 1] - x - off_diag[i] * off_diag[i] / q;
+    }
+    return count;
+}
+
+// solves (T - shift * I) x = b in place, Gaussian elimination with partial pivoting for
+// tridiagonal matrices, the same as LAPACK dgttrf + dgtts2
+static void solve_shifted_tridiagonal (const std::vector<double> &diag,
+    const std::vector<double> &off_diag, double shift, std::vector<double> &x)
+{
+    int n = (int)diag.size ();
+    std::vector<double> d (n);
+    std::vector<double> dl (off_diag);
+    std::vector<double> du (off_diag);
+    std::vector<double> du2 (n, 0.0);
+    std::vector<bool> swapped (n, false);
+    double tiny = 1e-14 * (fabs (diag[0]) + fabs (diag[n - 1]) + fabs (off_diag[n / 2 - 1]) + 1);
+    for (int i = 0; i < n; i++)
+    {
+        d[i] = diag[i] - shift;
+    }
+    for (int i = 0; i < n - 1; i++)
+    {
+        if (fabs (d[i]) >= fabs (dl[i]))
+        {
+            if (d[i] == 0.0)
+            {
+                d[i] = tiny;
+            }
+            double fact = dl[i] / d[i];
+            dl[i] = fact;
+            d[i + 1] -= fact * du[i];
+        }
+        else
+        {
+            double fact = d[i] / dl[i];
+            d[i] = dl[i];
+            dl[i] = fact;
+            double temp = du[i];
+            du[i] = d[i + 1];
+            d[i + 1] = temp - fact * d[i + 1];
+            if (i < n - 2)
+            {
+                du2[i] = du[i + 1];
+                du[i + 1] = -fact * du[i + 1];
+            }
+            swapped[i] = true;
+        }
+    }
+    if (d[n - 1] == 0.0)
+    {
+        d[n - 1] = tiny;
+    }
+
+    for (int i = 0; i < n - 1; i++)
+    {
+        if (swapped[i])
+        {
+            double temp = x[i];
+            x[i] = x[i + 1];
+            x[i + 1] = temp - dl[i] * x[i];
+        }
+        else
+        {
+            x[i + 1] -= dl[i] * x[i];
+        }
+    }
+    x[n - 1] /= d[n - 1];
+    x[n - 2] = (x[n - 2] - du[n - 2] * x[n - 1]) / d[n - 2];
+    for (int i = n - 3; i >= 0; i--)
+    {
+        x[i] = (x[i] - du[i] * x[i + 1] - du2[i] * x[i + 2]) / d[i];
+    }
+}
+
+bool fill_dpss_tapers (int window_len, double nw, int num_tapers, double *tapers)
+{
+    if ((window_len < 2) || (num_tapers < 1) || (num_tapers > window_len) || (nw <= 0) ||
+        (nw >= window_len / 2.0) || (tapers == NULL))
+    {
+        return false;
+    }
+    double w = nw / window_len;
+    std::vector<double> diag (window_len);
+    std::vector<double> off_diag (window_len - 1);
+    for (int i = 0; i < window_len; i++)
+    {
+        double t = (window_len - 1 - 2.0 * i) / 2.0;
+        diag[i] = t * t * cos (2.0 * M_PI * w);
+    }
+    for (int i = 1; i < window_len; i++)
+    {
+        off_diag[i - 1] = i * (window_len - i) / 2.0;
+    }
+    // Gershgorin bounds for bisection
+    double lower = diag[0];
+    double upper = diag[0];
+    for (int i = 0; i < window_len; i++)
+    {
+        double radius = ((i > 0) ? off_diag[i - 1] : 0) + ((i < window_len - 1) ? off_diag[i] : 0);
+        lower = std::min (lower, diag[i] - radius);
+        upper = std::max (upper, diag[i] + radius);
+    }
+
+    std::vector<double> x (window_len);
+    for (int k = 0; k < num_tapers; k++)
+    {
+        // k-th largest eigenvalue
+        int index = window_len - 1 - k;
+        double lo = lower;
+        double hi = upper;
+        for (int iter = 0; (iter < 200) && (hi - lo > 1e-15 * std::max (fabs (lo), fabs (hi)));
+             iter++)
+        {
+            double mid = 0.5 * (lo + hi);
+            if (count_eigenvalues_less (diag, off_diag, mid) > index)
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid;
+            }
+        }
+        double eigenvalue = 0.5 * (lo + hi);
+
+        for (int i = 0; i < window_len; i++)
+        {
+            x[i] = 1.0 + (double)i / window_len;
+        }
+        for (int iter = 0; iter < 3; iter++)
+        {
+            solve_shifted_tridiagonal (diag, off_diag, eigenvalue, x);
+            double norm = 0;
+            for (int i = 0; i < window_len; i++)
+            {
+                norm += x[i] * x[i];
+            }
+            norm = sqrt (norm);
+            for (int i = 0; i < window_len; i++)
+            {
+                x[i] /= norm;
+            }
+        }
+
+        // the same sign convention as in scipy: symmetric tapers have positive sum,
+        // antisymmetric tapers start with positive lobe
+        bool flip = false;
+        if (k % 2 == 0)
+        {
+            double sum = 0;
+            for (int i = 0; i < window_len; i++)
+            {
+                sum += x[i];
+            }
+            flip = sum < 0;
+        }
+        else
+        {
+            double thresh = std::max (1e-7, 1.0 / window_len);
+            for (int i = 0; i < window_len; i++)
+            {
+                if (x[i] * x[i] > thresh)
+                {
+                    flip = x[i] < 0;
+                    break;
+                }
+            }
+        }
+        for (int i = 0; i < window_len; i++)
+        {
+            tapers[k * window_len + i] = flip ? -x[i] : x[i];
+        }
+    }
+    return true;
+}
+
+const std::vector<double> *get_dpss_table (int window_len, double nw, int num_tapers)
+{
+    thread_local BoundedCache<std::tuple<int, double, int>, std::unique_ptr<std::vector<double>>>
+        tables (MAX_CACHED_TABLES);
+    std::tuple<int, double, int> key (window_len, nw, num_tapers);
+    const std::unique_ptr<std::vector<double>> *cached = tables.get (key);
+    if (cached != NULL)
+    {
+        return cached->get ();
+    }
+    if ((window_len < 2) || (num_tapers < 1) || (num_tapers > window_len))
+    {
+        return NULL;
+    }
+    std::unique_ptr<std::vector<double>> table (
+        new std::vector<double> ((size_t)window_len * num_tapers));
+    if (!fill_dpss_tapers (window_len, nw, num_tapers, table->data ()))
+    {
+        return NULL;
+    }
+    return tables.insert (key, std::move (table)).get ();
+}
@@ -0,0 +1,65 @@
+#include <math.h>
+
+#include "common_data_handler_helpers.h"
+#include "z_score_peak_detector.h"
+
+
+ZScorePeakDetector::ZScorePeakDetector (int lag, double threshold, double influence)
+    : window (lag), window_copy (lag)
+{
+    this->lag = lag;
+    this->threshold = threshold;
+    this->influence = influence;
+    num_processed = 0;
+    last_filtered = 0.0;
+    pending = 0.0;
+}
+
+void ZScorePeakDetector::process (const double *data, int data_len, double *output)
+{
+    for (int i = 0; i < data_len; i++)
+    {
+        output[i] = process_sample (data[i]);
+    }
+}
+
+// Sample i is compared with the window of filtered values [i - lag - 1, i - 2] ([0, lag - 1] for
+// i == lag), the same windows detect_peaks_z_score uses.
+double ZScorePeakDetector::process_sample (double value)
+{
+    long long pos = num_processed++;
+    if (pos < lag)
+    {
+        window.add_data (value);
+        pending = last_filtered;
+        last_filtered = value;
+        return 0.0;
+    }
+    if (pos > lag + 1)
+    {
+        window.add_data (pending);
+    }
+    double avg = window.get_mean ();
+    double std = window.get_value ();
+    double diff = fabs (value - avg);
+    // running sums differ from two pass mean and stddev in the last bits, recompute them if
+    // it can change the decision
+    double tolerance = 1e-9 * (fabs (value) + fabs (avg) + threshold * std);
+    if (fabs (diff - threshold * std) <= tolerance)
+    {
+        window.copy_values (window_copy.data ());
+        avg = mean (window_copy.data (), lag);
+        std = stddev (window_copy.data (), lag);
+        diff = fabs (value - avg);
+    }
+    double result = 0.0;
+    double filtered = value;
+    if (diff > threshold * std)
+    {
+        result = (value > avg) ? 1.0 : -1.0;
+        filtered = influence * value + (1 - influence) * last_filtered;
+    }
+    pending = last_filtered;
+    last_filtered = filtered;
+    return result;
+}
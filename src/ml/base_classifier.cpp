@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "base_classifier.h"
 #include "brainflow_constants.h"
 #include "spdlog/sinks/null_sink.h"
@@ -60,3 +62,59 @@ int BaseClassifier::set_log_file (const char *log_file)
     return (int)BrainFlowExitCodes::STATUS_OK;
 #endif
 }
+
+int BaseClassifier::predict_batch (
+    double *data, int batch_size, int data_len, double *output, int *output_len)
+{
+    if ((data == NULL) || (batch_size < 1) || (data_len < 1) || (output == NULL) ||
+        (output_len == NULL))
+    {
+        safe_logger (spdlog::level::err, "invalid input arguments");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int row_output_len = 0;
+    for (int i = 0; i < batch_size; i++)
+    {
+        int len = 0;
+        int res = predict (data + (size_t)i * data_len, data_len,
+            output + (size_t)i * row_output_len, &len);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+        // rows are packed, all of them have the same output size
+        if ((i > 0) && (len != row_output_len))
+        {
+            safe_logger (spdlog::level::err, "output size differs for rows of the batch");
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        row_output_len = len;
+    }
+    *output_len = row_output_len * batch_size;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BaseClassifier::predict_multi (const void *data, bool is_float32, int batch_size,
+    const int *input_lens, int num_inputs, double *output, int *output_lens, int num_outputs)
+{
+    if ((data == NULL) || (batch_size < 1) || (input_lens == NULL) || (output_lens == NULL))
+    {
+        safe_logger (spdlog::level::err, "invalid input arguments");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if ((num_inputs != 1) || (num_outputs != 1))
+    {
+        safe_logger (spdlog::level::err, "classifier supports one input and one output");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (!is_float32)
+    {
+        return predict_batch ((double *)data, batch_size, input_lens[0], output, output_lens);
+    }
+    std::vector<double> double_data ((size_t)batch_size * input_lens[0]);
+    for (size_t i = 0; i < double_data.size (); i++)
+    {
+        double_data[i] = (double)((const float *)data)[i];
+    }
+    return predict_batch (double_data.data (), batch_size, input_lens[0], output, output_lens);
+}
@@ -23,11 +23,21 @@ int DynLibClassifier::prepare ()
     }
     int (*func) (void *, struct BrainFlowModelParams *) =
         (int (*) (void *, struct BrainFlowModelParams *))dll_loader->get_address ("prepare");
-    if (func == NULL)
+    // symbols are resolved once, predict is called much more often than prepare
+    predict_func = (int (*) (double *, int, double *, int *,
+        struct BrainFlowModelParams *))dll_loader->get_address ("predict");
+    release_func = (int (*) (struct BrainFlowModelParams *))dll_loader->get_address ("release");
+    // optional
+    predict_batch_func = (int (*) (double *, int, int, double *, int *,
+        struct BrainFlowModelParams *))dll_loader->get_address ("predict_batch");
+    if ((func == NULL) || (predict_func == NULL))
     {
-        safe_logger (spdlog::level::err, "failed to get function address for prepare");
+        safe_logger (spdlog::level::err, "failed to get function address for prepare or predict");
         delete dll_loader;
         dll_loader = NULL;
+        predict_func = NULL;
+        release_func = NULL;
+        predict_batch_func = NULL;
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
     return func ((void *)this, &params);
@@ -35,19 +45,25 @@ int DynLibClassifier::prepare ()
 
 int DynLibClassifier::predict (double *data, int data_len, double *output, int *output_len)
 {
-    if (dll_loader == NULL)
+    if (predict_func == NULL)
+    {
+        return (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
+    }
+    return predict_func (data, data_len, output, output_len, &params);
+}
+
+int DynLibClassifier::predict_batch (
+    double *data, int batch_size, int data_len, double *output, int *output_len)
+{
+    if (predict_func == NULL)
     {
         return (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
     }
-    int (*func) (double *, int, double *, int *, struct BrainFlowModelParams *) =
-        (int (*) (double *, int, double *, int *,
-            struct BrainFlowModelParams *))dll_loader->get_address ("predict");
-    if (func == NULL)
+    if (predict_batch_func == NULL)
     {
-        safe_logger (spdlog::level::err, "failed to get function address for predict");
-        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        return BaseClassifier::predict_batch (data, batch_size, data_len, output, output_len);
     }
-    return func (data, data_len, output, output_len, &params);
+    return predict_batch_func (data, batch_size, data_len, output, output_len, &params);
 }
 
 int DynLibClassifier::release ()
@@ -58,18 +74,19 @@ int DynLibClassifier::release ()
     }
 
     int res = (int)BrainFlowExitCodes::STATUS_OK;
-    int (*func) (struct BrainFlowModelParams *) =
-        (int (*) (struct BrainFlowModelParams *))dll_loader->get_address ("release");
-    if (func == NULL)
+    if (release_func == NULL)
     {
         safe_logger (spdlog::level::err, "failed to get function address for release");
         res = (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
     else
     {
-        res = func (&params);
+        res = release_func (&params);
     }
 
+    predict_func = NULL;
+    predict_batch_func = NULL;
+    release_func = NULL;
     dll_loader->free_library ();
     delete dll_loader;
     dll_loader = NULL;
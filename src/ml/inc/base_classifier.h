@@ -47,5 +47,20 @@ public:
 
     virtual int prepare () = 0;
     virtual int predict (double *data, int data_len, double *output, int *output_len) = 0;
+    // data is batch_size rows of data_len, output has room for batch_size * max_array_size values,
+    // output_len is a total number of values, default implementation calls predict for each row
+    virtual int predict_batch (
+        double *data, int batch_size, int data_len, double *output, int *output_len);
+    // data holds num_inputs inputs one after another, input i is batch_size rows of input_lens[i]
+    // values of double or float. Outputs are written one after another, output_lens[i] is a size
+    // of output i. Default implementation supports one input and one output
+    virtual int predict_multi (const void *data, bool is_float32, int batch_size,
+        const int *input_lens, int num_inputs, double *output, int *output_lens, int num_outputs);
     virtual int release () = 0;
+
+    // true if predict can be called from several threads at the same time
+    virtual bool is_thread_safe ()
+    {
+        return false;
+    }
 };
@@ -13,6 +13,16 @@ struct BrainFlowModelParams
     std::string other_info;
     std::string output_name;
     int max_array_size;
+    // onnx runtime session tuning, 0 threads means onnx runtime default, inter op threads > 1
+    // enable parallel execution mode
+    int intra_op_num_threads;
+    int inter_op_num_threads;
+    int graph_optimization_level;
+    // share one process wide thread pool between onnx sessions instead of pool per session
+    bool use_global_thread_pool;
+    // optimized model is saved here and loaded instead of file while it's newer than file and
+    // was made with the same session settings, settings are kept in a file with .settings suffix
+    std::string optimized_model_file;
 
     BrainFlowModelParams (int metric, int classifier)
     {
@@ -22,13 +32,22 @@ struct BrainFlowModelParams
         other_info = "";
         output_name = "";
         max_array_size = 8192;
+        intra_op_num_threads = 0;
+        inter_op_num_threads = 0;
+        graph_optimization_level = 99; // ORT_ENABLE_ALL
+        use_global_thread_pool = false;
+        optimized_model_file = "";
     }
 
     // default copy constructor and assignment operator are ok, need less operator to use in map
     bool operator< (const struct BrainFlowModelParams &other) const
     {
-        return std::tie (metric, classifier, file, other_info, output_name, max_array_size) <
-            std::tie (other.metric, other.classifier, other.file, other.other_info, output_name,
-                max_array_size);
+        return std::tie (metric, classifier, file, other_info, output_name, max_array_size,
+                   intra_op_num_threads, inter_op_num_threads, graph_optimization_level,
+                   use_global_thread_pool, optimized_model_file) <
+            std::tie (other.metric, other.classifier, other.file, other.other_info,
+                other.output_name, other.max_array_size, other.intra_op_num_threads,
+                other.inter_op_num_threads, other.graph_optimization_level,
+                other.use_global_thread_pool, other.optimized_model_file);
     }
 };
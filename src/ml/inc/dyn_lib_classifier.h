@@ -12,6 +12,9 @@ public:
     DynLibClassifier (struct BrainFlowModelParams params) : BaseClassifier (params)
     {
         dll_loader = NULL;
+        predict_func = NULL;
+        predict_batch_func = NULL;
+        release_func = NULL;
     }
 
     virtual ~DynLibClassifier ()
@@ -22,6 +25,9 @@ public:
 
     virtual int prepare ();
     virtual int predict (double *data, int data_len, double *output, int *output_len);
+    // uses predict_batch of the library if it's exported, predict for each row otherwise
+    virtual int predict_batch (
+        double *data, int batch_size, int data_len, double *output, int *output_len);
     virtual int release ();
 
 protected:
@@ -31,4 +37,7 @@ protected:
     }
 
     DLLLoader *dll_loader;
+    int (*predict_func) (double *, int, double *, int *, struct BrainFlowModelParams *);
+    int (*predict_batch_func) (double *, int, int, double *, int *, struct BrainFlowModelParams *);
+    int (*release_func) (struct BrainFlowModelParams *);
 };
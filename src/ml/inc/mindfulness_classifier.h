@@ -19,4 +19,9 @@ public:
     virtual int prepare ();
     virtual int predict (double *data, int data_len, double *output, int *output_len);
     virtual int release ();
+
+    virtual bool is_thread_safe ()
+    {
+        return true;
+    }
 };
\ No newline at end of file
@@ -1,5 +1,18 @@
 #pragma once
 
+#include <math.h>
+
 
 extern const double mindfulness_coefficients[5];
-extern double mindfulness_intercept;
\ No newline at end of file
+extern double mindfulness_intercept;
+
+// logistic regression over avg band powers of 5 default bands
+inline double calc_mindfulness (const double *avg_band_powers)
+{
+    double value = 0.0;
+    for (int i = 0; i < 5; i++)
+    {
+        value += mindfulness_coefficients[i] * avg_band_powers[i];
+    }
+    return 1.0 / (1.0 + exp (-1.0 * (mindfulness_intercept + value)));
+}
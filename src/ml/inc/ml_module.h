@@ -9,9 +9,31 @@ extern "C"
     SHARED_EXPORT int CALLING_CONVENTION prepare (const char *json_params);
     SHARED_EXPORT int CALLING_CONVENTION predict (
         double *data, int data_len, double *output, int *output_len, const char *json_params);
+    // data is batch_size rows of data_len, output should have room for batch_size * max_array_size
+    SHARED_EXPORT int CALLING_CONVENTION predict_batch (double *data, int batch_size, int data_len,
+        double *output, int *output_len, const char *json_params);
+    // data holds num_inputs inputs one after another, input i is batch_size rows of input_lens[i],
+    // outputs are written one after another, output_lens[i] is a size of output i
+    SHARED_EXPORT int CALLING_CONVENTION predict_multi (double *data, int batch_size,
+        int *input_lens, int num_inputs, double *output, int *output_lens, int num_outputs,
+        const char *json_params);
+    // the same for float32 data, float onnx models use it without conversion
+    SHARED_EXPORT int CALLING_CONVENTION predict_multi_float32 (float *data, int batch_size,
+        int *input_lens, int num_inputs, double *output, int *output_lens, int num_outputs,
+        const char *json_params);
     SHARED_EXPORT int CALLING_CONVENTION release (const char *json_params);
     SHARED_EXPORT int CALLING_CONVENTION release_all ();
 
+    // handle skips json parsing and models lookup, it stays valid until release_with_handle, calls
+    // with handle of model released by other methods return CLASSIFIER_IS_NOT_PREPARED_ERROR
+    SHARED_EXPORT int CALLING_CONVENTION prepare_with_handle (
+        const char *json_params, void **handle);
+    SHARED_EXPORT int CALLING_CONVENTION predict_with_handle (
+        void *handle, double *data, int data_len, double *output, int *output_len);
+    SHARED_EXPORT int CALLING_CONVENTION predict_batch_with_handle (
+        void *handle, double *data, int batch_size, int data_len, double *output, int *output_len);
+    SHARED_EXPORT int CALLING_CONVENTION release_with_handle (void *handle);
+
     // logging methods
     SHARED_EXPORT int CALLING_CONVENTION set_log_level_ml_module (int log_level);
     SHARED_EXPORT int CALLING_CONVENTION set_log_file_ml_module (const char *log_file);
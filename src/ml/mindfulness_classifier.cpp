@@ -20,13 +20,7 @@ int MindfulnessClassifier::predict (double *data, int data_len, double *output,
             "Incorrect arguments. Null pointers or invalid feature vector size.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    double value = 0.0;
-    for (int i = 0; i < std::min (data_len, 5); i++)
-    {
-        value += mindfulness_coefficients[i] * data[i];
-    }
-    double mindfulness = 1.0 / (1.0 + exp (-1.0 * (mindfulness_intercept + value)));
-    *output = mindfulness;
+    *output = calc_mindfulness (data);
     *output_len = 1;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -13,21 +13,40 @@
 #include "ml_module.h"
 #include "onnx_classifier.h"
 #include "restfulness_classifier.h"
+#include "shared_mutex.h"
 
 #include "json.hpp"
 
 using json = nlohmann::json;
 
+// predict calls share model mutex if model is thread safe and take it exclusively otherwise,
+// prepare and release take it exclusively. So a slow model doesnt block others
+struct ModelSession
+{
+    std::shared_ptr<BaseClassifier> model;
+    SharedMutex mutex;
+    bool prepared; // false while prepare is running and after release
+};
+
 int string_to_brainflow_model_params (const char *json_params, struct BrainFlowModelParams *params);
+static int get_model_session (const char *json_params, std::shared_ptr<ModelSession> &session);
+template <typename Func>
+static int call_model (ModelSession &session, Func func);
+static int run_predict_multi (const void *data, bool is_float32, int batch_size,
+    const int *input_lens, int num_inputs, double *output, int *output_lens, int num_outputs,
+    const char *json_params);
+static void remove_model_session (
+    const struct BrainFlowModelParams &key, const std::shared_ptr<ModelSession> &session);
 
-std::map<struct BrainFlowModelParams, std::shared_ptr<BaseClassifier>> ml_models;
-std::mutex models_mutex;
+std::map<struct BrainFlowModelParams, std::shared_ptr<ModelSession>> ml_models;
+// protects ml_models only, never held during calls to classifier methods
+SharedMutex models_mutex;
+// serializes log settings
+std::mutex log_mutex;
 
 
 int prepare (const char *json_params)
 {
-    std::lock_guard<std::mutex> lock (models_mutex);
-
     std::shared_ptr<BaseClassifier> model = NULL;
     BaseClassifier::ml_logger->trace ("(Prepararing)Incoming json: {}", json_params);
     struct BrainFlowModelParams key (
@@ -37,10 +56,6 @@ int prepare (const char *json_params)
     {
         return res;
     }
-    if (ml_models.find (key) != ml_models.end ())
-    {
-        return (int)BrainFlowExitCodes::ANOTHER_CLASSIFIER_IS_PREPARED_ERROR;
-    }
 
     if ((key.metric == (int)BrainFlowMetrics::USER_DEFINED) &&
         (key.classifier == (int)BrainFlowClassifiers::DYN_LIB_CLASSIFIER))
@@ -67,61 +82,244 @@ int prepare (const char *json_params)
         return (int)BrainFlowExitCodes::UNSUPPORTED_CLASSIFIER_AND_METRIC_COMBINATION_ERROR;
     }
 
+    // register model before preparing it, loading a big model may take a while and other models
+    // should stay accessible, calls to this model wait for its mutex
+    std::shared_ptr<ModelSession> session (new ModelSession ());
+    session->model = model;
+    session->prepared = false;
+    std::lock_guard<SharedMutex> session_lock (session->mutex);
+    {
+        std::lock_guard<SharedMutex> lock (models_mutex);
+        if (ml_models.find (key) != ml_models.end ())
+        {
+            return (int)BrainFlowExitCodes::ANOTHER_CLASSIFIER_IS_PREPARED_ERROR;
+        }
+        ml_models[key] = session;
+    }
+
     res = model->prepare ();
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         BaseClassifier::ml_logger->error ("Unable to prepare model. Please refer to logs above.");
-        model = NULL;
+        remove_model_session (key, session);
     }
     else
     {
-        ml_models[key] = model;
+        session->prepared = true;
     }
     return res;
 }
 
 int predict (double *data, int data_len, double *output, int *output_len, const char *json_params)
 {
-    std::lock_guard<std::mutex> lock (models_mutex);
+    BaseClassifier::ml_logger->trace ("(Predict)Incoming json: {}", json_params);
+    std::shared_ptr<ModelSession> session;
+    int res = get_model_session (json_params, session);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return call_model (*session, [&] (BaseClassifier *model)
+        { return model->predict (data, data_len, output, output_len); });
+}
+
+int predict_batch (double *data, int batch_size, int data_len, double *output, int *output_len,
+    const char *json_params)
+{
+    BaseClassifier::ml_logger->trace ("(Predict batch)Incoming json: {}", json_params);
+    std::shared_ptr<ModelSession> session;
+    int res = get_model_session (json_params, session);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return call_model (*session, [&] (BaseClassifier *model)
+        { return model->predict_batch (data, batch_size, data_len, output, output_len); });
+}
+
+int predict_multi (double *data, int batch_size, int *input_lens, int num_inputs, double *output,
+    int *output_lens, int num_outputs, const char *json_params)
+{
+    BaseClassifier::ml_logger->trace ("(Predict multi)Incoming json: {}", json_params);
+    return run_predict_multi (data, false, batch_size, input_lens, num_inputs, output, output_lens,
+        num_outputs, json_params);
+}
+
+int predict_multi_float32 (float *data, int batch_size, int *input_lens, int num_inputs,
+    double *output, int *output_lens, int num_outputs, const char *json_params)
+{
+    BaseClassifier::ml_logger->trace ("(Predict multi float32)Incoming json: {}", json_params);
+    return run_predict_multi (data, true, batch_size, input_lens, num_inputs, output, output_lens,
+        num_outputs, json_params);
+}
+
+int release (const char *json_params)
+{
+    BaseClassifier::ml_logger->trace ("(Release)Incoming json: {}", json_params);
     struct BrainFlowModelParams key (
         (int)BrainFlowMetrics::MINDFULNESS, (int)BrainFlowClassifiers::DEFAULT_CLASSIFIER);
-    BaseClassifier::ml_logger->trace ("(Predict)Incoming json: {}", json_params);
     int res = string_to_brainflow_model_params (json_params, &key);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto model = ml_models.find (key);
-    if (model == ml_models.end ())
+    std::shared_ptr<ModelSession> session;
+    {
+        SharedLockGuard lock (models_mutex);
+        auto model = ml_models.find (key);
+        if (model != ml_models.end ())
+        {
+            session = model->second;
+        }
+    }
+    if (session == NULL)
+    {
+        BaseClassifier::ml_logger->error ("Must prepare model before releasing it.");
+        return (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
+    }
+    remove_model_session (key, session);
+    // waits for running predictions
+    std::lock_guard<SharedMutex> lock (session->mutex);
+    if (!session->prepared)
     {
-        BaseClassifier::ml_logger->error ("Must prepare model before using it for prediction.");
         return (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
     }
-    return model->second->predict (data, data_len, output, output_len);
+    res = session->model->release ();
+    session->prepared = false;
+    return res;
 }
 
-int release (const char *json_params)
+int prepare_with_handle (const char *json_params, void **handle)
 {
-    std::lock_guard<std::mutex> lock (models_mutex);
+    if (handle == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int res = prepare (json_params);
+    std::shared_ptr<ModelSession> session;
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        res = get_model_session (json_params, session);
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        *handle = (void *)new std::shared_ptr<ModelSession> (session);
+    }
+    return res;
+}
 
+int predict_with_handle (void *handle, double *data, int data_len, double *output, int *output_len)
+{
+    if (handle == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    ModelSession &session = **(std::shared_ptr<ModelSession> *)handle;
+    return call_model (session, [&] (BaseClassifier *model)
+        { return model->predict (data, data_len, output, output_len); });
+}
+
+int predict_batch_with_handle (
+    void *handle, double *data, int batch_size, int data_len, double *output, int *output_len)
+{
+    if (handle == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    ModelSession &session = **(std::shared_ptr<ModelSession> *)handle;
+    return call_model (session, [&] (BaseClassifier *model)
+        { return model->predict_batch (data, batch_size, data_len, output, output_len); });
+}
+
+int release_with_handle (void *handle)
+{
+    if (handle == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<ModelSession> *session = (std::shared_ptr<ModelSession> *)handle;
+    // classifier params are the key it was registered with
+    remove_model_session ((*session)->model->params, *session);
+    int res = (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
+    {
+        std::lock_guard<SharedMutex> lock ((*session)->mutex);
+        if ((*session)->prepared)
+        {
+            res = (*session)->model->release ();
+            (*session)->prepared = false;
+        }
+    }
+    delete session;
+    return res;
+}
+
+int get_model_session (const char *json_params, std::shared_ptr<ModelSession> &session)
+{
     struct BrainFlowModelParams key (
         (int)BrainFlowMetrics::MINDFULNESS, (int)BrainFlowClassifiers::DEFAULT_CLASSIFIER);
-    BaseClassifier::ml_logger->trace ("(Release)Incoming json: {}", json_params);
     int res = string_to_brainflow_model_params (json_params, &key);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-
+    SharedLockGuard lock (models_mutex);
     auto model = ml_models.find (key);
     if (model == ml_models.end ())
     {
-        BaseClassifier::ml_logger->error ("Must prepare model before releasing it.");
+        BaseClassifier::ml_logger->error ("Must prepare model before using it for prediction.");
         return (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
     }
-    res = model->second->release ();
-    ml_models.erase (model);
-    return res;
+    session = model->second;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void remove_model_session (
+    const struct BrainFlowModelParams &key, const std::shared_ptr<ModelSession> &session)
+{
+    std::lock_guard<SharedMutex> lock (models_mutex);
+    auto model = ml_models.find (key);
+    // a new model with the same key may be prepared already
+    if ((model != ml_models.end ()) && (model->second == session))
+    {
+        ml_models.erase (model);
+    }
+}
+
+int run_predict_multi (const void *data, bool is_float32, int batch_size, const int *input_lens,
+    int num_inputs, double *output, int *output_lens, int num_outputs, const char *json_params)
+{
+    std::shared_ptr<ModelSession> session;
+    int res = get_model_session (json_params, session);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return call_model (*session,
+        [&] (BaseClassifier *model)
+        {
+            return model->predict_multi (data, is_float32, batch_size, input_lens, num_inputs,
+                output, output_lens, num_outputs);
+        });
+}
+
+template <typename Func>
+int call_model (ModelSession &session, Func func)
+{
+    if (session.model->is_thread_safe ())
+    {
+        SharedLockGuard lock (session.mutex);
+        if (!session.prepared)
+        {
+            return (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
+        }
+        return func (session.model.get ());
+    }
+    std::lock_guard<SharedMutex> lock (session.mutex);
+    if (!session.prepared)
+    {
+        return (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
+    }
+    return func (session.model.get ());
 }
 
 int string_to_brainflow_model_params (const char *json_params, struct BrainFlowModelParams *params)
@@ -136,6 +334,17 @@ int string_to_brainflow_model_params (const char *json_params, struct BrainFlowM
         params->output_name = config["output_name"];
         params->other_info = config["other_info"];
         params->max_array_size = config["max_array_size"];
+        // optional, bindings which dont set them get defaults
+        params->intra_op_num_threads =
+            config.value ("intra_op_num_threads", params->intra_op_num_threads);
+        params->inter_op_num_threads =
+            config.value ("inter_op_num_threads", params->inter_op_num_threads);
+        params->graph_optimization_level =
+            config.value ("graph_optimization_level", params->graph_optimization_level);
+        params->use_global_thread_pool =
+            config.value ("use_global_thread_pool", params->use_global_thread_pool);
+        params->optimized_model_file =
+            config.value ("optimized_model_file", params->optimized_model_file);
         return (int)BrainFlowExitCodes::STATUS_OK;
     }
     catch (json::exception &e)
@@ -151,7 +360,7 @@ int log_message_ml_module (int log_level, char *log_message)
 {
     // its a method for loggging from high level api dont add it to Classifier class since it should
     // not be used internally
-    std::lock_guard<std::mutex> lock (models_mutex);
+    std::lock_guard<std::mutex> lock (log_mutex);
     if (log_level < 0)
     {
         BaseClassifier::ml_logger->warn ("log level should be >= 0");
@@ -170,25 +379,32 @@ int log_message_ml_module (int log_level, char *log_message)
 
 int set_log_level_ml_module (int log_level)
 {
-    std::lock_guard<std::mutex> lock (models_mutex);
+    std::lock_guard<std::mutex> lock (log_mutex);
     return BaseClassifier::set_log_level (log_level);
 }
 
 int set_log_file_ml_module (const char *log_file)
 {
-    std::lock_guard<std::mutex> lock (models_mutex);
+    std::lock_guard<std::mutex> lock (log_mutex);
     return BaseClassifier::set_log_file (log_file);
 }
 
 int release_all ()
 {
-    std::lock_guard<std::mutex> lock (models_mutex);
+    std::map<struct BrainFlowModelParams, std::shared_ptr<ModelSession>> all_models;
+    {
+        std::lock_guard<SharedMutex> lock (models_mutex);
+        all_models.swap (ml_models);
+    }
 
-    for (auto it = ml_models.begin (), next_it = it; it != ml_models.end (); it = next_it)
+    for (auto &it : all_models)
     {
-        ++next_it;
-        it->second->release ();
-        ml_models.erase (it);
+        std::lock_guard<SharedMutex> lock (it.second->mutex);
+        if (it.second->prepared)
+        {
+            it.second->model->release ();
+            it.second->prepared = false;
+        }
     }
 
     return (int)BrainFlowExitCodes::STATUS_OK;
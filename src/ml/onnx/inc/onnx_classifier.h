@@ -17,21 +17,33 @@ private:
     OrtSessionOptions *session_options;
     OrtSession *session;
     OrtAllocator *allocator;
+    OrtMemoryInfo *memory_info;
 
-    ONNXTensorElementDataType input_type;
-    std::vector<int64_t> input_node_dims;
+    // per input node in model order
+    std::vector<ONNXTensorElementDataType> input_types;
+    std::vector<std::vector<int64_t>> input_node_dims;
     std::vector<const char *> input_node_names;
-
-    ONNXTensorElementDataType output_type;
-    std::vector<int64_t> output_node_dims;
+    // selected by output_name
     std::vector<const char *> output_node_names;
 
     DLLLoader *dll_loader;
 
     int load_api ();
+    int create_env ();
+    // thread, optimization and cache settings from params, may replace model file by cached one
+    int set_session_options (std::string &model_file);
+    // optimized model depends on file and session settings, they are saved next to it
+    std::string get_cache_settings_file ();
+    std::string get_cache_settings ();
+    std::string read_cache_settings ();
+    void write_cache_settings ();
+    int check_status (OrtStatus *onnx_status, const char *func_name);
     int get_input_info ();
     int get_output_info ();
-    std::string get_onnxlib_path ();
+    int get_tensor_info (
+        OrtTypeInfo *type_info, ONNXTensorElementDataType &type, std::vector<int64_t> &dims);
+    int get_input_shape (size_t input, int batch_size, int data_len, std::vector<int64_t> &shape);
+    int copy_output (OrtValue *tensor, double *output, size_t max_len, size_t &len);
 
 
 public:
@@ -42,6 +54,7 @@ public:
         session_options = NULL;
         session = NULL;
         allocator = NULL;
+        memory_info = NULL;
         dll_loader = NULL;
     }
 
@@ -53,5 +66,19 @@ public:
 
     int prepare ();
     int predict (double *data, int data_len, double *output, int *output_len);
+    // batch dim is the first dim of input if model declares it dynamic(-1), output rows are in the
+    // same order. Models with fixed first dim accept only batch_size 1
+    int predict_batch (double *data, int batch_size, int data_len, double *output, int *output_len);
+    int predict_multi (const void *data, bool is_float32, int batch_size, const int *input_lens,
+        int num_inputs, double *output, int *output_lens, int num_outputs);
     int release ();
+
+    // onnx runtime library is loaded from the folder of this library
+    static std::string get_onnxlib_path ();
+
+    // OrtSession::Run is thread safe, buffers are per thread
+    bool is_thread_safe ()
+    {
+        return true;
+    }
 };
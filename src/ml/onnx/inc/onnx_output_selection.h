@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+
+// output_name is a comma separated list of nodes, selected indices are in this order. If it's
+// empty the only output node or a node named "output_probability" or "probabilities" is used.
+// Returns false and sets missing_node if a requested node is not in node_names or is repeated
+bool select_output_nodes (const std::vector<const char *> &node_names,
+    const std::string &output_name, std::vector<size_t> &selected, std::string &missing_node);
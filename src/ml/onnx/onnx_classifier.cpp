@@ -1,16 +1,62 @@
-#include "onnx_classifier.h"
+#include <fstream>
+#include <mutex>
+#include <stdio.h>
+#include <sys/stat.h>
+
 #include "brainflow_constants.h"
 #include "get_dll_dir.h"
+#include "onnx_classifier.h"
+#include "onnx_output_selection.h"
 
+// onnx runtime keeps a single env per process, it is shared by all classifiers and its mode (global
+// thread pools or not) is fixed by the first classifier until all of them are released
+static std::mutex env_mutex;
+static OrtEnv *shared_env = NULL;
+static int shared_env_users = 0;
+static bool shared_env_global_pools = false;
 
+// env and its logger are shared by all models, so messages go to ml_logger directly
 void log_onnx_msg (void *param, OrtLoggingLevel severity, const char *category, const char *logid,
     const char *code_location, const char *message)
 {
-    BaseClassifier *classifier = (BaseClassifier *)param;
-    if (classifier != NULL)
+    spdlog::level::level_enum level = spdlog::level::critical;
+    switch (severity)
+    {
+        case ORT_LOGGING_LEVEL_VERBOSE:
+            level = spdlog::level::trace;
+            break;
+        case ORT_LOGGING_LEVEL_INFO:
+            level = spdlog::level::debug;
+            break;
+        case ORT_LOGGING_LEVEL_WARNING:
+            level = spdlog::level::warn;
+            break;
+        case ORT_LOGGING_LEVEL_ERROR:
+            level = spdlog::level::err;
+            break;
+        default:
+            break;
+    }
+    BaseClassifier::ml_logger->log (
+        level, "msg from onnx: {}, code location: {}", message, code_location);
+}
+
+// onnx runtime skips messages below this level itself, it's set when env is created
+static OrtLoggingLevel get_onnx_log_level ()
+{
+    switch (BaseClassifier::ml_logger->level ())
     {
-        classifier->safe_logger (
-            spdlog::level::trace, "msg from onnx: {}, code location: {}", message, code_location);
+        case spdlog::level::trace:
+            return ORT_LOGGING_LEVEL_VERBOSE;
+        case spdlog::level::debug:
+            return ORT_LOGGING_LEVEL_INFO;
+        case spdlog::level::info:
+        case spdlog::level::warn:
+            return ORT_LOGGING_LEVEL_WARNING;
+        case spdlog::level::err:
+            return ORT_LOGGING_LEVEL_ERROR;
+        default:
+            return ORT_LOGGING_LEVEL_FATAL;
     }
 }
 
@@ -64,329 +110,345 @@ int OnnxClassifier::prepare ()
 
 int OnnxClassifier::predict (double *data, int data_len, double *output, int *output_len)
 {
-    int res = (int)BrainFlowExitCodes::STATUS_OK;
-    if (ort == NULL)
-    {
-        return (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
-    }
-    if ((data == NULL) || (data_len < 1) || (output == NULL) || (output_len == NULL))
+    return predict_batch (data, 1, data_len, output, output_len);
+}
+
+int OnnxClassifier::predict_batch (
+    double *data, int batch_size, int data_len, double *output, int *output_len)
+{
+    if (output_len == NULL)
     {
         safe_logger (spdlog::level::err, "invalid input arguments");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-
-    // todo add support for ints and float16
-    float *float_data = NULL;
-    if (input_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
-    {
-        float_data = new float[data_len];
-        for (int i = 0; i < data_len; i++)
-        {
-            float_data[i] = (float)data[i];
-        }
-    }
-    else if (input_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE)
+    // several outputs are concatenated
+    std::vector<int> output_lens (output_node_names.size (), 0);
+    int res = predict_multi (data, false, batch_size, &data_len, 1, output, output_lens.data (),
+        (int)output_lens.size ());
+    *output_len = 0;
+    for (int len : output_lens)
     {
-        // no need to convert
+        *output_len += len;
     }
-    else
+    return res;
+}
+
+int OnnxClassifier::get_input_shape (
+    size_t input, int batch_size, int data_len, std::vector<int64_t> &shape)
+{
+    shape = input_node_dims[input];
+    if (shape.empty ())
     {
-        safe_logger (
-            spdlog::level::err, "only float and double input types are currently supported");
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        shape.push_back (data_len);
+        return (int)BrainFlowExitCodes::STATUS_OK;
     }
-
-    // create input tensor object from data values
-    OrtMemoryInfo *memory_info = NULL;
-    OrtValue *input_tensor = NULL;
-    OrtValue *output_tensor = NULL;
-    OrtStatus *onnx_status =
-        ort->CreateCpuMemoryInfo (OrtArenaAllocator, OrtMemTypeDefault, &memory_info);
-    if (onnx_status != NULL)
+    // first dim is a batch dim only if it's dynamic(-1) like in most of exported models, fixed
+    // first dim is a part of a row
+    size_t first_row_dim = 0;
+    if (shape[0] < 0)
     {
-        const char *msg = ort->GetErrorMessage (onnx_status);
-        safe_logger (spdlog::level::err, "CreateCpuMemoryInfo failed: {}", msg);
-        ort->ReleaseStatus (onnx_status);
-        res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+        shape[0] = batch_size;
+        first_row_dim = 1;
     }
-    else if (memory_info == NULL)
+    else if (batch_size > 1)
     {
-        safe_logger (spdlog::level::err, "CreateCpuMemoryInfo failed");
-        res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+        safe_logger (spdlog::level::err,
+            "input {} has no dynamic batch dim, batch_size must be 1", input);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    // single dynamic dim of a row is calculated from data_len
+    int64_t known_size = 1;
+    int dynamic_dim = -1;
+    for (size_t i = first_row_dim; i < shape.size (); i++)
     {
-        if (input_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
+        if (shape[i] > 0)
         {
-            onnx_status = ort->CreateTensorWithDataAsOrtValue (memory_info, float_data,
-                data_len * sizeof (float), input_node_dims.data (), input_node_dims.size (),
-                ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &input_tensor);
+            known_size *= shape[i];
         }
-        else
+        else if (dynamic_dim < 0)
         {
-            onnx_status = ort->CreateTensorWithDataAsOrtValue (memory_info, data,
-                data_len * sizeof (double), input_node_dims.data (), input_node_dims.size (),
-                ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE, &input_tensor);
+            dynamic_dim = (int)i;
         }
-        if (onnx_status != NULL)
-        {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "CreateTensorWithDataAsOrtValue failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
-        else if (input_tensor == NULL)
+        else
         {
-            safe_logger (spdlog::level::err, "CreateTensorWithDataAsOrtValue failed");
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            safe_logger (spdlog::level::err, "only one dynamic dim besides batch is supported");
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
     }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    if (dynamic_dim >= 0)
     {
-        int is_tensor = 0;
-        onnx_status = ort->IsTensor (input_tensor, &is_tensor);
-        if (onnx_status != NULL)
+        if (data_len % known_size != 0)
         {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "IsTensor failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            safe_logger (spdlog::level::err, "data_len doesnt match shape of input {}", input);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
-        else
+        shape[dynamic_dim] = data_len / known_size;
+    }
+    else if (first_row_dim == 1)
+    {
+        // rows are one after another, longer rows would be misaligned
+        if (known_size != data_len)
         {
-            if (!is_tensor)
-            {
-                safe_logger (spdlog::level::err, "Input isnt a tensor");
-                res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-            }
+            safe_logger (spdlog::level::err, "data_len must be equal to size {} of input {}",
+                known_size, input);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
     }
+    else if (known_size > data_len)
+    {
+        // single row of fixed shape, extra values are ignored like before
+        safe_logger (spdlog::level::err, "data_len is less than size {} of input {}", known_size,
+            input);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    // score model & input tensor, get back output tensor
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+int OnnxClassifier::predict_multi (const void *data, bool is_float32, int batch_size,
+    const int *input_lens, int num_inputs, double *output, int *output_lens, int num_outputs)
+{
+    if (ort == NULL)
     {
-        onnx_status = ort->Run (session, NULL, input_node_names.data (),
-            (const OrtValue *const *)&input_tensor, 1, output_node_names.data (), 1,
-            &output_tensor);
-        if (onnx_status != NULL)
+        return (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR;
+    }
+    if ((data == NULL) || (batch_size < 1) || (input_lens == NULL) || (output == NULL) ||
+        (output_lens == NULL))
+    {
+        safe_logger (spdlog::level::err, "invalid input arguments");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if ((num_inputs != (int)input_node_names.size ()) ||
+        (num_outputs != (int)output_node_names.size ()))
+    {
+        safe_logger (spdlog::level::err, "model has {} inputs and {} selected outputs",
+            input_node_names.size (), output_node_names.size ());
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    // session is shared by threads, so shapes and conversion buffers are per thread, buffers keep
+    // their capacity between calls. Data of the same type as input is passed to onnx as is
+    thread_local std::vector<std::vector<int64_t>> input_shapes;
+    thread_local std::vector<std::vector<float>> float_buffers;
+    thread_local std::vector<std::vector<double>> double_buffers;
+    if (input_shapes.size () < (size_t)num_inputs)
+    {
+        input_shapes.resize (num_inputs);
+        float_buffers.resize (num_inputs);
+        double_buffers.resize (num_inputs);
+    }
+    std::vector<OrtValue *> input_tensors (num_inputs, NULL);
+    std::vector<OrtValue *> output_tensors (num_outputs, NULL);
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    size_t offset = 0;
+    for (int i = 0; (i < num_inputs) && (res == (int)BrainFlowExitCodes::STATUS_OK); i++)
+    {
+        if (input_lens[i] < 1)
         {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "Run failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            safe_logger (spdlog::level::err, "invalid len of input {}", i);
+            res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            break;
         }
-        else if (output_tensor == NULL)
+        res = get_input_shape (i, batch_size, input_lens[i], input_shapes[i]);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
-            safe_logger (spdlog::level::err, "Run failed");
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            break;
         }
-    }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
-    {
-        int is_tensor = 0;
-        onnx_status = ort->IsTensor (output_tensor, &is_tensor);
-        if (onnx_status != NULL)
+        size_t input_len = (size_t)batch_size * input_lens[i];
+        const float *float_data = is_float32 ? (const float *)data + offset : NULL;
+        const double *double_data = is_float32 ? NULL : (const double *)data + offset;
+        offset += input_len;
+
+        // todo add support for ints and float16
+        void *tensor_data = NULL;
+        size_t tensor_bytes = 0;
+        if (input_types[i] == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
         {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "IsTensor failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            if (float_data == NULL)
+            {
+                float_buffers[i].resize (input_len);
+                for (size_t j = 0; j < input_len; j++)
+                {
+                    float_buffers[i][j] = (float)double_data[j];
+                }
+                float_data = float_buffers[i].data ();
+            }
+            tensor_data = (void *)float_data;
+            tensor_bytes = input_len * sizeof (float);
         }
-        else
+        else if (input_types[i] == ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE)
         {
-            if (!is_tensor)
+            if (double_data == NULL)
             {
-                safe_logger (spdlog::level::err, "Output isnt a tensor");
-                res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+                double_buffers[i].resize (input_len);
+                for (size_t j = 0; j < input_len; j++)
+                {
+                    double_buffers[i][j] = (double)float_data[j];
+                }
+                double_data = double_buffers[i].data ();
             }
+            tensor_data = (void *)double_data;
+            tensor_bytes = input_len * sizeof (double);
+        }
+        else
+        {
+            safe_logger (
+                spdlog::level::err, "only float and double input types are currently supported");
+            res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            break;
         }
+        // memory info is created once in prepare
+        res = check_status (ort->CreateTensorWithDataAsOrtValue (memory_info, tensor_data,
+                                tensor_bytes, input_shapes[i].data (), input_shapes[i].size (),
+                                input_types[i], &input_tensors[i]),
+            "CreateTensorWithDataAsOrtValue");
     }
 
-    // Get pointer to output tensor float values
-    size_t output_size = 1;
+    // score model & input tensors, get back output tensors
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
-        for (int64_t output_dim : output_node_dims)
-        {
-            output_size *= output_dim;
-        }
-        if (output_size > (uint64_t)params.max_array_size)
+        res = check_status (ort->Run (session, NULL, input_node_names.data (),
+                                input_tensors.data (), num_inputs, output_node_names.data (),
+                                num_outputs, output_tensors.data ()),
+            "Run");
+    }
+    // outputs are written one after another, they share max_array_size * batch_size values
+    size_t max_len = (size_t)params.max_array_size * batch_size;
+    size_t total_len = 0;
+    for (int i = 0; i < num_outputs; i++)
+    {
+        size_t len = 0;
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            safe_logger (spdlog::level::warn, "output is bigger than allocated array");
-            output_size = params.max_array_size;
+            res = copy_output (output_tensors[i], output + total_len, max_len - total_len, len);
         }
+        output_lens[i] = (int)len;
+        total_len += len;
+    }
 
-        void *output_tensor_data = NULL;
-        onnx_status = ort->GetTensorMutableData (output_tensor, &output_tensor_data);
-        if (onnx_status != NULL)
-        {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "IsTensor failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
-        else if (output_tensor_data == NULL)
+    for (OrtValue *tensor : input_tensors)
+    {
+        if (tensor != NULL)
         {
-            safe_logger (spdlog::level::err, "GetTensorMutableData failed");
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            ort->ReleaseValue (tensor);
         }
-        else
+    }
+    for (OrtValue *tensor : output_tensors)
+    {
+        if (tensor != NULL)
         {
-            *output_len = (int)output_size;
-            switch (output_type)
-            {
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED:
-                {
-                    safe_logger (spdlog::level::trace, "undefined output type");
-                    res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
-                {
-                    float *output_data = (float *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = (double)output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
-                {
-                    uint8_t *output_data = (uint8_t *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = (double)output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
-                {
-                    int8_t *output_data = (int8_t *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = (double)output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
-                {
-                    uint16_t *output_data = (uint16_t *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = (double)output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
-                {
-                    int16_t *output_data = (int16_t *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = (double)output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
-                {
-                    int32_t *output_data = (int32_t *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = (double)output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
-                {
-                    int64_t *output_data = (int64_t *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = (double)output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING:
-                {
-                    safe_logger (spdlog::level::err, "string output type is not supported");
-                    res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
-                {
-                    safe_logger (spdlog::level::err, "float16 output type is not supported");
-                    res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
-                {
-                    double *output_data = (double *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
-                {
-                    uint32_t *output_data = (uint32_t *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = (double)output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
-                {
-                    uint64_t *output_data = (uint64_t *)output_tensor_data;
-                    for (uint64_t i = 0; i < output_size; i++)
-                    {
-                        output[i] = (double)output_data[i];
-                    }
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX64:
-                {
-                    safe_logger (spdlog::level::err, "complex64 output type is not supported");
-                    res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX128:
-                {
-                    safe_logger (spdlog::level::err, "complex128 output type is not supported");
-                    res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-                    break;
-                }
-                case ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16:
-                {
-                    safe_logger (spdlog::level::err, "bfloat16 output type is not supported");
-                    res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-                    break;
-                }
-                default:
-                {
-                    safe_logger (spdlog::level::err, "unknown output type");
-                    res = (int)BrainFlowExitCodes::STATUS_OK;
-                }
-            }
+            ort->ReleaseValue (tensor);
         }
     }
+    return res;
+}
 
-    if (output_tensor != NULL)
+template <typename T>
+static void copy_to_double (const void *tensor_data, double *output, size_t len)
+{
+    const T *data = (const T *)tensor_data;
+    for (size_t i = 0; i < len; i++)
     {
-        ort->ReleaseValue (output_tensor);
+        output[i] = (double)data[i];
     }
-    if (input_tensor != NULL)
+}
+
+int OnnxClassifier::copy_output (OrtValue *tensor, double *output, size_t max_len, size_t &len)
+{
+    len = 0;
+    if (tensor == NULL)
     {
-        ort->ReleaseValue (input_tensor);
+        safe_logger (spdlog::level::err, "Run failed");
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
-    if (memory_info != NULL)
+    int is_tensor = 0;
+    int res = check_status (ort->IsTensor (tensor, &is_tensor), "IsTensor");
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (!is_tensor))
     {
-        ort->ReleaseMemoryInfo (memory_info);
+        safe_logger (spdlog::level::err, "Output isnt a tensor");
+        res = (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
-    if (float_data != NULL)
+
+    // output dims may be dynamic, take type and size from the tensor itself
+    ONNXTensorElementDataType type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED;
+    size_t output_size = 0;
+    OrtTensorTypeAndShapeInfo *output_info = NULL;
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        res = check_status (
+            ort->GetTensorTypeAndShape (tensor, &output_info), "GetTensorTypeAndShape");
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        res = check_status (
+            ort->GetTensorElementType (output_info, &type), "GetTensorElementType");
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        res = check_status (ort->GetTensorShapeElementCount (output_info, &output_size),
+            "GetTensorShapeElementCount");
+    }
+    if (output_info != NULL)
     {
-        delete[] float_data;
+        ort->ReleaseTensorTypeAndShapeInfo (output_info);
+    }
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    if (output_size > max_len)
+    {
+        safe_logger (spdlog::level::warn, "output is bigger than allocated array");
+        output_size = max_len;
     }
 
+    void *tensor_data = NULL;
+    res = check_status (ort->GetTensorMutableData (tensor, &tensor_data), "GetTensorMutableData");
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (tensor_data == NULL))
+    {
+        safe_logger (spdlog::level::err, "GetTensorMutableData failed");
+        res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    switch (type)
+    {
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+            copy_to_double<float> (tensor_data, output, output_size);
+            break;
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+            copy_to_double<uint8_t> (tensor_data, output, output_size);
+            break;
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
+            copy_to_double<int8_t> (tensor_data, output, output_size);
+            break;
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
+            copy_to_double<uint16_t> (tensor_data, output, output_size);
+            break;
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
+            copy_to_double<int16_t> (tensor_data, output, output_size);
+            break;
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+            copy_to_double<int32_t> (tensor_data, output, output_size);
+            break;
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+            copy_to_double<int64_t> (tensor_data, output, output_size);
+            break;
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
+            copy_to_double<double> (tensor_data, output, output_size);
+            break;
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
+            copy_to_double<uint32_t> (tensor_data, output, output_size);
+            break;
+        case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
+            copy_to_double<uint64_t> (tensor_data, output, output_size);
+            break;
+        default:
+            safe_logger (spdlog::level::err, "output type {} is not supported", (int)type);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    len = output_size;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -405,6 +467,15 @@ int OnnxClassifier::release ()
                 allocator, const_cast<void *> (reinterpret_cast<const void *> (node_name)));
         }
     }
+    input_node_names.clear ();
+    input_types.clear ();
+    input_node_dims.clear ();
+    output_node_names.clear ();
+    if ((memory_info != NULL) && (ort != NULL))
+    {
+        ort->ReleaseMemoryInfo (memory_info);
+        memory_info = NULL;
+    }
     if ((session_options != NULL) && (ort != NULL))
     {
         ort->ReleaseSessionOptions (session_options);
@@ -417,7 +488,12 @@ int OnnxClassifier::release ()
     }
     if ((env != NULL) && (ort != NULL))
     {
-        ort->ReleaseEnv (env);
+        std::lock_guard<std::mutex> lock (env_mutex);
+        if (--shared_env_users == 0)
+        {
+            ort->ReleaseEnv (shared_env);
+            shared_env = NULL;
+        }
         env = NULL;
     }
     ort = NULL;
@@ -500,20 +576,7 @@ int OnnxClassifier::load_api ()
 
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
-        OrtStatus *onnx_status = ort->CreateEnvWithCustomLogger ((OrtLoggingFunction)log_onnx_msg,
-            (void *)this, ORT_LOGGING_LEVEL_VERBOSE, "brainflow_onnx_lib", &env);
-        if (onnx_status != NULL)
-        {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "CreateEnv failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
-        else if (env == NULL)
-        {
-            safe_logger (spdlog::level::err, "CreateEnvWithCustomLogger failed");
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
+        res = create_env ();
     }
 
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
@@ -533,15 +596,20 @@ int OnnxClassifier::load_api ()
         }
     }
 
+    std::string model_file = params.file;
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        res = set_session_options (model_file);
+    }
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
 #ifdef _WIN32
         wchar_t model_path[1024];
-        mbstowcs (model_path, params.file.c_str (), 1024);
+        mbstowcs (model_path, model_file.c_str (), 1024);
         OrtStatus *onnx_status = ort->CreateSession (env, model_path, session_options, &session);
 #else
         OrtStatus *onnx_status =
-            ort->CreateSession (env, params.file.c_str (), session_options, &session);
+            ort->CreateSession (env, model_file.c_str (), session_options, &session);
 #endif
         if (onnx_status != NULL)
         {
@@ -555,6 +623,11 @@ int OnnxClassifier::load_api ()
             safe_logger (spdlog::level::err, "CreateSessionOptions failed");
             res = (int)BrainFlowExitCodes::GENERAL_ERROR;
         }
+        else if ((!params.optimized_model_file.empty ()) && (model_file == params.file))
+        {
+            // optimized model is saved by CreateSession
+            write_cache_settings ();
+        }
     }
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
@@ -572,318 +645,400 @@ int OnnxClassifier::load_api ()
             res = (int)BrainFlowExitCodes::GENERAL_ERROR;
         }
     }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        OrtStatus *onnx_status =
+            ort->CreateCpuMemoryInfo (OrtArenaAllocator, OrtMemTypeDefault, &memory_info);
+        if (onnx_status != NULL)
+        {
+            const char *msg = ort->GetErrorMessage (onnx_status);
+            safe_logger (spdlog::level::err, "CreateCpuMemoryInfo failed: {}", msg);
+            ort->ReleaseStatus (onnx_status);
+            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        else if (memory_info == NULL)
+        {
+            safe_logger (spdlog::level::err, "CreateCpuMemoryInfo failed");
+            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+    }
 
     return res;
 }
 
-int OnnxClassifier::get_input_info ()
+int OnnxClassifier::check_status (OrtStatus *onnx_status, const char *func_name)
 {
-    int res = (int)BrainFlowExitCodes::STATUS_OK;
-    size_t num_input_nodes = 0;
-    OrtTypeInfo *type_info = NULL;
-    size_t num_dims = 0;
-    char *input_name = NULL;
-    const OrtTensorTypeAndShapeInfo *tensor_info = NULL;
-
-    // input count
-    OrtStatus *onnx_status = ort->SessionGetInputCount (session, &num_input_nodes);
     if (onnx_status != NULL)
     {
         const char *msg = ort->GetErrorMessage (onnx_status);
-        safe_logger (spdlog::level::err, "SessionGetInputCount failed: {}", msg);
+        safe_logger (spdlog::level::err, "{} failed: {}", func_name, msg);
         ort->ReleaseStatus (onnx_status);
-        res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
-    else if (num_input_nodes == 0)
-    {
-        safe_logger (spdlog::level::err, "SessionGetInputCount failed");
-        res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-    }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int OnnxClassifier::create_env ()
+{
+    std::lock_guard<std::mutex> lock (env_mutex);
+    if (shared_env != NULL)
     {
-        if (num_input_nodes != 1)
+        // sessions with DisablePerSessionThreads fail without global pools, and global pools
+        // cant be added to the existing env
+        if (shared_env_global_pools != params.use_global_thread_pool)
         {
-            safe_logger (spdlog::level::err, "Only one input node is supported");
-            res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            safe_logger (spdlog::level::err,
+                "onnx runtime env is already created {} global thread pools, release all onnx "
+                "classifiers to change use_global_thread_pool",
+                shared_env_global_pools ? "with" : "without");
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
+        shared_env_users++;
+        env = shared_env;
+        return (int)BrainFlowExitCodes::STATUS_OK;
     }
 
-    // input node types
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    // env outlives the classifier which created it so no logger param, pool sizes are taken from
+    // the first classifier
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    if (!params.use_global_thread_pool)
     {
-        onnx_status = ort->SessionGetInputTypeInfo (session, 0, &type_info);
-        if (onnx_status != NULL)
-        {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "SessionGetInputTypeInfo failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
-        else if (type_info == NULL)
-        {
-            safe_logger (spdlog::level::err, "SessionGetInputTypeInfo failed");
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
+        res = check_status (ort->CreateEnvWithCustomLogger ((OrtLoggingFunction)log_onnx_msg, NULL,
+                                get_onnx_log_level (), "brainflow_onnx_lib", &shared_env),
+            "CreateEnvWithCustomLogger");
     }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    else
     {
-        onnx_status = ort->CastTypeInfoToTensorInfo (type_info, &tensor_info);
-        if (onnx_status != NULL)
+        OrtThreadingOptions *tp_options = NULL;
+        res = check_status (ort->CreateThreadingOptions (&tp_options), "CreateThreadingOptions");
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "CastTypeInfoToTensorInfo failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            res = check_status (
+                ort->SetGlobalIntraOpNumThreads (tp_options, params.intra_op_num_threads),
+                "SetGlobalIntraOpNumThreads");
         }
-        else if (tensor_info == NULL)
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            safe_logger (spdlog::level::err, "CastTypeInfoToTensorInfo failed");
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            res = check_status (
+                ort->SetGlobalInterOpNumThreads (tp_options, params.inter_op_num_threads),
+                "SetGlobalInterOpNumThreads");
         }
-    }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
-    {
-        onnx_status = ort->GetTensorElementType (tensor_info, &input_type);
-        if (onnx_status != NULL)
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "GetTensorElementType failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            res = check_status (ort->CreateEnvWithCustomLoggerAndGlobalThreadPools (
+                                    (OrtLoggingFunction)log_onnx_msg, NULL,
+                                    get_onnx_log_level (), "brainflow_onnx_lib", tp_options,
+                                    &shared_env),
+                "CreateEnvWithCustomLoggerAndGlobalThreadPools");
         }
-        else
+        if (tp_options != NULL)
         {
-            safe_logger (spdlog::level::info, "input type is: {}", (int)input_type);
+            ort->ReleaseThreadingOptions (tp_options);
         }
     }
+    if ((res != (int)BrainFlowExitCodes::STATUS_OK) || (shared_env == NULL))
+    {
+        safe_logger (spdlog::level::err, "failed to create onnx runtime env");
+        shared_env = NULL;
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    shared_env_global_pools = params.use_global_thread_pool;
+    shared_env_users = 1;
+    env = shared_env;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    // check input dims
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+static bool get_mtime (const std::string &file, time_t &mtime)
+{
+    struct stat info;
+    if ((file.empty ()) || (stat (file.c_str (), &info) != 0))
     {
-        onnx_status = ort->GetDimensionsCount (tensor_info, &num_dims);
-        if (onnx_status != NULL)
-        {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "GetDimensionsCount failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
-        else
-        {
-            safe_logger (spdlog::level::info, "num dims is: {}", num_dims);
-        }
+        return false;
     }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    mtime = info.st_mtime;
+    return true;
+}
+
+std::string OnnxClassifier::get_cache_settings_file ()
+{
+    return params.optimized_model_file + ".settings";
+}
+
+std::string OnnxClassifier::get_cache_settings ()
+{
+    return "file=" + params.file +
+        " graph_optimization_level=" + std::to_string (params.graph_optimization_level) +
+        " intra_op_num_threads=" + std::to_string (params.intra_op_num_threads) +
+        " inter_op_num_threads=" + std::to_string (params.inter_op_num_threads) +
+        " use_global_thread_pool=" + std::to_string ((int)params.use_global_thread_pool);
+}
+
+std::string OnnxClassifier::read_cache_settings ()
+{
+    std::string settings;
+    std::ifstream file (get_cache_settings_file ());
+    if (file.is_open ())
     {
-        input_node_dims.resize (num_dims);
-        onnx_status =
-            ort->GetDimensions (tensor_info, (int64_t *)input_node_dims.data (), num_dims);
-        if (onnx_status != NULL)
-        {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "GetDimensions failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
-        else
-        {
-            for (size_t j = 0; j < num_dims; j++)
-            {
-                safe_logger (spdlog::level::info, "Input Dim {} size {}", j, input_node_dims[j]);
-            }
-        }
+        std::getline (file, settings);
     }
+    return settings;
+}
 
-    // input name
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+void OnnxClassifier::write_cache_settings ()
+{
+    std::ofstream file (get_cache_settings_file ());
+    if (file.is_open ())
     {
-        onnx_status = ort->SessionGetInputName (session, 0, allocator, &input_name);
-        if (onnx_status != NULL)
-        {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "SessionGetInputName failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
-        else if (input_name == NULL)
+        file << get_cache_settings () << std::endl;
+    }
+    if ((!file.is_open ()) || (!file.good ()))
+    {
+        safe_logger (spdlog::level::warn, "failed to write {}, optimized model will be recreated",
+            get_cache_settings_file ());
+    }
+}
+
+int OnnxClassifier::set_session_options (std::string &model_file)
+{
+    if ((params.intra_op_num_threads < 0) || (params.inter_op_num_threads < 0))
+    {
+        safe_logger (spdlog::level::err, "number of threads should be >= 0");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int level = params.graph_optimization_level;
+    if ((level != ORT_DISABLE_ALL) && (level != ORT_ENABLE_BASIC) &&
+        (level != ORT_ENABLE_EXTENDED) && (level != ORT_ENABLE_ALL))
+    {
+        safe_logger (spdlog::level::err, "graph optimization level should be 0, 1, 2 or 99");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    if (params.use_global_thread_pool)
+    {
+        res = check_status (
+            ort->DisablePerSessionThreads (session_options), "DisablePerSessionThreads");
+    }
+    else
+    {
+        if (params.intra_op_num_threads > 0)
         {
-            safe_logger (spdlog::level::err, "SessionGetInputName failed");
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            res = check_status (
+                ort->SetIntraOpNumThreads (session_options, params.intra_op_num_threads),
+                "SetIntraOpNumThreads");
         }
-        else
+        if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (params.inter_op_num_threads > 0))
         {
-            input_node_names.resize (1);
-            input_node_names[0] = input_name;
+            res = check_status (
+                ort->SetInterOpNumThreads (session_options, params.inter_op_num_threads),
+                "SetInterOpNumThreads");
         }
     }
-
-    if (type_info != NULL)
+    // inter op threads run independent nodes concurrently only in parallel mode
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (params.inter_op_num_threads > 1))
     {
-        ort->ReleaseTypeInfo (type_info);
+        res = check_status (ort->SetSessionExecutionMode (session_options, ORT_PARALLEL),
+            "SetSessionExecutionMode");
     }
 
+    // cached model is already optimized, skip optimizations to load faster
+    time_t model_time = 0;
+    time_t cache_time = 0;
+    bool use_cache = (get_mtime (params.optimized_model_file, cache_time)) &&
+        (get_mtime (params.file, model_time)) && (cache_time >= model_time) &&
+        (read_cache_settings () == get_cache_settings ());
+    if (use_cache)
+    {
+        safe_logger (spdlog::level::info, "loading optimized model from {}",
+            params.optimized_model_file);
+        model_file = params.optimized_model_file;
+        level = ORT_DISABLE_ALL;
+    }
+    else if (!params.optimized_model_file.empty ())
+    {
+        // settings are written back once the new model is saved
+        remove (get_cache_settings_file ().c_str ());
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        res = check_status (ort->SetSessionGraphOptimizationLevel (
+                                session_options, (GraphOptimizationLevel)level),
+            "SetSessionGraphOptimizationLevel");
+    }
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (!use_cache) &&
+        (!params.optimized_model_file.empty ()))
+    {
+#ifdef _WIN32
+        wchar_t optimized_path[1024];
+        mbstowcs (optimized_path, params.optimized_model_file.c_str (), 1024);
+        res = check_status (ort->SetOptimizedModelFilePath (session_options, optimized_path),
+            "SetOptimizedModelFilePath");
+#else
+        res = check_status (ort->SetOptimizedModelFilePath (
+                                session_options, params.optimized_model_file.c_str ()),
+            "SetOptimizedModelFilePath");
+#endif
+    }
     return res;
 }
 
-int OnnxClassifier::get_output_info ()
+int OnnxClassifier::get_tensor_info (
+    OrtTypeInfo *type_info, ONNXTensorElementDataType &type, std::vector<int64_t> &dims)
 {
-    int res = (int)BrainFlowExitCodes::STATUS_OK;
-    size_t num_output_nodes = 0;
-    size_t node_number = 0;
-    OrtTypeInfo *type_info = NULL;
-    size_t num_dims = 0;
-    char *output_name = NULL;
-    bool node_found = false;
     const OrtTensorTypeAndShapeInfo *tensor_info = NULL;
-
-    // output count
-    OrtStatus *onnx_status = ort->SessionGetOutputCount (session, &num_output_nodes);
-    if (onnx_status != NULL)
+    size_t num_dims = 0;
+    int res = check_status (
+        ort->CastTypeInfoToTensorInfo (type_info, &tensor_info), "CastTypeInfoToTensorInfo");
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (tensor_info == NULL))
     {
-        const char *msg = ort->GetErrorMessage (onnx_status);
-        safe_logger (spdlog::level::err, "SessionGetOutputCount failed: {}", msg);
-        ort->ReleaseStatus (onnx_status);
+        safe_logger (spdlog::level::err,
+            "CastTypeInfoToTensorInfo failed, make sure that ZipMap is disabled in your "
+            "model.");
         res = (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
-        for (node_number = 0; node_number < num_output_nodes; node_number++)
+        res = check_status (ort->GetTensorElementType (tensor_info, &type), "GetTensorElementType");
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        res = check_status (ort->GetDimensionsCount (tensor_info, &num_dims), "GetDimensionsCount");
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        dims.resize (num_dims);
+        res = check_status (
+            ort->GetDimensions (tensor_info, dims.data (), num_dims), "GetDimensions");
+    }
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        safe_logger (spdlog::level::info, "type is: {}, num dims is: {}", (int)type, num_dims);
+        for (size_t j = 0; j < num_dims; j++)
         {
-            // output name
-            if (res == (int)BrainFlowExitCodes::STATUS_OK)
-            {
-                onnx_status =
-                    ort->SessionGetOutputName (session, node_number, allocator, &output_name);
-                if (onnx_status != NULL)
-                {
-                    const char *msg = ort->GetErrorMessage (onnx_status);
-                    safe_logger (spdlog::level::err, "SessionGetOutputName failed: {}", msg);
-                    ort->ReleaseStatus (onnx_status);
-                    res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-                }
-                else
-                {
-                    safe_logger (spdlog::level::info, "found output node: {}", output_name);
-                    if (((num_output_nodes == 1) ||
-                            (strcmp (params.output_name.c_str (), output_name) == 0)) ||
-                        ((params.output_name.empty ()) &&
-                            (strcmp (output_name, "output_probability") == 0)) ||
-                        ((params.output_name.empty ()) &&
-                            (strcmp (output_name, "probabilities") == 0)))
-                    {
-                        output_node_names.resize (1);
-                        output_node_names[0] = output_name;
-                        node_found = true;
-                        break;
-                    }
-                    else
-                    {
-                        onnx_status = ort->AllocatorFree (allocator, output_name);
-                    }
-                }
-            }
+            safe_logger (spdlog::level::info, "Dim {} size {}", j, dims[j]);
         }
     }
-    if (!node_found)
+    return res;
+}
+
+int OnnxClassifier::get_input_info ()
+{
+    size_t num_input_nodes = 0;
+    int res = check_status (
+        ort->SessionGetInputCount (session, &num_input_nodes), "SessionGetInputCount");
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (num_input_nodes == 0))
     {
-        safe_logger (spdlog::level::err,
-            "Model has multiple output nodes, you need to provide correct node name via "
-            "BrainFlowModelParams.output_name, you can use https://netron.app/ to inspect the "
-            "model");
-        res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        safe_logger (spdlog::level::err, "SessionGetInputCount failed");
+        res = (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
 
-    // output node types
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    // inputs are fed in the same order as they are declared in the model
+    for (size_t i = 0; (i < num_input_nodes) && (res == (int)BrainFlowExitCodes::STATUS_OK); i++)
     {
-        onnx_status = ort->SessionGetOutputTypeInfo (session, node_number, &type_info);
-        if (onnx_status != NULL)
+        OrtTypeInfo *type_info = NULL;
+        ONNXTensorElementDataType type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED;
+        std::vector<int64_t> dims;
+        char *input_name = NULL;
+        res = check_status (
+            ort->SessionGetInputTypeInfo (session, i, &type_info), "SessionGetInputTypeInfo");
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "SessionGetOutputTypeInfo failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            safe_logger (spdlog::level::info, "input {}:", i);
+            res = get_tensor_info (type_info, type, dims);
         }
-        else if (type_info == NULL)
+        if (type_info != NULL)
         {
-            safe_logger (spdlog::level::err, "SessionGetOutputTypeInfo failed");
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            ort->ReleaseTypeInfo (type_info);
         }
-    }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
-    {
-        onnx_status = ort->CastTypeInfoToTensorInfo (type_info, &tensor_info);
-        if (onnx_status != NULL)
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "CastTypeInfoToTensorInfo failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            res = check_status (ort->SessionGetInputName (session, i, allocator, &input_name),
+                "SessionGetInputName");
         }
-        else if (tensor_info == NULL)
+        if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (input_name == NULL))
         {
-            safe_logger (spdlog::level::err,
-                "CastTypeInfoToTensorInfo failed, make sure that ZipMap is disabled in your "
-                "model.");
+            safe_logger (spdlog::level::err, "SessionGetInputName failed");
             res = (int)BrainFlowExitCodes::GENERAL_ERROR;
         }
-    }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
-    {
-        onnx_status = ort->GetTensorElementType (tensor_info, &output_type);
-        if (onnx_status != NULL)
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "GetTensorElementType failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            input_node_names.push_back (input_name);
+            input_types.push_back (type);
+            input_node_dims.push_back (dims);
         }
-        else
+    }
+
+    return res;
+}
+
+int OnnxClassifier::get_output_info ()
+{
+    size_t num_output_nodes = 0;
+    int res = check_status (
+        ort->SessionGetOutputCount (session, &num_output_nodes), "SessionGetOutputCount");
+
+    std::vector<char *> all_names (num_output_nodes, NULL);
+    for (size_t i = 0; (i < num_output_nodes) && (res == (int)BrainFlowExitCodes::STATUS_OK); i++)
+    {
+        res = check_status (ort->SessionGetOutputName (session, i, allocator, &all_names[i]),
+            "SessionGetOutputName");
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            safe_logger (spdlog::level::info, "output type is: {}", (int)input_type);
+            safe_logger (spdlog::level::info, "found output node: {}", all_names[i]);
         }
     }
 
-    // check output dims
+    std::vector<size_t> selected;
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
-        onnx_status = ort->GetDimensionsCount (tensor_info, &num_dims);
-        if (onnx_status != NULL)
-        {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "GetDimensionsCount failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
-        else
+        std::string missing_node;
+        std::vector<const char *> names (all_names.begin (), all_names.end ());
+        if (!select_output_nodes (names, params.output_name, selected, missing_node))
         {
-            safe_logger (spdlog::level::info, "num dims is: {}", num_dims);
+            if (!missing_node.empty ())
+            {
+                safe_logger (spdlog::level::err, "output node {} not found or repeated",
+                    missing_node);
+            }
+            safe_logger (spdlog::level::err,
+                "Model has multiple output nodes, you need to provide correct node name via "
+                "BrainFlowModelParams.output_name, you can use https://netron.app/ to inspect "
+                "the model");
+            res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
         }
     }
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+
+    // check that selected outputs are tensors
+    for (size_t i = 0; (i < selected.size ()) && (res == (int)BrainFlowExitCodes::STATUS_OK); i++)
     {
-        output_node_dims.resize (num_dims);
-        onnx_status =
-            ort->GetDimensions (tensor_info, (int64_t *)output_node_dims.data (), num_dims);
-        if (onnx_status != NULL)
+        OrtTypeInfo *type_info = NULL;
+        ONNXTensorElementDataType type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED;
+        std::vector<int64_t> dims;
+        res = check_status (ort->SessionGetOutputTypeInfo (session, selected[i], &type_info),
+            "SessionGetOutputTypeInfo");
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
         {
-            const char *msg = ort->GetErrorMessage (onnx_status);
-            safe_logger (spdlog::level::err, "GetDimensions failed: {}", msg);
-            ort->ReleaseStatus (onnx_status);
-            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+            safe_logger (spdlog::level::info, "output {}:", all_names[selected[i]]);
+            res = get_tensor_info (type_info, type, dims);
         }
-        else
+        if (type_info != NULL)
         {
-            for (size_t j = 0; j < num_dims; j++)
-            {
-                safe_logger (spdlog::level::info, "Output Dim {} size {}", j, output_node_dims[j]);
-            }
+            ort->ReleaseTypeInfo (type_info);
         }
     }
 
-    if (type_info != NULL)
+    // selected names are freed in release
+    for (size_t i = 0; i < selected.size (); i++)
+    {
+        output_node_names.push_back (all_names[selected[i]]);
+        all_names[selected[i]] = NULL;
+    }
+    for (char *name : all_names)
     {
-        ort->ReleaseTypeInfo (type_info);
+        if (name != NULL)
+        {
+            check_status (ort->AllocatorFree (allocator, name), "AllocatorFree");
+        }
     }
 
     return res;
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <string.h>
+
+#include "onnx_output_selection.h"
+
+
+bool select_output_nodes (const std::vector<const char *> &node_names,
+    const std::string &output_name, std::vector<size_t> &selected, std::string &missing_node)
+{
+    selected.clear ();
+    missing_node.clear ();
+
+    std::vector<std::string> requested;
+    size_t start = 0;
+    while (start < output_name.size ())
+    {
+        size_t end = output_name.find (',', start);
+        end = (end == std::string::npos) ? output_name.size () : end;
+        requested.push_back (output_name.substr (start, end - start));
+        start = end + 1;
+    }
+
+    // single output node is used whatever its name is
+    if ((node_names.size () == 1) && (requested.size () < 2))
+    {
+        selected.push_back (0);
+        return true;
+    }
+    if (requested.empty ())
+    {
+        for (size_t i = 0; i < node_names.size (); i++)
+        {
+            if ((strcmp (node_names[i], "output_probability") == 0) ||
+                (strcmp (node_names[i], "probabilities") == 0))
+            {
+                selected.push_back (i);
+                break;
+            }
+        }
+        return !selected.empty ();
+    }
+    for (const std::string &name : requested)
+    {
+        size_t i = 0;
+        for (; i < node_names.size (); i++)
+        {
+            if (name == node_names[i])
+            {
+                break;
+            }
+        }
+        // each node is returned once, ownership of names is moved by index
+        if ((i == node_names.size ()) ||
+            (std::find (selected.begin (), selected.end (), i) != selected.end ()))
+        {
+            missing_node = name;
+            selected.clear ();
+            return false;
+        }
+        selected.push_back (i);
+    }
+    return true;
+}
@@ -0,0 +1,208 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "async_streamer.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+// shared by a test and its fake streamer, streamer is owned and deleted by AsyncStreamer
+struct StreamerGate
+{
+    std::mutex m;
+    std::condition_variable cv;
+    bool is_open = false;
+    int calls = 0;
+    std::vector<double> received;
+
+    void wait_for_calls (int num_calls)
+    {
+        std::unique_lock<std::mutex> lk (m);
+        cv.wait (lk, [this, num_calls] { return calls >= num_calls; });
+    }
+
+    void open ()
+    {
+        {
+            std::lock_guard<std::mutex> lk (m);
+            is_open = true;
+        }
+        cv.notify_all ();
+    }
+};
+
+// slow consumer, blocks in stream_data until the gate is opened
+class FakeSlowStreamer : public Streamer
+{
+public:
+    FakeSlowStreamer (int len, StreamerGate *gate) : Streamer (len, "fake", "", "")
+    {
+        this->gate = gate;
+    }
+
+    int init_streamer ()
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+
+    void stream_data (double *data)
+    {
+        stream_data (data, 1);
+    }
+
+    void stream_data (double *data, int num_packages)
+    {
+        std::unique_lock<std::mutex> lk (gate->m);
+        gate->calls++;
+        gate->cv.notify_all ();
+        gate->cv.wait (lk, [this] { return gate->is_open; });
+        for (int i = 0; i < num_packages; i++)
+        {
+            gate->received.push_back (data[i * len]);
+        }
+    }
+
+private:
+    StreamerGate *gate;
+};
+
+static const int data_len = 3;
+
+// first element of each package is its index
+static std::vector<double> make_packages (int first, int num_packages)
+{
+    std::vector<double> packages (num_packages * data_len, 0.0);
+    for (int i = 0; i < num_packages; i++)
+    {
+        packages[i * data_len] = first + i;
+        packages[i * data_len + 1] = -1.0;
+    }
+    return packages;
+}
+
+// pushes package 0 and waits until the streaming thread is stuck with it, queue is empty after
+static void start_with_busy_streamer (AsyncStreamer &streamer, StreamerGate &gate)
+{
+    ASSERT_EQ (streamer.init_streamer (), (int)BrainFlowExitCodes::STATUS_OK);
+    std::vector<double> package = make_packages (0, 1);
+    streamer.stream_data (package.data ());
+    gate.wait_for_calls (1);
+}
+
+TEST (AsyncStreamerTest, StreamData_DropOldestQueueFull_KeepNewestPackages)
+{
+    StreamerGate gate;
+    {
+        AsyncStreamer streamer (new FakeSlowStreamer (data_len, &gate), data_len, 4,
+            StreamerOverflowPolicy::DROP_OLDEST);
+        start_with_busy_streamer (streamer, gate);
+        std::vector<double> packages = make_packages (1, 6);
+
+        streamer.stream_data (packages.data (), 6);
+
+        StreamerStats stats = streamer.get_stats ();
+        EXPECT_EQ (stats.queued, (size_t)4);
+        EXPECT_EQ (stats.queue_size, (size_t)4);
+        EXPECT_EQ (stats.dropped, 2);
+        EXPECT_EQ (stats.streamed, 0);
+        gate.open ();
+    }
+
+    EXPECT_THAT (gate.received, ElementsAre (0, 3, 4, 5, 6));
+}
+
+TEST (AsyncStreamerTest, StreamData_DropNewestQueueFull_KeepOldestPackages)
+{
+    StreamerGate gate;
+    {
+        AsyncStreamer streamer (new FakeSlowStreamer (data_len, &gate), data_len, 4,
+            StreamerOverflowPolicy::DROP_NEWEST);
+        start_with_busy_streamer (streamer, gate);
+        std::vector<double> packages = make_packages (1, 4);
+        std::vector<double> more_packages = make_packages (5, 2);
+
+        streamer.stream_data (packages.data (), 4);
+        streamer.stream_data (more_packages.data ());
+        streamer.stream_data (more_packages.data () + data_len);
+
+        StreamerStats stats = streamer.get_stats ();
+        EXPECT_EQ (stats.queued, (size_t)4);
+        EXPECT_EQ (stats.dropped, 2);
+        gate.open ();
+    }
+
+    EXPECT_THAT (gate.received, ElementsAre (0, 1, 2, 3, 4));
+}
+
+TEST (AsyncStreamerTest, StreamData_BlockQueueFull_WaitAndLoseNothing)
+{
+    StreamerGate gate;
+    {
+        AsyncStreamer streamer (
+            new FakeSlowStreamer (data_len, &gate), data_len, 4, StreamerOverflowPolicy::BLOCK);
+        start_with_busy_streamer (streamer, gate);
+        std::vector<double> packages = make_packages (1, 10);
+        std::atomic<bool> is_pushed (false);
+
+        std::thread producer ([&] {
+            streamer.stream_data (packages.data (), 10);
+            is_pushed = true;
+        });
+        while (streamer.get_stats ().queued < 4)
+        {
+            std::this_thread::sleep_for (std::chrono::milliseconds (1));
+        }
+        // streaming thread is stuck, producer can't push the rest
+        EXPECT_FALSE (is_pushed);
+        std::this_thread::sleep_for (std::chrono::milliseconds (20));
+        gate.open ();
+        producer.join ();
+
+        EXPECT_TRUE (is_pushed);
+        while (streamer.get_stats ().streamed < 11)
+        {
+            std::this_thread::sleep_for (std::chrono::milliseconds (1));
+        }
+        StreamerStats stats = streamer.get_stats ();
+        EXPECT_EQ (stats.queued, (size_t)0);
+        EXPECT_EQ (stats.dropped, 0);
+        // package 0 waited for the gate
+        EXPECT_GE (stats.max_latency_ms, 20.0);
+    }
+
+    ASSERT_EQ (gate.received.size (), (size_t)11);
+    for (int i = 0; i < 11; i++)
+    {
+        EXPECT_EQ (gate.received[i], i);
+    }
+}
+
+TEST (AsyncStreamerTest, Destructor_PackagesQueued_DrainQueue)
+{
+    StreamerGate gate;
+    std::thread opener;
+    {
+        AsyncStreamer streamer (new FakeSlowStreamer (data_len, &gate), data_len, 100,
+            StreamerOverflowPolicy::DROP_NEWEST);
+        start_with_busy_streamer (streamer, gate);
+        std::vector<double> packages = make_packages (1, 50);
+        streamer.stream_data (packages.data (), 50);
+        EXPECT_EQ (streamer.get_stats ().queued, (size_t)50);
+        // gate is opened while destructor waits for the streaming thread
+        opener = std::thread ([&gate] {
+            std::this_thread::sleep_for (std::chrono::milliseconds (10));
+            gate.open ();
+        });
+    }
+    opener.join ();
+
+    ASSERT_EQ (gate.received.size (), (size_t)51);
+    EXPECT_EQ (gate.received.back (), 50);
+}
@@ -0,0 +1,215 @@
+#include <chrono>
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board_controller.h"
+#include "brainflow_constants.h"
+#include "brainflow_input_params.h"
+#include "playback_file_board.h"
+
+using namespace testing;
+
+// recorded by synthetic board: 32 rows, package num in row 0, timestamp in row 30, 250 Hz
+#define PLAYBACK_TEST_NUM_ROWS 32
+#define PLAYBACK_TEST_SAMPLING_RATE 250
+
+
+static void write_recording (const char *file_name, int num_packages)
+{
+    FILE *fp = fopen (file_name, "w");
+    ASSERT_NE (fp, nullptr);
+    for (int i = 0; i < num_packages; i++)
+    {
+        for (int j = 0; j < PLAYBACK_TEST_NUM_ROWS; j++)
+        {
+            double value = j * 0.5;
+            if (j == 0)
+            {
+                value = i;
+            }
+            if (j == 30)
+            {
+                value = 1700000000.0 + (double)i / PLAYBACK_TEST_SAMPLING_RATE;
+            }
+            fprintf (fp, "%lf%c", value, (j == PLAYBACK_TEST_NUM_ROWS - 1) ? '\n' : '\t');
+        }
+    }
+    fclose (fp);
+}
+
+static struct BrainFlowInputParams make_params (const char *file_name)
+{
+    struct BrainFlowInputParams params;
+    params.master_board = (int)BoardIds::SYNTHETIC_BOARD;
+    params.file = file_name;
+    return params;
+}
+
+// drains the buffer with get_board_data until num_packages are received or timeout is reached,
+// returns package nums in order of arrival
+static std::vector<int> drain_packages (PlaybackFileBoard &board, int num_packages, double timeout)
+{
+    std::vector<int> package_nums;
+    std::vector<double> data;
+    auto start = std::chrono::steady_clock::now ();
+    while ((int)package_nums.size () < num_packages)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+        if (elapsed.count () > timeout)
+        {
+            break;
+        }
+        int count = 0;
+        board.get_board_data_count ((int)BrainFlowPresets::DEFAULT_PRESET, &count);
+        if (count == 0)
+        {
+            std::this_thread::sleep_for (std::chrono::milliseconds (1));
+            continue;
+        }
+        data.resize ((size_t)count * PLAYBACK_TEST_NUM_ROWS);
+        board.get_board_data (count, (int)BrainFlowPresets::DEFAULT_PRESET, data.data ());
+        // data is transposed, row 0 holds package nums
+        for (int i = 0; i < count; i++)
+        {
+            package_nums.push_back ((int)data[i]);
+        }
+    }
+    return package_nums;
+}
+
+static std::vector<int> make_range (int count)
+{
+    std::vector<int> range;
+    for (int i = 0; i < count; i++)
+    {
+        range.push_back (i);
+    }
+    return range;
+}
+
+// replays num_packages with the given speed, returns elapsed seconds
+static double replay (const char *file_name, const std::string &speed, int num_packages,
+    int buffer_size, std::vector<int> &package_nums)
+{
+    PlaybackFileBoard board (make_params (file_name));
+    std::string response;
+    EXPECT_EQ (board.prepare_session (), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (board.config_board ("set_speed:" + speed, response),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    auto start = std::chrono::steady_clock::now ();
+    EXPECT_EQ (board.start_stream (buffer_size, ""), (int)BrainFlowExitCodes::STATUS_OK);
+    package_nums = drain_packages (board, num_packages, 20.0);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+    // no loopback, nothing is pushed after the last package
+    std::this_thread::sleep_for (std::chrono::milliseconds (50));
+    int count = -1;
+    board.get_board_data_count ((int)BrainFlowPresets::DEFAULT_PRESET, &count);
+    EXPECT_EQ (count, 0);
+    board.release_session ();
+    return elapsed.count ();
+}
+
+TEST (PlaybackFileBoardTest, ConfigBoard_SetSpeed_AcceptPositiveOrMax)
+{
+    PlaybackFileBoard board (make_params ("playback_test_unused.csv"));
+    std::string response;
+
+    EXPECT_EQ (board.config_board ("set_speed:1", response), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (board.config_board ("set_speed:10", response), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (board.config_board ("set_speed:0.25", response), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (board.config_board ("set_speed:max", response), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (PlaybackFileBoardTest, ConfigBoard_SetSpeedInvalid_ReturnError)
+{
+    PlaybackFileBoard board (make_params ("playback_test_unused.csv"));
+    std::string response;
+
+    EXPECT_EQ (board.config_board ("set_speed:0", response),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (board.config_board ("set_speed:-2", response),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (board.config_board ("set_speed:fast", response),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (board.config_board ("set_speed:", response),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (board.config_board ("set_speed:nan", response),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+}
+
+TEST (PlaybackFileBoardTest, Replay_RealTime_AllPackagesInOrder)
+{
+    const char *file_name = "playback_test_1x.csv";
+    int num_packages = 100; // 0.4 seconds
+    write_recording (file_name, num_packages);
+    std::vector<int> package_nums;
+
+    double elapsed = replay (file_name, "1", num_packages, 1000, package_nums);
+
+    EXPECT_EQ (package_nums, make_range (num_packages));
+    EXPECT_GE (elapsed, 0.3);
+    remove (file_name);
+}
+
+TEST (PlaybackFileBoardTest, Replay_10x_AllPackagesInOrderFaster)
+{
+    const char *file_name = "playback_test_10x.csv";
+    int num_packages = 500; // 2 seconds
+    write_recording (file_name, num_packages);
+    std::vector<int> package_nums;
+
+    double elapsed = replay (file_name, "10", num_packages, 1000, package_nums);
+
+    EXPECT_EQ (package_nums, make_range (num_packages));
+    EXPECT_GE (elapsed, 0.15);
+    EXPECT_LT (elapsed, 1.0);
+    remove (file_name);
+}
+
+TEST (PlaybackFileBoardTest, Replay_MaxSpeed_AllPackagesInOrder)
+{
+    const char *file_name = "playback_test_max.csv";
+    int num_packages = 20000; // 80 seconds, buffer holds only 5% of it
+    write_recording (file_name, num_packages);
+    std::vector<int> package_nums;
+
+    double elapsed = replay (file_name, "max", num_packages, 1000, package_nums);
+
+    EXPECT_EQ (package_nums, make_range (num_packages));
+    EXPECT_LT (elapsed, 10.0);
+    remove (file_name);
+}
+
+TEST (PlaybackFileBoardTest, Replay_MaxSpeedNotDrained_StopWhenBufferIsFull)
+{
+    const char *file_name = "playback_test_max_full.csv";
+    int num_packages = 1000;
+    write_recording (file_name, num_packages);
+    PlaybackFileBoard board (make_params (file_name));
+    std::string response;
+    ASSERT_EQ (board.prepare_session (), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (board.config_board ("set_speed:max", response), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (board.start_stream (100, ""), (int)BrainFlowExitCodes::STATUS_OK);
+
+    // get_current_board_data doesnt free space, playback waits instead of overwriting
+    std::this_thread::sleep_for (std::chrono::milliseconds (200));
+    int count = 0;
+    board.get_board_data_count ((int)BrainFlowPresets::DEFAULT_PRESET, &count);
+    EXPECT_EQ (count, 100);
+    std::vector<double> data (100 * PLAYBACK_TEST_NUM_ROWS);
+    int returned = 0;
+    board.get_current_board_data (
+        100, (int)BrainFlowPresets::DEFAULT_PRESET, data.data (), &returned);
+    ASSERT_EQ (returned, 100);
+    EXPECT_EQ (data[0], 0.0);
+    EXPECT_EQ (data[99], 99.0);
+
+    // draining resumes playback from where it stopped
+    EXPECT_EQ (drain_packages (board, num_packages, 20.0), make_range (num_packages));
+    board.release_session ();
+    remove (file_name);
+}
@@ -0,0 +1,140 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <string>
+#include <vector>
+
+#include "board.h"
+#include "board_info_getter.h"
+#include "brainflow_boards.h"
+#include "brainflow_constants.h"
+#include "preset_layout.h"
+
+using namespace testing;
+
+
+static std::vector<int> get_board_ids ()
+{
+    std::vector<int> board_ids;
+    for (auto &el : boards_struct.brainflow_boards_json["boards"].items ())
+    {
+        board_ids.push_back (std::stoi (el.key ()));
+    }
+    return board_ids;
+}
+
+static std::string get_preset_str (int preset)
+{
+    if (preset == (int)BrainFlowPresets::AUXILIARY_PRESET)
+    {
+        return "auxiliary";
+    }
+    if (preset == (int)BrainFlowPresets::ANCILLARY_PRESET)
+    {
+        return "ancillary";
+    }
+    return "default";
+}
+
+// fields which are missing for a board resolve to the same defaults PresetLayout uses
+static int get_value (int (*getter) (int, int, int *), int board_id, int preset, int missing)
+{
+    int value = 0;
+    if (getter (board_id, preset, &value) != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return missing;
+    }
+    return value;
+}
+
+static std::vector<int> get_channels (
+    int (*getter) (int, int, int *, int *), int board_id, int preset)
+{
+    int channels[512] = {0};
+    int len = 0;
+    if (getter (board_id, preset, channels, &len) != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return std::vector<int> ();
+    }
+    return std::vector<int> (channels, channels + len);
+}
+
+TEST (PresetLayout, DefaultConstructed_MissingFieldDefaults)
+{
+    PresetLayout layout;
+    EXPECT_EQ (layout.num_rows, 0);
+    EXPECT_EQ (layout.sampling_rate, 0);
+    EXPECT_EQ (layout.timestamp_channel, -1);
+    EXPECT_EQ (layout.marker_channel, -1);
+    EXPECT_EQ (layout.package_num_channel, -1);
+    EXPECT_EQ (layout.battery_channel, -1);
+    EXPECT_TRUE (layout.eeg_channels.empty ());
+}
+
+TEST (PresetLayout, EveryBoardAndPreset_MatchesBoardDescrLookups)
+{
+    // missing fields are expected, getters log them as errors
+    Board::set_log_level ((int)LogLevels::LEVEL_OFF);
+    std::vector<int> board_ids = get_board_ids ();
+    ASSERT_FALSE (board_ids.empty ());
+
+    int num_checked = 0;
+    for (int board_id : board_ids)
+    {
+        int presets[16] = {0};
+        int num_presets = 0;
+        ASSERT_EQ (get_board_presets (board_id, presets, &num_presets),
+            (int)BrainFlowExitCodes::STATUS_OK)
+            << "board " << board_id;
+        for (int i = 0; i < num_presets; i++)
+        {
+            int preset = presets[i];
+            SCOPED_TRACE ("board " + std::to_string (board_id) + " preset " +
+                std::to_string (preset));
+            // copy the preset before lookups, getters use json::operator[] which may add keys
+            json board_preset =
+                boards_struct.brainflow_boards_json["boards"][std::to_string (board_id)]
+                                                   [get_preset_str (preset)];
+            PresetLayout layout (board_preset);
+
+            EXPECT_EQ (layout.num_rows, get_value (get_num_rows, board_id, preset, 0));
+            EXPECT_EQ (layout.sampling_rate, get_value (get_sampling_rate, board_id, preset, 0));
+            EXPECT_EQ (layout.timestamp_channel,
+                get_value (get_timestamp_channel, board_id, preset, -1));
+            EXPECT_EQ (
+                layout.marker_channel, get_value (get_marker_channel, board_id, preset, -1));
+            EXPECT_EQ (layout.package_num_channel,
+                get_value (get_package_num_channel, board_id, preset, -1));
+            EXPECT_EQ (
+                layout.battery_channel, get_value (get_battery_channel, board_id, preset, -1));
+
+            EXPECT_EQ (layout.eeg_channels, get_channels (get_eeg_channels, board_id, preset));
+            EXPECT_EQ (layout.emg_channels, get_channels (get_emg_channels, board_id, preset));
+            EXPECT_EQ (layout.ecg_channels, get_channels (get_ecg_channels, board_id, preset));
+            EXPECT_EQ (layout.eog_channels, get_channels (get_eog_channels, board_id, preset));
+            EXPECT_EQ (layout.eda_channels, get_channels (get_eda_channels, board_id, preset));
+            EXPECT_EQ (layout.ppg_channels, get_channels (get_ppg_channels, board_id, preset));
+            EXPECT_EQ (
+                layout.accel_channels, get_channels (get_accel_channels, board_id, preset));
+            EXPECT_EQ (layout.gyro_channels, get_channels (get_gyro_channels, board_id, preset));
+            EXPECT_EQ (layout.magnetometer_channels,
+                get_channels (get_magnetometer_channels, board_id, preset));
+            EXPECT_EQ (layout.temperature_channels,
+                get_channels (get_temperature_channels, board_id, preset));
+            EXPECT_EQ (layout.resistance_channels,
+                get_channels (get_resistance_channels, board_id, preset));
+            EXPECT_EQ (
+                layout.analog_channels, get_channels (get_analog_channels, board_id, preset));
+            EXPECT_EQ (
+                layout.other_channels, get_channels (get_other_channels, board_id, preset));
+
+            // streaming and playback boards take the layout from the master board
+            if (layout.num_rows > 0)
+            {
+                EXPECT_LT (layout.timestamp_channel, layout.num_rows);
+            }
+            num_checked++;
+        }
+    }
+    EXPECT_GE (num_checked, (int)board_ids.size ());
+    Board::set_log_level ((int)LogLevels::LEVEL_ERROR);
+}
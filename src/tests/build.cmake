@@ -28,11 +28,62 @@ FetchContent_MakeAvailable(googletest)
 enable_testing()
 
 SET (TESTS_SRC
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/async_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/binary_file_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board_info_getter.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/brainflow_boards.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/file_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/multicast_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/playback_file_board.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/preset_layout.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/band_power_stream.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/csp.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/data_handler.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/fastica.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/fft_plan.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/iir_filter.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/wavelet_plan.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/window_functions.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/z_score_peak_detector.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/base_classifier.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/dyn_lib_classifier.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/generated/mindfulness_model.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/mindfulness_classifier.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/ml_module.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/onnx/onnx_classifier.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/onnx/onnx_output_selection.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bluetooth/bluetooth_functions.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/binary_file.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/mapped_file.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/multicast_server.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/timestamp.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/tsv_file.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/async_streamer_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/playback_file_board_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/preset_layout_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/band_power_stream_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/csp_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/eeg_metric_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/fastica_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/fft_plan_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/iir_filter_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/rolling_filter_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/wavelet_plan_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/window_functions_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/z_score_peak_detector_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/ml/ml_module_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/ml/onnx_classifier_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/ml/onnx_output_selection_unittest.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bluetooth/socket_bluetooth_test.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bluetooth/bluetooth_functions_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/binary_file_format_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/binary_file_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bounded_cache_unittest.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/data_buffer_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/shared_mutex_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/tsv_file_unittest.cpp
 )
 
 add_executable(
@@ -42,8 +93,20 @@ add_executable(
 
 target_include_directories (
     ${TESTS_EXE_NAME} PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ml/onnx/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/third_party
+    ${CMAKE_CURRENT_SOURCE_DIR}/third_party/json
+    ${CMAKE_CURRENT_SOURCE_DIR}/third_party/onnxruntime/build/native/include
+    ${CMAKE_CURRENT_SOURCE_DIR}/third_party/DSPFilters/include
+    ${CMAKE_CURRENT_SOURCE_DIR}/third_party/kissfft
+    ${CMAKE_CURRENT_SOURCE_DIR}/third_party/loguru
+    ${CMAKE_CURRENT_SOURCE_DIR}/third_party/wavelib/header
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bluetooth/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bluetooth/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bluetooth/macos_third_party
 )
@@ -51,6 +114,20 @@ target_include_directories (
 target_link_libraries(
     ${TESTS_EXE_NAME} PRIVATE
     gmock_main
+    fmt::fmt-header-only
+    ${DSPFILTERS}
+    ${WAVELIB}
+    kissfft
+)
+
+# ml module loads model libraries at runtime
+if (UNIX AND NOT ANDROID)
+    target_link_libraries (${TESTS_EXE_NAME} PRIVATE dl)
+endif (UNIX AND NOT ANDROID)
+
+# onnx models for tests are loaded from the source tree
+target_compile_definitions (${TESTS_EXE_NAME} PRIVATE
+    BRAINFLOW_TEST_MODELS_DIR="${CMAKE_CURRENT_SOURCE_DIR}/src/tests/ml/models/"
 )
 
 set_target_properties (${TESTS_EXE_NAME}
@@ -60,5 +137,60 @@ set_target_properties (${TESTS_EXE_NAME}
     RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/build/tests
 )
 
+# benchmarks are plain executables, they are built with tests but not registered in ctest
+SET (BENCHMARKS
+    data_buffer_benchmark
+    transpose_benchmark
+)
+
+foreach (BENCHMARK ${BENCHMARKS})
+    add_executable (
+        ${BENCHMARK}
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/${BENCHMARK}.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    )
+
+    target_include_directories (
+        ${BENCHMARK} PRIVATE
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/inc
+    )
+
+    set_target_properties (${BENCHMARK}
+        PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/build/tests
+    )
+
+    if (UNIX)
+        target_link_libraries (${BENCHMARK} PRIVATE pthread)
+    endif (UNIX)
+endforeach (BENCHMARK)
+
+SET (DATA_HANDLER_BENCHMARKS
+    fft_benchmark
+)
+
+foreach (BENCHMARK ${DATA_HANDLER_BENCHMARKS})
+    add_executable (
+        ${BENCHMARK}
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/data_handler/${BENCHMARK}.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/fft_plan.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/window_functions.cpp
+    )
+
+    target_include_directories (
+        ${BENCHMARK} PRIVATE
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/inc
+        ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/inc
+        ${CMAKE_CURRENT_SOURCE_DIR}/third_party/kissfft
+    )
+
+    target_link_libraries (${BENCHMARK} PRIVATE kissfft)
+
+    set_target_properties (${BENCHMARK}
+        PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/build/tests
+    )
+endforeach (BENCHMARK)
+
 include(GoogleTest)
 gtest_discover_tests(${TESTS_EXE_NAME})
\ No newline at end of file
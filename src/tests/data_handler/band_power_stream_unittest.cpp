@@ -0,0 +1,187 @@
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "band_power_stream.h"
+#include "brainflow_constants.h"
+#include "fft_plan.h"
+#include "test_signals.h"
+
+using namespace testing;
+
+
+// num_channels rows of num_samples, channels differ in phase and offset
+static std::vector<double> make_data (int num_channels, int num_samples)
+{
+    std::vector<double> data;
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        std::vector<double> signal = make_test_signal (num_samples, channel * 0.7);
+        for (double value : signal)
+        {
+            data.push_back (3.0 + channel + value);
+        }
+    }
+    return data;
+}
+
+// get_psd_welch with 80% overlap and constant detrend like in get_custom_band_powers
+static std::vector<double> reference_psd (
+    const double *data, int data_len, int nfft, int sampling_rate, bool remove_mean)
+{
+    std::vector<double> window (data, data + data_len);
+    if (remove_mean)
+    {
+        double mean = 0.0;
+        for (int i = 0; i < data_len; i++)
+        {
+            mean += window[i];
+        }
+        mean /= data_len;
+        for (int i = 0; i < data_len; i++)
+        {
+            window[i] -= mean;
+        }
+    }
+    FFTPlan *plan = get_fft_plan (nfft, (int)WindowOperations::HANNING);
+    std::vector<double> psd (nfft / 2 + 1, 0.0);
+    std::vector<double> segment (nfft / 2 + 1);
+    int counter = 0;
+    for (int pos = 0; pos + nfft <= data_len; pos += nfft - 4 * nfft / 5, counter++)
+    {
+        plan->get_psd (window.data () + pos, sampling_rate, segment.data ());
+        for (int i = 0; i < nfft / 2 + 1; i++)
+        {
+            psd[i] += segment[i];
+        }
+    }
+    for (int i = 0; i < nfft / 2; i++)
+    {
+        psd[i] /= counter;
+    }
+    return psd;
+}
+
+static void add_in_chunks (BandPowerStream &stream, const std::vector<double> &data,
+    int num_channels, int num_samples, int chunk_len)
+{
+    std::vector<double> chunk;
+    for (int offset = 0; offset < num_samples; offset += chunk_len)
+    {
+        int len = std::min (chunk_len, num_samples - offset);
+        chunk.resize (num_channels * len);
+        for (int channel = 0; channel < num_channels; channel++)
+        {
+            std::copy (data.begin () + channel * num_samples + offset,
+                data.begin () + channel * num_samples + offset + len,
+                chunk.begin () + channel * len);
+        }
+        stream.add_data (chunk.data (), len);
+    }
+}
+
+static void expect_psd_equal_to_welch (BandPowerStream &stream, const std::vector<double> &data,
+    int num_samples, int window_len, int nfft, int sampling_rate, bool remove_mean)
+{
+    std::vector<double> ampl (stream.get_psd_len ());
+    std::vector<double> freq (stream.get_psd_len ());
+    for (int channel = 0; channel < stream.get_num_channels (); channel++)
+    {
+        stream.get_psd (channel, ampl.data (), freq.data ());
+        std::vector<double> expected =
+            reference_psd (data.data () + channel * num_samples + num_samples - window_len,
+                window_len, nfft, sampling_rate, remove_mean);
+        for (int i = 0; i < nfft / 2 + 1; i++)
+        {
+            EXPECT_NEAR (ampl[i], expected[i], 1e-9 * (1.0 + expected[i]));
+            EXPECT_DOUBLE_EQ (freq[i], i * (double)sampling_rate / nfft);
+        }
+    }
+}
+
+TEST (BandPowerStreamTest, GetPSD_WindowAlignedWithHop_ReturnSameDataAsWelch)
+{
+    const int num_channels = 3;
+    const int window_len = 1000;
+    const int nfft = 512;
+    const int hop = nfft - 4 * nfft / 5;
+    const int num_samples = window_len + 7 * hop;
+    std::vector<double> data = make_data (num_channels, num_samples);
+    std::vector<double> head = make_data (num_channels, 900);
+    BandPowerStream stream (num_channels, 250, window_len, nfft, NULL, true);
+    BandPowerStream short_stream (num_channels, 250, window_len, nfft, NULL, true);
+
+    add_in_chunks (short_stream, head, num_channels, 900, 25);
+    add_in_chunks (stream, data, num_channels, num_samples, 25);
+
+    EXPECT_FALSE (short_stream.is_ready ());
+    ASSERT_TRUE (stream.is_ready ());
+    expect_psd_equal_to_welch (stream, data, num_samples, window_len, nfft, 250, true);
+}
+
+TEST (BandPowerStreamTest, GetPSDs_AllChannels_ReturnSameDataAsGetPSD)
+{
+    const int num_channels = 3;
+    const int num_samples = 1300;
+    std::vector<double> data = make_data (num_channels, num_samples);
+    std::vector<double> head = make_data (num_channels, 900);
+    BandPowerStream stream (num_channels, 250, 1000, 512, NULL, true);
+    BandPowerStream short_stream (num_channels, 250, 1000, 512, NULL, true);
+    int psd_len = stream.get_psd_len ();
+    std::vector<double> ampls (num_channels * psd_len);
+    std::vector<double> freqs (psd_len);
+    std::vector<double> channel_ampl (psd_len);
+    std::vector<double> channel_freq (psd_len);
+
+    add_in_chunks (short_stream, head, num_channels, 900, 25);
+    add_in_chunks (stream, data, num_channels, num_samples, 25);
+
+    EXPECT_FALSE (short_stream.get_psds (ampls.data (), freqs.data ()));
+    ASSERT_TRUE (stream.get_psds (ampls.data (), freqs.data ()));
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        stream.get_psd (channel, channel_ampl.data (), channel_freq.data ());
+        EXPECT_EQ (std::vector<double> (ampls.begin () + channel * psd_len,
+                       ampls.begin () + (channel + 1) * psd_len),
+            channel_ampl);
+        EXPECT_EQ (freqs, channel_freq);
+    }
+}
+
+TEST (BandPowerStreamTest, GetPSD_WindowEqualToNfft_ReturnSameDataAsWelch)
+{
+    const int num_channels = 2;
+    const int num_samples = 777;
+    std::vector<double> data = make_data (num_channels, num_samples);
+    BandPowerStream stream (num_channels, 128, 256, 256, NULL, false);
+
+    add_in_chunks (stream, data, num_channels, num_samples, 13);
+
+    expect_psd_equal_to_welch (stream, data, num_samples, 256, 256, 128, false);
+}
+
+TEST (BandPowerStreamTest, GetPSD_StreamWithFilter_ReturnWelchOfContinuouslyFilteredData)
+{
+    const int num_channels = 5;
+    const int window_len = 1000;
+    const int nfft = 512;
+    const int num_samples = window_len + 12 * (nfft - 4 * nfft / 5);
+    IIRFilterDesignKey key;
+    key.filter_operation = (int)IIRFilterOperations::BANDPASS;
+    key.filter_type = (int)FilterTypes::BUTTERWORTH;
+    key.order = 4;
+    key.sampling_rate = 250;
+    key.start_freq = 2.0;
+    key.stop_freq = 45.0;
+    key.ripple = 0.0;
+    std::shared_ptr<IIRFilter> filter (new IIRFilter (num_channels));
+    filter->add_stage (get_iir_filter_design (key));
+    IIRFilter reference_filter (num_channels);
+    reference_filter.add_stage (get_iir_filter_design (key));
+    std::vector<double> data = make_data (num_channels, num_samples);
+    BandPowerStream stream (num_channels, 250, window_len, nfft, filter, true);
+
+    add_in_chunks (stream, data, num_channels, num_samples, 40);
+    reference_filter.process_block (data.data (), num_samples);
+
+    expect_psd_equal_to_welch (stream, data, num_samples, window_len, nfft, 250, true);
+}
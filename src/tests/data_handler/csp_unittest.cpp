@@ -0,0 +1,180 @@
+#include <gmock/gmock.h>
+#include <math.h>
+#include <vector>
+
+#include "csp.h"
+
+using namespace testing;
+
+
+// epochs of class 1 have bigger variance in the first channel
+static void make_epochs (int n_epochs, int n_channels, int n_times, std::vector<double> &data,
+    std::vector<double> &labels)
+{
+    data.resize (n_epochs * n_channels * n_times);
+    labels.resize (n_epochs);
+    for (int e = 0; e < n_epochs; e++)
+    {
+        labels[e] = e % 2;
+        for (int c = 0; c < n_channels; c++)
+        {
+            for (int t = 0; t < n_times; t++)
+            {
+                double value = sin (t * (0.1 + 0.07 * c) + e) + 0.3 * cos (t * 1.3 * (c + 1)) + c;
+                if ((c == 0) && (labels[e] == 1))
+                {
+                    value *= 3.0;
+                }
+                data[(e * n_channels + c) * n_times + t] = value;
+            }
+        }
+    }
+}
+
+// covariances accumulated epoch by epoch on copies of data
+static void reference_csp (const std::vector<double> &data, const std::vector<double> &labels,
+    int n_epochs, int n_channels, int n_times, RowMajorMatrix &filters, Eigen::VectorXd &values)
+{
+    RowMajorMatrix sum1 = RowMajorMatrix::Zero (n_channels, n_channels);
+    RowMajorMatrix sum2 = RowMajorMatrix::Zero (n_channels, n_channels);
+    int n_class1 = 0;
+    int n_class2 = 0;
+    for (int e = 0; e < n_epochs; e++)
+    {
+        RowMajorMatrix x (n_channels, n_times);
+        for (int c = 0; c < n_channels; c++)
+        {
+            for (int t = 0; t < n_times; t++)
+            {
+                x (c, t) = data[(e * n_channels + c) * n_times + t];
+            }
+            x.row (c).array () -= x.row (c).mean ();
+        }
+        if (labels[e] == 0)
+        {
+            sum1 += (x * x.transpose ()) / double (n_times);
+            n_class1++;
+        }
+        else
+        {
+            sum2 += (x * x.transpose ()) / double (n_times);
+            n_class2++;
+        }
+    }
+    sum1 /= double (n_class1);
+    sum2 /= double (n_class2);
+    Eigen::GeneralizedSelfAdjointEigenSolver<RowMajorMatrix> ges (sum1, sum1 + sum2);
+    values = ges.eigenvalues ();
+    filters = ges.eigenvectors ().transpose ();
+}
+
+TEST (CSPTest, Compute_NoShrinkage_MatchEpochByEpochCovariances)
+{
+    int n_epochs = 40;
+    int n_channels = 6;
+    int n_times = 200;
+    std::vector<double> data;
+    std::vector<double> labels;
+    make_epochs (n_epochs, n_channels, n_times, data, labels);
+
+    CSP csp (n_channels);
+    ASSERT_EQ ((int)BrainFlowExitCodes::STATUS_OK,
+        csp.compute (data.data (), labels.data (), n_epochs, n_times));
+    std::vector<double> filters (n_channels * n_channels);
+    std::vector<double> values (n_channels);
+    csp.get_filters (filters.data (), values.data ());
+
+    RowMajorMatrix expected_filters;
+    Eigen::VectorXd expected_values;
+    reference_csp (
+        data, labels, n_epochs, n_channels, n_times, expected_filters, expected_values);
+    for (int i = 0; i < n_channels; i++)
+    {
+        EXPECT_NEAR (values[i], expected_values (i), 1e-9);
+        // eigenvectors are defined up to a sign
+        double sign = (filters[i * n_channels] * expected_filters (i, 0) < 0) ? -1.0 : 1.0;
+        for (int j = 0; j < n_channels; j++)
+        {
+            EXPECT_NEAR (sign * filters[i * n_channels + j], expected_filters (i, j), 1e-6);
+        }
+    }
+}
+
+TEST (CSPTest, Compute_FullShrinkage_ReturnEqualEigenvalues)
+{
+    int n_epochs = 10;
+    int n_channels = 4;
+    int n_times = 100;
+    std::vector<double> data;
+    std::vector<double> labels;
+    make_epochs (n_epochs, n_channels, n_times, data, labels);
+
+    // both covariances become scaled identity matrices, so all eigenvalues are the same
+    CSP csp (n_channels, 1.0);
+    ASSERT_EQ ((int)BrainFlowExitCodes::STATUS_OK,
+        csp.compute (data.data (), labels.data (), n_epochs, n_times));
+    std::vector<double> filters (n_channels * n_channels);
+    std::vector<double> values (n_channels);
+    csp.get_filters (filters.data (), values.data ());
+    for (int i = 1; i < n_channels; i++)
+    {
+        EXPECT_NEAR (values[i], values[0], 1e-9);
+    }
+}
+
+TEST (CSPTest, Compute_InvalidLabels_ReturnError)
+{
+    int n_channels = 3;
+    int n_times = 50;
+    std::vector<double> data;
+    std::vector<double> labels;
+    make_epochs (4, n_channels, n_times, data, labels);
+    CSP csp (n_channels);
+
+    labels[2] = 2;
+    EXPECT_EQ ((int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR,
+        csp.compute (data.data (), labels.data (), 4, n_times));
+    // single class
+    std::vector<double> zeros (4, 0.0);
+    EXPECT_EQ ((int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR,
+        csp.compute (data.data (), zeros.data (), 4, n_times));
+    EXPECT_EQ ((int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR,
+        CSP (n_channels, 1.5).compute (data.data (), labels.data (), 4, n_times));
+}
+
+TEST (CSPTest, ApplyFilters_Chunks_MatchWholeData)
+{
+    int n_filters = 2;
+    int n_channels = 3;
+    int n_times = 20;
+    std::vector<double> filters = {1.0, 0.5, -1.0, 0.0, 2.0, 0.25};
+    std::vector<double> data (n_channels * n_times);
+    for (int i = 0; i < n_channels * n_times; i++)
+    {
+        data[i] = sin (i * 0.7);
+    }
+
+    std::vector<double> output (n_filters * n_times);
+    CSP::apply_filters (
+        filters.data (), n_filters, n_channels, data.data (), n_times, output.data ());
+    for (int f = 0; f < n_filters; f++)
+    {
+        for (int t = 0; t < n_times; t++)
+        {
+            double expected = 0;
+            for (int c = 0; c < n_channels; c++)
+            {
+                expected += filters[f * n_channels + c] * data[c * n_times + t];
+            }
+            EXPECT_NEAR (output[f * n_times + t], expected, 1e-12);
+        }
+    }
+
+    // single sample of a stream
+    std::vector<double> sample = {data[5], data[n_times + 5], data[2 * n_times + 5]};
+    std::vector<double> sample_output (n_filters);
+    CSP::apply_filters (
+        filters.data (), n_filters, n_channels, sample.data (), 1, sample_output.data ());
+    EXPECT_NEAR (sample_output[0], output[5], 1e-12);
+    EXPECT_NEAR (sample_output[1], output[n_times + 5], 1e-12);
+}
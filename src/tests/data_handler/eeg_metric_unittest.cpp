@@ -0,0 +1,183 @@
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "brainflow_model_params.h"
+#include "data_handler.h"
+#include "mindfulness_classifier.h"
+#include "restfulness_classifier.h"
+#include "test_signals.h"
+
+using namespace testing;
+
+
+static const int sampling_rate = 250;
+static const int num_channels = 4;
+
+// num_channels rows of num_samples, channels differ in phase and scale
+static std::vector<double> make_eeg (int num_samples)
+{
+    std::vector<double> data;
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        std::vector<double> signal = make_test_signal (num_samples, channel * 0.7);
+        for (double &value : signal)
+        {
+            data.push_back (value * (10.0 + channel));
+        }
+    }
+    return data;
+}
+
+// window_len samples of each channel which end at sample end
+static std::vector<double> get_window (
+    const std::vector<double> &data, int num_samples, int end, int window_len)
+{
+    std::vector<double> window;
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        auto last = data.begin () + channel * num_samples + end;
+        window.insert (window.end (), last - window_len, last);
+    }
+    return window;
+}
+
+static double predict_with_classifier (
+    BaseClassifier &classifier, std::vector<double> &data, int num_samples, int apply_filters)
+{
+    double start_freqs[5] = {2.0, 4.0, 8.0, 13.0, 30.0};
+    double stop_freqs[5] = {4.0, 8.0, 13.0, 30.0, 45.0};
+    double avg_band_powers[5];
+    double stddev_band_powers[5];
+    EXPECT_EQ (get_custom_band_powers (data.data (), num_channels, num_samples, start_freqs,
+                   stop_freqs, 5, sampling_rate, apply_filters, avg_band_powers,
+                   stddev_band_powers),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    double output = -1.0;
+    int output_len = 0;
+    EXPECT_EQ (classifier.predict (avg_band_powers, 5, &output, &output_len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    return output;
+}
+
+TEST (EegMetricTest, GetEegMetric_BuiltInMetrics_ReturnSameDataAsBandPowersAndClassifier)
+{
+    const int num_samples = 4 * sampling_rate;
+    std::vector<double> data = make_eeg (num_samples);
+    MindfulnessClassifier mindfulness (BrainFlowModelParams (
+        (int)BrainFlowMetrics::MINDFULNESS, (int)BrainFlowClassifiers::DEFAULT_CLASSIFIER));
+    RestfulnessClassifier restfulness (BrainFlowModelParams (
+        (int)BrainFlowMetrics::RESTFULNESS, (int)BrainFlowClassifiers::DEFAULT_CLASSIFIER));
+
+    for (int apply_filters = 0; apply_filters < 2; apply_filters++)
+    {
+        double mindfulness_score = -1.0;
+        double restfulness_score = -1.0;
+
+        ASSERT_EQ (get_eeg_metric (data.data (), num_channels, num_samples, sampling_rate,
+                       (int)BrainFlowMetrics::MINDFULNESS, apply_filters, &mindfulness_score),
+            (int)BrainFlowExitCodes::STATUS_OK);
+        ASSERT_EQ (get_eeg_metric (data.data (), num_channels, num_samples, sampling_rate,
+                       (int)BrainFlowMetrics::RESTFULNESS, apply_filters, &restfulness_score),
+            (int)BrainFlowExitCodes::STATUS_OK);
+
+        EXPECT_EQ (mindfulness_score,
+            predict_with_classifier (mindfulness, data, num_samples, apply_filters));
+        EXPECT_EQ (restfulness_score,
+            predict_with_classifier (restfulness, data, num_samples, apply_filters));
+        EXPECT_GT (mindfulness_score, 0.0);
+        EXPECT_LT (mindfulness_score, 1.0);
+    }
+}
+
+TEST (EegMetricTest, GetBandPowerStreamMetric_WindowAlignedWithHop_ReturnSameDataAsBatch)
+{
+    const int window_len = 4 * sampling_rate;
+    // nfft of get_custom_band_powers for this window and 80% overlap
+    const int hop = 512 - 4 * 512 / 5;
+    const int num_samples = window_len + 10 * hop;
+    std::vector<double> data = make_eeg (num_samples);
+    int stream_id = -1;
+    ASSERT_EQ (create_band_power_stream (sampling_rate, window_len, num_channels, 0, &stream_id),
+        (int)BrainFlowExitCodes::STATUS_OK);
+
+    int num_added = 0;
+    for (int step = 0; step <= 10; step++)
+    {
+        int chunk_len = (step == 0) ? window_len : hop;
+        std::vector<double> chunk;
+        for (int channel = 0; channel < num_channels; channel++)
+        {
+            auto start = data.begin () + channel * num_samples + num_added;
+            chunk.insert (chunk.end (), start, start + chunk_len);
+        }
+        ASSERT_EQ (add_band_power_stream_data (stream_id, chunk.data (), num_channels, chunk_len),
+            (int)BrainFlowExitCodes::STATUS_OK);
+        num_added += chunk_len;
+
+        // stream without filters sees the same window as the batch call
+        std::vector<double> window = get_window (data, num_samples, num_added, window_len);
+        for (int metric : {(int)BrainFlowMetrics::MINDFULNESS, (int)BrainFlowMetrics::RESTFULNESS})
+        {
+            double stream_score = -1.0;
+            double batch_score = -1.0;
+            ASSERT_EQ (get_band_power_stream_metric (stream_id, metric, &stream_score),
+                (int)BrainFlowExitCodes::STATUS_OK);
+            ASSERT_EQ (get_eeg_metric (window.data (), num_channels, window_len, sampling_rate,
+                           metric, 0, &batch_score),
+                (int)BrainFlowExitCodes::STATUS_OK);
+            EXPECT_NEAR (stream_score, batch_score, 1e-9);
+        }
+    }
+    EXPECT_EQ (release_band_power_stream (stream_id), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (EegMetricTest, GetEegMetric_InvalidArguments_ReturnError)
+{
+    const int num_samples = 4 * sampling_rate;
+    std::vector<double> data = make_eeg (num_samples);
+    double output = -1.0;
+
+    EXPECT_EQ (get_eeg_metric (data.data (), num_channels, num_samples, sampling_rate,
+                   (int)BrainFlowMetrics::USER_DEFINED, 0, &output),
+        (int)BrainFlowExitCodes::UNSUPPORTED_CLASSIFIER_AND_METRIC_COMBINATION_ERROR);
+    EXPECT_EQ (get_eeg_metric (data.data (), 0, num_samples, sampling_rate,
+                   (int)BrainFlowMetrics::MINDFULNESS, 0, &output),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (get_eeg_metric (data.data (), num_channels, num_samples, sampling_rate,
+                   (int)BrainFlowMetrics::MINDFULNESS, 0, NULL),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (get_eeg_metric (NULL, num_channels, num_samples, sampling_rate,
+                   (int)BrainFlowMetrics::MINDFULNESS, 0, &output),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (output, -1.0);
+}
+
+TEST (EegMetricTest, GetBandPowerStreamMetric_InvalidArguments_ReturnError)
+{
+    const int window_len = 4 * sampling_rate;
+    std::vector<double> data = make_eeg (window_len);
+    int stream_id = -1;
+    double output = -1.0;
+    const int mindfulness = (int)BrainFlowMetrics::MINDFULNESS;
+    ASSERT_EQ (create_band_power_stream (sampling_rate, window_len, num_channels, 1, &stream_id),
+        (int)BrainFlowExitCodes::STATUS_OK);
+
+    EXPECT_EQ (get_band_power_stream_metric (stream_id, mindfulness, &output),
+        (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR);
+    EXPECT_EQ (add_band_power_stream_data (stream_id, data.data (), num_channels - 1, window_len),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    ASSERT_EQ (add_band_power_stream_data (stream_id, data.data (), num_channels, window_len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (get_band_power_stream_metric (
+                   stream_id, (int)BrainFlowMetrics::USER_DEFINED, &output),
+        (int)BrainFlowExitCodes::UNSUPPORTED_CLASSIFIER_AND_METRIC_COMBINATION_ERROR);
+    EXPECT_EQ (get_band_power_stream_metric (stream_id, mindfulness, NULL),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (output, -1.0);
+    ASSERT_EQ (get_band_power_stream_metric (stream_id, mindfulness, &output),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (release_band_power_stream (stream_id), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (get_band_power_stream_metric (stream_id, mindfulness, &output),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+}
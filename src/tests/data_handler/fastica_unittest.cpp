@@ -0,0 +1,118 @@
+#include <gmock/gmock.h>
+#include <math.h>
+#include <vector>
+
+#include "fastica.h"
+
+using namespace testing;
+
+
+// sine, square and sawtooth mixed into 3 channels, rows are channels
+static Eigen::MatrixXd make_sources (int n_times)
+{
+    Eigen::MatrixXd sources (3, n_times);
+    for (int t = 0; t < n_times; t++)
+    {
+        sources (0, t) = sin (t * 0.05);
+        sources (1, t) = (sin (t * 0.013) > 0) ? 1.0 : -1.0;
+        sources (2, t) = fmod (t * 0.031, 2.0) - 1.0;
+    }
+    return sources;
+}
+
+static Eigen::MatrixXd mix (const Eigen::MatrixXd &sources)
+{
+    Eigen::MatrixXd mixing (3, 3);
+    mixing << 1.0, 0.5, 0.3, 0.4, 1.0, 0.6, 0.2, 0.7, 1.0;
+    return mixing * sources;
+}
+
+static double max_abs_correlation (const Eigen::MatrixXd &sources, const double *component)
+{
+    int n_times = (int)sources.cols ();
+    Eigen::Map<const Eigen::VectorXd> c (component, n_times);
+    Eigen::VectorXd centered_c = c.array () - c.mean ();
+    double best = 0;
+    for (int i = 0; i < sources.rows (); i++)
+    {
+        Eigen::VectorXd s = sources.row (i).transpose ();
+        s.array () -= s.mean ();
+        double corr = fabs (s.dot (centered_c)) / (s.norm () * centered_c.norm ());
+        best = (corr > best) ? corr : best;
+    }
+    return best;
+}
+
+static void check_components (FastICA &ica, const Eigen::MatrixXd &sources)
+{
+    int n_times = (int)sources.cols ();
+    std::vector<double> w (9);
+    std::vector<double> k (9);
+    std::vector<double> a (9);
+    std::vector<double> s (3 * n_times);
+    ASSERT_EQ ((int)BrainFlowExitCodes::STATUS_OK,
+        ica.get_matrixes (w.data (), k.data (), a.data (), s.data ()));
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_GT (max_abs_correlation (sources, s.data () + i * n_times), 0.99);
+    }
+}
+
+TEST (FastICATest, Compute_MixedSources_RecoverSources)
+{
+    Eigen::MatrixXd sources = make_sources (5000);
+    Eigen::MatrixXd data = mix (sources);
+    FastICA ica (3);
+    ASSERT_EQ ((int)BrainFlowExitCodes::STATUS_OK, ica.compute (data));
+    EXPECT_LT (ica.get_num_iterations (), 299);
+    check_components (ica, sources);
+}
+
+TEST (FastICATest, Compute_Float32_RecoverSources)
+{
+    Eigen::MatrixXd sources = make_sources (5000);
+    Eigen::MatrixXd data = mix (sources);
+    FastICA ica (3, 300, 1e-4, true);
+    ASSERT_EQ ((int)BrainFlowExitCodes::STATUS_OK, ica.compute (data));
+    check_components (ica, sources);
+}
+
+TEST (FastICATest, Compute_WarmStart_ConvergeFaster)
+{
+    Eigen::MatrixXd sources = make_sources (5000);
+    Eigen::MatrixXd data = mix (sources);
+    FastICA cold (3, 300, 1e-6);
+    ASSERT_EQ ((int)BrainFlowExitCodes::STATUS_OK, cold.compute (data));
+    std::vector<double> w (9);
+    std::vector<double> k (9);
+    std::vector<double> a (9);
+    std::vector<double> s (3 * 5000);
+    cold.get_matrixes (w.data (), k.data (), a.data (), s.data ());
+
+    // the same recording, W from the previous run is already a fixed point
+    Eigen::MatrixXd w_init =
+        Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> (w.data ());
+    FastICA warm (3, 300, 1e-6);
+    warm.set_init_w (w_init);
+    data = mix (sources);
+    ASSERT_EQ ((int)BrainFlowExitCodes::STATUS_OK, warm.compute (data));
+    EXPECT_LE (warm.get_num_iterations (), 3);
+    EXPECT_LT (warm.get_num_iterations (), cold.get_num_iterations ());
+    check_components (warm, sources);
+}
+
+TEST (FastICATest, Compute_MaxIterations_StopEarly)
+{
+    Eigen::MatrixXd data = mix (make_sources (1000));
+    FastICA ica (3, 2, 1e-12);
+    ASSERT_EQ ((int)BrainFlowExitCodes::STATUS_OK, ica.compute (data));
+    EXPECT_EQ (ica.get_num_iterations (), 1);
+}
+
+TEST (FastICATest, Compute_InvalidArgs_ReturnError)
+{
+    Eigen::MatrixXd data = mix (make_sources (100));
+    EXPECT_EQ ((int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR, FastICA (4).compute (data));
+    EXPECT_EQ ((int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR, FastICA (1).compute (data));
+    EXPECT_EQ ((int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR, FastICA (3, 0).compute (data));
+}
@@ -0,0 +1,125 @@
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "fft_plan.h"
+#include "window_functions.h"
+
+// Compares Welch PSD computed the way get_psd_welch used to work (kissfft config, window and
+// buffers allocated for each segment) with a cached FFTPlan shared by all segments.
+// Data is 10s at 250Hz per channel, 80% overlap like in get_custom_band_powers.
+
+
+static void old_segment_psd (
+    const double *data, int nfft, int sampling_rate, int window_function, double *output_ampl)
+{
+    double *windowed_data = new double[nfft];
+    fill_window (window_function, nfft, windowed_data);
+    for (int i = 0; i < nfft; i++)
+    {
+        windowed_data[i] *= data[i];
+    }
+    kiss_fft_cpx *sout = new kiss_fft_cpx[nfft];
+    kiss_fftr_cfg cfg = kiss_fftr_alloc (nfft, 0, 0, 0);
+    kiss_fftr (cfg, windowed_data, sout);
+    double *re = new double[nfft / 2 + 1];
+    double *im = new double[nfft / 2 + 1];
+    for (int i = 0; i < nfft / 2 + 1; i++)
+    {
+        re[i] = sout[i].r;
+        im[i] = sout[i].i;
+    }
+    for (int i = 0; i < nfft / 2 + 1; i++)
+    {
+        output_ampl[i] = (re[i] * re[i] + im[i] * im[i]) / ((double)(sampling_rate * nfft));
+        if ((i != 0) && (i != nfft / 2))
+        {
+            output_ampl[i] *= 2;
+        }
+    }
+    delete[] re;
+    delete[] im;
+    delete[] sout;
+    delete[] windowed_data;
+    kiss_fftr_free (cfg);
+}
+
+template <typename Func>
+static double measure_us (Func func, int iterations)
+{
+    auto start = std::chrono::high_resolution_clock::now ();
+    for (int i = 0; i < iterations; i++)
+    {
+        func ();
+    }
+    auto stop = std::chrono::high_resolution_clock::now ();
+    return std::chrono::duration<double, std::micro> (stop - start).count () / iterations;
+}
+
+int main ()
+{
+    int channels[] = {8, 32, 64};
+    int nffts[] = {256, 512, 1024};
+    const int sampling_rate = 250;
+    const int cols = 2500;
+    const int window_function = (int)WindowOperations::HANNING;
+
+    for (int num_channels : channels)
+    {
+        std::vector<double> data (num_channels * cols);
+        for (size_t i = 0; i < data.size (); i++)
+        {
+            data[i] = sin (i * 0.07) + 0.3 * sin (i * 0.9);
+        }
+        for (int nfft : nffts)
+        {
+            int step = nfft - 4 * nfft / 5;
+            std::vector<double> ampls (nfft / 2 + 1);
+            std::vector<double> output (nfft / 2 + 1);
+            int iterations = 10;
+
+            double old_time = measure_us (
+                [&] ()
+                {
+                    for (int channel = 0; channel < num_channels; channel++)
+                    {
+                        const double *row = data.data () + channel * cols;
+                        for (int pos = 0; pos + nfft <= cols; pos += step)
+                        {
+                            old_segment_psd (
+                                row + pos, nfft, sampling_rate, window_function, ampls.data ());
+                            for (int i = 0; i < nfft / 2 + 1; i++)
+                            {
+                                output[i] += ampls[i];
+                            }
+                        }
+                    }
+                },
+                iterations);
+            double new_time = measure_us (
+                [&] ()
+                {
+                    for (int channel = 0; channel < num_channels; channel++)
+                    {
+                        const double *row = data.data () + channel * cols;
+                        FFTPlan *plan = get_fft_plan (nfft, window_function);
+                        for (int pos = 0; pos + nfft <= cols; pos += step)
+                        {
+                            plan->get_psd (row + pos, sampling_rate, ampls.data ());
+                            for (int i = 0; i < nfft / 2 + 1; i++)
+                            {
+                                output[i] += ampls[i];
+                            }
+                        }
+                    }
+                },
+                iterations);
+            printf ("channels: %2d nfft: %4d plan per segment: %10.1f us cached plan: %10.1f us "
+                    "speedup: %.2fx\n",
+                num_channels, nfft, old_time, new_time, old_time / new_time);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <gmock/gmock.h>
+#include <math.h>
+#include <thread>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "fft_plan.h"
+#include "test_signals.h"
+#include "window_functions.h"
+
+using namespace testing;
+
+
+// windowed real fft computed by kissfft directly
+static std::vector<kiss_fft_cpx> reference_fft (const std::vector<double> &data, int window)
+{
+    int nfft = (int)data.size ();
+    std::vector<double> windowed (nfft);
+    fill_window (window, nfft, windowed.data ());
+    for (int i = 0; i < nfft; i++)
+    {
+        windowed[i] *= data[i];
+    }
+    std::vector<kiss_fft_cpx> expected (nfft / 2 + 1);
+    kiss_fftr_cfg cfg = kiss_fftr_alloc (nfft, 0, NULL, NULL);
+    kiss_fftr (cfg, windowed.data (), expected.data ());
+    kiss_fftr_free (cfg);
+    return expected;
+}
+
+TEST (FFTPlanTest, PerformFFT_CachedPlan_ReturnSameDataAsKissFFT)
+{
+    const int nfft = 128;
+    std::vector<double> data = make_test_signal (nfft);
+    std::vector<kiss_fft_cpx> expected =
+        reference_fft (data, (int)WindowOperations::BLACKMAN_HARRIS);
+    std::vector<double> re (nfft / 2 + 1);
+    std::vector<double> im (nfft / 2 + 1);
+    FFTPlan *plan = get_fft_plan (nfft, (int)WindowOperations::BLACKMAN_HARRIS);
+
+    // second call checks that scratch buffers dont leak state between calls
+    plan->perform_fft (make_test_signal (nfft * 2).data () + nfft, re.data (), im.data ());
+    plan->perform_fft (data.data (), re.data (), im.data ());
+
+    for (int i = 0; i < nfft / 2 + 1; i++)
+    {
+        EXPECT_EQ (re[i], expected[i].r);
+        EXPECT_EQ (im[i], expected[i].i);
+    }
+}
+
+TEST (FFTPlanTest, PerformFFT_SameParamsInSeveralThreads_ReturnSameDataAsKissFFT)
+{
+    const int nfft = 512;
+    std::vector<double> data = make_test_signal (nfft, 2.0);
+    std::vector<kiss_fft_cpx> expected = reference_fft (data, (int)WindowOperations::HAMMING);
+    std::vector<std::vector<double>> re (4, std::vector<double> (nfft / 2 + 1));
+    std::vector<std::vector<double>> im (4, std::vector<double> (nfft / 2 + 1));
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.push_back (std::thread ([&, t] () {
+            FFTPlan *plan = get_fft_plan (nfft, (int)WindowOperations::HAMMING);
+            for (int j = 0; j < 50; j++)
+            {
+                plan->perform_fft (data.data (), re[t].data (), im[t].data ());
+            }
+        }));
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join ();
+    }
+
+    for (int t = 0; t < 4; t++)
+    {
+        for (int i = 0; i < nfft / 2 + 1; i++)
+        {
+            EXPECT_EQ (re[t][i], expected[i].r);
+            EXPECT_EQ (im[t][i], expected[i].i);
+        }
+    }
+}
+
+TEST (FFTPlanTest, PerformIFFT_SpectrumOfData_RestoreData)
+{
+    const int nfft = 64;
+    std::vector<double> data = make_test_signal (nfft);
+    std::vector<double> re (nfft / 2 + 1);
+    std::vector<double> im (nfft / 2 + 1);
+    std::vector<double> restored (nfft);
+    FFTPlan *plan = get_fft_plan (nfft, (int)WindowOperations::NO_WINDOW);
+
+    plan->perform_fft (data.data (), re.data (), im.data ());
+    plan->perform_ifft (re.data (), im.data (), restored.data ());
+
+    for (int i = 0; i < nfft; i++)
+    {
+        EXPECT_NEAR (restored[i], data[i], 1e-12);
+    }
+}
+
+TEST (FFTPlanTest, GetPSD_SineWave_ReturnPeakAtSineFreq)
+{
+    const int nfft = 256;
+    const int sampling_rate = 256;
+    std::vector<double> data (nfft);
+    for (int i = 0; i < nfft; i++)
+    {
+        data[i] = sin (2.0 * M_PI * 10.0 * i / sampling_rate);
+    }
+    std::vector<double> ampl (nfft / 2 + 1);
+
+    get_fft_plan (nfft, (int)WindowOperations::NO_WINDOW)
+        ->get_psd (data.data (), sampling_rate, ampl.data ());
+
+    int max_index = 0;
+    for (int i = 1; i < nfft / 2 + 1; i++)
+    {
+        if (ampl[i] > ampl[max_index])
+        {
+            max_index = i;
+        }
+    }
+    EXPECT_EQ (max_index, 10);
+    // parseval: power of unit sine is 0.5, freq resolution is 1
+    EXPECT_NEAR (ampl[10], 0.5, 1e-9);
+}
+
+TEST (FFTPlanTest, GetFFTPlan_InvalidParams_ReturnNull)
+{
+    EXPECT_EQ (get_fft_plan (255, (int)WindowOperations::HANNING), nullptr);
+    EXPECT_EQ (get_fft_plan (0, (int)WindowOperations::HANNING), nullptr);
+    EXPECT_EQ (get_fft_plan (256, 100), nullptr);
+}
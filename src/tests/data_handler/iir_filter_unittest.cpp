@@ -0,0 +1,191 @@
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <math.h>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "iir_filter.h"
+#include "test_signals.h"
+
+#include "DspFilters/Dsp.h"
+
+using namespace testing;
+
+
+static IIRFilterDesignKey make_key (
+    int filter_operation, int filter_type, double start_freq, double stop_freq)
+{
+    IIRFilterDesignKey key;
+    key.filter_operation = filter_operation;
+    key.filter_type = filter_type;
+    key.order = 4;
+    key.sampling_rate = 250;
+    key.start_freq = start_freq;
+    key.stop_freq = stop_freq;
+    key.ripple = 0.5;
+    return key;
+}
+
+TEST (IIRFilterTest, Process_CachedDesign_ReturnSameDataAsFilterDesign)
+{
+    std::vector<double> expected = make_test_signal (500);
+    std::vector<double> data = expected;
+    Dsp::FilterDesign<Dsp::ChebyshevI::Design::BandPass<MAX_FILTER_ORDER>, 1> reference;
+    Dsp::Params params;
+    params[0] = 250;
+    params[1] = 4;
+    params[2] = 17.5;
+    params[3] = 25.0;
+    params[4] = 0.5;
+    reference.setParams (params);
+    double *channels[1] = {expected.data ()};
+    reference.process ((int)expected.size (), channels);
+
+    IIRFilter filter (1);
+    filter.add_stage (get_iir_filter_design (make_key (
+        (int)IIRFilterOperations::BANDPASS, (int)FilterTypes::CHEBYSHEV_TYPE_1, 5.0, 30.0)));
+    filter.process (0, data.data (), (int)data.size ());
+
+    for (size_t i = 0; i < data.size (); i++)
+    {
+        EXPECT_EQ (data[i], expected[i]);
+    }
+}
+
+TEST (IIRFilterTest, Process_DataSplitIntoChunks_ReturnSameDataAsSingleCall)
+{
+    std::vector<double> expected = make_test_signal (1000);
+    std::vector<double> data = expected;
+    IIRFilter whole (1);
+    IIRFilter chunked (1);
+    for (int stage = 0; stage < 2; stage++)
+    {
+        std::shared_ptr<const IIRFilterDesign> design = get_iir_filter_design (
+            make_key ((int)IIRFilterOperations::BANDSTOP, (int)FilterTypes::BUTTERWORTH,
+                48.0 + stage * 10.0, 52.0 + stage * 10.0));
+        whole.add_stage (design);
+        chunked.add_stage (design);
+    }
+
+    whole.process (0, expected.data (), (int)expected.size ());
+    for (int offset = 0; offset < (int)data.size (); offset += 37)
+    {
+        chunked.process (0, data.data () + offset, std::min (37, (int)data.size () - offset));
+    }
+
+    for (size_t i = 0; i < data.size (); i++)
+    {
+        EXPECT_DOUBLE_EQ (data[i], expected[i]);
+    }
+}
+
+TEST (IIRFilterTest, ProcessBlock_OddNumberOfChannels_ReturnSameDataAsProcess)
+{
+    const int num_channels = 7; // doesnt fit into simd lanes
+    const int num_samples = 700;
+    std::vector<double> expected (num_channels * num_samples);
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        std::vector<double> signal = make_test_signal (num_samples + channel * 11);
+        std::copy (signal.begin () + channel * 11, signal.end (),
+            expected.begin () + channel * num_samples);
+    }
+    std::vector<double> data = expected;
+    IIRFilter per_channel (num_channels);
+    IIRFilter block (num_channels);
+    std::shared_ptr<const IIRFilterDesign> notch = get_iir_filter_design (make_key (
+        (int)IIRFilterOperations::BANDSTOP, (int)FilterTypes::BUTTERWORTH, 48.0, 52.0));
+    std::shared_ptr<const IIRFilterDesign> bandpass = get_iir_filter_design (make_key (
+        (int)IIRFilterOperations::BANDPASS, (int)FilterTypes::CHEBYSHEV_TYPE_1, 3.0, 45.0));
+    per_channel.add_stage (notch);
+    per_channel.add_stage (bandpass);
+    block.add_stage (notch);
+    block.add_stage (bandpass);
+
+    for (int channel = 0; channel < num_channels; channel++)
+    {
+        per_channel.process (channel, expected.data () + channel * num_samples, num_samples);
+    }
+    // two blocks to check that history of all channels is kept
+    std::vector<double> chunk (num_channels * 300);
+    for (int offset = 0; offset < num_samples; offset += 300)
+    {
+        int chunk_len = std::min (300, num_samples - offset);
+        for (int channel = 0; channel < num_channels; channel++)
+        {
+            std::copy (data.begin () + channel * num_samples + offset,
+                data.begin () + channel * num_samples + offset + chunk_len,
+                chunk.begin () + channel * chunk_len);
+        }
+        block.process_block (chunk.data (), chunk_len);
+        for (int channel = 0; channel < num_channels; channel++)
+        {
+            std::copy (chunk.begin () + channel * chunk_len,
+                chunk.begin () + (channel + 1) * chunk_len,
+                data.begin () + channel * num_samples + offset);
+        }
+    }
+
+    for (size_t i = 0; i < data.size (); i++)
+    {
+        EXPECT_EQ (data[i], expected[i]);
+    }
+}
+
+TEST (IIRFilterTest, Reset_FilterWithHistory_StartFromZeroHistory)
+{
+    std::vector<double> first = make_test_signal (100);
+    std::vector<double> second = first;
+    IIRFilter filter (2);
+    filter.add_stage (get_iir_filter_design (
+        make_key ((int)IIRFilterOperations::HIGHPASS, (int)FilterTypes::BESSEL, 1.0, 0.0)));
+
+    filter.process (0, first.data (), (int)first.size ());
+    filter.process (1, first.data (), (int)first.size ()); // channels are independent
+    filter.reset ();
+    filter.process (1, second.data (), (int)second.size ());
+
+    std::vector<double> original = make_test_signal (100);
+    IIRFilter fresh (1);
+    fresh.add_stage (get_iir_filter_design (
+        make_key ((int)IIRFilterOperations::HIGHPASS, (int)FilterTypes::BESSEL, 1.0, 0.0)));
+    fresh.process (0, original.data (), (int)original.size ());
+    for (size_t i = 0; i < second.size (); i++)
+    {
+        EXPECT_EQ (second[i], original[i]);
+    }
+}
+
+TEST (IIRFilterTest, Process_DesignEvictedFromCache_ReturnSameDataAsNewDesign)
+{
+    IIRFilterDesignKey key = make_key (
+        (int)IIRFilterOperations::LOWPASS, (int)FilterTypes::BUTTERWORTH, 30.0, 0.0);
+    std::vector<double> expected = make_test_signal (300);
+    std::vector<double> data = expected;
+    IIRFilter held (1);
+    held.add_stage (get_iir_filter_design (key));
+
+    // more distinct designs than the cache keeps, filter must keep its own design alive
+    for (int i = 0; i < 300; i++)
+    {
+        IIRFilterDesignKey other = key;
+        other.start_freq = 1.0 + i * 0.25;
+        ASSERT_NE (get_iir_filter_design (other), nullptr);
+    }
+    IIRFilter fresh (1);
+    fresh.add_stage (get_iir_filter_design (key));
+    held.process (0, data.data (), (int)data.size ());
+    fresh.process (0, expected.data (), (int)expected.size ());
+
+    for (size_t i = 0; i < data.size (); i++)
+    {
+        EXPECT_EQ (data[i], expected[i]);
+    }
+}
+
+TEST (IIRFilterTest, GetDesign_InvalidFilterType_ReturnNull)
+{
+    IIRFilterDesignKey key = make_key ((int)IIRFilterOperations::BANDPASS, 100, 5.0, 30.0);
+
+    EXPECT_EQ (get_iir_filter_design (key), nullptr);
+}
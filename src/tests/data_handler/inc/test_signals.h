@@ -0,0 +1,16 @@
+#pragma once
+
+#include <math.h>
+#include <vector>
+
+
+// deterministic mix of tones and a slow trend, shift changes phase of the main tone
+inline std::vector<double> make_test_signal (int len, double shift = 0.0)
+{
+    std::vector<double> signal (len);
+    for (int i = 0; i < len; i++)
+    {
+        signal[i] = sin (i * 0.3 + shift) + 0.5 * sin (i * 1.3) + 0.25 * cos (i * 1.7) + 0.01 * i;
+    }
+    return signal;
+}
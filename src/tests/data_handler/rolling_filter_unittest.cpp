@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <gmock/gmock.h>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "rolling_filter.h"
+
+using namespace testing;
+
+
+// values with many duplicates to check ties in heaps
+static std::vector<double> make_data (int len)
+{
+    std::vector<double> data (len);
+    srand (42);
+    for (int i = 0; i < len; i++)
+    {
+        data[i] = (double)(rand () % 50) - 25.0 + ((i % 3 == 0) ? 0.5 : 0.0);
+    }
+    return data;
+}
+
+// values of the window which ends at pos, window is shorter at the beginning
+static std::vector<double> get_window (const std::vector<double> &data, int pos, int period)
+{
+    int first = std::max (0, pos - period + 1);
+    return std::vector<double> (data.begin () + first, data.begin () + pos + 1);
+}
+
+TEST (RollingFilterTest, RollingMedian_DifferentPeriods_ReturnMedianOfWindow)
+{
+    std::vector<double> data = make_data (500);
+    int periods[] = {1, 2, 3, 4, 7, 10, 33};
+    for (int period : periods)
+    {
+        RollingMedian<double> filter (period);
+        for (int i = 0; i < (int)data.size (); i++)
+        {
+            filter.add_data (data[i]);
+            double expected = data[i];
+            if (i + 1 >= period)
+            {
+                std::vector<double> window = get_window (data, i, period);
+                std::sort (window.begin (), window.end ());
+                expected = (window[(period - 1) / 2] + window[period / 2]) / 2.0;
+            }
+            ASSERT_EQ (filter.get_value (), expected) << "period " << period << " pos " << i;
+        }
+    }
+}
+
+TEST (RollingFilterTest, RollingStats_DifferentPeriods_ReturnStatsOfWindow)
+{
+    std::vector<double> data = make_data (500);
+    int periods[] = {1, 2, 5, 16, 64};
+    for (int period : periods)
+    {
+        RollingAverage<double> average (period);
+        RollingStddev<double> stddev (period);
+        RollingRms<double> rms (period);
+        RollingMin<double> min (period);
+        RollingMax<double> max (period);
+        for (int i = 0; i < (int)data.size (); i++)
+        {
+            average.add_data (data[i]);
+            stddev.add_data (data[i]);
+            rms.add_data (data[i]);
+            min.add_data (data[i]);
+            max.add_data (data[i]);
+            std::vector<double> window = get_window (data, i, period);
+            double sum = 0.0;
+            double sum_squares = 0.0;
+            for (double value : window)
+            {
+                sum += value;
+                sum_squares += value * value;
+            }
+            double mean = sum / window.size ();
+            double variance = 0.0;
+            for (double value : window)
+            {
+                variance += (value - mean) * (value - mean);
+            }
+            variance /= window.size ();
+
+            ASSERT_NEAR (average.get_value (), mean, 1e-9);
+            ASSERT_NEAR (stddev.get_value (), sqrt (variance), 1e-9);
+            ASSERT_NEAR (rms.get_value (), sqrt (sum_squares / window.size ()), 1e-9);
+            ASSERT_EQ (min.get_value (), *std::min_element (window.begin (), window.end ()));
+            ASSERT_EQ (max.get_value (), *std::max_element (window.begin (), window.end ()));
+        }
+    }
+}
+
+TEST (RollingFilterTest, RollingStddev_ConstantAfterLargeValues_ReturnZero)
+{
+    RollingStddev<double> filter (8);
+    for (int i = 0; i < 1000; i++)
+    {
+        filter.add_data (1e9 + i * 1e7);
+    }
+    for (int i = 0; i < 16; i++)
+    {
+        filter.add_data (3.0);
+    }
+
+    EXPECT_EQ (filter.get_value (), 0.0);
+}
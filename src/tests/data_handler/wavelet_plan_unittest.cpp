@@ -0,0 +1,122 @@
+#include <gmock/gmock.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "test_signals.h"
+#include "wauxlib.h"
+#include "wavelet_helpers.h"
+#include "wavelet_plan.h"
+
+using namespace testing;
+
+
+// transform with wavelib objects created for a single call
+static std::vector<double> reference_transform (
+    std::vector<double> &data, int wavelet, int level, int extension, std::vector<int> &lengths)
+{
+    wave_object obj = wave_init (get_wavelet_name (wavelet).c_str ());
+    wt_object wt = wt_init (obj, "dwt", (int)data.size (), level);
+    setDWTExtension (wt, get_extension_type (extension).c_str ());
+    setWTConv (wt, "direct");
+    dwt (wt, data.data ());
+    std::vector<double> coeffs (wt->output, wt->output + wt->outlength);
+    lengths.assign (wt->length, wt->length + level + 1);
+    wt_free (wt);
+    wave_free (obj);
+    return coeffs;
+}
+
+TEST (WaveletPlanTest, PerformWaveletTransform_ReusedPlan_MatchSingleCallObjects)
+{
+    int wavelets[] = {(int)WaveletTypes::HAAR, (int)WaveletTypes::DB4, (int)WaveletTypes::DB15,
+        (int)WaveletTypes::BIOR6_8, (int)WaveletTypes::COIF5, (int)WaveletTypes::SYM10};
+    int extensions[] = {
+        (int)WaveletExtensionTypes::SYMMETRIC, (int)WaveletExtensionTypes::PERIODIC};
+    int lens[] = {255, 1000};
+
+    for (int wavelet : wavelets)
+    {
+        for (int extension : extensions)
+        {
+            for (int len : lens)
+            {
+                WaveletPlan *plan = get_wavelet_plan (wavelet, len, 3, extension);
+                ASSERT_NE (plan, nullptr);
+                // several signals through the same plan
+                for (int iter = 0; iter < 3; iter++)
+                {
+                    std::vector<double> data = make_test_signal (len, iter);
+                    std::vector<int> expected_lengths;
+                    std::vector<double> expected =
+                        reference_transform (data, wavelet, 3, extension, expected_lengths);
+
+                    std::vector<double> coeffs (len + 2 * 3 * (40 + 1));
+                    std::vector<int> lengths (4);
+                    int output_len = plan->perform_wavelet_transform (
+                        data.data (), coeffs.data (), lengths.data ());
+                    ASSERT_EQ (output_len, (int)expected.size ());
+                    EXPECT_EQ (lengths, expected_lengths);
+                    coeffs.resize (output_len);
+                    EXPECT_EQ (coeffs, expected);
+
+                    std::vector<double> restored (len);
+                    plan->perform_inverse_wavelet_transform (
+                        coeffs.data (), lengths.data (), restored.data ());
+                    for (int i = 0; i < len; i++)
+                    {
+                        EXPECT_NEAR (restored[i], data[i], 1e-9);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST (WaveletPlanTest, PerformWaveletDenoising_ReusedPlan_MatchWavelibDenoise)
+{
+    int len = 500;
+    int wavelet = (int)WaveletTypes::DB8;
+    int extension = (int)WaveletExtensionTypes::SYMMETRIC;
+    int methods[] = {
+        (int)WaveletDenoisingTypes::VISUSHRINK, (int)WaveletDenoisingTypes::SURESHRINK};
+    int thresholds[] = {(int)ThresholdTypes::SOFT, (int)ThresholdTypes::HARD};
+    int noise_levels[] = {
+        (int)NoiseEstimationLevelTypes::FIRST_LEVEL, (int)NoiseEstimationLevelTypes::ALL_LEVELS};
+    WaveletPlan *plan = get_wavelet_plan (wavelet, len, 4, extension);
+    ASSERT_NE (plan, nullptr);
+
+    for (int method : methods)
+    {
+        for (int threshold : thresholds)
+        {
+            for (int noise_level : noise_levels)
+            {
+                std::vector<double> data = make_test_signal (len, method + threshold + noise_level);
+                std::vector<double> expected (len);
+                denoise_object obj = denoise_init (len, 4, get_wavelet_name (wavelet).c_str ());
+                setDenoiseMethod (obj, get_wavelet_denoising_type (method).c_str ());
+                setDenoiseWTMethod (obj, "dwt");
+                setDenoiseWTExtension (obj, get_extension_type (extension).c_str ());
+                setDenoiseParameters (obj, get_threshold_type (threshold).c_str (),
+                    get_noise_estimation_type (noise_level).c_str ());
+                denoise (obj, data.data (), expected.data ());
+                denoise_free (obj);
+
+                plan->perform_wavelet_denoising (data.data (), method, threshold, noise_level);
+                EXPECT_EQ (data, expected);
+            }
+        }
+    }
+}
+
+TEST (WaveletPlanTest, GetWaveletPlan_InvalidParams_ReturnNullOrThrow)
+{
+    int sym = (int)WaveletExtensionTypes::SYMMETRIC;
+    EXPECT_EQ (get_wavelet_plan (-1, 256, 3, sym), nullptr);
+    EXPECT_EQ (get_wavelet_plan ((int)WaveletTypes::DB4, 256, 3, 100), nullptr);
+    EXPECT_EQ (get_wavelet_plan ((int)WaveletTypes::DB4, 0, 3, sym), nullptr);
+    // too short signal for this level
+    EXPECT_THROW (get_wavelet_plan ((int)WaveletTypes::DB15, 64, 5, sym), std::runtime_error);
+}
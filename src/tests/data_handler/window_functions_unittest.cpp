@@ -0,0 +1,124 @@
+#include <gmock/gmock.h>
+#include <math.h>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "brainflow_constants.h"
+#include "window_functions.h"
+
+using namespace testing;
+
+
+TEST (WindowFunctionsTest, FillWindow_TukeyLimits_MatchRectangularAndHanning)
+{
+    int len = 100;
+    std::vector<double> tukey (len);
+    std::vector<double> expected (len);
+    fill_window ((int)WindowOperations::TUKEY, len, tukey.data (), 0.0);
+    no_window_function (len, expected.data ());
+    EXPECT_EQ (tukey, expected);
+
+    fill_window ((int)WindowOperations::TUKEY, len, tukey.data (), 1.0);
+    hanning_function (len, expected.data ());
+    for (int i = 0; i < len; i++)
+    {
+        EXPECT_NEAR (tukey[i], expected[i], 1e-12);
+    }
+}
+
+TEST (WindowFunctionsTest, FillWindow_KaiserAndFlatTop_PeriodicWithUnitPeak)
+{
+    int len = 128;
+    int windows[] = {(int)WindowOperations::KAISER, (int)WindowOperations::FLAT_TOP};
+    for (int window : windows)
+    {
+        std::vector<double> wind (len);
+        ASSERT_TRUE (fill_window (window, len, wind.data ()));
+        EXPECT_NEAR (wind[len / 2], 1.0, 1e-8);
+        for (int i = 1; i < len; i++)
+        {
+            EXPECT_NEAR (wind[i], wind[len - i], 1e-12);
+        }
+    }
+    // beta 0 is rectangular
+    std::vector<double> wind (len);
+    fill_window ((int)WindowOperations::KAISER, len, wind.data (), 0.0);
+    for (int i = 0; i < len; i++)
+    {
+        EXPECT_NEAR (wind[i], 1.0, 1e-15);
+    }
+}
+
+TEST (WindowFunctionsTest, FillDPSSTapers_SmallLen_MatchDenseEigenSolver)
+{
+    int len = 64;
+    double nw = 3.0;
+    int num_tapers = 5;
+    std::vector<double> tapers (len * num_tapers);
+    ASSERT_TRUE (fill_dpss_tapers (len, nw, num_tapers, tapers.data ()));
+
+    // the same tridiagonal matrix solved as a dense one
+    Eigen::MatrixXd t = Eigen::MatrixXd::Zero (len, len);
+    for (int i = 0; i < len; i++)
+    {
+        t (i, i) = pow ((len - 1 - 2.0 * i) / 2.0, 2) * cos (2.0 * M_PI * nw / len);
+        if (i > 0)
+        {
+            t (i, i - 1) = t (i - 1, i) = i * (len - i) / 2.0;
+        }
+    }
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es (t);
+    // concentration matrix, sin (2 pi w (i - j)) / (pi (i - j))
+    Eigen::MatrixXd a (len, len);
+    for (int i = 0; i < len; i++)
+    {
+        for (int j = 0; j < len; j++)
+        {
+            a (i, j) = (i == j) ? 2.0 * nw / len :
+                                  sin (2.0 * M_PI * nw / len * (i - j)) / (M_PI * (i - j));
+        }
+    }
+    double prev_concentration = 1.0;
+    for (int k = 0; k < num_tapers; k++)
+    {
+        Eigen::Map<Eigen::VectorXd> taper (tapers.data () + k * len, len);
+        Eigen::VectorXd expected = es.eigenvectors ().col (len - 1 - k);
+        EXPECT_NEAR (fabs (taper.dot (expected)), 1.0, 1e-10);
+        EXPECT_NEAR (taper.norm (), 1.0, 1e-12);
+        // symmetric for even k, antisymmetric for odd k
+        double sign = (k % 2 == 0) ? 1.0 : -1.0;
+        for (int i = 0; i < len; i++)
+        {
+            EXPECT_NEAR (taper (i), sign * taper (len - 1 - i), 1e-10);
+        }
+        double concentration = taper.dot (a * taper);
+        EXPECT_LT (concentration, prev_concentration);
+        prev_concentration = concentration;
+        if (k == 0)
+        {
+            EXPECT_GT (taper.sum (), 0.0);
+            EXPECT_GT (concentration, 0.9999);
+        }
+    }
+    EXPECT_FALSE (fill_dpss_tapers (len, 0.0, num_tapers, tapers.data ()));
+    EXPECT_FALSE (fill_dpss_tapers (len, nw, len + 1, tapers.data ()));
+}
+
+TEST (WindowFunctionsTest, GetDPSSTable_LongWindow_OrthonormalTapers)
+{
+    int len = 4096;
+    int num_tapers = 7;
+    const std::vector<double> *table = get_dpss_table (len, 4.0, num_tapers);
+    ASSERT_NE (table, nullptr);
+    Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
+        tapers (table->data (), num_tapers, len);
+    Eigen::MatrixXd gram = tapers * tapers.transpose ();
+    EXPECT_TRUE (gram.isApprox (Eigen::MatrixXd::Identity (num_tapers, num_tapers), 1e-9));
+}
+
+TEST (WindowFunctionsTest, GetWindowTable_InvalidParams_ReturnNull)
+{
+    EXPECT_EQ (get_window_table (100, 256), nullptr);
+    EXPECT_EQ (get_window_table ((int)WindowOperations::HANNING, 0), nullptr);
+    EXPECT_EQ (get_window_table ((int)WindowOperations::TUKEY, 256, 1.5), nullptr);
+}
@@ -0,0 +1,104 @@
+#include <gmock/gmock.h>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "common_data_handler_helpers.h"
+#include "z_score_peak_detector.h"
+
+using namespace testing;
+
+
+// detect_peaks_z_score before the detector was added
+static std::vector<double> reference_peaks (
+    const std::vector<double> &data, int lag, double threshold, double influence)
+{
+    int data_len = (int)data.size ();
+    std::vector<double> output (data_len, 0.0);
+    std::vector<double> filtered_data (data);
+    std::vector<double> avg_filter (data_len);
+    std::vector<double> std_filter (data_len);
+    avg_filter[lag - 1] = mean (filtered_data.data (), lag);
+    std_filter[lag - 1] = stddev (filtered_data.data (), lag);
+    for (int i = lag; i < data_len; i++)
+    {
+        if (fabs (data[i] - avg_filter[i - 1]) > threshold * std_filter[i - 1])
+        {
+            output[i] = (data[i] > avg_filter[i - 1]) ? 1 : -1;
+            filtered_data[i] = influence * data[i] + (1 - influence) * filtered_data[i - 1];
+        }
+        avg_filter[i] = mean (filtered_data.data () + i - lag, lag);
+        std_filter[i] = stddev (filtered_data.data () + i - lag, lag);
+    }
+    return output;
+}
+
+static std::vector<double> make_signal (int len)
+{
+    std::vector<double> data (len);
+    srand (7);
+    for (int i = 0; i < len; i++)
+    {
+        data[i] = sin (i * 0.05) + 0.1 * (rand () % 10);
+        if (rand () % 40 == 0)
+        {
+            data[i] += (rand () % 2 == 0) ? 3.0 : -3.0;
+        }
+    }
+    return data;
+}
+
+TEST (ZScorePeakDetectorTest, Process_DifferentParams_ReturnSameDataAsBatchAlgorithm)
+{
+    std::vector<double> data = make_signal (3000);
+    int lags[] = {2, 5, 30, 100};
+    double thresholds[] = {0.0, 1.5, 3.0};
+    double influences[] = {0.0, 0.3, 1.0};
+    for (int lag : lags)
+    {
+        for (double threshold : thresholds)
+        {
+            for (double influence : influences)
+            {
+                std::vector<double> expected = reference_peaks (data, lag, threshold, influence);
+                std::vector<double> output (data.size ());
+                ZScorePeakDetector detector (lag, threshold, influence);
+
+                detector.process (data.data (), (int)data.size (), output.data ());
+
+                ASSERT_EQ (output, expected)
+                    << "lag " << lag << " threshold " << threshold << " influence " << influence;
+            }
+        }
+    }
+}
+
+TEST (ZScorePeakDetectorTest, Process_DataSplitIntoChunks_ReturnSameDataAsSingleCall)
+{
+    std::vector<double> data = make_signal (1000);
+    std::vector<double> expected = reference_peaks (data, 20, 2.5, 0.5);
+    std::vector<double> output (data.size ());
+    ZScorePeakDetector detector (20, 2.5, 0.5);
+
+    for (int offset = 0; offset < (int)data.size (); offset += 7)
+    {
+        int len = std::min (7, (int)data.size () - offset);
+        detector.process (data.data () + offset, len, output.data () + offset);
+    }
+
+    EXPECT_EQ (output, expected);
+}
+
+TEST (ZScorePeakDetectorTest, Process_ConstantSignalWithZeroThreshold_ReturnSameDataAsBatch)
+{
+    // stddev is 0 and decisions depend on exact equality with the mean
+    std::vector<double> data (200, 0.1);
+    data[150] = 0.3;
+    std::vector<double> expected = reference_peaks (data, 10, 0.0, 0.5);
+    std::vector<double> output (data.size ());
+    ZScorePeakDetector detector (10, 0.0, 0.5);
+
+    detector.process (data.data (), (int)data.size (), output.data ());
+
+    EXPECT_EQ (output, expected);
+}
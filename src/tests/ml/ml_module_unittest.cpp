@@ -0,0 +1,220 @@
+#include <atomic>
+#include <chrono>
+#include <gmock/gmock.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "ml_module.h"
+
+using namespace testing;
+
+
+// built-in models dont need model files or onnx runtime
+static std::string make_params (int metric)
+{
+    return "{\"metric\": " + std::to_string (metric) +
+        ", \"classifier\": 0, \"file\": \"\", \"output_name\": \"\", \"other_info\": \"\", "
+        "\"max_array_size\": 8192}";
+}
+
+// batch_size feature vectors of avg and stddev band powers
+static std::vector<double> make_features (int batch_size)
+{
+    std::vector<double> features (batch_size * 10);
+    for (int i = 0; i < batch_size; i++)
+    {
+        for (int j = 0; j < 10; j++)
+        {
+            features[i * 10 + j] = 0.05 + 0.1 * ((i * 7 + j * 3) % 9) / (j < 5 ? 1.0 : 4.0);
+        }
+    }
+    return features;
+}
+
+TEST (MLModuleTest, PredictBatch_BuiltInModel_ReturnSameDataAsPredict)
+{
+    std::string params = make_params ((int)BrainFlowMetrics::MINDFULNESS);
+    ASSERT_EQ (prepare (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    const int batch_size = 6;
+    std::vector<double> features = make_features (batch_size);
+    std::vector<double> output (batch_size, -1.0);
+    int output_len = 0;
+
+    ASSERT_EQ (predict_batch (features.data (), batch_size, 10, output.data (), &output_len,
+                   params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (output_len, batch_size);
+    // each row is written to its own offset
+    for (int i = 0; i < batch_size; i++)
+    {
+        double expected = 0.0;
+        int len = 0;
+        ASSERT_EQ (predict (features.data () + i * 10, 10, &expected, &len, params.c_str ()),
+            (int)BrainFlowExitCodes::STATUS_OK);
+        EXPECT_EQ (output[i], expected);
+    }
+    EXPECT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (MLModuleTest, PredictBatch_InvalidRowSize_ReturnError)
+{
+    std::string params = make_params ((int)BrainFlowMetrics::RESTFULNESS);
+    ASSERT_EQ (prepare (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    std::vector<double> features = make_features (2);
+    std::vector<double> output (2);
+    int output_len = 0;
+
+    EXPECT_EQ (predict_batch (features.data (), 2, 4, output.data (), &output_len,
+                   params.c_str ()),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (predict_batch (features.data (), 0, 10, output.data (), &output_len,
+                   params.c_str ()),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (MLModuleTest, PredictWithHandle_PreparedModel_ReturnSameDataAsJsonCalls)
+{
+    std::string params = make_params ((int)BrainFlowMetrics::RESTFULNESS);
+    void *handle = NULL;
+    ASSERT_EQ (prepare_with_handle (params.c_str (), &handle), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_NE (handle, nullptr);
+    std::vector<double> features = make_features (4);
+    double value = 0.0;
+    double expected = 0.0;
+    int len = 0;
+
+    ASSERT_EQ (predict_with_handle (handle, features.data (), 10, &value, &len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (predict (features.data (), 10, &expected, &len, params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (value, expected);
+
+    std::vector<double> batch (4);
+    std::vector<double> expected_batch (4);
+    ASSERT_EQ (predict_batch_with_handle (handle, features.data (), 4, 10, batch.data (), &len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (len, 4);
+    ASSERT_EQ (predict_batch (features.data (), 4, 10, expected_batch.data (), &len,
+                   params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (batch, expected_batch);
+
+    // handle releases the model registered for these params
+    EXPECT_EQ (release_with_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (predict (features.data (), 10, &value, &len, params.c_str ()),
+        (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR);
+}
+
+TEST (MLModuleTest, PredictWithHandle_ModelReleasedByJson_ReturnNotPrepared)
+{
+    std::string params = make_params ((int)BrainFlowMetrics::MINDFULNESS);
+    void *handle = NULL;
+    ASSERT_EQ (prepare_with_handle (params.c_str (), &handle), (int)BrainFlowExitCodes::STATUS_OK);
+    std::vector<double> features = make_features (1);
+    double value = 0.0;
+    int len = 0;
+
+    ASSERT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (predict_with_handle (handle, features.data (), 10, &value, &len),
+        (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR);
+    // model prepared again with the same params is not affected by the stale handle
+    ASSERT_EQ (prepare (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (release_with_handle (handle),
+        (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR);
+    EXPECT_EQ (predict (features.data (), 10, &value, &len, params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (MLModuleTest, PredictWithHandle_SeveralThreads_ReturnSameDataAsSingleThread)
+{
+    std::string params = make_params ((int)BrainFlowMetrics::MINDFULNESS);
+    void *handle = NULL;
+    ASSERT_EQ (prepare_with_handle (params.c_str (), &handle), (int)BrainFlowExitCodes::STATUS_OK);
+    const int batch_size = 16;
+    std::vector<double> features = make_features (batch_size);
+    std::vector<double> expected (batch_size);
+    for (int i = 0; i < batch_size; i++)
+    {
+        int len = 0;
+        ASSERT_EQ (predict_with_handle (handle, features.data () + i * 10, 10, &expected[i], &len),
+            (int)BrainFlowExitCodes::STATUS_OK);
+    }
+    std::atomic<int> mismatches (0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.push_back (std::thread ([&] () {
+            for (int iter = 0; iter < 1000; iter++)
+            {
+                int row = iter % batch_size;
+                double value = 0.0;
+                int len = 0;
+                int res =
+                    predict_with_handle (handle, features.data () + row * 10, 10, &value, &len);
+                if ((res != (int)BrainFlowExitCodes::STATUS_OK) || (value != expected[row]))
+                {
+                    mismatches++;
+                }
+            }
+        }));
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join ();
+    }
+
+    EXPECT_EQ (mismatches.load (), 0);
+    EXPECT_EQ (release_with_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (MLModuleTest, ReleaseWithHandle_WhilePredicting_PredictionsFinishOrReturnNotPrepared)
+{
+    std::string params = make_params ((int)BrainFlowMetrics::RESTFULNESS);
+    void *handle = NULL;
+    ASSERT_EQ (prepare_with_handle (params.c_str (), &handle), (int)BrainFlowExitCodes::STATUS_OK);
+    std::vector<double> features = make_features (1);
+    std::atomic<int> unexpected (0);
+    std::atomic<int> not_prepared (0);
+    std::atomic<bool> stop (false);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.push_back (std::thread ([&] () {
+            while (!stop.load ())
+            {
+                double value = 0.0;
+                int len = 0;
+                int res = predict (features.data (), 10, &value, &len, params.c_str ());
+                if (res == (int)BrainFlowExitCodes::CLASSIFIER_IS_NOT_PREPARED_ERROR)
+                {
+                    not_prepared++;
+                }
+                else if (res != (int)BrainFlowExitCodes::STATUS_OK)
+                {
+                    unexpected++;
+                }
+            }
+        }));
+    }
+    std::this_thread::sleep_for (std::chrono::milliseconds (20));
+    EXPECT_EQ (release_with_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    // wait until every thread saw the released model
+    for (int i = 0; (i < 1000) && (not_prepared.load () < 4); i++)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (1));
+    }
+    stop = true;
+    for (std::thread &thread : threads)
+    {
+        thread.join ();
+    }
+
+    EXPECT_EQ (unexpected.load (), 0);
+    EXPECT_GE (not_prepared.load (), 4);
+}
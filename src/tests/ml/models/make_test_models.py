@@ -0,0 +1,43 @@
+"""Generates small onnx models for onnx classifier tests, requires onnx package.
+
+Models use opset 11 and ir version 6 to be loadable by onnx runtime shipped with brainflow.
+"""
+
+import os
+
+import onnx
+from onnx import helper, TensorProto
+
+
+def save_model(nodes, inputs, outputs, file_name):
+    graph = helper.make_graph(nodes, os.path.splitext(file_name)[0], inputs, outputs)
+    model = helper.make_model(graph, producer_name='brainflow_tests',
+                              opset_imports=[helper.make_opsetid('', 11)])
+    model.ir_version = 6
+    onnx.checker.check_model(model)
+    onnx.save(model, os.path.join(os.path.dirname(os.path.abspath(__file__)), file_name))
+
+
+def main():
+    # two inputs of different types and sizes, two outputs
+    save_model([helper.make_node('Mul', ['x', 'x'], ['x_squared']),
+                helper.make_node('Neg', ['y'], ['y_negated'])],
+               [helper.make_tensor_value_info('x', TensorProto.FLOAT, ['batch', 3]),
+                helper.make_tensor_value_info('y', TensorProto.DOUBLE, ['batch', 2])],
+               [helper.make_tensor_value_info('x_squared', TensorProto.FLOAT, ['batch', 3]),
+                helper.make_tensor_value_info('y_negated', TensorProto.DOUBLE, ['batch', 2])],
+               'multi_io.onnx')
+    # dynamic batch dim
+    save_model([helper.make_node('Mul', ['x', 'x'], ['x_squared'])],
+               [helper.make_tensor_value_info('x', TensorProto.FLOAT, ['batch', 4])],
+               [helper.make_tensor_value_info('x_squared', TensorProto.FLOAT, ['batch', 4])],
+               'square.onnx')
+    # fixed first dim is a part of a row, not a batch dim
+    save_model([helper.make_node('Mul', ['x', 'x'], ['x_squared'])],
+               [helper.make_tensor_value_info('x', TensorProto.FLOAT, [2, 3])],
+               [helper.make_tensor_value_info('x_squared', TensorProto.FLOAT, [2, 3])],
+               'fixed_square.onnx')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,305 @@
+#include <fstream>
+#include <gmock/gmock.h>
+#include <stdio.h>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <time.h>
+#include <vector>
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+#include "brainflow_constants.h"
+#include "ml_module.h"
+#include "onnx_classifier.h"
+#include "runtime_dll_loader.h"
+
+using namespace testing;
+
+// models are generated by models/make_test_models.py, onnx runtime library is not a part of the
+// repo, tests are skipped if it's not next to the test executable
+#define SKIP_WITHOUT_ONNX_RUNTIME()                                       \
+    if (!is_onnx_runtime_available ())                                    \
+    {                                                                     \
+        GTEST_SKIP () << "onnx runtime library is not found";             \
+    }
+
+
+static bool is_onnx_runtime_available ()
+{
+    DLLLoader loader (OnnxClassifier::get_onnxlib_path ().c_str ());
+    return loader.load_library ();
+}
+
+static std::string make_params (
+    const std::string &model, const std::string &output_name, bool use_global_thread_pool = false)
+{
+    return "{\"metric\": " + std::to_string ((int)BrainFlowMetrics::USER_DEFINED) +
+        ", \"classifier\": " + std::to_string ((int)BrainFlowClassifiers::ONNX_CLASSIFIER) +
+        ", \"file\": \"" + BRAINFLOW_TEST_MODELS_DIR + model + "\", \"output_name\": \"" +
+        output_name + "\", \"other_info\": \"\", \"max_array_size\": 64" +
+        ", \"use_global_thread_pool\": " + (use_global_thread_pool ? "true" : "false") + "}";
+}
+
+static std::string make_cached_params (const std::string &cache_file, int optimization_level)
+{
+    std::string params = make_params ("square.onnx", "");
+    params.pop_back ();
+    return params + ", \"optimized_model_file\": \"" + cache_file +
+        "\", \"graph_optimization_level\": " + std::to_string (optimization_level) + "}";
+}
+
+static time_t get_mtime (const char *file)
+{
+    struct stat info;
+    if (stat (file, &info) != 0)
+    {
+        return 0;
+    }
+    return info.st_mtime;
+}
+
+static std::vector<double> make_rows (int batch_size, int data_len, double offset)
+{
+    std::vector<double> rows (batch_size * data_len);
+    for (size_t i = 0; i < rows.size (); i++)
+    {
+        rows[i] = offset + 0.25 * i;
+    }
+    return rows;
+}
+
+TEST (OnnxClassifierTest, PredictMulti_TwoInputsOfDifferentTypes_ReturnAllOutputs)
+{
+    SKIP_WITHOUT_ONNX_RUNTIME ();
+    std::string params = make_params ("multi_io.onnx", "x_squared,y_negated");
+    ASSERT_EQ (prepare (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    const int batch_size = 2;
+    // float input x is converted, double input y is passed as is
+    std::vector<double> x = make_rows (batch_size, 3, 1.0);
+    std::vector<double> y = make_rows (batch_size, 2, -3.0);
+    std::vector<double> data (x);
+    data.insert (data.end (), y.begin (), y.end ());
+    int input_lens[2] = {3, 2};
+    std::vector<double> output (64 * batch_size, 0.0);
+    int output_lens[2] = {0, 0};
+
+    ASSERT_EQ (predict_multi (data.data (), batch_size, input_lens, 2, output.data (),
+                   output_lens, 2, params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+
+    ASSERT_EQ (output_lens[0], batch_size * 3);
+    ASSERT_EQ (output_lens[1], batch_size * 2);
+    for (int i = 0; i < output_lens[0]; i++)
+    {
+        EXPECT_EQ (output[i], (double)((float)x[i] * (float)x[i]));
+    }
+    for (int i = 0; i < output_lens[1]; i++)
+    {
+        EXPECT_EQ (output[output_lens[0] + i], -y[i]);
+    }
+    EXPECT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (OnnxClassifierTest, PredictMultiFloat32_TwoInputsOfDifferentTypes_ReturnSameDataAsDouble)
+{
+    SKIP_WITHOUT_ONNX_RUNTIME ();
+    std::string params = make_params ("multi_io.onnx", "x_squared,y_negated");
+    ASSERT_EQ (prepare (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    const int batch_size = 3;
+    std::vector<double> data = make_rows (batch_size, 5, 0.5);
+    std::vector<float> float_data (data.begin (), data.end ());
+    int input_lens[2] = {3, 2};
+    std::vector<double> expected (64 * batch_size, 0.0);
+    std::vector<double> output (64 * batch_size, 0.0);
+    int expected_lens[2] = {0, 0};
+    int output_lens[2] = {0, 0};
+
+    ASSERT_EQ (predict_multi (data.data (), batch_size, input_lens, 2, expected.data (),
+                   expected_lens, 2, params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (predict_multi_float32 (float_data.data (), batch_size, input_lens, 2,
+                   output.data (), output_lens, 2, params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+
+    EXPECT_EQ (output_lens[0], expected_lens[0]);
+    EXPECT_EQ (output_lens[1], expected_lens[1]);
+    // values are exact in float, so both paths return the same data
+    EXPECT_EQ (output, expected);
+    EXPECT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (OnnxClassifierTest, PredictBatchWithHandle_SeveralThreadsDifferentBatchSizes_ReturnSquares)
+{
+    SKIP_WITHOUT_ONNX_RUNTIME ();
+    std::string params = make_params ("square.onnx", "");
+    void *handle = NULL;
+    ASSERT_EQ (prepare_with_handle (params.c_str (), &handle), (int)BrainFlowExitCodes::STATUS_OK);
+    const int num_threads = 4;
+    std::vector<int> failures (num_threads, 0);
+    std::vector<std::thread> threads;
+
+    // per thread conversion buffers grow and shrink with batch size of each call
+    for (int t = 0; t < num_threads; t++)
+    {
+        threads.push_back (std::thread ([&, t] () {
+            for (int j = 0; j < 50; j++)
+            {
+                int batch_size = 1 + (t + j) % 5;
+                std::vector<double> data = make_rows (batch_size, 4, t - j * 0.5);
+                std::vector<double> output (64 * batch_size, 0.0);
+                int output_len = 0;
+                int res = predict_batch_with_handle (
+                    handle, data.data (), batch_size, 4, output.data (), &output_len);
+                if ((res != (int)BrainFlowExitCodes::STATUS_OK) || (output_len != batch_size * 4))
+                {
+                    failures[t]++;
+                    continue;
+                }
+                for (int i = 0; i < output_len; i++)
+                {
+                    if (output[i] != (double)((float)data[i] * (float)data[i]))
+                    {
+                        failures[t]++;
+                        break;
+                    }
+                }
+            }
+        }));
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join ();
+    }
+
+    EXPECT_THAT (failures, Each (0));
+    std::vector<double> data = make_rows (1, 4, 2.0);
+    std::vector<double> output (64, 0.0);
+    int output_len = 0;
+    ASSERT_EQ (predict_with_handle (handle, data.data (), 4, output.data (), &output_len),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (output_len, 4);
+    EXPECT_EQ (output[3], (double)((float)data[3] * (float)data[3]));
+    EXPECT_EQ (release_with_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (OnnxClassifierTest, PredictBatch_FixedFirstDim_AcceptOnlySingleRow)
+{
+    SKIP_WITHOUT_ONNX_RUNTIME ();
+    std::string params = make_params ("fixed_square.onnx", "");
+    ASSERT_EQ (prepare (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    // input is [2, 3], first dim equal to batch size is still a part of the row
+    std::vector<double> data = make_rows (2, 6, 1.0);
+    std::vector<double> output (64 * 2, 0.0);
+    int output_len = 0;
+
+    ASSERT_EQ (predict (data.data (), 6, output.data (), &output_len, params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (output_len, 6);
+    for (int i = 0; i < output_len; i++)
+    {
+        EXPECT_EQ (output[i], data[i] * data[i]);
+    }
+    EXPECT_EQ (predict_batch (data.data (), 2, 6, output.data (), &output_len, params.c_str ()),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (predict_batch (data.data (), 2, 3, output.data (), &output_len, params.c_str ()),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (OnnxClassifierTest, PredictBatch_DynamicBatchDimWrongRowSize_ReturnInvalidArguments)
+{
+    SKIP_WITHOUT_ONNX_RUNTIME ();
+    std::string params = make_params ("square.onnx", "");
+    ASSERT_EQ (prepare (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    // input is [batch, 4], rows of 5 values would be split at wrong positions
+    std::vector<double> data = make_rows (2, 5, 1.0);
+    std::vector<double> output (64 * 2, 0.0);
+    int output_len = 0;
+
+    EXPECT_EQ (predict_batch (data.data (), 2, 5, output.data (), &output_len, params.c_str ()),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (predict_batch (data.data (), 1, 5, output.data (), &output_len, params.c_str ()),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (predict_batch (data.data (), 2, 3, output.data (), &output_len, params.c_str ()),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    ASSERT_EQ (predict_batch (data.data (), 2, 4, output.data (), &output_len, params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (output_len, 8);
+    EXPECT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (OnnxClassifierTest, Prepare_OtherThreadPoolModeInProcess_ReturnInvalidArguments)
+{
+    SKIP_WITHOUT_ONNX_RUNTIME ();
+    std::string per_session = make_params ("square.onnx", "", false);
+    std::string global = make_params ("square.onnx", "", true);
+    ASSERT_EQ (prepare (per_session.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+
+    // onnx runtime env is shared by all models, its mode is set by the first one
+    EXPECT_EQ (prepare (global.c_str ()), (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    ASSERT_EQ (release (per_session.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (prepare (global.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (prepare (per_session.c_str ()), (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+
+    std::vector<double> data = make_rows (3, 4, 0.5);
+    std::vector<double> output (64 * 3, 0.0);
+    int output_len = 0;
+    EXPECT_EQ (predict_batch (data.data (), 3, 4, output.data (), &output_len, global.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (output_len, 12);
+    EXPECT_EQ (release (global.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (OnnxClassifierTest, Prepare_OptimizedModelFile_ReuseItUntilSettingsChange)
+{
+    SKIP_WITHOUT_ONNX_RUNTIME ();
+    const char *cache_file = "onnx_classifier_test_cache.onnx";
+    std::string settings_file = std::string (cache_file) + ".settings";
+    remove (cache_file);
+    remove (settings_file.c_str ());
+    std::vector<double> data = make_rows (2, 4, 1.5);
+    std::vector<double> output (64 * 2, 0.0);
+    int output_len = 0;
+
+    // the first model saves optimized model and its settings
+    std::string params = make_cached_params (cache_file, 99);
+    ASSERT_EQ (prepare (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_NE (get_mtime (cache_file), 0);
+    ASSERT_NE (get_mtime (settings_file.c_str ()), 0);
+
+    // cache from the future is rewritten only if it's not reused
+    struct utimbuf future_time;
+    future_time.actime = time (NULL) + 1000;
+    future_time.modtime = future_time.actime;
+    ASSERT_EQ (utime (cache_file, &future_time), 0);
+    ASSERT_EQ (prepare (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (predict_batch (data.data (), 2, 4, output.data (), &output_len, params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (release (params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (get_mtime (cache_file), future_time.modtime);
+    EXPECT_EQ (output_len, 8);
+    EXPECT_EQ (output[7], (double)((float)data[7] * (float)data[7]));
+
+    // other optimization level makes a new cache
+    std::string basic_params = make_cached_params (cache_file, 1);
+    ASSERT_EQ (prepare (basic_params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (
+        predict_batch (data.data (), 2, 4, output.data (), &output_len, basic_params.c_str ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (release (basic_params.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_NE (get_mtime (cache_file), future_time.modtime);
+    EXPECT_EQ (output[7], (double)((float)data[7] * (float)data[7]));
+    std::string settings;
+    std::ifstream settings_stream (settings_file);
+    std::getline (settings_stream, settings);
+    EXPECT_THAT (settings, HasSubstr ("graph_optimization_level=1 "));
+
+    settings_stream.close ();
+    remove (cache_file);
+    remove (settings_file.c_str ());
+}
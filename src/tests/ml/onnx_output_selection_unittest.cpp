@@ -0,0 +1,71 @@
+#include <gmock/gmock.h>
+#include <string>
+#include <vector>
+
+#include "onnx_output_selection.h"
+
+using namespace testing;
+
+
+TEST (OnnxOutputSelectionTest, Select_SingleProbabilitiesNodeNoName_ReturnItOnce)
+{
+    const char *names[] = {"probabilities", "output_probability"};
+    for (const char *name : names)
+    {
+        std::vector<const char *> node_names = {name};
+        std::vector<size_t> selected;
+        std::string missing_node;
+        EXPECT_TRUE (select_output_nodes (node_names, "", selected, missing_node));
+        EXPECT_THAT (selected, ElementsAre (0));
+    }
+}
+
+TEST (OnnxOutputSelectionTest, Select_SingleNodeAnyName_ReturnIt)
+{
+    std::vector<const char *> node_names = {"label"};
+    std::vector<size_t> selected;
+    std::string missing_node;
+    EXPECT_TRUE (select_output_nodes (node_names, "", selected, missing_node));
+    EXPECT_THAT (selected, ElementsAre (0));
+    EXPECT_TRUE (select_output_nodes (node_names, "other", selected, missing_node));
+    EXPECT_THAT (selected, ElementsAre (0));
+}
+
+TEST (OnnxOutputSelectionTest, Select_MultipleNodesNoName_ReturnProbabilities)
+{
+    std::vector<const char *> node_names = {"label", "probabilities"};
+    std::vector<size_t> selected;
+    std::string missing_node;
+    EXPECT_TRUE (select_output_nodes (node_names, "", selected, missing_node));
+    EXPECT_THAT (selected, ElementsAre (1));
+
+    node_names = {"label", "scores"};
+    EXPECT_FALSE (select_output_nodes (node_names, "", selected, missing_node));
+    EXPECT_TRUE (selected.empty ());
+}
+
+TEST (OnnxOutputSelectionTest, Select_NameList_ReturnNodesInRequestedOrder)
+{
+    std::vector<const char *> node_names = {"label", "probabilities", "embedding"};
+    std::vector<size_t> selected;
+    std::string missing_node;
+    EXPECT_TRUE (select_output_nodes (node_names, "embedding,label", selected, missing_node));
+    EXPECT_THAT (selected, ElementsAre (2, 0));
+    EXPECT_TRUE (missing_node.empty ());
+}
+
+TEST (OnnxOutputSelectionTest, Select_MissingOrRepeatedName_ReturnFalse)
+{
+    std::vector<const char *> node_names = {"label", "probabilities"};
+    std::vector<size_t> selected;
+    std::string missing_node;
+    EXPECT_FALSE (select_output_nodes (node_names, "label,scores", selected, missing_node));
+    EXPECT_EQ (missing_node, "scores");
+    EXPECT_TRUE (selected.empty ());
+    EXPECT_FALSE (select_output_nodes (node_names, "label,label", selected, missing_node));
+    EXPECT_EQ (missing_node, "label");
+
+    node_names = {"probabilities"};
+    EXPECT_FALSE (select_output_nodes (node_names, "probabilities,probabilities", selected,
+        missing_node));
+}
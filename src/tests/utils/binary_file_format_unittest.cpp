@@ -0,0 +1,127 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <limits>
+#include <string.h>
+#include <vector>
+
+#include "binary_file_format.h"
+
+using namespace testing;
+
+
+static BinaryFileHeader make_header ()
+{
+    BinaryFileHeader header;
+    header.board_id = 57;
+    header.preset = 2;
+    header.num_rows = 24;
+    header.sampling_rate = 500;
+    header.value_size = (int32_t)sizeof (float);
+    return header;
+}
+
+static std::vector<double> make_values ()
+{
+    std::vector<double> values = {0.0, -0.0, 1.0, -2.5, 1e-310, 123456.789012345,
+        std::numeric_limits<double>::infinity (), -std::numeric_limits<double>::infinity (),
+        std::numeric_limits<double>::quiet_NaN ()};
+    for (int i = 0; i < 100; i++)
+    {
+        values.push_back (i * 0.1 - 3.0);
+    }
+    return values;
+}
+
+TEST (BinaryFileFormatTest, EncodeDecode_Header_KeepAllFields)
+{
+    BinaryFileHeader header = make_header ();
+    unsigned char raw[BRAINFLOW_BINARY_HEADER_SIZE];
+    BinaryFileHeader decoded;
+
+    encode_binary_header (header, raw);
+
+    EXPECT_EQ (memcmp (raw, BRAINFLOW_BINARY_MAGIC, BRAINFLOW_BINARY_MAGIC_LEN), 0);
+    ASSERT_TRUE (decode_binary_header (raw, decoded));
+    EXPECT_EQ (decoded.version, BRAINFLOW_BINARY_VERSION);
+    EXPECT_EQ (decoded.board_id, 57);
+    EXPECT_EQ (decoded.preset, 2);
+    EXPECT_EQ (decoded.num_rows, 24);
+    EXPECT_EQ (decoded.sampling_rate, 500);
+    EXPECT_EQ (decoded.value_size, 4);
+    EXPECT_EQ (decoded.package_size (), (size_t)24 * 4);
+}
+
+TEST (BinaryFileFormatTest, Encode_Header_LittleEndianFields)
+{
+    BinaryFileHeader header = make_header ();
+    header.board_id = -1;
+    unsigned char raw[BRAINFLOW_BINARY_HEADER_SIZE];
+
+    encode_binary_header (header, raw);
+
+    EXPECT_THAT (
+        std::vector<unsigned char> (raw + 12, raw + 16), ElementsAre (0xFF, 0xFF, 0xFF, 0xFF));
+    EXPECT_THAT (std::vector<unsigned char> (raw + 24, raw + 28), ElementsAre (0xF4, 0x01, 0, 0));
+}
+
+TEST (BinaryFileFormatTest, Decode_InvalidHeader_ReturnFalse)
+{
+    unsigned char raw[BRAINFLOW_BINARY_HEADER_SIZE];
+    BinaryFileHeader decoded;
+
+    encode_binary_header (make_header (), raw);
+    raw[0] = 'X';
+    EXPECT_FALSE (decode_binary_header (raw, decoded));
+
+    encode_binary_header (make_header (), raw);
+    write_int32_le (raw + 8, BRAINFLOW_BINARY_VERSION + 1);
+    EXPECT_FALSE (decode_binary_header (raw, decoded));
+
+    encode_binary_header (make_header (), raw);
+    write_int32_le (raw + 20, 0);
+    EXPECT_FALSE (decode_binary_header (raw, decoded));
+
+    encode_binary_header (make_header (), raw);
+    write_int32_le (raw + 28, 2);
+    EXPECT_FALSE (decode_binary_header (raw, decoded));
+}
+
+TEST (BinaryFileFormatTest, EncodeDecode_Float64Values_BitExact)
+{
+    std::vector<double> values = make_values ();
+    std::vector<unsigned char> raw (values.size () * sizeof (double));
+    std::vector<double> decoded (values.size ());
+
+    encode_binary_values (values.data (), values.size (), (int32_t)sizeof (double), raw.data ());
+    decode_binary_values (raw.data (), values.size (), (int32_t)sizeof (double), decoded.data ());
+
+    EXPECT_EQ (memcmp (decoded.data (), values.data (), values.size () * sizeof (double)), 0);
+    // 1.0 is 0x3FF0000000000000, stored least significant byte first
+    EXPECT_THAT (std::vector<unsigned char> (raw.begin () + 16, raw.begin () + 24),
+        ElementsAre (0, 0, 0, 0, 0, 0, 0xF0, 0x3F));
+}
+
+TEST (BinaryFileFormatTest, EncodeDecode_Float32Values_RoundToFloat)
+{
+    std::vector<double> values = make_values ();
+    std::vector<unsigned char> raw (values.size () * sizeof (float));
+    std::vector<double> decoded (values.size ());
+
+    encode_binary_values (values.data (), values.size (), (int32_t)sizeof (float), raw.data ());
+    decode_binary_values (raw.data (), values.size (), (int32_t)sizeof (float), decoded.data ());
+
+    for (size_t i = 0; i < values.size (); i++)
+    {
+        if (values[i] != values[i])
+        {
+            EXPECT_NE (decoded[i], decoded[i]) << "value " << i;
+        }
+        else
+        {
+            EXPECT_EQ (decoded[i], (double)(float)values[i]) << "value " << i;
+        }
+    }
+    // 1.0f is 0x3F800000
+    EXPECT_THAT (std::vector<unsigned char> (raw.begin () + 8, raw.begin () + 12),
+        ElementsAre (0, 0, 0x80, 0x3F));
+}
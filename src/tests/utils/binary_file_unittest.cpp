@@ -0,0 +1,392 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <stdio.h>
+#include <vector>
+
+#include "binary_file.h"
+#include "brainflow_constants.h"
+#include "data_handler.h"
+
+using namespace testing;
+
+
+// packages with 3 channels: package num, timestamp and value
+static std::vector<double> make_packages (int first, int count)
+{
+    std::vector<double> packages;
+    for (int i = first; i < first + count; i++)
+    {
+        packages.push_back ((double)i);
+        packages.push_back (1000.0 + i * 0.004);
+        packages.push_back (i * 0.5 - 7.0);
+    }
+    return packages;
+}
+
+static BinaryFileHeader make_header ()
+{
+    BinaryFileHeader header;
+    header.board_id = -1;
+    header.num_rows = 3;
+    header.sampling_rate = 250;
+    header.timestamp_channel = 1;
+    header.index_step = 16;
+    return header;
+}
+
+static void write_packages (const char *file_name, const BinaryFileHeader &header, int first,
+    int count, bool append)
+{
+    BinaryFileWriter writer;
+    std::vector<double> packages = make_packages (first, count);
+    ASSERT_EQ (writer.open (file_name, header, append), (int)BrainFlowExitCodes::STATUS_OK);
+    // write in uneven blocks to cross index steps in the middle of a block
+    for (int i = 0; i < count; i += 7)
+    {
+        int block = std::min (7, count - i);
+        ASSERT_EQ (writer.write_packages (packages.data () + i * 3, block),
+            (int)BrainFlowExitCodes::STATUS_OK);
+    }
+    ASSERT_EQ (writer.close (), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (BinaryFileTest, WriteRead_Float64Packages_ReturnSameValues)
+{
+    const char *file_name = "binary_file_test_f64.bin";
+    write_packages (file_name, make_header (), 0, 100, false);
+    BinaryFileReader reader;
+
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_TRUE (BinaryFileReader::is_binary_file (file_name));
+    EXPECT_EQ (reader.get_num_packages (), 100);
+    EXPECT_EQ (reader.get_header ().board_id, -1);
+    EXPECT_EQ (reader.get_header ().sampling_rate, 250);
+    std::vector<double> expected = make_packages (0, 100);
+    double package[3];
+    for (int i = 0; i < 100; i++)
+    {
+        reader.read_package (i, package);
+        EXPECT_THAT (
+            package, ElementsAre (expected[i * 3], expected[i * 3 + 1], expected[i * 3 + 2]));
+    }
+    std::vector<double> transposed (3 * 10);
+    reader.read_packages_transposed (45, 10, transposed.data (), 10);
+    for (int i = 0; i < 10; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            EXPECT_EQ (transposed[j * 10 + i], expected[(45 + i) * 3 + j]);
+        }
+    }
+    reader.close ();
+    remove (file_name);
+}
+
+TEST (BinaryFileTest, WriteRead_Float32Packages_ReturnRoundedValues)
+{
+    const char *file_name = "binary_file_test_f32.bin";
+    BinaryFileHeader header = make_header ();
+    header.value_size = 4;
+    write_packages (file_name, header, 0, 20, false);
+    BinaryFileReader reader;
+
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_packages (), 20);
+    std::vector<double> expected = make_packages (0, 20);
+    double package[3];
+    reader.read_package (13, package);
+    EXPECT_EQ (package[0], (double)(float)expected[39]);
+    EXPECT_EQ (package[1], (double)(float)expected[40]);
+    EXPECT_EQ (package[2], (double)(float)expected[41]);
+    reader.close ();
+    remove (file_name);
+}
+
+TEST (BinaryFileTest, FindPackage_WithAndWithoutIndex_ReturnFirstNotLess)
+{
+    const char *file_name = "binary_file_test_index.bin";
+    BinaryFileHeader header = make_header ();
+    write_packages (file_name, header, 0, 1000, false);
+    BinaryFileReader reader;
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+
+    EXPECT_EQ (reader.find_package (0.0, -1), 0);
+    EXPECT_EQ (reader.find_package (1000.0, -1), 0);
+    EXPECT_EQ (reader.find_package (1000.0 + 500 * 0.004, -1), 500);
+    EXPECT_EQ (reader.find_package (1000.0 + 500.5 * 0.004, -1), 501);
+    EXPECT_EQ (reader.find_package (1000.0 + 999 * 0.004, -1), 999);
+    EXPECT_EQ (reader.find_package (5000.0, -1), 1000);
+    reader.close ();
+
+    // same search without index, timestamp channel is provided by caller
+    header.timestamp_channel = -1;
+    write_packages (file_name, header, 0, 1000, false);
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_packages (), 1000);
+    EXPECT_EQ (reader.find_package (1000.0 + 500.5 * 0.004, 1), 501);
+    EXPECT_EQ (reader.find_package (1000.0 + 17 * 0.004, 1), 17);
+    reader.close ();
+    remove (file_name);
+}
+
+TEST (BinaryFileTest, Append_ExistingFileWithIndex_KeepIndexConsistent)
+{
+    const char *file_name = "binary_file_test_append.bin";
+    BinaryFileHeader header = make_header ();
+    write_packages (file_name, header, 0, 37, false);
+    write_packages (file_name, header, 37, 70, true);
+    BinaryFileReader reader;
+
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_packages (), 107);
+    double package[3];
+    reader.read_package (36, package);
+    EXPECT_EQ (package[0], 36.0);
+    reader.read_package (37, package);
+    EXPECT_EQ (package[0], 37.0);
+    reader.read_package (106, package);
+    EXPECT_EQ (package[0], 106.0);
+    EXPECT_EQ (reader.find_package (1000.0 + 80 * 0.004, -1), 80);
+    reader.close ();
+
+    header.num_rows = 4;
+    BinaryFileWriter writer;
+    EXPECT_EQ (writer.open (file_name, header, true),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    remove (file_name);
+}
+
+TEST (BinaryFileTest, Open_FileWithoutIndexAndPartialPackage_IgnoreTail)
+{
+    const char *file_name = "binary_file_test_partial.bin";
+    BinaryFileHeader header = make_header ();
+    std::vector<double> packages = make_packages (0, 10);
+    unsigned char raw[BRAINFLOW_BINARY_HEADER_SIZE];
+    encode_binary_header (header, raw);
+    FILE *fp = fopen (file_name, "wb");
+    fwrite (raw, 1, sizeof (raw), fp);
+    fwrite (packages.data (), sizeof (double), packages.size () - 1, fp);
+    fclose (fp);
+    BinaryFileReader reader;
+
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_packages (), 9);
+    EXPECT_EQ (reader.find_package (1000.0 + 5 * 0.004, -1), 5);
+    reader.close ();
+
+    // appending drops partial package and builds index
+    write_packages (file_name, header, 9, 40, true);
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_packages (), 49);
+    double package[3];
+    reader.read_package (9, package);
+    EXPECT_EQ (package[0], 9.0);
+    EXPECT_EQ (reader.find_package (1000.0 + 40 * 0.004, -1), 40);
+    reader.close ();
+    remove (file_name);
+}
+
+TEST (BinaryFileTest, Open_NotBinaryFile_ReturnError)
+{
+    const char *file_name = "binary_file_test_text.csv";
+    FILE *fp = fopen (file_name, "wb");
+    fprintf (fp, "1.0\t2.0\t3.0\n");
+    fclose (fp);
+    BinaryFileReader reader;
+
+    EXPECT_FALSE (BinaryFileReader::is_binary_file (file_name));
+    EXPECT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    remove (file_name);
+}
+
+static std::vector<unsigned char> read_bytes (const char *file_name)
+{
+    std::vector<unsigned char> bytes;
+    FILE *fp = fopen (file_name, "rb");
+    if (fp == NULL)
+    {
+        return bytes;
+    }
+    unsigned char buf[4096];
+    size_t len = 0;
+    while ((len = fread (buf, 1, sizeof (buf), fp)) > 0)
+    {
+        bytes.insert (bytes.end (), buf, buf + len);
+    }
+    fclose (fp);
+    return bytes;
+}
+
+static void write_bytes (const char *file_name, const unsigned char *bytes, size_t len)
+{
+    FILE *fp = fopen (file_name, "wb");
+    ASSERT_NE (fp, nullptr);
+    fwrite (bytes, 1, len, fp);
+    fclose (fp);
+}
+
+static void expect_packages (const BinaryFileReader &reader, int first, size_t count)
+{
+    std::vector<double> expected = make_packages (first, (int)count);
+    std::vector<double> package (3);
+    for (size_t i = 0; i < count; i++)
+    {
+        reader.read_package (i, package.data ());
+        for (int j = 0; j < 3; j++)
+        {
+            // bit exact, values are stored as is
+            EXPECT_EQ (memcmp (&package[j], &expected[i * 3 + j], sizeof (double)), 0)
+                << "package " << i << " channel " << j;
+        }
+    }
+}
+
+TEST (BinaryFileTest, WriteRead_RoundTrip_KeepHeaderAndLayout)
+{
+    const char *file_name = "binary_file_test_round_trip.bin";
+    BinaryFileHeader header = make_header ();
+    header.board_id = 57;
+    header.preset = 2;
+    header.sampling_rate = 500;
+    write_packages (file_name, header, 0, 100, false);
+    BinaryFileReader reader;
+
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    const BinaryFileHeader &read_header = reader.get_header ();
+    EXPECT_EQ (read_header.version, BRAINFLOW_BINARY_VERSION);
+    EXPECT_EQ (read_header.board_id, 57);
+    EXPECT_EQ (read_header.preset, 2);
+    EXPECT_EQ (read_header.num_rows, 3);
+    EXPECT_EQ (read_header.sampling_rate, 500);
+    EXPECT_EQ (read_header.value_size, 8);
+    EXPECT_EQ (read_header.timestamp_channel, 1);
+    EXPECT_EQ (read_header.index_step, 16);
+    EXPECT_EQ (reader.get_num_packages (), 100);
+    expect_packages (reader, 0, 100);
+    reader.close ();
+
+    // header, packages, 7 index entries and footer
+    size_t num_entries = (100 + 15) / 16;
+    EXPECT_EQ (read_bytes (file_name).size (),
+        BRAINFLOW_BINARY_HEADER_SIZE + 100 * 3 * sizeof (double) +
+            num_entries * BRAINFLOW_BINARY_INDEX_ENTRY_SIZE + BRAINFLOW_BINARY_FOOTER_SIZE);
+    remove (file_name);
+}
+
+TEST (BinaryFileTest, Open_TruncatedHeader_ReturnError)
+{
+    const char *file_name = "binary_file_test_truncated_header.bin";
+    write_packages (file_name, make_header (), 0, 10, false);
+    std::vector<unsigned char> bytes = read_bytes (file_name);
+    BinaryFileReader reader;
+
+    size_t cuts[] = {0, 4, BRAINFLOW_BINARY_MAGIC_LEN, 32, BRAINFLOW_BINARY_HEADER_SIZE - 1};
+    for (size_t cut : cuts)
+    {
+        write_bytes (file_name, bytes.data (), cut);
+        EXPECT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR)
+            << "cut at " << cut;
+        BinaryFileWriter writer;
+        EXPECT_EQ (writer.open (file_name, make_header (), true),
+            (cut == 0) ? (int)BrainFlowExitCodes::STATUS_OK :
+                         (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR)
+            << "cut at " << cut;
+        writer.close ();
+    }
+    remove (file_name);
+}
+
+TEST (BinaryFileTest, Open_TruncatedPackages_ReadCompletePackagesOnly)
+{
+    const char *file_name = "binary_file_test_truncated_data.bin";
+    const char *full_name = "binary_file_test_truncated_full.bin";
+    BinaryFileHeader header = make_header ();
+    write_packages (full_name, header, 0, 50, false);
+    std::vector<unsigned char> bytes = read_bytes (full_name);
+    size_t package_size = 3 * sizeof (double);
+    BinaryFileReader reader;
+
+    // crash while writing leaves no index and may leave a partial package
+    for (size_t cut = BRAINFLOW_BINARY_HEADER_SIZE;
+         cut <= BRAINFLOW_BINARY_HEADER_SIZE + 50 * package_size; cut += 13)
+    {
+        write_bytes (file_name, bytes.data (), cut);
+        ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK)
+            << "cut at " << cut;
+        size_t expected_packages = (cut - BRAINFLOW_BINARY_HEADER_SIZE) / package_size;
+        EXPECT_EQ (reader.get_num_packages (), expected_packages) << "cut at " << cut;
+        expect_packages (reader, 0, expected_packages);
+        reader.close ();
+    }
+
+    // appending to the truncated file continues right after the last complete package
+    write_bytes (file_name, bytes.data (), BRAINFLOW_BINARY_HEADER_SIZE + 20 * package_size + 5);
+    write_packages (file_name, header, 20, 30, true);
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_packages (), 50);
+    expect_packages (reader, 0, 50);
+    reader.close ();
+    EXPECT_EQ (read_bytes (file_name), bytes);
+    remove (file_name);
+    remove (full_name);
+}
+
+TEST (BinaryFileTest, Open_UnknownVersion_ReturnError)
+{
+    const char *file_name = "binary_file_test_unknown_version.bin";
+    write_packages (file_name, make_header (), 0, 10, false);
+    std::vector<unsigned char> bytes = read_bytes (file_name);
+    write_int32_le (bytes.data () + 8, BRAINFLOW_BINARY_VERSION + 1);
+    write_bytes (file_name, bytes.data (), bytes.size ());
+    BinaryFileReader reader;
+
+    EXPECT_TRUE (BinaryFileReader::is_binary_file (file_name));
+    EXPECT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    remove (file_name);
+}
+
+// write_file takes data transposed, a row per channel
+static std::vector<double> make_transposed_packages (int first, int count)
+{
+    std::vector<double> packages = make_packages (first, count);
+    std::vector<double> data (packages.size ());
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            data[j * count + i] = packages[i * 3 + j];
+        }
+    }
+    return data;
+}
+
+TEST (BinaryFileTest, WriteFile_TimestampChannelProvided_SearchByIndex)
+{
+    const char *file_name = "binary_file_test_write_file.bin";
+    std::vector<double> data = make_transposed_packages (0, 600);
+    std::vector<double> more_data = make_transposed_packages (600, 400);
+
+    EXPECT_EQ (write_file_with_index (data.data (), 3, 600, file_name, "wb", 3),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    ASSERT_EQ (write_file_with_index (data.data (), 3, 600, file_name, "wb", 1),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    // appending keeps timestamp channel of the existing file
+    ASSERT_EQ (write_file (more_data.data (), 3, 400, file_name, "ab"),
+        (int)BrainFlowExitCodes::STATUS_OK);
+
+    std::vector<unsigned char> bytes = read_bytes (file_name);
+    ASSERT_GT (bytes.size (), (size_t)BRAINFLOW_BINARY_FOOTER_SIZE);
+    EXPECT_EQ (memcmp (bytes.data () + bytes.size () - BRAINFLOW_BINARY_FOOTER_SIZE,
+                   BRAINFLOW_BINARY_INDEX_MAGIC, BRAINFLOW_BINARY_MAGIC_LEN),
+        0);
+    BinaryFileReader reader;
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_header ().timestamp_channel, 1);
+    ASSERT_EQ (reader.get_num_packages (), (size_t)1000);
+    expect_packages (reader, 0, 1000);
+    EXPECT_EQ (reader.find_package (1000.0 + 500.5 * 0.004, -1), (size_t)501);
+    EXPECT_EQ (reader.find_package (1000.0 + 700 * 0.004, -1), (size_t)700);
+    EXPECT_EQ (reader.find_package (5000.0, -1), (size_t)1000);
+    reader.close ();
+    remove (file_name);
+}
@@ -0,0 +1,67 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <string>
+
+#include "bounded_cache.h"
+
+using namespace testing;
+
+
+TEST (BoundedCacheTest, Get_MissingKey_ReturnNull)
+{
+    BoundedCache<int, std::string> cache (4);
+
+    cache.insert (1, "one");
+
+    EXPECT_EQ (cache.get (2), nullptr);
+    ASSERT_NE (cache.get (1), nullptr);
+    EXPECT_EQ (*cache.get (1), "one");
+}
+
+TEST (BoundedCacheTest, Insert_ExistingKey_ReplaceValueWithoutDrop)
+{
+    BoundedCache<int, std::string> cache (2);
+
+    cache.insert (1, "one");
+    cache.insert (2, "two");
+    const std::string &value = cache.insert (2, "second");
+
+    EXPECT_EQ (value, "second");
+    EXPECT_EQ (cache.size (), (size_t)2);
+    ASSERT_NE (cache.get (1), nullptr);
+    EXPECT_EQ (*cache.get (2), "second");
+}
+
+TEST (BoundedCacheTest, Insert_LimitHit_DropAllEntries)
+{
+    BoundedCache<int, std::unique_ptr<int>> cache (3);
+
+    for (int i = 0; i < 3; i++)
+    {
+        cache.insert (i, std::unique_ptr<int> (new int (i)));
+    }
+    EXPECT_EQ (cache.size (), (size_t)3);
+    int *value = cache.insert (10, std::unique_ptr<int> (new int (10))).get ();
+
+    EXPECT_EQ (*value, 10);
+    EXPECT_EQ (cache.size (), (size_t)1);
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ (cache.get (i), nullptr);
+    }
+    ASSERT_NE (cache.get (10), nullptr);
+    EXPECT_EQ (cache.get (10)->get (), value);
+}
+
+TEST (BoundedCacheTest, Insert_SharedValueDropped_KeepValueAliveForOwners)
+{
+    BoundedCache<int, std::shared_ptr<const int>> cache (1);
+    std::shared_ptr<const int> held = cache.insert (1, std::make_shared<const int> (1));
+
+    cache.insert (2, std::make_shared<const int> (2));
+
+    EXPECT_EQ (cache.get (1), nullptr);
+    EXPECT_EQ (*held, 1);
+    EXPECT_EQ (held.use_count (), 1);
+}
@@ -0,0 +1,78 @@
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "data_buffer.h"
+
+// Contention benchmark for DataBuffer: one acquisition thread pushes samples as fast as it can
+// while several consumer threads poll get_data_count/get_current_data like UI threads do.
+// Usage: data_buffer_benchmark [num_rows] [num_samples] [num_readers]
+
+
+static void run (int num_rows, int num_samples, int num_readers)
+{
+    DataBuffer buffer (num_rows, 45000);
+    std::atomic<bool> done (false);
+    std::vector<long long> reader_ops (num_readers, 0);
+    std::vector<std::thread> readers;
+
+    for (int r = 0; r < num_readers; r++)
+    {
+        readers.push_back (std::thread (
+            [&, r] ()
+            {
+                std::vector<double> chunk (num_rows * 250);
+                long long ops = 0;
+                while (!done)
+                {
+                    if (buffer.get_data_count () > 0)
+                    {
+                        buffer.get_current_data (250, chunk.data ());
+                    }
+                    ops++;
+                }
+                reader_ops[r] = ops;
+            }));
+    }
+
+    std::vector<double> package (num_rows, 1.0);
+    auto start = std::chrono::high_resolution_clock::now ();
+    for (int i = 0; i < num_samples; i++)
+    {
+        package[0] = (double)i;
+        buffer.add_data (package.data ());
+    }
+    auto stop = std::chrono::high_resolution_clock::now ();
+    done = true;
+    for (auto &reader : readers)
+    {
+        reader.join ();
+    }
+
+    double seconds = std::chrono::duration<double> (stop - start).count ();
+    long long total_reader_ops = 0;
+    for (long long ops : reader_ops)
+    {
+        total_reader_ops += ops;
+    }
+    printf ("rows: %3d readers: %2d push: %10.0f samples/s (%6.1f ns/sample) polls: %10.0f/s\n",
+        num_rows, num_readers, num_samples / seconds, seconds * 1e9 / num_samples,
+        total_reader_ops / seconds);
+}
+
+int main (int argc, char *argv[])
+{
+    int num_rows = (argc > 1) ? atoi (argv[1]) : 32;
+    int num_samples = (argc > 2) ? atoi (argv[2]) : 2000000;
+    int max_readers = (argc > 3) ? atoi (argv[3]) : 8;
+
+    run (num_rows, num_samples, 0);
+    for (int num_readers = 1; num_readers <= max_readers; num_readers *= 2)
+    {
+        run (num_rows, num_samples, num_readers);
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include <array>
+#include <atomic>
 #include <future>
 #include <gmock/gmock-matchers.h>
 #include <gmock/gmock.h>
@@ -67,6 +68,45 @@ TEST (DataBufferTest, AddData_AddMoreDataThanBufferCapacity_OverwriteOldestData)
     }
 }
 
+TEST (DataBufferTest, AddDataBlock_BlockWrapsAroundBufferEnd_StoreAllDataInOrder)
+{
+    DataBuffer buffer (2, 4);
+    double first_values[6] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    double second_values[4] = {7.0, 8.0, 9.0, 10.0};
+    double retrieved[8];
+
+    buffer.add_data (first_values, 3);
+    buffer.get_data (2, retrieved);
+    buffer.add_data (second_values, 2);
+
+    EXPECT_EQ (buffer.get_data_count (), 3);
+    EXPECT_EQ (buffer.get_data (4, retrieved), 3);
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT_EQ (retrieved[i], first_values[4 + i]);
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ (retrieved[i + 2], second_values[i]);
+    }
+}
+
+TEST (DataBufferTest, AddDataBlock_BlockBiggerThanBufferCapacity_KeepNewestData)
+{
+    DataBuffer buffer (2, 2);
+    double values[8] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+    double retrieved[4];
+
+    buffer.add_data (values, 4);
+
+    EXPECT_EQ (buffer.get_data_count (), 2);
+    buffer.get_current_data (2, retrieved);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ (retrieved[i], values[4 + i]);
+    }
+}
+
 TEST (DataBufferTest, AddData_BufferIsNotReady_DoNothing)
 {
     DataBuffer buffer_zero (4, 0);
@@ -112,6 +152,85 @@ TEST (DataBufferTest, AddData_InvokeSimultaneouslyOnMultipleThreads_AddDataWitho
     }
 }
 
+TEST (DataBufferTest, AddData_ReadConcurrentlyWithOverwrite_ReturnConsistentSamples)
+{
+    DataBuffer buffer (4, 8);
+    std::atomic<bool> done (false);
+
+    std::thread producer (
+        [&] ()
+        {
+            double values[4];
+            for (int i = 0; i < 200000; i++)
+            {
+                for (int j = 0; j < 4; j++)
+                {
+                    values[j] = (double)i;
+                }
+                buffer.add_data (values);
+            }
+            done = true;
+        });
+
+    double retrieved[32];
+    double last_seen = -1.0;
+    while (!done)
+    {
+        size_t count = buffer.get_current_data (8, retrieved);
+        for (size_t i = 0; i < count; i++)
+        {
+            // all channels of a sample come from the same add_data call and samples are ordered
+            for (int j = 1; j < 4; j++)
+            {
+                ASSERT_EQ (retrieved[i * 4 + j], retrieved[i * 4]);
+            }
+            if (i > 0)
+            {
+                ASSERT_EQ (retrieved[i * 4], retrieved[(i - 1) * 4] + 1.0);
+            }
+        }
+        if (count > 0)
+        {
+            ASSERT_GE (retrieved[(count - 1) * 4], last_seen);
+            last_seen = retrieved[(count - 1) * 4];
+        }
+    }
+    producer.join ();
+}
+
+TEST (DataBufferTest, GetData_ConsumeConcurrentlyWithProducer_ReturnEachSampleOnceInOrder)
+{
+    DataBuffer buffer (2, 100000);
+    const int total = 50000;
+
+    std::thread producer (
+        [&] ()
+        {
+            double values[2];
+            for (int i = 0; i < total; i++)
+            {
+                values[0] = values[1] = (double)i;
+                buffer.add_data (values);
+            }
+        });
+
+    double retrieved[256];
+    int expected = 0;
+    while (expected < total)
+    {
+        size_t count = buffer.get_data (128, retrieved);
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ (retrieved[i * 2], (double)expected);
+            ASSERT_EQ (retrieved[i * 2 + 1], (double)expected);
+            expected++;
+        }
+    }
+    producer.join ();
+
+    EXPECT_EQ (buffer.get_data_count (), 0);
+}
+
 TEST (DataBufferTest, GetData_MaxCountLessThanAvailableCount_ReturnMaxCountBytes)
 {
     DataBuffer buffer (4, 2);
@@ -202,6 +321,21 @@ TEST (DataBufferTest, GetData_AllValueSetsAlreadyReturned_DataCountIsZero)
     EXPECT_EQ (buffer.get_data_count (), 0);
 }
 
+TEST (DataBufferTest, GetFreeSpace_AddAndConsumeData_ReturnUnusedCapacity)
+{
+    DataBuffer buffer (2, 3);
+    double values[6] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    double retrieved[6];
+
+    EXPECT_EQ (buffer.get_free_space (), 3);
+    buffer.add_data (values, 2);
+    EXPECT_EQ (buffer.get_free_space (), 1);
+    buffer.add_data (values, 3);
+    EXPECT_EQ (buffer.get_free_space (), 0);
+    buffer.get_data (2, retrieved);
+    EXPECT_EQ (buffer.get_free_space (), 2);
+}
+
 TEST (DataBufferTest, GetData_InvokedInMultipleThreads_DataReturnedWithoutMixing)
 {
     DataBuffer buffer (4, 1024);
@@ -408,6 +542,55 @@ TEST (DataBufferTest, GetCurrentData_InvokedInMultipleThreads_DataReturnedWithou
     }
 }
 
+TEST (DataBufferTest, GetDataTransposed_DataWrapsAroundBufferEnd_ReturnRowPerChannel)
+{
+    DataBuffer buffer (3, 4);
+    double values[15];
+    for (int i = 0; i < 15; i++)
+    {
+        values[i] = (double)i;
+    }
+    // 5 samples in buffer for 4, first one is overwritten and data wraps around
+    buffer.add_data (values, 5);
+
+    double retrieved[12];
+    auto result = buffer.get_data_transposed (4, retrieved);
+
+    EXPECT_EQ (result, 4);
+    EXPECT_EQ (buffer.get_data_count (), 0);
+    for (int channel = 0; channel < 3; channel++)
+    {
+        for (int sample = 0; sample < 4; sample++)
+        {
+            EXPECT_EQ (retrieved[channel * 4 + sample], values[(sample + 1) * 3 + channel]);
+        }
+    }
+}
+
+TEST (DataBufferTest, GetCurrentDataTransposed_OddNumberOfSamples_ReturnRowPerChannel)
+{
+    DataBuffer buffer (5, 64);
+    double values[5 * 37];
+    for (int i = 0; i < 5 * 37; i++)
+    {
+        values[i] = (double)i;
+    }
+    buffer.add_data (values, 37);
+
+    double retrieved[5 * 33];
+    auto result = buffer.get_current_data_transposed (33, retrieved);
+
+    EXPECT_EQ (result, 33);
+    EXPECT_EQ (buffer.get_data_count (), 37);
+    for (int channel = 0; channel < 5; channel++)
+    {
+        for (int sample = 0; sample < 33; sample++)
+        {
+            EXPECT_EQ (retrieved[channel * 33 + sample], values[(sample + 4) * 5 + channel]);
+        }
+    }
+}
+
 TEST (DataBufferTest, IsReady_BufferCanFitInMemory_ReturnTrue)
 {
     DataBuffer buffer (4, 16);
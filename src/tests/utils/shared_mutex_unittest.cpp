@@ -0,0 +1,109 @@
+#include <atomic>
+#include <chrono>
+#include <gmock/gmock.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "shared_mutex.h"
+
+using namespace testing;
+
+
+TEST (SharedMutexTest, LockShared_InvokedInMultipleThreads_ReadersRunConcurrently)
+{
+    SharedMutex mutex;
+    std::atomic<int> active_readers (0);
+    std::atomic<int> max_active_readers (0);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; i++)
+    {
+        threads.push_back (std::thread ([&] {
+            SharedLockGuard lock (mutex);
+            int active = ++active_readers;
+            int prev_max = max_active_readers.load ();
+            while ((active > prev_max) &&
+                (!max_active_readers.compare_exchange_weak (prev_max, active)))
+            {
+            }
+            // wait until all readers are inside or timeout
+            for (int j = 0; (j < 1000) && (active_readers.load () < 4); j++)
+            {
+                std::this_thread::sleep_for (std::chrono::milliseconds (1));
+            }
+            --active_readers;
+        }));
+    }
+    for (auto &thread : threads)
+    {
+        thread.join ();
+    }
+
+    EXPECT_EQ (max_active_readers.load (), 4);
+}
+
+TEST (SharedMutexTest, Lock_MixedReadersAndWriters_WritersAreExclusive)
+{
+    SharedMutex mutex;
+    int value = 0;
+    int copy = 0;
+    std::atomic<bool> is_consistent (true);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; i++)
+    {
+        threads.push_back (std::thread ([&] {
+            for (int j = 0; j < 1000; j++)
+            {
+                std::lock_guard<SharedMutex> lock (mutex);
+                value++;
+                copy = value;
+            }
+        }));
+        threads.push_back (std::thread ([&] {
+            for (int j = 0; j < 1000; j++)
+            {
+                SharedLockGuard lock (mutex);
+                if (value != copy)
+                {
+                    is_consistent = false;
+                }
+            }
+        }));
+    }
+    for (auto &thread : threads)
+    {
+        thread.join ();
+    }
+
+    EXPECT_TRUE (is_consistent.load ());
+    EXPECT_EQ (value, 4000);
+}
+
+TEST (SharedMutexTest, LockShared_WriterIsWaiting_NewReaderWaitsForWriter)
+{
+    SharedMutex mutex;
+    std::atomic<int> order (0);
+    int writer_order = -1;
+    int reader_order = -1;
+
+    mutex.lock_shared ();
+    std::thread writer ([&] {
+        std::lock_guard<SharedMutex> lock (mutex);
+        writer_order = order++;
+    });
+    // let writer start waiting
+    std::this_thread::sleep_for (std::chrono::milliseconds (50));
+    std::thread reader ([&] {
+        SharedLockGuard lock (mutex);
+        reader_order = order++;
+    });
+    std::this_thread::sleep_for (std::chrono::milliseconds (50));
+    mutex.unlock_shared ();
+    writer.join ();
+    reader.join ();
+
+    EXPECT_EQ (writer_order, 0);
+    EXPECT_EQ (reader_order, 1);
+}
@@ -0,0 +1,78 @@
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "data_buffer.h"
+
+// Compares reading transposed data from DataBuffer via a temporary buffer and a naive reshape
+// (how Board::get_current_board_data used to work) with the direct transposing read.
+
+
+static void reshape_data (int data_count, int num_rows, const double *buf, double *output_buf)
+{
+    for (int i = 0; i < data_count; i++)
+    {
+        for (int j = 0; j < num_rows; j++)
+        {
+            output_buf[j * data_count + i] = buf[i * num_rows + j];
+        }
+    }
+}
+
+template <typename Func>
+static double measure_us (Func func, int iterations)
+{
+    auto start = std::chrono::high_resolution_clock::now ();
+    for (int i = 0; i < iterations; i++)
+    {
+        func ();
+    }
+    auto stop = std::chrono::high_resolution_clock::now ();
+    return std::chrono::duration<double, std::micro> (stop - start).count () / iterations;
+}
+
+int main ()
+{
+    int rows[] = {8, 24, 32, 64};
+    int cols[] = {250, 2500, 25000, 250000};
+
+    for (int num_rows : rows)
+    {
+        for (int num_cols : cols)
+        {
+            DataBuffer buffer (num_rows, num_cols);
+            std::vector<double> package (num_rows);
+            for (int i = 0; i < num_cols; i++)
+            {
+                for (int j = 0; j < num_rows; j++)
+                {
+                    package[j] = (double)(i * num_rows + j);
+                }
+                buffer.add_data (package.data ());
+            }
+            std::vector<double> output (num_rows * num_cols);
+            int iterations = 20000000 / (num_rows * num_cols);
+            if (iterations < 3)
+            {
+                iterations = 3;
+            }
+
+            double old_time = measure_us (
+                [&] ()
+                {
+                    double *buf = new double[num_rows * num_cols];
+                    int count = (int)buffer.get_current_data (num_cols, buf);
+                    reshape_data (count, num_rows, buf, output.data ());
+                    delete[] buf;
+                },
+                iterations);
+            double new_time = measure_us (
+                [&] () { buffer.get_current_data_transposed (num_cols, output.data ()); },
+                iterations);
+            printf ("rows: %3d cols: %7d copy+reshape: %10.1f us transposed read: %10.1f us "
+                    "speedup: %.2fx\n",
+                num_rows, num_cols, old_time, new_time, old_time / new_time);
+        }
+    }
+    return 0;
+}
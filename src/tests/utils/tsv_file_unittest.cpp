@@ -0,0 +1,168 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "tsv_file.h"
+
+using namespace testing;
+
+
+static std::string write_temp_file (const std::string &name, const std::string &content)
+{
+    FILE *fp = fopen (name.c_str (), "wb");
+    fwrite (content.data (), 1, content.size (), fp);
+    fclose (fp);
+    return name;
+}
+
+TEST (TsvFileTest, ParseDouble_FormattedRandomValues_MatchStrtod)
+{
+    std::mt19937 generator (42);
+    std::uniform_real_distribution<double> distribution (-1e6, 1e6);
+    const char *formats[] = {"%lf", "%.17g", "%e", "%.3f", "%g"};
+    char str[64];
+
+    for (int i = 0; i < 100000; i++)
+    {
+        double value = distribution (generator) * ((i % 7 == 0) ? 1e-9 : 1.0);
+        snprintf (str, sizeof (str), formats[i % 5], value);
+        double parsed = 0.0;
+
+        EXPECT_TRUE (parse_double (str, str + strlen (str), &parsed));
+        EXPECT_EQ (parsed, strtod (str, NULL)) << str;
+    }
+}
+
+TEST (TsvFileTest, ParseDouble_SpecialValues_ParseLikeStrtod)
+{
+    const char *values[] = {"  12.5 ", "-0", "1e300", "1E-30", "123456789012345678901", "inf",
+        "+3.25", "0.000000000000000000000000001", "4.\r\n"};
+    for (const char *str : values)
+    {
+        double parsed = 0.0;
+        EXPECT_TRUE (parse_double (str, str + strlen (str), &parsed)) << str;
+        EXPECT_EQ (parsed, strtod (str, NULL)) << str;
+    }
+    double parsed = 0.0;
+    const char *nan_str = "nan";
+    EXPECT_TRUE (parse_double (nan_str, nan_str + 3, &parsed));
+    EXPECT_TRUE (parsed != parsed);
+}
+
+TEST (TsvFileTest, ParseDouble_NotANumber_ReturnFalse)
+{
+    const char *values[] = {"", "  ", "abc", "--1", "x1", "."};
+    for (const char *str : values)
+    {
+        double parsed = 0.0;
+        EXPECT_FALSE (parse_double (str, str + strlen (str), &parsed)) << str;
+    }
+}
+
+TEST (TsvFileTest, ParseDouble_TrailingChars_ParsePrefixLikeStod)
+{
+    const char *values[] = {"1.0abc", "1.0x", "1e", "2.5e+", "1 2", "0x1p3", "-0x1.8p1", "7;"};
+    for (const char *str : values)
+    {
+        double parsed = 0.0;
+        EXPECT_TRUE (parse_double (str, str + strlen (str), &parsed)) << str;
+        EXPECT_EQ (parsed, std::stod (str)) << str;
+    }
+}
+
+TEST (TsvFileTest, Open_LastLineWithoutNewline_CountAllLines)
+{
+    std::string file_name = write_temp_file ("tsv_file_test_lines.csv", "1\t2\n3\t4\n5\t6");
+    TsvFile file;
+
+    int res = file.open (file_name.c_str ());
+
+    EXPECT_EQ (res, (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (file.get_num_lines (), 3);
+    EXPECT_EQ (file.get_line_offset (1), 4);
+    EXPECT_EQ (file.get_num_cols (2), 2);
+    file.close ();
+    remove (file_name.c_str ());
+}
+
+TEST (TsvFileTest, Open_MissingFile_ReturnError)
+{
+    TsvFile file;
+
+    EXPECT_NE (file.open ("tsv_file_test_no_such_file.csv"), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (file.get_num_lines (), 0);
+}
+
+TEST (TsvFileTest, ParseLine_CommaAndTabSeparators_ReturnAllValues)
+{
+    std::string file_name =
+        write_temp_file ("tsv_file_test_sep.csv", "1.5,2.5,3.5\r\n4.5\t5.5\t6.5\t\n7,,8\n");
+    TsvFile file;
+    file.open (file_name.c_str ());
+    double values[3];
+
+    EXPECT_EQ (file.parse_line (0, values, 3), 3);
+    EXPECT_THAT (values, ElementsAre (1.5, 2.5, 3.5));
+    EXPECT_EQ (file.parse_line (1, values, 3), 3);
+    EXPECT_THAT (values, ElementsAre (4.5, 5.5, 6.5));
+    EXPECT_EQ (file.parse_line (1, values, 2), -1);
+    EXPECT_EQ (file.parse_line (2, values, 3), -1);
+    EXPECT_EQ (file.parse_line (3, values, 3), -1);
+    file.close ();
+    remove (file_name.c_str ());
+}
+
+TEST (TsvFileTest, ParseLinesTransposed_BigFile_StoreRowPerColumn)
+{
+    int num_lines = 50000;
+    int num_cols = 8;
+    std::string content;
+    char value[64];
+    for (int i = 0; i < num_lines; i++)
+    {
+        for (int j = 0; j < num_cols; j++)
+        {
+            snprintf (value, sizeof (value), "%lf%c", i * 0.25 - j * 1000.0,
+                (j == num_cols - 1) ? '\n' : '\t');
+            content += value;
+        }
+    }
+    std::string file_name = write_temp_file ("tsv_file_test_big.csv", content);
+    TsvFile file;
+    file.open (file_name.c_str ());
+    std::vector<double> data (num_lines * num_cols);
+
+    int res = file.parse_lines_transposed (0, num_lines, num_cols, data.data (), num_lines);
+
+    EXPECT_EQ (res, (int)BrainFlowExitCodes::STATUS_OK);
+    for (int i = 0; i < num_lines; i++)
+    {
+        for (int j = 0; j < num_cols; j++)
+        {
+            ASSERT_EQ (data[j * num_lines + i], i * 0.25 - j * 1000.0);
+        }
+    }
+    file.close ();
+    remove (file_name.c_str ());
+}
+
+TEST (TsvFileTest, ParseLinesTransposed_RowsWithDifferentSize_ReturnError)
+{
+    std::string file_name = write_temp_file ("tsv_file_test_size.csv", "1\t2\n3\t4\t5\n");
+    TsvFile file;
+    file.open (file_name.c_str ());
+    double data[6];
+
+    EXPECT_EQ (file.parse_lines_transposed (0, 2, 2, data, 2),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (file.parse_lines_transposed (1, 2, 2, data, 2),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    file.close ();
+    remove (file_name.c_str ());
+}
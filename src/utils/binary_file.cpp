@@ -0,0 +1,444 @@
+#include <algorithm>
+
+#include "binary_file.h"
+#include "brainflow_constants.h"
+#include "transpose.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#define BINARY_FILE_WRITE_BUFFER_SIZE 1048576
+
+
+static int64_t file_size (FILE *fp)
+{
+#ifdef _WIN32
+    if (_fseeki64 (fp, 0, SEEK_END) != 0)
+    {
+        return -1;
+    }
+    return (int64_t)_ftelli64 (fp);
+#else
+    if (fseeko (fp, 0, SEEK_END) != 0)
+    {
+        return -1;
+    }
+    return (int64_t)ftello (fp);
+#endif
+}
+
+static bool file_seek (FILE *fp, int64_t offset)
+{
+#ifdef _WIN32
+    return _fseeki64 (fp, offset, SEEK_SET) == 0;
+#else
+    return fseeko (fp, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+static bool file_truncate (FILE *fp, int64_t size)
+{
+    fflush (fp);
+#ifdef _WIN32
+    return _chsize_s (_fileno (fp), size) == 0;
+#else
+    return ftruncate (fileno (fp), (off_t)size) == 0;
+#endif
+}
+
+////////////////////////////////////
+////////// BinaryFileWriter ////////
+////////////////////////////////////
+
+BinaryFileWriter::BinaryFileWriter ()
+{
+    fp = NULL;
+    num_packages = 0;
+}
+
+BinaryFileWriter::~BinaryFileWriter ()
+{
+    close ();
+}
+
+int BinaryFileWriter::open (const char *file_name, const BinaryFileHeader &header, bool append)
+{
+    close ();
+    this->header = header;
+    num_packages = 0;
+    index_packages.clear ();
+    index_timestamps.clear ();
+    if ((header.num_rows <= 0) || (header.timestamp_channel >= header.num_rows) ||
+        (header.index_step <= 0) ||
+        ((header.value_size != (int32_t)sizeof (double)) &&
+            (header.value_size != (int32_t)sizeof (float))))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    if (append)
+    {
+        int res = prepare_append (file_name);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    if (fp == NULL)
+    {
+        fp = fopen (file_name, "wb");
+        if (fp == NULL)
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        unsigned char raw[BRAINFLOW_BINARY_HEADER_SIZE];
+        encode_binary_header (this->header, raw);
+        if (fwrite (raw, 1, sizeof (raw), fp) != sizeof (raw))
+        {
+            fclose (fp);
+            fp = NULL;
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+    }
+    setvbuf (fp, NULL, _IOFBF, BINARY_FILE_WRITE_BUFFER_SIZE);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+// opens existing file for appending, removes its index footer, fp stays NULL if file is empty
+int BinaryFileWriter::prepare_append (const char *file_name)
+{
+    fp = fopen (file_name, "r+b");
+    if (fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK; // no such file, create it
+    }
+    int64_t size = file_size (fp);
+    if (size == 0)
+    {
+        fclose (fp);
+        fp = NULL;
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    unsigned char raw[BRAINFLOW_BINARY_HEADER_SIZE];
+    BinaryFileHeader existing_header;
+    if ((size < BRAINFLOW_BINARY_HEADER_SIZE) || (!file_seek (fp, 0)) ||
+        (fread (raw, 1, sizeof (raw), fp) != sizeof (raw)) ||
+        (!decode_binary_header (raw, existing_header)) ||
+        (existing_header.num_rows != header.num_rows) ||
+        (existing_header.value_size != header.value_size))
+    {
+        fclose (fp);
+        fp = NULL;
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    header = existing_header;
+
+    int64_t data_end = size;
+    unsigned char footer[BRAINFLOW_BINARY_FOOTER_SIZE];
+    if ((size >= BRAINFLOW_BINARY_HEADER_SIZE + BRAINFLOW_BINARY_FOOTER_SIZE) &&
+        (file_seek (fp, size - BRAINFLOW_BINARY_FOOTER_SIZE)) &&
+        (fread (footer, 1, sizeof (footer), fp) == sizeof (footer)) &&
+        (memcmp (footer, BRAINFLOW_BINARY_INDEX_MAGIC, BRAINFLOW_BINARY_MAGIC_LEN) == 0))
+    {
+        int64_t num_entries = read_int64_le (footer + BRAINFLOW_BINARY_MAGIC_LEN);
+        int64_t index_start =
+            size - BRAINFLOW_BINARY_FOOTER_SIZE - num_entries * BRAINFLOW_BINARY_INDEX_ENTRY_SIZE;
+        if ((num_entries >= 0) && (index_start >= BRAINFLOW_BINARY_HEADER_SIZE) &&
+            (file_seek (fp, index_start)))
+        {
+            std::vector<unsigned char> entries (
+                (size_t)num_entries * BRAINFLOW_BINARY_INDEX_ENTRY_SIZE);
+            if (fread (entries.data (), 1, entries.size (), fp) == entries.size ())
+            {
+                for (int64_t i = 0; i < num_entries; i++)
+                {
+                    const unsigned char *entry =
+                        entries.data () + i * BRAINFLOW_BINARY_INDEX_ENTRY_SIZE;
+                    index_packages.push_back (read_int64_le (entry));
+                    index_timestamps.push_back (read_double_le (entry + 8));
+                }
+                data_end = index_start;
+            }
+        }
+    }
+    // drop partially written package if any
+    int64_t package_size = (int64_t)header.package_size ();
+    num_packages = (data_end - BRAINFLOW_BINARY_HEADER_SIZE) / package_size;
+    data_end = BRAINFLOW_BINARY_HEADER_SIZE + num_packages * package_size;
+    // index is rebuilt from scratch if it doesnt match the data
+    int64_t expected_entries = (num_packages + header.index_step - 1) / header.index_step;
+    if ((header.timestamp_channel < 0) || ((int64_t)index_packages.size () != expected_entries))
+    {
+        index_packages.clear ();
+        index_timestamps.clear ();
+        if (header.timestamp_channel >= 0)
+        {
+            std::vector<unsigned char> value (header.value_size);
+            for (int64_t i = 0; i < num_packages; i += header.index_step)
+            {
+                double timestamp = 0.0;
+                if ((!file_seek (fp, BRAINFLOW_BINARY_HEADER_SIZE + i * package_size +
+                            header.timestamp_channel * header.value_size)) ||
+                    (fread (value.data (), 1, value.size (), fp) != value.size ()))
+                {
+                    fclose (fp);
+                    fp = NULL;
+                    return (int)BrainFlowExitCodes::GENERAL_ERROR;
+                }
+                decode_binary_values (value.data (), 1, header.value_size, &timestamp);
+                index_packages.push_back (i);
+                index_timestamps.push_back (timestamp);
+            }
+        }
+    }
+    if (((data_end != size) && (!file_truncate (fp, data_end))) || (!file_seek (fp, data_end)))
+    {
+        fclose (fp);
+        fp = NULL;
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BinaryFileWriter::write_packages (const double *packages, size_t count)
+{
+    if (fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    if (header.timestamp_channel >= 0)
+    {
+        int64_t next_indexed = (num_packages + header.index_step - 1) / header.index_step;
+        next_indexed *= header.index_step;
+        for (int64_t i = next_indexed; i < num_packages + (int64_t)count; i += header.index_step)
+        {
+            index_packages.push_back (i);
+            index_timestamps.push_back (
+                packages[(i - num_packages) * header.num_rows + header.timestamp_channel]);
+        }
+    }
+    size_t num_values = count * (size_t)header.num_rows;
+    size_t num_bytes = num_values * (size_t)header.value_size;
+    const unsigned char *raw = (const unsigned char *)packages;
+#ifdef BRAINFLOW_BIG_ENDIAN
+    bool need_encoding = true;
+#else
+    bool need_encoding = (header.value_size != (int32_t)sizeof (double));
+#endif
+    if (need_encoding)
+    {
+        encoded.resize (num_bytes);
+        encode_binary_values (packages, num_values, header.value_size, encoded.data ());
+        raw = encoded.data ();
+    }
+    num_packages += (int64_t)count;
+    if (fwrite (raw, 1, num_bytes, fp) != num_bytes)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BinaryFileWriter::close ()
+{
+    if (fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    if (header.timestamp_channel >= 0)
+    {
+        std::vector<unsigned char> index (
+            index_packages.size () * BRAINFLOW_BINARY_INDEX_ENTRY_SIZE +
+            BRAINFLOW_BINARY_FOOTER_SIZE);
+        unsigned char *ptr = index.data ();
+        for (size_t i = 0; i < index_packages.size (); i++)
+        {
+            write_int64_le (ptr, index_packages[i]);
+            write_double_le (ptr + 8, index_timestamps[i]);
+            ptr += BRAINFLOW_BINARY_INDEX_ENTRY_SIZE;
+        }
+        memcpy (ptr, BRAINFLOW_BINARY_INDEX_MAGIC, BRAINFLOW_BINARY_MAGIC_LEN);
+        write_int64_le (ptr + BRAINFLOW_BINARY_MAGIC_LEN, (int64_t)index_packages.size ());
+        if (fwrite (index.data (), 1, index.size (), fp) != index.size ())
+        {
+            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+    }
+    if (fclose (fp) != 0)
+    {
+        res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    fp = NULL;
+    return res;
+}
+
+////////////////////////////////////
+////////// BinaryFileReader ////////
+////////////////////////////////////
+
+BinaryFileReader::BinaryFileReader ()
+{
+    packages = NULL;
+    num_packages = 0;
+    package_size = 0;
+    index = NULL;
+    num_index_entries = 0;
+}
+
+bool BinaryFileReader::is_binary_file (const char *file_name)
+{
+    FILE *fp = fopen (file_name, "rb");
+    if (fp == NULL)
+    {
+        return false;
+    }
+    char magic[BRAINFLOW_BINARY_MAGIC_LEN];
+    bool res = (fread (magic, 1, sizeof (magic), fp) == sizeof (magic)) &&
+        (memcmp (magic, BRAINFLOW_BINARY_MAGIC, BRAINFLOW_BINARY_MAGIC_LEN) == 0);
+    fclose (fp);
+    return res;
+}
+
+int BinaryFileReader::open (const char *file_name)
+{
+    close ();
+    int res = file.open (file_name);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    const unsigned char *data = (const unsigned char *)file.get_data ();
+    size_t size = file.get_size ();
+    if ((size < BRAINFLOW_BINARY_HEADER_SIZE) || (!decode_binary_header (data, header)))
+    {
+        close ();
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    package_size = header.package_size ();
+    packages = data + BRAINFLOW_BINARY_HEADER_SIZE;
+
+    size_t data_end = size;
+    if ((size >= BRAINFLOW_BINARY_HEADER_SIZE + BRAINFLOW_BINARY_FOOTER_SIZE) &&
+        (memcmp (data + size - BRAINFLOW_BINARY_FOOTER_SIZE, BRAINFLOW_BINARY_INDEX_MAGIC,
+             BRAINFLOW_BINARY_MAGIC_LEN) == 0))
+    {
+        int64_t num_entries =
+            read_int64_le (data + size - BRAINFLOW_BINARY_FOOTER_SIZE + BRAINFLOW_BINARY_MAGIC_LEN);
+        size_t max_entries = (size - BRAINFLOW_BINARY_HEADER_SIZE - BRAINFLOW_BINARY_FOOTER_SIZE) /
+            BRAINFLOW_BINARY_INDEX_ENTRY_SIZE;
+        if ((num_entries >= 0) && ((size_t)num_entries <= max_entries))
+        {
+            num_index_entries = (size_t)num_entries;
+            data_end = size - BRAINFLOW_BINARY_FOOTER_SIZE -
+                num_index_entries * BRAINFLOW_BINARY_INDEX_ENTRY_SIZE;
+            index = data + data_end;
+        }
+    }
+    num_packages = (data_end - BRAINFLOW_BINARY_HEADER_SIZE) / package_size;
+    // index is optional, ignore it if it doesnt match the data
+    size_t expected_entries = (num_packages + header.index_step - 1) / header.index_step;
+    if ((header.timestamp_channel < 0) || (num_index_entries != expected_entries))
+    {
+        index = NULL;
+        num_index_entries = 0;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void BinaryFileReader::close ()
+{
+    file.close ();
+    header = BinaryFileHeader ();
+    packages = NULL;
+    num_packages = 0;
+    package_size = 0;
+    index = NULL;
+    num_index_entries = 0;
+}
+
+void BinaryFileReader::read_package (size_t package_num, double *package) const
+{
+    decode_binary_values (
+        packages + package_num * package_size, header.num_rows, header.value_size, package);
+}
+
+void BinaryFileReader::read_packages_transposed (
+    size_t first_package, size_t count, double *data, size_t stride) const
+{
+    const unsigned char *src = packages + first_package * package_size;
+#ifndef BRAINFLOW_BIG_ENDIAN
+    if (header.value_size == (int32_t)sizeof (double))
+    {
+        transpose_samples ((const double *)src, header.num_rows, count, data, stride);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; i++)
+    {
+        for (int32_t j = 0; j < header.num_rows; j++)
+        {
+            decode_binary_values (src + i * package_size + j * header.value_size, 1,
+                header.value_size, data + j * stride + i);
+        }
+    }
+}
+
+double BinaryFileReader::read_value (size_t package_num, int channel) const
+{
+    double value = 0.0;
+    decode_binary_values (packages + package_num * package_size + channel * header.value_size, 1,
+        header.value_size, &value);
+    return value;
+}
+
+size_t BinaryFileReader::find_package (double timestamp, int timestamp_channel) const
+{
+    if (header.timestamp_channel >= 0)
+    {
+        timestamp_channel = header.timestamp_channel;
+    }
+    if ((timestamp_channel < 0) || (timestamp_channel >= header.num_rows))
+    {
+        return 0;
+    }
+    size_t first = 0;
+    size_t last = num_packages;
+    if (index != NULL)
+    {
+        // narrow the search to a single index step
+        size_t lo = 0;
+        size_t hi = num_index_entries;
+        while (lo < hi)
+        {
+            size_t mid = lo + (hi - lo) / 2;
+            if (read_double_le (index + mid * BRAINFLOW_BINARY_INDEX_ENTRY_SIZE + 8) < timestamp)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        first = (lo == 0) ? 0 : (lo - 1) * header.index_step;
+        last = std::min (num_packages, lo * (size_t)header.index_step);
+    }
+    while (first < last)
+    {
+        size_t mid = first + (last - first) / 2;
+        if (read_value (mid, timestamp_channel) < timestamp)
+        {
+            first = mid + 1;
+        }
+        else
+        {
+            last = mid;
+        }
+    }
+    return first;
+}
@@ -1,12 +1,60 @@
 #include "data_buffer.h"
+#include "transpose.h"
 
+#include <algorithm>
 #include <new>
 
+// stack block for transposed reads, 16 samples of 64 channels
+#define DATA_BUFFER_BLOCK_LEN (BRAINFLOW_TRANSPOSE_TILE * 64)
+
+
+static inline void load_values (const std::atomic<double> *src, size_t count, double *dst)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dst[i] = src[i].load (std::memory_order_relaxed);
+    }
+}
+
+static inline void store_values (std::atomic<double> *dst, size_t count, const double *src)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dst[i].store (src[i], std::memory_order_relaxed);
+    }
+}
+
+// slots are loaded block by block into a plain array and transposed from it
+static void load_transposed (const std::atomic<double> *src, size_t num_rows, size_t num_samples,
+    double *dst, size_t dst_stride)
+{
+    size_t block_samples = (num_rows == 0) ? 0 : DATA_BUFFER_BLOCK_LEN / num_rows;
+    if (block_samples == 0)
+    {
+        for (size_t sample = 0; sample < num_samples; sample++)
+        {
+            for (size_t row = 0; row < num_rows; row++)
+            {
+                dst[row * dst_stride + sample] =
+                    src[sample * num_rows + row].load (std::memory_order_relaxed);
+            }
+        }
+        return;
+    }
+    double block[DATA_BUFFER_BLOCK_LEN];
+    for (size_t first = 0; first < num_samples; first += block_samples)
+    {
+        size_t count = std::min (block_samples, num_samples - first);
+        load_values (src + first * num_rows, count * num_rows, block);
+        transpose_samples (block, num_rows, count, dst + first, dst_stride);
+    }
+}
+
 DataBuffer::DataBuffer (int num_samples, size_t buffer_size)
+    : write_pos (0), head (0), read_pos (0)
 {
     this->buffer_size = buffer_size;
     this->num_samples = num_samples;
-    first_free = first_used = count = 0;
 
     if (buffer_size == 0)
     {
@@ -16,7 +64,7 @@ DataBuffer::DataBuffer (int num_samples, size_t buffer_size)
     {
         try
         {
-            data = new double[buffer_size * num_samples];
+            data = new std::atomic<double>[buffer_size * num_samples];
         }
         catch (const std::bad_alloc &)
         {
@@ -37,85 +85,186 @@ bool DataBuffer::is_ready ()
 
 void DataBuffer::add_data (double *value)
 {
-    if (!is_ready ())
+    add_data (value, 1);
+}
+
+void DataBuffer::add_data (const double *values, size_t count)
+{
+    if ((!is_ready ()) || (count == 0))
     {
         return;
     }
+    // only the newest buffer_size samples survive anyway
+    if (count > buffer_size)
+    {
+        values += (count - buffer_size) * num_samples;
+        count = buffer_size;
+    }
 
-    lock.lock ();
+    producer_lock.lock ();
 
-    if (count == 0)
+    size_t pos = head.load (std::memory_order_relaxed);
+    // announce slots before touching them so readers can detect that their copy is stale
+    write_pos.store (pos + count, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+    put_chunk (pos, count, values);
+    head.store (pos + count, std::memory_order_release);
+
+    producer_lock.unlock ();
+}
+
+void DataBuffer::get_chunk (size_t start, size_t size, double *data_buf, bool transpose)
+{
+    start = start % buffer_size;
+    size_t first_half = size;
+    if (start + size > buffer_size)
     {
-        first_used = first_free = 0;
+        first_half = buffer_size - start;
     }
-    else if (first_free == first_used)
+    size_t second_half = size - first_half;
+    if (transpose)
     {
-        first_used = next (first_used);
-        count--;
+        // write straight into caller's buffer, row stride is the number of returned samples
+        load_transposed (data + start * num_samples, num_samples, first_half, data_buf, size);
+        load_transposed (data, num_samples, second_half, data_buf + first_half, size);
+    }
+    else
+    {
+        load_values (data + start * num_samples, first_half * num_samples, data_buf);
+        load_values (data, second_half * num_samples, data_buf + first_half * num_samples);
     }
-
-    memcpy (this->data + first_free * num_samples, value, sizeof (double) * num_samples);
-    first_free = next (first_free);
-    count++;
-
-    lock.unlock ();
 }
 
-void DataBuffer::get_chunk (size_t start, size_t size, double *data_buf)
+void DataBuffer::put_chunk (size_t start, size_t size, const double *data_buf)
 {
+    start = start % buffer_size;
     if (start + size < buffer_size)
     {
-        memcpy (data_buf, data + start * num_samples, size * sizeof (double) * num_samples);
+        store_values (data + start * num_samples, size * num_samples, data_buf);
     }
     else
     {
         size_t first_half = buffer_size - start;
         size_t second_half = size - first_half;
-        memcpy (data_buf, data + start * num_samples, first_half * sizeof (double) * num_samples);
-        memcpy (
-            data_buf + first_half * num_samples, data, second_half * sizeof (double) * num_samples);
+        store_values (data + start * num_samples, first_half * num_samples, data_buf);
+        store_values (data, second_half * num_samples, data_buf + first_half * num_samples);
     }
 }
 
+// true if producer reused any slot starting from position start during the last copy
+bool DataBuffer::is_overwritten (size_t start)
+{
+    std::atomic_thread_fence (std::memory_order_acquire);
+    return (write_pos.load (std::memory_order_relaxed) - start > buffer_size);
+}
+
 // Removes data from buffer
 size_t DataBuffer::get_data (size_t max_count, double *data_buf)
 {
-    lock.lock ();
-    size_t result_count = max_count;
-    if (result_count > count)
+    return read_data (max_count, data_buf, false);
+}
+
+size_t DataBuffer::get_data_transposed (size_t max_count, double *data_buf)
+{
+    return read_data (max_count, data_buf, true);
+}
+
+// Doesn't remove data from buffer
+size_t DataBuffer::get_current_data (size_t max_count, double *data_buf)
+{
+    return read_current_data (max_count, data_buf, false);
+}
+
+size_t DataBuffer::get_current_data_transposed (size_t max_count, double *data_buf)
+{
+    return read_current_data (max_count, data_buf, true);
+}
+
+size_t DataBuffer::read_data (size_t max_count, double *data_buf, bool transpose)
+{
+    if (!is_ready ())
     {
-        result_count = count;
+        return 0;
     }
-    if (result_count)
+
+    while (true)
     {
-        get_chunk (first_used, result_count, data_buf);
-        first_used = (first_used + result_count) % buffer_size;
-        count -= result_count;
+        // read_pos first: head observed afterwards is never behind it
+        size_t tail = read_pos.load (std::memory_order_acquire);
+        size_t cur_head = head.load (std::memory_order_acquire);
+        size_t first = tail;
+        // oldest samples were overwritten by producer
+        if (cur_head - tail > buffer_size)
+        {
+            first = cur_head - buffer_size;
+        }
+        size_t result_count = cur_head - first;
+        if (result_count > max_count)
+        {
+            result_count = max_count;
+        }
+        if (result_count == 0)
+        {
+            return 0;
+        }
+        get_chunk (first, result_count, data_buf, transpose);
+        if (is_overwritten (first))
+        {
+            continue;
+        }
+        if (read_pos.compare_exchange_weak (tail, first + result_count, std::memory_order_acq_rel,
+                std::memory_order_relaxed))
+        {
+            return result_count;
+        }
     }
-    lock.unlock ();
-    return result_count;
 }
 
-// Doesn't remove data from buffer
-size_t DataBuffer::get_current_data (size_t max_count, double *data_buf)
+size_t DataBuffer::read_current_data (size_t max_count, double *data_buf, bool transpose)
 {
-    lock.lock ();
-    size_t result_count = max_count;
-    if (result_count > count)
-        result_count = count;
-    if (result_count)
+    if (!is_ready ())
     {
-        size_t first_return = (first_used + (count - result_count)) % buffer_size;
-        get_chunk (first_return, result_count, data_buf);
+        return 0;
+    }
+
+    while (true)
+    {
+        size_t tail = read_pos.load (std::memory_order_acquire);
+        size_t cur_head = head.load (std::memory_order_acquire);
+        size_t result_count = cur_head - tail;
+        if (result_count > buffer_size)
+        {
+            result_count = buffer_size;
+        }
+        if (result_count > max_count)
+        {
+            result_count = max_count;
+        }
+        if (result_count == 0)
+        {
+            return 0;
+        }
+        size_t first_return = cur_head - result_count;
+        get_chunk (first_return, result_count, data_buf, transpose);
+        if (!is_overwritten (first_return))
+        {
+            return result_count;
+        }
     }
-    lock.unlock ();
-    return result_count;
 }
 
 size_t DataBuffer::get_data_count ()
 {
-    lock.lock ();
-    size_t result = this->count;
-    lock.unlock ();
+    size_t tail = read_pos.load (std::memory_order_acquire);
+    size_t result = head.load (std::memory_order_acquire) - tail;
+    if (result > buffer_size)
+    {
+        result = buffer_size;
+    }
     return result;
 }
+
+size_t DataBuffer::get_free_space ()
+{
+    return buffer_size - get_data_count ();
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "binary_file_format.h"
+#include "mapped_file.h"
+
+
+// Writes packages in BrainFlow binary format and the timestamp index on close.
+// All methods return BrainFlowExitCodes.
+class BinaryFileWriter
+{
+
+public:
+    BinaryFileWriter ();
+    ~BinaryFileWriter ();
+
+    // in append mode existing file must have the same num_rows and value size, its index is
+    // kept and extended
+    int open (const char *file_name, const BinaryFileHeader &header, bool append);
+    // packages are stored one after another, num_rows values each
+    int write_packages (const double *packages, size_t num_packages);
+    int close ();
+
+    bool is_open () const
+    {
+        return fp != NULL;
+    }
+
+private:
+    FILE *fp;
+    BinaryFileHeader header;
+    int64_t num_packages;
+    std::vector<int64_t> index_packages;
+    std::vector<double> index_timestamps;
+    std::vector<unsigned char> encoded;
+
+    int prepare_append (const char *file_name);
+};
+
+// Memory mapped reader for BrainFlow binary format, packages are accessed by number in O(1),
+// search by timestamp is O(log n) and uses sparse index if it is present.
+class BinaryFileReader
+{
+
+public:
+    BinaryFileReader ();
+
+    // returns BrainFlowExitCodes
+    int open (const char *file_name);
+    void close ();
+
+    // checks magic of a file without mapping it
+    static bool is_binary_file (const char *file_name);
+
+    const BinaryFileHeader &get_header () const
+    {
+        return header;
+    }
+
+    size_t get_num_packages () const
+    {
+        return num_packages;
+    }
+
+    // package must hold num_rows values
+    void read_package (size_t package_num, double *package) const;
+    // reads num_packages starting from first_package, value j of package i is stored in
+    // data[j * stride + i]
+    void read_packages_transposed (
+        size_t first_package, size_t num_packages, double *data, size_t stride) const;
+    // returns number of the first package with timestamp >= timestamp, timestamps in a file must
+    // grow. timestamp_channel is used if file has no index
+    size_t find_package (double timestamp, int timestamp_channel) const;
+
+private:
+    MappedFile file;
+    BinaryFileHeader header;
+    const unsigned char *packages;
+    size_t num_packages;
+    size_t package_size;
+    const unsigned char *index;
+    size_t num_index_entries;
+
+    double read_value (size_t package_num, int channel) const;
+};
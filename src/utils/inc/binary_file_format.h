@@ -0,0 +1,214 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// BrainFlow binary recording: fixed size header followed by packages stored one after another,
+// each package is num_rows little endian float64 or float32 values (value_size bytes each).
+//
+// header layout, all fields are little endian int32 unless noted:
+//   0  magic "BFBINARY" (8 bytes)
+//   8  format version
+//   12 board id
+//   16 preset
+//   20 num_rows
+//   24 sampling rate
+//   28 value size, 8 for float64, 4 for float32
+//   32 timestamp channel, -1 if there is no timestamp index
+//   36 timestamp index step in packages
+//   40 reserved (8 bytes)
+//
+// If file was closed properly it ends with a sparse timestamp index: num_entries entries of
+// little endian int64 package number and float64 timestamp for every index_step-th package,
+// followed by the footer: magic "BFINDEX1" (8 bytes) and int64 num_entries. Files without
+// index(e.g. after a crash) are still valid, readers should fall back to a binary search.
+
+#define BRAINFLOW_BINARY_MAGIC "BFBINARY"
+#define BRAINFLOW_BINARY_INDEX_MAGIC "BFINDEX1"
+#define BRAINFLOW_BINARY_MAGIC_LEN 8
+#define BRAINFLOW_BINARY_VERSION 1
+#define BRAINFLOW_BINARY_HEADER_SIZE 48
+#define BRAINFLOW_BINARY_INDEX_ENTRY_SIZE 16
+#define BRAINFLOW_BINARY_FOOTER_SIZE 16
+#define BRAINFLOW_BINARY_DEFAULT_INDEX_STEP 1024
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define BRAINFLOW_BIG_ENDIAN
+#endif
+
+
+struct BinaryFileHeader
+{
+    int32_t version;
+    int32_t board_id;
+    int32_t preset;
+    int32_t num_rows;
+    int32_t sampling_rate;
+    int32_t value_size;
+    int32_t timestamp_channel;
+    int32_t index_step;
+
+    BinaryFileHeader ()
+    {
+        version = BRAINFLOW_BINARY_VERSION;
+        board_id = -100;
+        preset = 0;
+        num_rows = 0;
+        sampling_rate = 0;
+        value_size = (int32_t)sizeof (double);
+        timestamp_channel = -1;
+        index_step = BRAINFLOW_BINARY_DEFAULT_INDEX_STEP;
+    }
+
+    size_t package_size () const
+    {
+        return (size_t)num_rows * (size_t)value_size;
+    }
+};
+
+inline void write_int32_le (unsigned char *dst, int32_t value)
+{
+    uint32_t v = (uint32_t)value;
+    for (int i = 0; i < 4; i++)
+    {
+        dst[i] = (unsigned char)((v >> (8 * i)) & 0xFF);
+    }
+}
+
+inline int32_t read_int32_le (const unsigned char *src)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        v |= (uint32_t)src[i] << (8 * i);
+    }
+    return (int32_t)v;
+}
+
+inline void write_int64_le (unsigned char *dst, int64_t value)
+{
+    uint64_t v = (uint64_t)value;
+    for (int i = 0; i < 8; i++)
+    {
+        dst[i] = (unsigned char)((v >> (8 * i)) & 0xFF);
+    }
+}
+
+inline int64_t read_int64_le (const unsigned char *src)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        v |= (uint64_t)src[i] << (8 * i);
+    }
+    return (int64_t)v;
+}
+
+inline void write_double_le (unsigned char *dst, double value)
+{
+    int64_t v;
+    memcpy (&v, &value, sizeof (v));
+    write_int64_le (dst, v);
+}
+
+inline double read_double_le (const unsigned char *src)
+{
+    int64_t v = read_int64_le (src);
+    double value;
+    memcpy (&value, &v, sizeof (value));
+    return value;
+}
+
+inline void encode_binary_header (const BinaryFileHeader &header, unsigned char *dst)
+{
+    memset (dst, 0, BRAINFLOW_BINARY_HEADER_SIZE);
+    memcpy (dst, BRAINFLOW_BINARY_MAGIC, BRAINFLOW_BINARY_MAGIC_LEN);
+    write_int32_le (dst + 8, header.version);
+    write_int32_le (dst + 12, header.board_id);
+    write_int32_le (dst + 16, header.preset);
+    write_int32_le (dst + 20, header.num_rows);
+    write_int32_le (dst + 24, header.sampling_rate);
+    write_int32_le (dst + 28, header.value_size);
+    write_int32_le (dst + 32, header.timestamp_channel);
+    write_int32_le (dst + 36, header.index_step);
+}
+
+// returns false if src doesnt contain a valid header
+inline bool decode_binary_header (const unsigned char *src, BinaryFileHeader &header)
+{
+    if (memcmp (src, BRAINFLOW_BINARY_MAGIC, BRAINFLOW_BINARY_MAGIC_LEN) != 0)
+    {
+        return false;
+    }
+    header.version = read_int32_le (src + 8);
+    header.board_id = read_int32_le (src + 12);
+    header.preset = read_int32_le (src + 16);
+    header.num_rows = read_int32_le (src + 20);
+    header.sampling_rate = read_int32_le (src + 24);
+    header.value_size = read_int32_le (src + 28);
+    header.timestamp_channel = read_int32_le (src + 32);
+    header.index_step = read_int32_le (src + 36);
+    if ((header.version != BRAINFLOW_BINARY_VERSION) || (header.num_rows <= 0) ||
+        ((header.value_size != (int32_t)sizeof (double)) &&
+            (header.value_size != (int32_t)sizeof (float))) ||
+        (header.timestamp_channel >= header.num_rows) || (header.index_step <= 0))
+    {
+        return false;
+    }
+    return true;
+}
+
+// converts count values to the on disk representation, dst must hold count * value_size bytes
+inline void encode_binary_values (
+    const double *src, size_t count, int32_t value_size, unsigned char *dst)
+{
+    if (value_size == (int32_t)sizeof (double))
+    {
+#ifdef BRAINFLOW_BIG_ENDIAN
+        for (size_t i = 0; i < count; i++)
+        {
+            write_double_le (dst + i * sizeof (double), src[i]);
+        }
+#else
+        memcpy (dst, src, count * sizeof (double));
+#endif
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            float value = (float)src[i];
+            int32_t v;
+            memcpy (&v, &value, sizeof (v));
+            write_int32_le (dst + i * sizeof (float), v);
+        }
+    }
+}
+
+// converts count values from the on disk representation to doubles
+inline void decode_binary_values (
+    const unsigned char *src, size_t count, int32_t value_size, double *dst)
+{
+    if (value_size == (int32_t)sizeof (double))
+    {
+#ifdef BRAINFLOW_BIG_ENDIAN
+        for (size_t i = 0; i < count; i++)
+        {
+            dst[i] = read_double_le (src + i * sizeof (double));
+        }
+#else
+        memcpy (dst, src, count * sizeof (double));
+#endif
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            int32_t v = read_int32_le (src + i * sizeof (float));
+            float value;
+            memcpy (&value, &v, sizeof (value));
+            dst[i] = (double)value;
+        }
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <map>
+#include <stddef.h>
+#include <utility>
+
+
+// Map with a limit on number of entries, used for plans, tables and filter designs which are
+// expensive to create. Typical app uses a few keys, so if limit is hit everything is dropped
+// instead of tracking usage. Not thread safe, callers make it thread_local or lock it. Value is
+// usually a smart pointer, pointers returned by get stay valid until next insert.
+template <typename Key, typename Value>
+class BoundedCache
+{
+public:
+    explicit BoundedCache (size_t max_size)
+    {
+        this->max_size = max_size;
+    }
+
+    // returns NULL if key is not cached
+    const Value *get (const Key &key) const
+    {
+        auto it = entries.find (key);
+        if (it == entries.end ())
+        {
+            return NULL;
+        }
+        return &it->second;
+    }
+
+    const Value &insert (const Key &key, Value value)
+    {
+        if ((entries.size () >= max_size) && (entries.find (key) == entries.end ()))
+        {
+            entries.clear ();
+        }
+        Value &entry = entries[key];
+        entry = std::move (value);
+        return entry;
+    }
+
+    size_t size () const
+    {
+        return entries.size ();
+    }
+
+private:
+    size_t max_size;
+    std::map<Key, Value> entries;
+};
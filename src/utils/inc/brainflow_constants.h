@@ -111,7 +111,11 @@ enum class AggOperations : int
 {
     MEAN = 0,
     MEDIAN = 1,
-    EACH = 2
+    EACH = 2,
+    STDDEV = 3,
+    MIN = 4,
+    MAX = 5,
+    RMS = 6
 };
 
 enum class WindowOperations : int
@@ -119,7 +123,10 @@ enum class WindowOperations : int
     NO_WINDOW = 0,
     HANNING = 1,
     HAMMING = 2,
-    BLACKMAN_HARRIS = 3
+    BLACKMAN_HARRIS = 3,
+    TUKEY = 4,
+    KAISER = 5,
+    FLAT_TOP = 6
 };
 
 enum class DetrendOperations : int
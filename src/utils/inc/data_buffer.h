@@ -1,34 +1,56 @@
 #pragma once
 
-#include "spinlock.h"
+#include <atomic>
 #include <stdlib.h>
 #include <string.h>
 
+#include "spinlock.h"
+
+// Ring buffer between the board read thread and consumers.
+// Positions are monotonic sample counters, slot is position % buffer_size. Readers never take a
+// lock: they copy optimistically and validate against write_pos afterwards (seqlock style), so
+// polling get_data_count/get_current_data never stalls the acquisition thread. Producers only
+// serialize with each other (there is normally exactly one), consumers of get_data race on a
+// CAS of read_pos. Slots are atomics accessed with relaxed order, a copy which races with the
+// producer is well defined and discarded by the validation.
 class DataBuffer
 {
-
-    SpinLock lock;
-    double *data;
+    std::atomic<double> *data;
 
     size_t buffer_size;
-    size_t first_used, first_free;
-    size_t count;
     size_t num_samples;
 
-    size_t next (size_t index)
-    {
-        return (index + 1) % buffer_size;
-    }
-
-    void get_chunk (size_t start, size_t size, double *data_buf);
+    // samples which producer started to write, used by readers to detect overwrites
+    std::atomic<size_t> write_pos;
+    char pad0[64];
+    // samples which are fully written and visible to readers
+    std::atomic<size_t> head;
+    char pad1[64];
+    // samples removed by get_data
+    std::atomic<size_t> read_pos;
+    char pad2[64];
+    SpinLock producer_lock;
+
+    void get_chunk (size_t start, size_t size, double *data_buf, bool transpose);
+    void put_chunk (size_t start, size_t size, const double *data_buf);
+    bool is_overwritten (size_t start);
+    size_t read_data (size_t max_count, double *data_buf, bool transpose);
+    size_t read_current_data (size_t max_count, double *data_buf, bool transpose);
 
 public:
     DataBuffer (int num_samples, size_t buffer_size);
     ~DataBuffer ();
 
     void add_data (double *value);
+    // adds count samples stored one after another, one copy for the whole block
+    void add_data (const double *values, size_t count);
     size_t get_data (size_t max_count, double *data_buf);
     size_t get_current_data (size_t max_count, double *data_buf);
+    // same as above but data_buf is filled row by row: all samples of channel 0, then channel 1...
+    size_t get_data_transposed (size_t max_count, double *data_buf);
+    size_t get_current_data_transposed (size_t max_count, double *data_buf);
     size_t get_data_count ();
+    // number of samples which can be added before unread samples start to be overwritten
+    size_t get_free_space ();
     bool is_ready ();
 };
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stddef.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+
+// Read only memory mapping of a whole file, empty files are allowed and have NULL data
+class MappedFile
+{
+
+public:
+    MappedFile ();
+    ~MappedFile ();
+
+    // returns BrainFlowExitCodes
+    int open (const char *file_name);
+    void close ();
+
+    const char *get_data () const
+    {
+        return data;
+    }
+
+    size_t get_size () const
+    {
+        return size;
+    }
+
+private:
+    const char *data;
+    size_t size;
+#ifdef _WIN32
+    HANDLE file_handle;
+    HANDLE mapping_handle;
+#endif
+
+    // not copyable, owns the mapping
+    MappedFile (const MappedFile &);
+    MappedFile &operator= (const MappedFile &);
+};
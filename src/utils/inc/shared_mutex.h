@@ -0,0 +1,91 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+
+// Reader/writer lock for C++11 (std::shared_mutex needs C++17). Writers have priority: once a
+// writer waits, new readers block, so a stream of short reads can't starve it.
+class SharedMutex
+{
+public:
+    SharedMutex ()
+    {
+        num_readers = 0;
+        num_waiting_writers = 0;
+        is_writer_active = false;
+    }
+
+    SharedMutex (const SharedMutex &) = delete;
+    SharedMutex &operator= (const SharedMutex &) = delete;
+
+    inline void lock ()
+    {
+        std::unique_lock<std::mutex> lk (m);
+        num_waiting_writers++;
+        cv_writer.wait (lk, [this] { return (!is_writer_active) && (num_readers == 0); });
+        num_waiting_writers--;
+        is_writer_active = true;
+    }
+
+    inline void unlock ()
+    {
+        std::lock_guard<std::mutex> lk (m);
+        is_writer_active = false;
+        if (num_waiting_writers > 0)
+        {
+            cv_writer.notify_one ();
+        }
+        else
+        {
+            cv_reader.notify_all ();
+        }
+    }
+
+    inline void lock_shared ()
+    {
+        std::unique_lock<std::mutex> lk (m);
+        cv_reader.wait (
+            lk, [this] { return (!is_writer_active) && (num_waiting_writers == 0); });
+        num_readers++;
+    }
+
+    inline void unlock_shared ()
+    {
+        std::lock_guard<std::mutex> lk (m);
+        num_readers--;
+        if ((num_readers == 0) && (num_waiting_writers > 0))
+        {
+            cv_writer.notify_one ();
+        }
+    }
+
+private:
+    std::mutex m;
+    std::condition_variable cv_reader;
+    std::condition_variable cv_writer;
+    int num_readers;
+    int num_waiting_writers;
+    bool is_writer_active;
+};
+
+// std::lock_guard analog for shared ownership
+class SharedLockGuard
+{
+public:
+    explicit SharedLockGuard (SharedMutex &mutex) : mutex (mutex)
+    {
+        mutex.lock_shared ();
+    }
+
+    ~SharedLockGuard ()
+    {
+        mutex.unlock_shared ();
+    }
+
+    SharedLockGuard (const SharedLockGuard &) = delete;
+    SharedLockGuard &operator= (const SharedLockGuard &) = delete;
+
+private:
+    SharedMutex &mutex;
+};
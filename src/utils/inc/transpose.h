@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stddef.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BRAINFLOW_TRANSPOSE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define BRAINFLOW_TRANSPOSE_NEON
+#endif
+
+// number of samples processed at once, 16 samples of 64 channels still fit into L1
+#define BRAINFLOW_TRANSPOSE_TILE 16
+
+
+// transposes 2 channels of 2 samples
+inline void transpose_2x2 (const double *src, size_t num_rows, double *dst, size_t dst_stride)
+{
+#if defined(BRAINFLOW_TRANSPOSE_SSE2)
+    __m128d first = _mm_loadu_pd (src);
+    __m128d second = _mm_loadu_pd (src + num_rows);
+    _mm_storeu_pd (dst, _mm_unpacklo_pd (first, second));
+    _mm_storeu_pd (dst + dst_stride, _mm_unpackhi_pd (first, second));
+#elif defined(BRAINFLOW_TRANSPOSE_NEON)
+    float64x2_t first = vld1q_f64 (src);
+    float64x2_t second = vld1q_f64 (src + num_rows);
+    vst1q_f64 (dst, vzip1q_f64 (first, second));
+    vst1q_f64 (dst + dst_stride, vzip2q_f64 (first, second));
+#else
+    dst[0] = src[0];
+    dst[1] = src[num_rows];
+    dst[dst_stride] = src[1];
+    dst[dst_stride + 1] = src[num_rows + 1];
+#endif
+}
+
+// Converts num_samples packages of num_rows channels stored one after another (DataBuffer
+// layout) into a row major matrix where row j starts at dst + j * dst_stride.
+inline void transpose_samples (
+    const double *src, size_t num_rows, size_t num_samples, double *dst, size_t dst_stride)
+{
+    for (size_t tile = 0; tile < num_samples; tile += BRAINFLOW_TRANSPOSE_TILE)
+    {
+        size_t tile_end = tile + BRAINFLOW_TRANSPOSE_TILE;
+        if (tile_end > num_samples)
+        {
+            tile_end = num_samples;
+        }
+        size_t row = 0;
+        for (; row + 1 < num_rows; row += 2)
+        {
+            size_t sample = tile;
+            for (; sample + 1 < tile_end; sample += 2)
+            {
+                transpose_2x2 (src + sample * num_rows + row, num_rows,
+                    dst + row * dst_stride + sample, dst_stride);
+            }
+            for (; sample < tile_end; sample++)
+            {
+                dst[row * dst_stride + sample] = src[sample * num_rows + row];
+                dst[(row + 1) * dst_stride + sample] = src[sample * num_rows + row + 1];
+            }
+        }
+        for (; row < num_rows; row++)
+        {
+            for (size_t sample = tile; sample < tile_end; sample++)
+            {
+                dst[row * dst_stride + sample] = src[sample * num_rows + row];
+            }
+        }
+    }
+}
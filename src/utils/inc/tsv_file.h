@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "mapped_file.h"
+
+
+// parses a number from [begin, end) like std::stod: leading spaces and trailing chars after a valid
+// numeric prefix are allowed, returns false if there is no number at all
+bool parse_double (const char *begin, const char *end, double *value);
+
+// Memory mapped file in the format used by write_file and file streamer: one package per line,
+// values are separated by tabs or commas(detected per line). Line index is built once in open.
+class TsvFile
+{
+
+public:
+    TsvFile ();
+
+    // returns BrainFlowExitCodes
+    int open (const char *file_name);
+    void close ();
+
+    size_t get_num_lines () const
+    {
+        return line_starts.empty () ? 0 : line_starts.size () - 1;
+    }
+
+    // offset in bytes of the first char of a line
+    size_t get_line_offset (size_t line) const
+    {
+        return line_starts[line];
+    }
+
+    // returns number of values in a line or -1 if it can not be parsed
+    int get_num_cols (size_t line) const;
+    // parses line into values, returns number of values or -1 if line can not be parsed or has
+    // more than max_values values
+    int parse_line (size_t line, double *values, int max_values) const;
+    // parses num_lines lines starting from first_line, each line must have num_cols values,
+    // value j of line i is stored in data[j * stride + i]. Big blocks are split between threads.
+    // returns BrainFlowExitCodes
+    int parse_lines_transposed (
+        size_t first_line, size_t num_lines, int num_cols, double *data, size_t stride) const;
+
+private:
+    MappedFile file;
+    // line i is [line_starts[i], line_starts[i + 1]), last element is the end of the file
+    std::vector<size_t> line_starts;
+
+    int parse_range (const char *begin, const char *end, double *values, int max_values,
+        size_t values_stride) const;
+};
@@ -0,0 +1,124 @@
+#include "mapped_file.h"
+#include "brainflow_constants.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+MappedFile::MappedFile ()
+{
+    data = NULL;
+    size = 0;
+#ifdef _WIN32
+    file_handle = INVALID_HANDLE_VALUE;
+    mapping_handle = NULL;
+#endif
+}
+
+MappedFile::~MappedFile ()
+{
+    close ();
+}
+
+#ifdef _WIN32
+int MappedFile::open (const char *file_name)
+{
+    close ();
+    file_handle = CreateFileA (file_name, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file_handle == INVALID_HANDLE_VALUE)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx (file_handle, &file_size))
+    {
+        close ();
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    if (file_size.QuadPart == 0)
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    mapping_handle = CreateFileMappingA (file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping_handle == NULL)
+    {
+        close ();
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    data = (const char *)MapViewOfFile (mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL)
+    {
+        close ();
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    size = (size_t)file_size.QuadPart;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void MappedFile::close ()
+{
+    if (data != NULL)
+    {
+        UnmapViewOfFile (data);
+        data = NULL;
+    }
+    if (mapping_handle != NULL)
+    {
+        CloseHandle (mapping_handle);
+        mapping_handle = NULL;
+    }
+    if (file_handle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle (file_handle);
+        file_handle = INVALID_HANDLE_VALUE;
+    }
+    size = 0;
+}
+#else
+int MappedFile::open (const char *file_name)
+{
+    close ();
+    int fd = ::open (file_name, O_RDONLY);
+    if (fd < 0)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    struct stat st;
+    if (fstat (fd, &st) != 0)
+    {
+        ::close (fd);
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    if (st.st_size == 0)
+    {
+        ::close (fd);
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    void *mapping = mmap (NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // mapping stays valid after closing descriptor
+    ::close (fd);
+    if (mapping == MAP_FAILED)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    madvise (mapping, (size_t)st.st_size, MADV_SEQUENTIAL);
+    data = (const char *)mapping;
+    size = (size_t)st.st_size;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void MappedFile::close ()
+{
+    if (data != NULL)
+    {
+        munmap ((void *)data, size);
+        data = NULL;
+    }
+    size = 0;
+}
+#endif
@@ -0,0 +1,292 @@
+#include <algorithm>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+
+#include "brainflow_constants.h"
+#include "tsv_file.h"
+
+// blocks with less values are parsed in the calling thread
+#define TSV_MIN_VALUES_PER_THREAD 262144
+#define TSV_MAX_THREADS 8
+
+
+// exact powers of ten which fit into double mantissa
+static const double powers_of_ten[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static bool parse_double_slow (const char *begin, const char *end, double *value)
+{
+    std::string str (begin, end);
+    char *parsed_end = NULL;
+    *value = strtod (str.c_str (), &parsed_end);
+    // the same as std::stod used before: numeric prefix is enough, trailing chars are ignored
+    return (parsed_end != str.c_str ());
+}
+
+bool parse_double (const char *begin, const char *end, double *value)
+{
+    while ((begin < end) && (*begin == ' '))
+    {
+        begin++;
+    }
+    while ((end > begin) && ((end[-1] == ' ') || (end[-1] == '\r') || (end[-1] == '\n')))
+    {
+        end--;
+    }
+    if (begin == end)
+    {
+        return false;
+    }
+
+    // fast path: if mantissa fits into 53 bits and power of ten is exact, single multiplication
+    // or division is correctly rounded, same result as strtod. Everything else goes to strtod,
+    // including hex floats and values with trailing chars
+    const char *ptr = begin;
+    bool negative = false;
+    if ((*ptr == '-') || (*ptr == '+'))
+    {
+        negative = (*ptr == '-');
+        ptr++;
+    }
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    for (; (ptr < end) && (*ptr >= '0') && (*ptr <= '9'); ptr++)
+    {
+        has_digits = true;
+        mantissa = mantissa * 10 + (uint64_t)(*ptr - '0');
+        if ((mantissa != 0) && (++num_digits > 18))
+        {
+            return parse_double_slow (begin, end, value);
+        }
+    }
+    if ((ptr < end) && (*ptr == '.'))
+    {
+        ptr++;
+        for (; (ptr < end) && (*ptr >= '0') && (*ptr <= '9'); ptr++)
+        {
+            has_digits = true;
+            mantissa = mantissa * 10 + (uint64_t)(*ptr - '0');
+            exponent--;
+            if ((mantissa != 0) && (++num_digits > 18))
+            {
+                return parse_double_slow (begin, end, value);
+            }
+        }
+    }
+    if (!has_digits)
+    {
+        return parse_double_slow (begin, end, value); // nan, inf, etc
+    }
+    if ((ptr < end) && ((*ptr == 'e') || (*ptr == 'E')))
+    {
+        ptr++;
+        bool negative_exponent = false;
+        if ((ptr < end) && ((*ptr == '-') || (*ptr == '+')))
+        {
+            negative_exponent = (*ptr == '-');
+            ptr++;
+        }
+        if ((ptr == end) || (*ptr < '0') || (*ptr > '9'))
+        {
+            return parse_double_slow (begin, end, value);
+        }
+        int explicit_exponent = 0;
+        for (; (ptr < end) && (*ptr >= '0') && (*ptr <= '9'); ptr++)
+        {
+            explicit_exponent = explicit_exponent * 10 + (*ptr - '0');
+            if (explicit_exponent > 1000)
+            {
+                return parse_double_slow (begin, end, value);
+            }
+        }
+        exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+    if (ptr != end)
+    {
+        return parse_double_slow (begin, end, value);
+    }
+    if ((mantissa > ((uint64_t)1 << 53)) || (exponent < -22) || (exponent > 22))
+    {
+        return parse_double_slow (begin, end, value);
+    }
+    double result = (double)mantissa;
+    if (exponent < 0)
+    {
+        result /= powers_of_ten[-exponent];
+    }
+    else
+    {
+        result *= powers_of_ten[exponent];
+    }
+    *value = negative ? -result : result;
+    return true;
+}
+
+TsvFile::TsvFile ()
+{
+}
+
+int TsvFile::open (const char *file_name)
+{
+    close ();
+    int res = file.open (file_name);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    const char *data = file.get_data ();
+    size_t size = file.get_size ();
+    line_starts.push_back (0);
+    const char *ptr = data;
+    const char *end = data + size;
+    while (ptr < end)
+    {
+        const char *next = (const char *)memchr (ptr, '\n', end - ptr);
+        if (next == NULL)
+        {
+            break;
+        }
+        ptr = next + 1;
+        line_starts.push_back (ptr - data);
+    }
+    // last line without trailing newline
+    if ((size > 0) && (data[size - 1] != '\n'))
+    {
+        line_starts.push_back (size);
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void TsvFile::close ()
+{
+    file.close ();
+    line_starts.clear ();
+}
+
+int TsvFile::parse_range (const char *begin, const char *end, double *values, int max_values,
+    size_t values_stride) const
+{
+    while ((end > begin) && ((end[-1] == '\n') || (end[-1] == '\r')))
+    {
+        end--;
+    }
+    if (begin == end)
+    {
+        return 0;
+    }
+    char sep = (memchr (begin, '\t', end - begin) != NULL) ? '\t' : ',';
+    int num_values = 0;
+    const char *ptr = begin;
+    while (ptr < end)
+    {
+        const char *token_end = (const char *)memchr (ptr, sep, end - ptr);
+        if (token_end == NULL)
+        {
+            token_end = end;
+        }
+        if (values != NULL)
+        {
+            if ((num_values >= max_values) ||
+                (!parse_double (ptr, token_end, values + num_values * values_stride)))
+            {
+                return -1;
+            }
+        }
+        else
+        {
+            double value = 0.0;
+            if (!parse_double (ptr, token_end, &value))
+            {
+                return -1;
+            }
+        }
+        num_values++;
+        // separator right before end of line doesnt start a new value
+        ptr = token_end + 1;
+    }
+    return num_values;
+}
+
+int TsvFile::get_num_cols (size_t line) const
+{
+    if (line >= get_num_lines ())
+    {
+        return -1;
+    }
+    const char *data = file.get_data ();
+    return parse_range (data + line_starts[line], data + line_starts[line + 1], NULL, 0, 1);
+}
+
+int TsvFile::parse_line (size_t line, double *values, int max_values) const
+{
+    if (line >= get_num_lines ())
+    {
+        return -1;
+    }
+    const char *data = file.get_data ();
+    return parse_range (
+        data + line_starts[line], data + line_starts[line + 1], values, max_values, 1);
+}
+
+int TsvFile::parse_lines_transposed (
+    size_t first_line, size_t num_lines, int num_cols, double *data, size_t stride) const
+{
+    if ((first_line + num_lines > get_num_lines ()) || (num_cols <= 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    const char *file_data = file.get_data ();
+    auto parse_block = [&] (size_t start, size_t stop)
+    {
+        for (size_t line = start; line < stop; line++)
+        {
+            int res = parse_range (file_data + line_starts[line],
+                file_data + line_starts[line + 1], data + (line - first_line), num_cols, stride);
+            if (res != num_cols)
+            {
+                return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+            }
+        }
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    };
+
+    size_t num_threads = std::min<size_t> (
+        (num_lines * num_cols) / TSV_MIN_VALUES_PER_THREAD, TSV_MAX_THREADS);
+    num_threads = std::min<size_t> (num_threads, std::thread::hardware_concurrency ());
+    if (num_threads < 2)
+    {
+        return parse_block (first_line, first_line + num_lines);
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<int> results (num_threads, (int)BrainFlowExitCodes::STATUS_OK);
+    size_t lines_per_thread = (num_lines + num_threads - 1) / num_threads;
+    for (size_t i = 0; i < num_threads; i++)
+    {
+        size_t start = first_line + i * lines_per_thread;
+        size_t stop = std::min (start + lines_per_thread, first_line + num_lines);
+        if (start >= stop)
+        {
+            break;
+        }
+        threads.push_back (
+            std::thread ([&, i, start, stop] { results[i] = parse_block (start, stop); }));
+    }
+    for (auto &thread : threads)
+    {
+        thread.join ();
+    }
+    for (int res : results)
+    {
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
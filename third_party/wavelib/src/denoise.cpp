@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -29,41 +30,24 @@ denoise_object denoise_init (int length, int J, const char *wname)
     return obj;
 }
 
-void visushrink (double *signal, int N, int J, const char *wname, const char *method,
-    const char *ext, const char *thresh, const char *level, double *denoised)
+void visushrink_wt (
+    wt_object wt, double *signal, const char *thresh, const char *level, double *denoised)
 {
-    int filt_len, iter, i, dlen, dwt_len, sgn, MaxIter, it;
+    int iter, i, dlen, dwt_len, sgn, it, J;
     double sigma, td, tmp;
-    wave_object wave;
-    wt_object wt;
     double *dout, *lnoise;
 
-    wave = wave_init (wname);
-
-    filt_len = wave->filtlength;
-
-    MaxIter = (int)(log ((double)N / ((double)filt_len - 1.0)) / log (2.0));
-
-    if (J > MaxIter)
+    J = wt->J;
+    if (!strcmp (wt->method, "dwt"))
     {
-        wave_free (wave);
-        throw std::runtime_error ("to small buffer size for this wavelet");
-    }
-
-    wt = wt_init (wave, method, N, J);
-    if (!strcmp (method, "dwt"))
-    {
-        setDWTExtension (wt, ext);
         dwt (wt, signal);
     }
-    else if (!strcmp (method, "swt"))
+    else if (!strcmp (wt->method, "swt"))
     {
         swt (wt, signal);
     }
     else
     {
-        wave_free (wave);
-        wt_free (wt);
         throw std::runtime_error ("unsupported wavelet method");
     }
 
@@ -112,8 +96,6 @@ void visushrink (double *signal, int N, int J, const char *wname, const char *me
     {
         free (dout);
         free (lnoise);
-        wave_free (wave);
-        wt_free (wt);
         throw std::runtime_error ("acceptable noise extimation values are first and all");
     }
 
@@ -155,57 +137,76 @@ void visushrink (double *signal, int N, int J, const char *wname, const char *me
         iter += wt->length[it + 1];
     }
 
-    if (!strcmp (method, "dwt"))
+    if (!strcmp (wt->method, "dwt"))
     {
         idwt (wt, denoised);
     }
-    else if (!strcmp (method, "swt"))
+    else if (!strcmp (wt->method, "swt"))
     {
         iswt (wt, denoised);
     }
 
     free (dout);
     free (lnoise);
-    wave_free (wave);
-    wt_free (wt);
 }
 
-void sureshrink (double *signal, int N, int J, const char *wname, const char *method,
+void visushrink (double *signal, int N, int J, const char *wname, const char *method,
     const char *ext, const char *thresh, const char *level, double *denoised)
 {
-    int filt_len, i, it, len, dlen, dwt_len, min_index, sgn, MaxIter, iter;
-    double sigma, norm, td, tv, te, ct, thr, temp, x_sum;
+    int filt_len, MaxIter;
     wave_object wave;
     wt_object wt;
-    double *dout, *risk, *dsum, *lnoise;
 
     wave = wave_init (wname);
 
     filt_len = wave->filtlength;
 
     MaxIter = (int)(log ((double)N / ((double)filt_len - 1.0)) / log (2.0));
-    // Depends on J
+
     if (J > MaxIter)
     {
         wave_free (wave);
-        throw std::runtime_error ("not enough data points for this wavelet");
+        throw std::runtime_error ("to small buffer size for this wavelet");
     }
 
     wt = wt_init (wave, method, N, J);
-
     if (!strcmp (method, "dwt"))
     {
         setDWTExtension (wt, ext);
+    }
+    try
+    {
+        visushrink_wt (wt, signal, thresh, level, denoised);
+    }
+    catch (...)
+    {
+        wave_free (wave);
+        wt_free (wt);
+        throw;
+    }
+
+    wave_free (wave);
+    wt_free (wt);
+}
+
+void sureshrink_wt (
+    wt_object wt, double *signal, const char *thresh, const char *level, double *denoised)
+{
+    int i, it, len, dlen, dwt_len, min_index, sgn, iter, J;
+    double sigma, norm, td, tv, te, ct, thr, temp, x_sum;
+    double *dout, *risk, *dsum, *lnoise;
+
+    J = wt->J;
+    if (!strcmp (wt->method, "dwt"))
+    {
         dwt (wt, signal);
     }
-    else if (!strcmp (method, "swt"))
+    else if (!strcmp (wt->method, "swt"))
     {
         swt (wt, signal);
     }
     else
     {
-        wave_free (wave);
-        wt_free (wt);
         throw std::runtime_error ("unsupported wavelet type");
     }
 
@@ -257,8 +258,6 @@ void sureshrink (double *signal, int N, int J, const char *wname, const char *me
         free (risk);
         free (dsum);
         free (lnoise);
-        wave_free (wave);
-        wt_free (wt);
         throw std::runtime_error ("wrong noise estimation level value");
     }
 
@@ -296,7 +295,7 @@ void sureshrink (double *signal, int N, int J, const char *wname, const char *me
                     dout[i] = fabs (wt->output[len + i] / sigma);
                 }
 
-                qsort (dout, dwt_len, sizeof (double), compare_double);
+                std::sort (dout, dout + dwt_len);
                 for (i = 0; i < dwt_len; ++i)
                 {
                     dout[i] = (dout[i] * dout[i]);
@@ -348,11 +347,11 @@ void sureshrink (double *signal, int N, int J, const char *wname, const char *me
         len += wt->length[it + 1];
     }
 
-    if (!strcmp (method, "dwt"))
+    if (!strcmp (wt->method, "dwt"))
     {
         idwt (wt, denoised);
     }
-    else if (!strcmp (method, "swt"))
+    else if (!strcmp (wt->method, "swt"))
     {
         iswt (wt, denoised);
     }
@@ -360,6 +359,43 @@ void sureshrink (double *signal, int N, int J, const char *wname, const char *me
     free (dsum);
     free (risk);
     free (lnoise);
+}
+
+void sureshrink (double *signal, int N, int J, const char *wname, const char *method,
+    const char *ext, const char *thresh, const char *level, double *denoised)
+{
+    int filt_len, MaxIter;
+    wave_object wave;
+    wt_object wt;
+
+    wave = wave_init (wname);
+
+    filt_len = wave->filtlength;
+
+    MaxIter = (int)(log ((double)N / ((double)filt_len - 1.0)) / log (2.0));
+    // Depends on J
+    if (J > MaxIter)
+    {
+        wave_free (wave);
+        throw std::runtime_error ("not enough data points for this wavelet");
+    }
+
+    wt = wt_init (wave, method, N, J);
+    if (!strcmp (method, "dwt"))
+    {
+        setDWTExtension (wt, ext);
+    }
+    try
+    {
+        sureshrink_wt (wt, signal, thresh, level, denoised);
+    }
+    catch (...)
+    {
+        wave_free (wave);
+        wt_free (wt);
+        throw;
+    }
+
     wave_free (wave);
     wt_free (wt);
 }
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "waux.h"
 #include "../header/wauxlib.h"
 
@@ -49,11 +51,12 @@ double median (double *x, int N)
 {
     double sigma;
 
-    qsort (x, N, sizeof (double), compare_double);
+    // partial sort is enough, x[N / 2 - 1] is the max of values before x[N / 2]
+    std::nth_element (x, x + N / 2, x + N);
 
     if ((N % 2) == 0)
     {
-        sigma = (x[N / 2 - 1] + x[N / 2]) / 2.0;
+        sigma = (*std::max_element (x, x + N / 2) + x[N / 2]) / 2.0;
     }
     else
     {
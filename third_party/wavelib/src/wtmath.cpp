@@ -7,6 +7,7 @@ void dwt_per_stride (double *inp, int N, double *lpd, double *hpd, int lpd_len,
     int len_cA, double *cD, int istride, int ostride)
 {
     int l, l2, isodd, i, t, len_avg, is, os;
+    double sum_a, sum_d;
 
     len_avg = lpd_len;
     l2 = len_avg / 2;
@@ -16,65 +17,70 @@ void dwt_per_stride (double *inp, int N, double *lpd, double *hpd, int lpd_len,
     {
         t = 2 * i + l2;
         os = i * ostride;
-        cA[os] = 0.0;
-        cD[os] = 0.0;
+        sum_a = 0.0;
+        sum_d = 0.0;
+        // filter doesnt cross signal borders, skip extension checks
+        if ((t - len_avg + 1 >= 0) && (t < N))
+        {
+            for (l = 0; l < len_avg; ++l)
+            {
+                is = (t - l) * istride;
+                sum_a += lpd[l] * inp[is];
+                sum_d += hpd[l] * inp[is];
+            }
+            cA[os] = sum_a;
+            cD[os] = sum_d;
+            continue;
+        }
         for (l = 0; l < len_avg; ++l)
         {
             if ((t - l) >= l2 && (t - l) < N)
             {
                 is = (t - l) * istride;
-                cA[os] += lpd[l] * inp[is];
-                cD[os] += hpd[l] * inp[is];
             }
             else if ((t - l) < l2 && (t - l) >= 0)
             {
                 is = (t - l) * istride;
-                cA[os] += lpd[l] * inp[is];
-                cD[os] += hpd[l] * inp[is];
             }
             else if ((t - l) < 0 && isodd == 0)
             {
                 is = (t - l + N) * istride;
-                cA[os] += lpd[l] * inp[is];
-                cD[os] += hpd[l] * inp[is];
             }
             else if ((t - l) < 0 && isodd == 1)
             {
                 if ((t - l) != -1)
                 {
                     is = (t - l + N + 1) * istride;
-                    cA[os] += lpd[l] * inp[is];
-                    cD[os] += hpd[l] * inp[is];
                 }
                 else
                 {
                     is = (N - 1) * istride;
-                    cA[os] += lpd[l] * inp[is];
-                    cD[os] += hpd[l] * inp[is];
                 }
             }
             else if ((t - l) >= N && isodd == 0)
             {
                 is = (t - l - N) * istride;
-                cA[os] += lpd[l] * inp[is];
-                cD[os] += hpd[l] * inp[is];
             }
             else if ((t - l) >= N && isodd == 1)
             {
-                is = (t - l - (N + 1)) * istride;
                 if (t - l != N)
                 {
-                    cA[os] += lpd[l] * inp[is];
-                    cD[os] += hpd[l] * inp[is];
+                    is = (t - l - (N + 1)) * istride;
                 }
                 else
                 {
                     is = (N - 1) * istride;
-                    cA[os] += lpd[l] * inp[is];
-                    cD[os] += hpd[l] * inp[is];
                 }
             }
+            else
+            {
+                continue;
+            }
+            sum_a += lpd[l] * inp[is];
+            sum_d += hpd[l] * inp[is];
         }
+        cA[os] = sum_a;
+        cD[os] = sum_d;
     }
 }
 
@@ -83,35 +89,47 @@ void dwt_sym_stride (double *inp, int N, double *lpd, double *hpd, int lpd_len,
 {
     int i, l, t, len_avg;
     int is, os;
+    double sum_a, sum_d;
     len_avg = lpd_len;
 
     for (i = 0; i < len_cA; ++i)
     {
         t = 2 * i + 1;
         os = i * ostride;
-        cA[os] = 0.0;
-        cD[os] = 0.0;
+        sum_a = 0.0;
+        sum_d = 0.0;
+        // filter doesnt cross signal borders, skip extension checks
+        if ((t - len_avg + 1 >= 0) && (t < N))
+        {
+            for (l = 0; l < len_avg; ++l)
+            {
+                is = (t - l) * istride;
+                sum_a += lpd[l] * inp[is];
+                sum_d += hpd[l] * inp[is];
+            }
+            cA[os] = sum_a;
+            cD[os] = sum_d;
+            continue;
+        }
         for (l = 0; l < len_avg; ++l)
         {
             if ((t - l) >= 0 && (t - l) < N)
             {
                 is = (t - l) * istride;
-                cA[os] += lpd[l] * inp[is];
-                cD[os] += hpd[l] * inp[is];
             }
             else if ((t - l) < 0)
             {
                 is = (-t + l - 1) * istride;
-                cA[os] += lpd[l] * inp[is];
-                cD[os] += hpd[l] * inp[is];
             }
-            else if ((t - l) >= N)
+            else
             {
                 is = (2 * N - t + l - 1) * istride;
-                cA[os] += lpd[l] * inp[is];
-                cD[os] += hpd[l] * inp[is];
             }
+            sum_a += lpd[l] * inp[is];
+            sum_d += hpd[l] * inp[is];
         }
+        cA[os] = sum_a;
+        cD[os] = sum_d;
     }
 }
 
@@ -220,6 +238,7 @@ void idwt_per_stride (double *cA, int len_cA, double *cD, double *lpr, double *h
 {
     int len_avg, i, l, m, n, t, l2;
     int is, ms, ns;
+    double sum_m, sum_n;
 
     len_avg = lpr_len;
     l2 = len_avg / 2;
@@ -232,38 +251,41 @@ void idwt_per_stride (double *cA, int len_cA, double *cD, double *lpr, double *h
         n += 2;
         ms = m * ostride;
         ns = n * ostride;
-        X[ms] = 0.0;
-        X[ns] = 0.0;
+        sum_m = 0.0;
+        sum_n = 0.0;
         for (l = 0; l < l2; ++l)
         {
             t = 2 * l;
             if ((i - l) >= 0 && (i - l) < len_cA)
             {
                 is = (i - l) * istride;
-                X[ms] += lpr[t] * cA[is] + hpr[t] * cD[is];
-                X[ns] += lpr[t + 1] * cA[is] + hpr[t + 1] * cD[is];
             }
             else if ((i - l) >= len_cA && (i - l) < len_cA + len_avg - 1)
             {
                 is = (i - l - len_cA) * istride;
-                X[ms] += lpr[t] * cA[is] + hpr[t] * cD[is];
-                X[ns] += lpr[t + 1] * cA[is] + hpr[t + 1] * cD[is];
             }
             else if ((i - l) < 0 && (i - l) > -l2)
             {
                 is = (len_cA + i - l) * istride;
-                X[ms] += lpr[t] * cA[is] + hpr[t] * cD[is];
-                X[ns] += lpr[t + 1] * cA[is] + hpr[t + 1] * cD[is];
             }
+            else
+            {
+                continue;
+            }
+            sum_m += lpr[t] * cA[is] + hpr[t] * cD[is];
+            sum_n += lpr[t + 1] * cA[is] + hpr[t + 1] * cD[is];
         }
+        X[ms] = sum_m;
+        X[ns] = sum_n;
     }
 }
 
 void idwt_sym_stride (double *cA, int len_cA, double *cD, double *lpr, double *hpr, int lpr_len,
     double *X, int istride, int ostride)
 {
-    int len_avg, i, l, m, n, t, v;
+    int len_avg, i, l, m, n, t, v, l_end;
     int ms, ns, is;
+    double sum_m, sum_n;
     len_avg = lpr_len;
     m = -2;
     n = -1;
@@ -275,18 +297,19 @@ void idwt_sym_stride (double *cA, int len_cA, double *cD, double *lpr, double *h
         n += 2;
         ms = m * ostride;
         ns = n * ostride;
-        X[ms] = 0.0;
-        X[ns] = 0.0;
-        for (l = 0; l < len_avg / 2; ++l)
+        sum_m = 0.0;
+        sum_n = 0.0;
+        // only taps with 0 <= i - l < len_cA contribute
+        l_end = (i + 1 < len_avg / 2) ? i + 1 : len_avg / 2;
+        for (l = 0; l < l_end; ++l)
         {
             t = 2 * l;
-            if ((i - l) >= 0 && (i - l) < len_cA)
-            {
-                is = (i - l) * istride;
-                X[ms] += lpr[t] * cA[is] + hpr[t] * cD[is];
-                X[ns] += lpr[t + 1] * cA[is] + hpr[t + 1] * cD[is];
-            }
+            is = (i - l) * istride;
+            sum_m += lpr[t] * cA[is] + hpr[t] * cD[is];
+            sum_n += lpr[t + 1] * cA[is] + hpr[t + 1] * cD[is];
         }
+        X[ms] = sum_m;
+        X[ns] = sum_n;
     }
 }
 